@@ -2222,7 +2222,8 @@ gst_av1_parse_tile_info (GstAV1Parser * parser, GstBitReader * br,
     if (retval != GST_AV1_PARSER_OK)
       goto error;
 
-    tile_info->tile_size_bytes_minus_1 = AV1_READ_BIT_CHECKED (br, &retval);
+    tile_info->tile_size_bytes_minus_1 =
+        AV1_READ_BITS_CHECKED (br, 2, &retval);
     if (retval != GST_AV1_PARSER_OK)
       goto error;
 
@@ -4274,9 +4275,14 @@ gst_av1_parse_tile_group (GstAV1Parser * parser, GstBitReader * br,
       if (retval != GST_AV1_PARSER_OK)
         goto error;
       tile_size = tile_size_minus_1 + 1;
-      sz -= tile_size - parser->state.tile_size_bytes;
+      sz -= tile_size + parser->state.tile_size_bytes;
     }
 
+    tile_group->entry[tile_num].tile_offset = gst_bit_reader_get_pos (br) / 8;
+    tile_group->entry[tile_num].tile_size = tile_size;
+    tile_group->entry[tile_num].tile_row = tile_row;
+    tile_group->entry[tile_num].tile_col = tile_col;
+
     tile_group->entry[tile_num].mi_row_start =
         parser->state.mi_row_starts[tile_row];
     tile_group->entry[tile_num].mi_row_end =
@@ -4292,7 +4298,7 @@ gst_av1_parse_tile_group (GstAV1Parser * parser, GstBitReader * br,
      */
 
     /* Skip the real data to the next one */
-    if (!gst_bit_reader_skip (br, tile_size)) {
+    if (!gst_bit_reader_skip (br, tile_size * 8)) {
       retval = GST_AV1_PARSER_NO_MORE_DATA;
       goto error;
     }
@@ -4347,7 +4353,14 @@ gst_av1_parser_parse_tile_group_obu (GstAV1Parser * parser, GstAV1OBU * obu,
 
   gst_bit_reader_init (&bit_reader, obu->data, obu->obu_size);
   ret = gst_av1_parse_tile_group (parser, &bit_reader, tile_group);
-  return ret;
+  if (ret != GST_AV1_PARSER_OK)
+    return ret;
+
+  /* The last tile group of the frame ends it */
+  if (tile_group->tg_end == tile_group->num_tiles - 1)
+    parser->state.seen_frame_header = 0;
+
+  return GST_AV1_PARSER_OK;
 }
 
 static GstAV1ParserResult
@@ -1659,6 +1659,10 @@ struct _GstAV1TileListOBU {
  *   It is a requirement of bitstream conformance that the value of tg_end is greater
  *   than or equal to tg_start. It is a requirement of bitstream conformance that the
  *   value of tg_end for the last tile group in each frame is equal to num_tiles-1.
+ * @tile_offset: offset of the tile data from the start of the OBU data
+ * @tile_size: size of the tile data
+ * @tile_row: row of the tile in the frame
+ * @tile_col: column of the tile in the frame
  * @mi_row_start: start position in mi rows
  * @mi_row_end: end position in mi rows
  * @mi_col_start: start position in mi cols
@@ -1670,6 +1674,10 @@ struct _GstAV1TileGroupOBU {
   guint8 tg_start;
   guint8 tg_end;
   struct {
+    guint32 tile_offset;
+    guint32 tile_size;
+    guint32 tile_row;
+    guint32 tile_col;
     /* global varialbes */
     guint32 mi_row_start; /* MiRowStart */
     guint32 mi_row_end; /* MiRowEnd */
@@ -2400,6 +2400,102 @@ gst_h265_parser_parse_pps (GstH265Parser * parser,
   return res;
 }
 
+/**
+ * gst_h265_parser_parse_slice_hdr_light:
+ * @parser: a #GstH265Parser
+ * @nalu: The `GST_H265_NAL_SLICE` #GstH265NalUnit to parse
+ * @slice: The #GstH265SliceHdr to fill.
+ *
+ * Parses the start of the slice segment header of @nalu, up to
+ * slice_pic_order_cnt_lsb: first_slice_segment_in_pic_flag,
+ * no_output_of_prior_pics_flag, the picture parameter set,
+ * dependent_slice_segment_flag, slice_segment_address, slice_type,
+ * pic_output_flag, colour_plane_id and slice_pic_order_cnt_lsb. The other
+ * fields of @slice are set to 0, slice_type is only known for independent
+ * slice segments.
+ *
+ * This is enough to find access unit boundaries and key frames, for a
+ * fraction of the cost of gst_h265_parser_parse_slice_hdr(). Nothing is
+ * allocated in @slice.
+ *
+ * Returns: a #GstH265ParserResult
+ *
+ * Since: 1.20
+ */
+GstH265ParserResult
+gst_h265_parser_parse_slice_hdr_light (GstH265Parser * parser,
+    GstH265NalUnit * nalu, GstH265SliceHdr * slice)
+{
+  NalReader nr;
+  gint pps_id;
+  GstH265PPS *pps;
+  GstH265SPS *sps;
+
+  memset (slice, 0, sizeof (*slice));
+
+  if (!nalu->size) {
+    GST_DEBUG ("Invalid Nal Unit");
+    return GST_H265_PARSER_ERROR;
+  }
+
+  nal_reader_init (&nr, nalu->data + nalu->offset + nalu->header_bytes,
+      nalu->size - nalu->header_bytes);
+
+  READ_UINT8 (&nr, slice->first_slice_segment_in_pic_flag, 1);
+
+  if (GST_H265_IS_NAL_TYPE_IRAP (nalu->type))
+    READ_UINT8 (&nr, slice->no_output_of_prior_pics_flag, 1);
+
+  READ_UE_MAX (&nr, pps_id, GST_H265_MAX_PPS_COUNT - 1);
+  pps = gst_h265_parser_get_pps (parser, pps_id);
+  if (!pps) {
+    GST_WARNING
+        ("couldn't find associated picture parameter set with id: %d", pps_id);
+    return GST_H265_PARSER_BROKEN_LINK;
+  }
+
+  slice->pps = pps;
+  sps = pps->sps;
+  if (!sps) {
+    GST_WARNING
+        ("couldn't find associated sequence parameter set with id: %d",
+        pps->id);
+    return GST_H265_PARSER_BROKEN_LINK;
+  }
+
+  slice->pic_output_flag = 1;
+
+  if (!slice->first_slice_segment_in_pic_flag) {
+    const guint n = ceil_log2 (pps->PicWidthInCtbsY * pps->PicHeightInCtbsY);
+
+    if (pps->dependent_slice_segments_enabled_flag)
+      READ_UINT8 (&nr, slice->dependent_slice_segment_flag, 1);
+    READ_UINT32 (&nr, slice->segment_address, n);
+  }
+
+  if (slice->dependent_slice_segment_flag)
+    return GST_H265_PARSER_OK;
+
+  if (!nal_reader_skip_long (&nr, pps->num_extra_slice_header_bits))
+    goto error;
+  READ_UE_MAX (&nr, slice->type, 63);
+
+  if (pps->output_flag_present_flag)
+    READ_UINT8 (&nr, slice->pic_output_flag, 1);
+  if (sps->separate_colour_plane_flag == 1)
+    READ_UINT8 (&nr, slice->colour_plane_id, 2);
+
+  if (!GST_H265_IS_NAL_TYPE_IDR (nalu->type))
+    READ_UINT16 (&nr, slice->pic_order_cnt_lsb,
+        (sps->log2_max_pic_order_cnt_lsb_minus4 + 4));
+
+  return GST_H265_PARSER_OK;
+
+error:
+  GST_WARNING ("error parsing \"Slice header\"");
+  return GST_H265_PARSER_ERROR;
+}
+
 /**
  * gst_h265_parser_parse_slice_hdr:
  * @parser: a #GstH265Parser
@@ -64,6 +64,46 @@ ceil_log2 (guint32 v)
 
 /****** Nal parser ******/
 
+/* The cache holds up to 64 unescaped bits, MSB first, and is refilled a
+ * word at a time when the next bytes can't contain an emulation prevention
+ * byte. The bits below bits_in_cache are always zero, so that the leading
+ * zeros of Exp-Golomb codes can be counted in the cache directly.
+ *
+ * The position and emulation prevention byte count are reported as if the
+ * bytes were read one at a time when needed, which is what the callers use
+ * to compute the size of the headers. Bytes which are cached but not
+ * touched yet, and the emulation prevention bytes preceding them, are not
+ * accounted. */
+
+#if defined(__GNUC__)
+#define nal_reader_clz64(x) __builtin_clzll (x)
+#define nal_reader_popcount(x) __builtin_popcount (x)
+#else
+static inline guint
+nal_reader_clz64 (guint64 x)
+{
+  guint n = 0;
+
+  while (!(x & G_GUINT64_CONSTANT (0x8000000000000000))) {
+    x <<= 1;
+    n++;
+  }
+
+  return n;
+}
+
+static inline guint
+nal_reader_popcount (guint x)
+{
+  guint n = 0;
+
+  for (; x; x &= x - 1)
+    n++;
+
+  return n;
+}
+#endif
+
 void
 nal_reader_init (NalReader * nr, const guint8 * data, guint size)
 {
@@ -73,42 +113,93 @@ nal_reader_init (NalReader * nr, const guint8 * data, guint size)
 
   nr->byte = 0;
   nr->bits_in_cache = 0;
+  nr->epb_flags = 0;
   /* fill with something other than 0 to detect emulation prevention bytes */
-  nr->first_byte = 0xff;
   nr->epb_cache = 0xff;
-  nr->cache = 0xff;
+  nr->cache = 0;
 }
 
-gboolean
-nal_reader_read (NalReader * nr, guint nbits)
+static inline void
+nal_reader_refill (NalReader * nr)
 {
-  if (G_UNLIKELY (nr->byte * 8 + (nbits - nr->bits_in_cache) > nr->size * 8)) {
-    GST_DEBUG ("Can not read %u bits, bits in cache %u, Byte * 8 %u, size in "
-        "bits %u", nbits, nr->bits_in_cache, nr->byte * 8, nr->size * 8);
-    return FALSE;
+  /* Fast path, a 0x03 is needed for an emulation prevention byte */
+  if (G_LIKELY (nr->byte + 8 <= nr->size)) {
+    guint64 word = GST_READ_UINT64_BE (nr->data + nr->byte);
+    guint64 x = word ^ G_GUINT64_CONSTANT (0x0303030303030303);
+    guint n = (64 - nr->bits_in_cache) / 8;
+    guint shift = 64 - n * 8;
+
+    /* Flags the 0x03 bytes, with possible false positives before a real
+     * one which only send us to the slow path */
+    x = (x - G_GUINT64_CONSTANT (0x0101010101010101)) & ~x &
+        G_GUINT64_CONSTANT (0x8080808080808080);
+
+    if (n > 0 && (x >> shift) == 0) {
+      word >>= shift;
+      nr->cache |= word << (shift - nr->bits_in_cache);
+      nr->bits_in_cache += n * 8;
+      nr->byte += n;
+      nr->epb_flags = n < 8 ? nr->epb_flags << n : 0;
+      if (n >= 3)
+        nr->epb_cache = word & 0xffffff;
+      else
+        nr->epb_cache = (nr->epb_cache << (n * 8)) | word;
+      return;
+    }
   }
 
-  while (nr->bits_in_cache < nbits) {
+  while (nr->bits_in_cache <= 56 && nr->byte < nr->size) {
     guint8 byte;
+    guint8 epb = 0;
 
   next_byte:
-    if (G_UNLIKELY (nr->byte >= nr->size))
-      return FALSE;
-
     byte = nr->data[nr->byte++];
     nr->epb_cache = (nr->epb_cache << 8) | byte;
 
     /* check if the byte is a emulation_prevention_three_byte */
     if ((nr->epb_cache & 0xffffff) == 0x3) {
+      /* Only skipped when the byte following it is read */
+      if (G_UNLIKELY (nr->byte >= nr->size)) {
+        nr->byte--;
+        nr->epb_cache >>= 8;
+        break;
+      }
       nr->n_epb++;
+      epb = 1;
       goto next_byte;
     }
-    nr->cache = (nr->cache << 8) | nr->first_byte;
-    nr->first_byte = byte;
+
+    nr->cache |= (guint64) byte << (56 - nr->bits_in_cache);
     nr->bits_in_cache += 8;
+    nr->epb_flags = (nr->epb_flags << 1) | epb;
   }
+}
 
-  return TRUE;
+static inline void
+nal_reader_consume (NalReader * nr, guint nbits)
+{
+  nr->cache <<= nbits;
+  nr->bits_in_cache -= nbits;
+}
+
+/* Makes sure at least @nbits, at most 57, are in the cache */
+gboolean
+nal_reader_read (NalReader * nr, guint nbits)
+{
+  g_assert (nbits <= 57);
+
+  if (G_LIKELY (nr->bits_in_cache >= nbits))
+    return TRUE;
+
+  if (G_UNLIKELY (nbits > nal_reader_get_remaining (nr))) {
+    GST_DEBUG ("Can not read %u bits, bits in cache %u, Byte * 8 %u, size in "
+        "bits %u", nbits, nr->bits_in_cache, nr->byte * 8, nr->size * 8);
+    return FALSE;
+  }
+
+  nal_reader_refill (nr);
+
+  return nr->bits_in_cache >= nbits;
 }
 
 /* Skips the specified amount of bits. This is only suitable to a
@@ -118,10 +209,18 @@ nal_reader_skip (NalReader * nr, guint nbits)
 {
   g_assert (nbits <= 8 * sizeof (nr->cache));
 
+  if (G_UNLIKELY (nbits > 32)) {
+    if (G_UNLIKELY (nbits > nal_reader_get_remaining (nr)))
+      return FALSE;
+    if (!nal_reader_skip (nr, 32))
+      return FALSE;
+    nbits -= 32;
+  }
+
   if (G_UNLIKELY (!nal_reader_read (nr, nbits)))
     return FALSE;
 
-  nr->bits_in_cache -= nbits;
+  nal_reader_consume (nr, nbits);
 
   return TRUE;
 }
@@ -144,43 +243,55 @@ nal_reader_skip_long (NalReader * nr, guint nbits)
   return TRUE;
 }
 
+/* Number of emulation prevention bytes before the cached bytes which are
+ * not touched yet */
+static inline guint
+nal_reader_untouched_epb (const NalReader * nr)
+{
+  guint untouched = nr->bits_in_cache / 8;
+
+  if (untouched == 0)
+    return 0;
+
+  return nal_reader_popcount (nr->epb_flags & (0xff >> (8 - untouched)));
+}
+
 guint
 nal_reader_get_pos (const NalReader * nr)
 {
-  return nr->byte * 8 - nr->bits_in_cache;
+  guint byte = nr->byte - nr->bits_in_cache / 8 -
+      nal_reader_untouched_epb (nr);
+
+  return byte * 8 - nr->bits_in_cache % 8;
 }
 
 guint
 nal_reader_get_remaining (const NalReader * nr)
 {
-  return (nr->size - nr->byte) * 8 + nr->bits_in_cache;
+  return nr->size * 8 - nal_reader_get_pos (nr);
 }
 
 guint
 nal_reader_get_epb_count (const NalReader * nr)
 {
-  return nr->n_epb;
+  return nr->n_epb - nal_reader_untouched_epb (nr);
 }
 
 #define NAL_READER_READ_BITS(bits) \
 gboolean \
 nal_reader_get_bits_uint##bits (NalReader *nr, guint##bits *val, guint nbits) \
 { \
-  guint shift; \
+  if (G_UNLIKELY (nbits == 0)) { \
+    *val = 0; \
+    return TRUE; \
+  } \
   \
   if (!nal_reader_read (nr, nbits)) \
     return FALSE; \
   \
-  /* bring the required bits down and truncate */ \
-  shift = nr->bits_in_cache - nbits; \
-  *val = nr->first_byte >> shift; \
-  \
-  *val |= nr->cache << (8 - shift); \
-  /* mask out required bits */ \
-  if (nbits < bits) \
-    *val &= ((guint##bits)1 << nbits) - 1; \
-  \
-  nr->bits_in_cache = shift; \
+  /* bring the required bits down */ \
+  *val = nr->cache >> (64 - nbits); \
+  nal_reader_consume (nr, nbits); \
   \
   return TRUE; \
 } \
@@ -204,26 +315,38 @@ NAL_READER_PEEK_BITS (8);
 gboolean
 nal_reader_get_ue (NalReader * nr, guint32 * val)
 {
-  guint i = 0;
-  guint8 bit;
+  guint i = 0, zeros;
   guint32 value;
 
-  if (G_UNLIKELY (!nal_reader_get_bits_uint8 (nr, &bit, 1)))
-    return FALSE;
+  if (G_UNLIKELY (nr->bits_in_cache < 32))
+    nal_reader_refill (nr);
+
+  /* The bits after the cached ones are 0, a code longer than the cache
+   * leaves it empty */
+  while (G_UNLIKELY (nr->cache == 0)) {
+    i += nr->bits_in_cache;
+    nr->bits_in_cache = 0;
+    if (G_UNLIKELY (i > 31))
+      return FALSE;
 
-  while (bit == 0) {
-    i++;
-    if (G_UNLIKELY (!nal_reader_get_bits_uint8 (nr, &bit, 1)))
+    nal_reader_refill (nr);
+    if (G_UNLIKELY (nr->bits_in_cache == 0))
       return FALSE;
   }
 
+  zeros = nal_reader_clz64 (nr->cache);
+  i += zeros;
+  /* Leading zeros and the 1 bit, in two steps as this can be 64 bits */
+  nal_reader_consume (nr, zeros);
+  nal_reader_consume (nr, 1);
+
   if (G_UNLIKELY (i > 31))
     return FALSE;
 
   if (G_UNLIKELY (!nal_reader_get_bits_uint32 (nr, &value, i)))
     return FALSE;
 
-  *val = (1 << i) - 1 + value;
+  *val = ((guint32) 1 << i) - 1 + value;
 
   return TRUE;
 }
@@ -247,7 +370,7 @@ nal_reader_get_se (NalReader * nr, gint32 * val)
 gboolean
 nal_reader_is_byte_aligned (NalReader * nr)
 {
-  if (nr->bits_in_cache != 0)
+  if (nr->bits_in_cache % 8 != 0)
     return FALSE;
   return TRUE;
 }
@@ -295,15 +418,161 @@ nal_reader_has_more_data (NalReader * nr)
 
 /***********  end of nal parser ***************/
 
+/* The vectorized scanner compares blocks of NAL_SCAN_BLOCK_SIZE bytes
+ * against zero, at two consecutive offsets, and turns the result into a
+ * mask with NAL_SCAN_MASK_BITS bits per byte. Only the positions starting
+ * a 0x0000 pair are left, which are rare in coded slice data, and are then
+ * checked one by one for the third byte.
+ *
+ * Like in the MPEG-TS sync scanner, only the instruction sets the compiler
+ * targets are used, there is no runtime CPU detection. */
+#if defined(__GNUC__) && defined(__AVX2__)
+#include <immintrin.h>
+#define NAL_SCAN_IMPLEMENTATION "avx2"
+#define NAL_SCAN_BLOCK_SIZE 32
+#define NAL_SCAN_MASK_BITS 1
+
+static inline guint64
+zero_mask (const guint8 * data)
+{
+  __m256i v = _mm256_loadu_si256 ((const __m256i *) data);
+
+  return (guint32) _mm256_movemask_epi8 (_mm256_cmpeq_epi8 (v,
+          _mm256_setzero_si256 ()));
+}
+#elif defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+#define NAL_SCAN_IMPLEMENTATION "sse2"
+#define NAL_SCAN_BLOCK_SIZE 16
+#define NAL_SCAN_MASK_BITS 1
+
+static inline guint64
+zero_mask (const guint8 * data)
+{
+  __m128i v = _mm_loadu_si128 ((const __m128i *) data);
+
+  return (guint16) _mm_movemask_epi8 (_mm_cmpeq_epi8 (v,
+          _mm_setzero_si128 ()));
+}
+#elif defined(__GNUC__) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define NAL_SCAN_IMPLEMENTATION "neon"
+#define NAL_SCAN_BLOCK_SIZE 16
+#define NAL_SCAN_MASK_BITS 4
+
+static inline guint64
+zero_mask (const guint8 * data)
+{
+  uint8x16_t eq = vceqzq_u8 (vld1q_u8 (data));
+
+  /* NEON has no movemask, narrow each byte to a nibble instead */
+  return vget_lane_u64 (vreinterpret_u64_u8 (vshrn_n_u16 (vreinterpretq_u16_u8
+              (eq), 4)), 0);
+}
+#else
+#define NAL_SCAN_IMPLEMENTATION "scalar"
+#endif
+
+static inline void
+add_epb_position (GArray * epb_positions, guint pos)
+{
+  if (epb_positions)
+    g_array_append_val (epb_positions, pos);
+}
+
+static gint
+scan_for_start_codes_from (const guint8 * data, guint i, guint size,
+    GArray * epb_positions)
+{
+  /* 0x000003 may end the data, a start code must be followed by a byte */
+  while (i + 3 <= size) {
+    if (data[i + 2] > 3 || data[i + 2] == 2) {
+      i += 3;
+    } else if (data[i + 1]) {
+      i += 2;
+    } else if (data[i]) {
+      i++;
+    } else {
+      if (data[i + 2] == 0x01 && i + 4 <= size)
+        return i;
+      if (data[i + 2] == 0x03)
+        add_epb_position (epb_positions, i + 2);
+      i++;
+    }
+  }
+
+  return -1;
+}
+
+/* scan_for_start_codes_scalar:
+ *
+ * Reference implementation of scan_for_start_codes_with_epb(), without
+ * vector instructions.
+ */
 gint
-scan_for_start_codes (const guint8 * data, guint size)
+scan_for_start_codes_scalar (const guint8 * data, guint size,
+    GArray * epb_positions)
 {
-  GstByteReader br;
-  gst_byte_reader_init (&br, data, size);
+  return scan_for_start_codes_from (data, 0, size, epb_positions);
+}
+
+/* scan_for_start_codes_with_epb:
+ * @data: the data to scan
+ * @size: the size of @data
+ * @epb_positions: (allow NULL): a #GArray of guint
+ *
+ * Looks for the first 0x000001 start code prefix in @data which is
+ * followed by at least one byte.
+ *
+ * The offsets of the emulation prevention bytes, that is of the 0x03 in
+ * each 0x000003 sequence located before the start code, are appended to
+ * @epb_positions in the same pass. If no start code is found, all the
+ * emulation prevention bytes of @data are reported.
+ *
+ * Returns: the offset of the start code, or -1 if none.
+ */
+gint
+scan_for_start_codes_with_epb (const guint8 * data, guint size,
+    GArray * epb_positions)
+{
+  guint i = 0;
+
+#ifdef NAL_SCAN_BLOCK_SIZE
+  /* The third byte of the last candidate of a block and the byte following
+   * its start code must be in @data */
+  for (; i + NAL_SCAN_BLOCK_SIZE + 3 <= size; i += NAL_SCAN_BLOCK_SIZE) {
+    guint64 mask = zero_mask (data + i) & zero_mask (data + i + 1);
+
+    while (G_UNLIKELY (mask)) {
+      guint k = __builtin_ctzll (mask) / NAL_SCAN_MASK_BITS;
 
+      mask &= ~((((guint64) 1 << NAL_SCAN_MASK_BITS) - 1) <<
+          (k * NAL_SCAN_MASK_BITS));
+      k += i;
+
+      if (data[k + 2] == 0x01)
+        return k;
+      if (data[k + 2] == 0x03)
+        add_epb_position (epb_positions, k + 2);
+    }
+  }
+#endif
+
+  /* Leftover which doesn't fill a block */
+  return scan_for_start_codes_from (data, i, size, epb_positions);
+}
+
+gint
+scan_for_start_codes (const guint8 * data, guint size)
+{
   /* NALU not empty, so we can at least expect 1 (even 2) bytes following sc */
-  return gst_byte_reader_masked_scan_uint32 (&br, 0xffffff00, 0x00000100,
-      0, size);
+  return scan_for_start_codes_with_epb (data, size, NULL);
+}
+
+const gchar *
+scan_for_start_codes_get_implementation (void)
+{
+  return NAL_SCAN_IMPLEMENTATION;
 }
 
 void
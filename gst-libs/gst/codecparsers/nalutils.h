@@ -48,11 +48,12 @@ typedef struct
   guint size;
 
   guint n_epb;                  /* Number of emulation prevention bytes */
-  guint byte;                   /* Byte position */
-  guint bits_in_cache;          /* bitpos in the cache of next bit */
-  guint8 first_byte;
+  guint byte;                   /* Byte position after the cached bytes */
+  guint bits_in_cache;          /* Number of bits in the cache */
+  guint8 epb_flags;             /* Bit n set if an emulation prevention byte
+                                   preceded the n-th last cached byte */
   guint32 epb_cache;            /* cache 3 bytes to check emulation prevention bytes */
-  guint64 cache;                /* cached bytes */
+  guint64 cache;                /* cached bits, MSB first and zero padded */
 } NalReader;
 
 typedef struct
@@ -196,6 +197,17 @@ gboolean nal_reader_get_se (NalReader * nr, gint32 * val);
 G_GNUC_INTERNAL
 gint scan_for_start_codes (const guint8 * data, guint size);
 
+G_GNUC_INTERNAL
+gint scan_for_start_codes_with_epb (const guint8 * data, guint size,
+                                    GArray * epb_positions);
+
+G_GNUC_INTERNAL
+gint scan_for_start_codes_scalar (const guint8 * data, guint size,
+                                  GArray * epb_positions);
+
+G_GNUC_INTERNAL
+const gchar * scan_for_start_codes_get_implementation (void);
+
 G_GNUC_INTERNAL
 void nal_writer_init (NalWriter * nw, guint nal_prefix_size, gboolean packetized);
 
@@ -0,0 +1,637 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:gstav1decoder
+ * @title: GstAV1Decoder
+ * @short_description: Base class to implement stateless AV1 decoders
+ * @sources:
+ * - gstav1picture.h
+ *
+ * The input buffers are temporal units, in the low overhead bitstream
+ * format. Each temporal unit outputs one picture: the decoded frame it
+ * shows, or the reference frame it shows again with show_existing_frame.
+ * The decoded frames are stored in the reference frame slots of their
+ * refresh_frame_flags, which are provided to
+ * #GstAV1DecoderClass.start_picture.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "gstav1decoder.h"
+
+GST_DEBUG_CATEGORY (gst_av1_decoder_debug);
+#define GST_CAT_DEFAULT gst_av1_decoder_debug
+
+struct _GstAV1DecoderPrivate
+{
+  gint max_width;
+  gint max_height;
+  GstAV1Profile profile;
+  guint8 bit_depth;
+
+  gboolean had_sequence;
+
+  GstAV1Parser *parser;
+  GstAV1Dpb *dpb;
+  GstFlowReturn last_ret;
+
+  /* Picture currently being processed/decoded */
+  GstAV1Picture *current_picture;
+  GstVideoCodecFrame *current_frame;
+
+  /* Frames are skipped until a key frame */
+  gboolean wait_keyframe;
+
+  /* The current frame is output with a picture */
+  gboolean frame_has_picture;
+  /* A frame of the current temporal unit was skipped */
+  gboolean frame_skipped;
+};
+
+#define parent_class gst_av1_decoder_parent_class
+G_DEFINE_ABSTRACT_TYPE_WITH_CODE (GstAV1Decoder, gst_av1_decoder,
+    GST_TYPE_VIDEO_DECODER,
+    G_ADD_PRIVATE (GstAV1Decoder);
+    GST_DEBUG_CATEGORY_INIT (gst_av1_decoder_debug, "av1decoder", 0,
+        "AV1 Video Decoder"));
+
+static gboolean gst_av1_decoder_start (GstVideoDecoder * decoder);
+static gboolean gst_av1_decoder_stop (GstVideoDecoder * decoder);
+static gboolean gst_av1_decoder_set_format (GstVideoDecoder * decoder,
+    GstVideoCodecState * state);
+static GstFlowReturn gst_av1_decoder_finish (GstVideoDecoder * decoder);
+static gboolean gst_av1_decoder_flush (GstVideoDecoder * decoder);
+static GstFlowReturn gst_av1_decoder_drain (GstVideoDecoder * decoder);
+static GstFlowReturn gst_av1_decoder_handle_frame (GstVideoDecoder * decoder,
+    GstVideoCodecFrame * frame);
+
+static GstAV1Picture *gst_av1_decoder_duplicate_picture_default (GstAV1Decoder *
+    decoder, GstAV1Picture * picture);
+
+static void
+gst_av1_decoder_class_init (GstAV1DecoderClass * klass)
+{
+  GstVideoDecoderClass *decoder_class = GST_VIDEO_DECODER_CLASS (klass);
+
+  decoder_class->start = GST_DEBUG_FUNCPTR (gst_av1_decoder_start);
+  decoder_class->stop = GST_DEBUG_FUNCPTR (gst_av1_decoder_stop);
+  decoder_class->set_format = GST_DEBUG_FUNCPTR (gst_av1_decoder_set_format);
+  decoder_class->finish = GST_DEBUG_FUNCPTR (gst_av1_decoder_finish);
+  decoder_class->flush = GST_DEBUG_FUNCPTR (gst_av1_decoder_flush);
+  decoder_class->drain = GST_DEBUG_FUNCPTR (gst_av1_decoder_drain);
+  decoder_class->handle_frame =
+      GST_DEBUG_FUNCPTR (gst_av1_decoder_handle_frame);
+
+  klass->duplicate_picture =
+      GST_DEBUG_FUNCPTR (gst_av1_decoder_duplicate_picture_default);
+}
+
+static void
+gst_av1_decoder_init (GstAV1Decoder * self)
+{
+  gst_video_decoder_set_packetized (GST_VIDEO_DECODER (self), TRUE);
+
+  self->priv = gst_av1_decoder_get_instance_private (self);
+}
+
+static gboolean
+gst_av1_decoder_start (GstVideoDecoder * decoder)
+{
+  GstAV1Decoder *self = GST_AV1_DECODER (decoder);
+  GstAV1DecoderPrivate *priv = self->priv;
+
+  priv->parser = gst_av1_parser_new ();
+  priv->dpb = gst_av1_dpb_new ();
+  priv->had_sequence = FALSE;
+  priv->wait_keyframe = TRUE;
+
+  return TRUE;
+}
+
+static gboolean
+gst_av1_decoder_stop (GstVideoDecoder * decoder)
+{
+  GstAV1Decoder *self = GST_AV1_DECODER (decoder);
+  GstAV1DecoderPrivate *priv = self->priv;
+
+  if (self->input_state) {
+    gst_video_codec_state_unref (self->input_state);
+    self->input_state = NULL;
+  }
+
+  gst_av1_picture_clear (&priv->current_picture);
+
+  if (priv->parser) {
+    gst_av1_parser_free (priv->parser);
+    priv->parser = NULL;
+  }
+
+  if (priv->dpb) {
+    gst_av1_dpb_free (priv->dpb);
+    priv->dpb = NULL;
+  }
+
+  return TRUE;
+}
+
+static gboolean
+gst_av1_decoder_set_format (GstVideoDecoder * decoder,
+    GstVideoCodecState * state)
+{
+  GstAV1Decoder *self = GST_AV1_DECODER (decoder);
+
+  GST_DEBUG_OBJECT (decoder, "Set format");
+
+  if (self->input_state)
+    gst_video_codec_state_unref (self->input_state);
+
+  self->input_state = gst_video_codec_state_ref (state);
+
+  return TRUE;
+}
+
+static void
+gst_av1_decoder_reset (GstAV1Decoder * self)
+{
+  GstAV1DecoderPrivate *priv = self->priv;
+
+  gst_av1_picture_clear (&priv->current_picture);
+
+  if (priv->dpb)
+    gst_av1_dpb_clear (priv->dpb);
+
+  priv->wait_keyframe = TRUE;
+}
+
+static GstFlowReturn
+gst_av1_decoder_finish (GstVideoDecoder * decoder)
+{
+  GST_DEBUG_OBJECT (decoder, "finish");
+
+  gst_av1_decoder_reset (GST_AV1_DECODER (decoder));
+
+  return GST_FLOW_OK;
+}
+
+static gboolean
+gst_av1_decoder_flush (GstVideoDecoder * decoder)
+{
+  GST_DEBUG_OBJECT (decoder, "flush");
+
+  gst_av1_decoder_reset (GST_AV1_DECODER (decoder));
+
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_av1_decoder_drain (GstVideoDecoder * decoder)
+{
+  GST_DEBUG_OBJECT (decoder, "drain");
+
+  gst_av1_decoder_reset (GST_AV1_DECODER (decoder));
+
+  return GST_FLOW_OK;
+}
+
+static GstAV1Picture *
+gst_av1_decoder_duplicate_picture_default (GstAV1Decoder * decoder,
+    GstAV1Picture * picture)
+{
+  GstAV1Picture *new_picture;
+
+  new_picture = gst_av1_picture_new ();
+  new_picture->frame_hdr = picture->frame_hdr;
+  new_picture->temporal_id = picture->temporal_id;
+  new_picture->spatial_id = picture->spatial_id;
+
+  return new_picture;
+}
+
+static gboolean
+gst_av1_decoder_process_sequence (GstAV1Decoder * self, GstAV1OBU * obu)
+{
+  GstAV1DecoderPrivate *priv = self->priv;
+  GstAV1DecoderClass *klass = GST_AV1_DECODER_GET_CLASS (self);
+  GstAV1SequenceHeaderOBU seq_hdr;
+  GstAV1ParserResult pres;
+  gint max_width, max_height;
+
+  pres = gst_av1_parser_parse_sequence_header_obu (priv->parser, obu,
+      &seq_hdr);
+  if (pres != GST_AV1_PARSER_OK) {
+    GST_WARNING_OBJECT (self, "Failed to parse sequence header");
+    return FALSE;
+  }
+
+  max_width = seq_hdr.max_frame_width_minus_1 + 1;
+  max_height = seq_hdr.max_frame_height_minus_1 + 1;
+
+  /* It is repeated before key frames */
+  if (priv->had_sequence && priv->profile == seq_hdr.seq_profile &&
+      priv->max_width == max_width && priv->max_height == max_height &&
+      priv->bit_depth == seq_hdr.bit_depth)
+    return TRUE;
+
+  GST_INFO_OBJECT (self, "new sequence, profile %d, max resolution %dx%d, "
+      "bit depth %d", seq_hdr.seq_profile, max_width, max_height,
+      seq_hdr.bit_depth);
+
+  priv->profile = seq_hdr.seq_profile;
+  priv->max_width = max_width;
+  priv->max_height = max_height;
+  priv->bit_depth = seq_hdr.bit_depth;
+
+  /* The new sequence starts with a key frame, which refreshes all slots */
+  gst_av1_dpb_clear (priv->dpb);
+
+  priv->had_sequence = TRUE;
+  if (klass->new_sequence)
+    priv->had_sequence = klass->new_sequence (self, &seq_hdr);
+
+  return priv->had_sequence;
+}
+
+static gboolean
+gst_av1_decoder_output_picture (GstAV1Decoder * self, GstAV1Picture * picture)
+{
+  GstAV1DecoderPrivate *priv = self->priv;
+  GstAV1DecoderClass *klass = GST_AV1_DECODER_GET_CLASS (self);
+
+  /* With spatial layers, only the first shown frame is output */
+  if (priv->frame_has_picture) {
+    GST_WARNING_OBJECT (self, "Temporal unit shows more than one frame");
+    gst_av1_picture_unref (picture);
+
+    return TRUE;
+  }
+
+  GST_LOG_OBJECT (self, "Outputting picture %p (order hint %d)",
+      picture, picture->frame_hdr.order_hint);
+
+  priv->frame_has_picture = TRUE;
+
+  g_assert (klass->output_picture);
+  priv->last_ret = klass->output_picture (self,
+      gst_video_codec_frame_ref (priv->current_frame), picture);
+
+  return TRUE;
+}
+
+static gboolean
+gst_av1_decoder_show_existing_frame (GstAV1Decoder * self,
+    const GstAV1FrameHeaderOBU * frame_hdr)
+{
+  GstAV1DecoderPrivate *priv = self->priv;
+  GstAV1DecoderClass *klass = GST_AV1_DECODER_GET_CLASS (self);
+  GstAV1Picture *ref_picture;
+  GstAV1Picture *picture;
+  GstAV1ParserResult pres;
+
+  ref_picture = priv->dpb->pic_list[frame_hdr->frame_to_show_map_idx];
+  if (!ref_picture) {
+    GST_ERROR_OBJECT (self, "Invalid frame_to_show_map_idx %d",
+        frame_hdr->frame_to_show_map_idx);
+    return FALSE;
+  }
+
+  pres = gst_av1_parser_reference_frame_loading (priv->parser,
+      &ref_picture->frame_hdr);
+  if (pres != GST_AV1_PARSER_OK) {
+    GST_ERROR_OBJECT (self, "Failed to load reference frame");
+    return FALSE;
+  }
+
+  g_assert (klass->duplicate_picture);
+  picture = klass->duplicate_picture (self, ref_picture);
+  if (!picture) {
+    GST_ERROR_OBJECT (self, "subclass didn't provide duplicated picture");
+    return FALSE;
+  }
+
+  picture->pts = GST_BUFFER_PTS (priv->current_frame->input_buffer);
+  picture->system_frame_number = priv->current_frame->system_frame_number;
+
+  /* Shown with the film grain parameters of the shown frame (7.21) */
+  picture->frame_hdr.show_existing_frame = TRUE;
+  picture->frame_hdr.frame_to_show_map_idx = frame_hdr->frame_to_show_map_idx;
+  picture->frame_hdr.show_frame = TRUE;
+  picture->frame_hdr.refresh_frame_flags = frame_hdr->refresh_frame_flags;
+
+  /* Showing a key frame refreshes all slots with it (7.21) */
+  if (picture->frame_hdr.frame_type == GST_AV1_KEY_FRAME) {
+    pres = gst_av1_parser_reference_frame_update (priv->parser,
+        &picture->frame_hdr);
+    if (pres != GST_AV1_PARSER_OK) {
+      GST_ERROR_OBJECT (self, "Failed to update references");
+      gst_av1_picture_unref (picture);
+      return FALSE;
+    }
+
+    gst_av1_dpb_add (priv->dpb, gst_av1_picture_ref (picture));
+  }
+
+  return gst_av1_decoder_output_picture (self, picture);
+}
+
+static gboolean
+gst_av1_decoder_process_frame_header (GstAV1Decoder * self, GstAV1OBU * obu,
+    const GstAV1FrameHeaderOBU * frame_hdr)
+{
+  GstAV1DecoderPrivate *priv = self->priv;
+  GstAV1DecoderClass *klass = GST_AV1_DECODER_GET_CLASS (self);
+  GstAV1Picture *picture;
+  GstVideoCodecFrame *frame = NULL;
+  gint i;
+
+  if (priv->wait_keyframe) {
+    if (frame_hdr->show_existing_frame ||
+        frame_hdr->frame_type != GST_AV1_KEY_FRAME) {
+      GST_DEBUG_OBJECT (self, "Drop frame before initial keyframe");
+      priv->frame_skipped = TRUE;
+      return TRUE;
+    }
+
+    priv->wait_keyframe = FALSE;
+  }
+
+  if (frame_hdr->show_existing_frame)
+    return gst_av1_decoder_show_existing_frame (self, frame_hdr);
+
+  if (!frame_hdr->frame_is_intra) {
+    for (i = 0; i < GST_AV1_REFS_PER_FRAME; i++) {
+      if (!priv->dpb->pic_list[frame_hdr->ref_frame_idx[i]]) {
+        GST_ERROR_OBJECT (self, "Missing reference frame %d",
+            frame_hdr->ref_frame_idx[i]);
+        return FALSE;
+      }
+    }
+  }
+
+  picture = gst_av1_picture_new ();
+  picture->frame_hdr = *frame_hdr;
+  picture->pts = GST_BUFFER_PTS (priv->current_frame->input_buffer);
+  picture->system_frame_number = priv->current_frame->system_frame_number;
+  picture->temporal_id = obu->header.obu_temporal_id;
+  picture->spatial_id = obu->header.obu_spatial_id;
+
+  if (frame_hdr->show_frame)
+    frame = priv->current_frame;
+
+  if (klass->new_picture) {
+    if (!klass->new_picture (self, frame, picture)) {
+      GST_ERROR_OBJECT (self, "new picture error");
+      gst_av1_picture_unref (picture);
+      return FALSE;
+    }
+  }
+
+  if (klass->start_picture) {
+    if (!klass->start_picture (self, picture, priv->dpb)) {
+      GST_ERROR_OBJECT (self, "start picture error");
+      gst_av1_picture_unref (picture);
+      return FALSE;
+    }
+  }
+
+  priv->current_picture = picture;
+
+  return TRUE;
+}
+
+static gboolean
+gst_av1_decoder_finish_current_picture (GstAV1Decoder * self)
+{
+  GstAV1DecoderPrivate *priv = self->priv;
+  GstAV1DecoderClass *klass = GST_AV1_DECODER_GET_CLASS (self);
+  GstAV1Picture *picture = priv->current_picture;
+  GstAV1ParserResult pres;
+
+  priv->current_picture = NULL;
+
+  if (klass->end_picture) {
+    if (!klass->end_picture (self, picture)) {
+      GST_ERROR_OBJECT (self, "end picture error");
+      gst_av1_picture_unref (picture);
+      return FALSE;
+    }
+  }
+
+  /* 7.20 */
+  pres = gst_av1_parser_reference_frame_update (priv->parser,
+      &picture->frame_hdr);
+  if (pres != GST_AV1_PARSER_OK) {
+    GST_ERROR_OBJECT (self, "Failed to update references");
+    gst_av1_picture_unref (picture);
+    return FALSE;
+  }
+
+  gst_av1_dpb_add (priv->dpb, gst_av1_picture_ref (picture));
+
+  if (!picture->frame_hdr.show_frame) {
+    GST_LOG_OBJECT (self, "Picture %p is not shown", picture);
+    gst_av1_picture_unref (picture);
+    return TRUE;
+  }
+
+  return gst_av1_decoder_output_picture (self, picture);
+}
+
+static gboolean
+gst_av1_decoder_process_tile_group (GstAV1Decoder * self, GstAV1OBU * obu,
+    const GstAV1TileGroupOBU * tile_group)
+{
+  GstAV1DecoderPrivate *priv = self->priv;
+  GstAV1DecoderClass *klass = GST_AV1_DECODER_GET_CLASS (self);
+  GstAV1Tile tile;
+
+  /* Tiles of a skipped frame */
+  if (!priv->current_picture)
+    return TRUE;
+
+  tile.tile_group = *tile_group;
+  tile.obu = *obu;
+
+  if (klass->decode_tile) {
+    if (!klass->decode_tile (self, priv->current_picture, &tile)) {
+      GST_ERROR_OBJECT (self, "decode tile error");
+      return FALSE;
+    }
+  }
+
+  if (tile_group->tg_end == tile_group->num_tiles - 1)
+    return gst_av1_decoder_finish_current_picture (self);
+
+  return TRUE;
+}
+
+static gboolean
+gst_av1_decoder_decode_obu (GstAV1Decoder * self, GstAV1OBU * obu)
+{
+  GstAV1DecoderPrivate *priv = self->priv;
+  GstAV1ParserResult pres;
+  GstAV1FrameHeaderOBU frame_hdr;
+  GstAV1TileGroupOBU tile_group;
+  GstAV1FrameOBU frame;
+
+  GST_LOG_OBJECT (self, "OBU type %d, size %u", obu->obu_type, obu->obu_size);
+
+  switch (obu->obu_type) {
+    case GST_AV1_OBU_FRAME_HEADER:
+    case GST_AV1_OBU_FRAME:
+    case GST_AV1_OBU_TILE_GROUP:
+      if (!priv->had_sequence) {
+        GST_DEBUG_OBJECT (self, "Drop frame before sequence header");
+        priv->frame_skipped = TRUE;
+        return TRUE;
+      }
+      break;
+    default:
+      break;
+  }
+
+  switch (obu->obu_type) {
+    case GST_AV1_OBU_SEQUENCE_HEADER:
+      return gst_av1_decoder_process_sequence (self, obu);
+    case GST_AV1_OBU_TEMPORAL_DELIMITER:
+      pres = gst_av1_parser_parse_temporal_delimiter_obu (priv->parser, obu);
+      break;
+    case GST_AV1_OBU_FRAME_HEADER:
+      pres = gst_av1_parser_parse_frame_header_obu (priv->parser, obu,
+          &frame_hdr);
+      if (pres != GST_AV1_PARSER_OK)
+        break;
+
+      return gst_av1_decoder_process_frame_header (self, obu, &frame_hdr);
+    case GST_AV1_OBU_FRAME:
+      pres = gst_av1_parser_parse_frame_obu (priv->parser, obu, &frame);
+      if (pres != GST_AV1_PARSER_OK)
+        break;
+
+      if (!gst_av1_decoder_process_frame_header (self, obu,
+              &frame.frame_header))
+        return FALSE;
+
+      return gst_av1_decoder_process_tile_group (self, obu, &frame.tile_group);
+    case GST_AV1_OBU_TILE_GROUP:
+      pres = gst_av1_parser_parse_tile_group_obu (priv->parser, obu,
+          &tile_group);
+      if (pres != GST_AV1_PARSER_OK)
+        break;
+
+      return gst_av1_decoder_process_tile_group (self, obu, &tile_group);
+    default:
+      /* Redundant frame headers, metadata, tile lists and padding are not
+       * needed to decode */
+      return TRUE;
+  }
+
+  if (pres != GST_AV1_PARSER_OK) {
+    GST_WARNING_OBJECT (self, "Failed to parse OBU type %d", obu->obu_type);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_av1_decoder_handle_frame (GstVideoDecoder * decoder,
+    GstVideoCodecFrame * frame)
+{
+  GstAV1Decoder *self = GST_AV1_DECODER (decoder);
+  GstAV1DecoderPrivate *priv = self->priv;
+  GstBuffer *in_buf = frame->input_buffer;
+  GstAV1ParserResult pres;
+  GstAV1OBU obu;
+  GstMapInfo map;
+  guint32 consumed;
+  guint offset = 0;
+  gboolean decode_ret = TRUE;
+
+  GST_LOG_OBJECT (self, "handle frame %" GST_PTR_FORMAT, in_buf);
+
+  priv->current_frame = frame;
+  priv->last_ret = GST_FLOW_OK;
+  priv->frame_has_picture = FALSE;
+  priv->frame_skipped = FALSE;
+
+  if (!gst_buffer_map (in_buf, &map, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Cannot map buffer");
+    decode_ret = FALSE;
+    goto done;
+  }
+
+  while (decode_ret && offset < map.size) {
+    pres = gst_av1_parser_identify_one_obu (priv->parser, map.data + offset,
+        map.size - offset, &obu, &consumed);
+
+    /* Of a layer the operating point doesn't decode */
+    if (pres == GST_AV1_PARSER_DROP) {
+      offset += consumed;
+      continue;
+    }
+
+    if (pres != GST_AV1_PARSER_OK) {
+      GST_WARNING_OBJECT (self, "Failed to identify OBU");
+      decode_ret = FALSE;
+      break;
+    }
+
+    decode_ret = gst_av1_decoder_decode_obu (self, &obu);
+    offset += consumed;
+  }
+
+  gst_buffer_unmap (in_buf, &map);
+
+  if (decode_ret && priv->current_picture) {
+    GST_ERROR_OBJECT (self, "Temporal unit ends with missing tiles");
+    decode_ret = FALSE;
+  }
+
+done:
+  if (!decode_ret) {
+    GST_VIDEO_DECODER_ERROR (self, 1, STREAM, DECODE,
+        ("Failed to decode data"), (NULL), priv->last_ret);
+
+    /* The picture was output, the frame goes with it */
+    if (priv->frame_has_picture)
+      gst_video_codec_frame_unref (frame);
+    else
+      gst_video_decoder_drop_frame (decoder, frame);
+
+    gst_av1_picture_clear (&priv->current_picture);
+    priv->current_frame = NULL;
+
+    return priv->last_ret;
+  }
+
+  if (priv->frame_has_picture) {
+    gst_video_codec_frame_unref (frame);
+  } else if (priv->frame_skipped) {
+    gst_video_decoder_drop_frame (decoder, frame);
+  } else {
+    /* Headers only, or frames which are not shown */
+    gst_video_decoder_release_frame (decoder, frame);
+  }
+
+  priv->current_frame = NULL;
+
+  return priv->last_ret;
+}
@@ -0,0 +1,144 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_AV1_DECODER_H__
+#define __GST_AV1_DECODER_H__
+
+#include <gst/codecs/codecs-prelude.h>
+
+#include <gst/video/video.h>
+#include <gst/codecparsers/gstav1parser.h>
+#include <gst/codecs/gstav1picture.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_AV1_DECODER            (gst_av1_decoder_get_type())
+#define GST_AV1_DECODER(obj)            (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_AV1_DECODER,GstAV1Decoder))
+#define GST_AV1_DECODER_CLASS(klass)    (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_AV1_DECODER,GstAV1DecoderClass))
+#define GST_AV1_DECODER_GET_CLASS(obj)  (G_TYPE_INSTANCE_GET_CLASS((obj),GST_TYPE_AV1_DECODER,GstAV1DecoderClass))
+#define GST_IS_AV1_DECODER(obj)         (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_AV1_DECODER))
+#define GST_IS_AV1_DECODER_CLASS(klass) (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_AV1_DECODER))
+#define GST_AV1_DECODER_CAST(obj)       ((GstAV1Decoder*)obj)
+
+typedef struct _GstAV1Decoder GstAV1Decoder;
+typedef struct _GstAV1DecoderClass GstAV1DecoderClass;
+typedef struct _GstAV1DecoderPrivate GstAV1DecoderPrivate;
+
+/**
+ * GstAV1Decoder:
+ *
+ * The opaque #GstAV1Decoder data structure.
+ */
+struct _GstAV1Decoder
+{
+  /*< private >*/
+  GstVideoDecoder parent;
+
+  /*< protected >*/
+  GstVideoCodecState * input_state;
+
+  /*< private >*/
+  GstAV1DecoderPrivate *priv;
+  gpointer padding[GST_PADDING_LARGE];
+};
+
+/**
+ * GstAV1DecoderClass:
+ * @new_sequence:      Notifies subclass of a new or changed sequence header
+ * @new_picture:       Optional.
+ *                     Called whenever new #GstAV1Picture is created.
+ *                     Subclass can set implementation specific user data
+ *                     on the #GstAV1Picture via gst_av1_picture_set_user_data()
+ * @duplicate_picture: Duplicate the #GstAV1Picture a show_existing_frame
+ *                     shows. The default implementation copies its frame
+ *                     header, film grain parameters included
+ * @start_picture:     Optional.
+ *                     Called per one #GstAV1Picture to notify subclass to prepare
+ *                     decoding process for the #GstAV1Picture, with the
+ *                     reference frame slots it is predicted from
+ * @decode_tile:       Provides per tile group data with the parsed tile group
+ *                     and the raw bitstream of its OBU for subclass to decode it
+ * @end_picture:       Optional.
+ *                     Called per one #GstAV1Picture to notify subclass to finish
+ *                     decoding process for the #GstAV1Picture
+ * @output_picture:    Called with a #GstAV1Picture which is required to be outputted,
+ *                     one per temporal unit. Pictures which are decoded but
+ *                     not shown are only stored as reference.
+ *                     The #GstVideoCodecFrame must be consumed by subclass via
+ *                     gst_video_decoder_{finish,drop,release}_frame().
+ */
+struct _GstAV1DecoderClass
+{
+  GstVideoDecoderClass parent_class;
+
+  gboolean        (*new_sequence)      (GstAV1Decoder * decoder,
+                                        const GstAV1SequenceHeaderOBU * seq_hdr);
+
+  /**
+   * GstAV1Decoder:new_picture:
+   * @decoder: a #GstAV1Decoder
+   * @frame: (nullable): (transfer none): the #GstVideoCodecFrame of the
+   *   temporal unit, or %NULL if @picture is not shown
+   * @picture: (transfer none): a #GstAV1Picture
+   */
+  gboolean        (*new_picture)       (GstAV1Decoder * decoder,
+                                        GstVideoCodecFrame * frame,
+                                        GstAV1Picture * picture);
+
+  GstAV1Picture * (*duplicate_picture) (GstAV1Decoder * decoder,
+                                        GstAV1Picture * picture);
+
+  /**
+   * GstAV1Decoder:start_picture:
+   * @decoder: a #GstAV1Decoder
+   * @picture: (transfer none): a #GstAV1Picture
+   * @dpb: (transfer none): the reference frame slots
+   */
+  gboolean        (*start_picture)     (GstAV1Decoder * decoder,
+                                        GstAV1Picture * picture,
+                                        GstAV1Dpb * dpb);
+
+  gboolean        (*decode_tile)       (GstAV1Decoder * decoder,
+                                        GstAV1Picture * picture,
+                                        GstAV1Tile * tile);
+
+  gboolean        (*end_picture)       (GstAV1Decoder * decoder,
+                                        GstAV1Picture * picture);
+
+  /**
+   * GstAV1Decoder:output_picture:
+   * @decoder: a #GstAV1Decoder
+   * @frame: (transfer full): a #GstVideoCodecFrame
+   * @picture: (transfer full): a #GstAV1Picture
+   */
+  GstFlowReturn   (*output_picture)    (GstAV1Decoder * decoder,
+                                        GstVideoCodecFrame * frame,
+                                        GstAV1Picture * picture);
+
+  /*< private >*/
+  gpointer padding[GST_PADDING_LARGE];
+};
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC(GstAV1Decoder, gst_object_unref)
+
+GST_CODECS_API
+GType gst_av1_decoder_get_type (void);
+
+G_END_DECLS
+
+#endif /* __GST_AV1_DECODER_H__ */
@@ -0,0 +1,905 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:gstmpeg2decoder
+ * @title: GstMpeg2Decoder
+ * @short_description: Base class to implement stateless MPEG-2 decoders
+ * @sources:
+ * - gstmpeg2picture.h
+ *
+ * The input must be parsed and aligned on pictures, as mpegvideoparse
+ * outputs it. Both fields of a frame coded as field pictures may come in one
+ * or two buffers.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+
+#include "gstmpeg2decoder.h"
+
+GST_DEBUG_CATEGORY (gst_mpeg2_decoder_debug);
+#define GST_CAT_DEFAULT gst_mpeg2_decoder_debug
+
+typedef enum
+{
+  GST_MPEG2_DECODER_STATE_GOT_SEQ_HDR = 1 << 0,
+  GST_MPEG2_DECODER_STATE_GOT_SEQ_EXT = 1 << 1,
+  GST_MPEG2_DECODER_STATE_GOT_SEQ_DISPLAY_EXT = 1 << 2,
+  GST_MPEG2_DECODER_STATE_GOT_SEQ_SCALABLE_EXT = 1 << 3,
+  GST_MPEG2_DECODER_STATE_GOT_PIC_HDR = 1 << 4,
+  GST_MPEG2_DECODER_STATE_GOT_PIC_EXT = 1 << 5,
+} GstMpeg2DecoderState;
+
+struct _GstMpeg2DecoderPrivate
+{
+  gint width, height;
+  gboolean progressive;
+  guint8 profile;
+  guint8 chroma_format;
+
+  /* headers in effect */
+  guint state;
+  GstMpegVideoSequenceHdr seq_hdr;
+  GstMpegVideoSequenceExt seq_ext;
+  GstMpegVideoSequenceDisplayExt seq_display_ext;
+  GstMpegVideoSequenceScalableExt seq_scalable_ext;
+  GstMpegVideoQuantMatrixExt quant_matrix;
+  GstMpegVideoPictureHdr pic_hdr;
+  GstMpegVideoPictureExt pic_ext;
+
+  gboolean had_sequence;
+  gboolean seq_changed;
+
+  GstMpeg2Dpb *dpb;
+  GstFlowReturn last_ret;
+
+  /* Picture currently being processed/decoded */
+  GstMpeg2Picture *current_picture;
+  GstVideoCodecFrame *current_frame;
+
+  /* Decoded first field waiting for its second field */
+  GstMpeg2Picture *first_field;
+
+  /* Pictures are skipped until an I picture */
+  gboolean wait_keyframe;
+  /* The B pictures preceding the first P picture of the GOP are only
+   * predicted from the following anchor picture (closed_gop), or can't be
+   * decoded (broken_link) */
+  gboolean closed_gop;
+  gboolean broken_link;
+
+  /* The slices of the current picture are skipped */
+  gboolean skip_picture;
+  /* The next picture is skipped if it is the second field of a skipped
+   * first field of this structure */
+  GstMpegVideoPictureStructure skipped_field;
+
+  /* The current frame is output with a picture */
+  gboolean frame_has_picture;
+  /* A picture of the current frame was skipped */
+  gboolean frame_skipped;
+};
+
+#define parent_class gst_mpeg2_decoder_parent_class
+G_DEFINE_ABSTRACT_TYPE_WITH_CODE (GstMpeg2Decoder, gst_mpeg2_decoder,
+    GST_TYPE_VIDEO_DECODER,
+    G_ADD_PRIVATE (GstMpeg2Decoder);
+    GST_DEBUG_CATEGORY_INIT (gst_mpeg2_decoder_debug, "mpeg2decoder", 0,
+        "MPEG-2 Video Decoder"));
+
+static gboolean gst_mpeg2_decoder_start (GstVideoDecoder * decoder);
+static gboolean gst_mpeg2_decoder_stop (GstVideoDecoder * decoder);
+static gboolean gst_mpeg2_decoder_set_format (GstVideoDecoder * decoder,
+    GstVideoCodecState * state);
+static GstFlowReturn gst_mpeg2_decoder_finish (GstVideoDecoder * decoder);
+static gboolean gst_mpeg2_decoder_flush (GstVideoDecoder * decoder);
+static GstFlowReturn gst_mpeg2_decoder_drain (GstVideoDecoder * decoder);
+static GstFlowReturn gst_mpeg2_decoder_handle_frame (GstVideoDecoder * decoder,
+    GstVideoCodecFrame * frame);
+
+static void
+gst_mpeg2_decoder_class_init (GstMpeg2DecoderClass * klass)
+{
+  GstVideoDecoderClass *decoder_class = GST_VIDEO_DECODER_CLASS (klass);
+
+  decoder_class->start = GST_DEBUG_FUNCPTR (gst_mpeg2_decoder_start);
+  decoder_class->stop = GST_DEBUG_FUNCPTR (gst_mpeg2_decoder_stop);
+  decoder_class->set_format = GST_DEBUG_FUNCPTR (gst_mpeg2_decoder_set_format);
+  decoder_class->finish = GST_DEBUG_FUNCPTR (gst_mpeg2_decoder_finish);
+  decoder_class->flush = GST_DEBUG_FUNCPTR (gst_mpeg2_decoder_flush);
+  decoder_class->drain = GST_DEBUG_FUNCPTR (gst_mpeg2_decoder_drain);
+  decoder_class->handle_frame =
+      GST_DEBUG_FUNCPTR (gst_mpeg2_decoder_handle_frame);
+}
+
+static void
+gst_mpeg2_decoder_init (GstMpeg2Decoder * self)
+{
+  gst_video_decoder_set_packetized (GST_VIDEO_DECODER (self), TRUE);
+
+  self->priv = gst_mpeg2_decoder_get_instance_private (self);
+}
+
+static void
+gst_mpeg2_decoder_reset (GstMpeg2Decoder * self)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+
+  if (priv->dpb)
+    gst_mpeg2_dpb_clear (priv->dpb);
+  gst_mpeg2_picture_clear (&priv->current_picture);
+  gst_mpeg2_picture_clear (&priv->first_field);
+
+  priv->state &= ~(GST_MPEG2_DECODER_STATE_GOT_PIC_HDR |
+      GST_MPEG2_DECODER_STATE_GOT_PIC_EXT);
+  priv->wait_keyframe = TRUE;
+  priv->closed_gop = FALSE;
+  priv->broken_link = FALSE;
+  priv->skip_picture = FALSE;
+  priv->skipped_field = 0;
+}
+
+static gboolean
+gst_mpeg2_decoder_start (GstVideoDecoder * decoder)
+{
+  GstMpeg2Decoder *self = GST_MPEG2_DECODER (decoder);
+  GstMpeg2DecoderPrivate *priv = self->priv;
+
+  priv->dpb = gst_mpeg2_dpb_new ();
+  priv->state = 0;
+  priv->had_sequence = FALSE;
+  gst_mpeg2_decoder_reset (self);
+
+  return TRUE;
+}
+
+static gboolean
+gst_mpeg2_decoder_stop (GstVideoDecoder * decoder)
+{
+  GstMpeg2Decoder *self = GST_MPEG2_DECODER (decoder);
+  GstMpeg2DecoderPrivate *priv = self->priv;
+
+  if (self->input_state) {
+    gst_video_codec_state_unref (self->input_state);
+    self->input_state = NULL;
+  }
+
+  gst_mpeg2_decoder_reset (self);
+
+  if (priv->dpb) {
+    gst_mpeg2_dpb_free (priv->dpb);
+    priv->dpb = NULL;
+  }
+
+  return TRUE;
+}
+
+static gboolean
+gst_mpeg2_decoder_set_format (GstVideoDecoder * decoder,
+    GstVideoCodecState * state)
+{
+  GstMpeg2Decoder *self = GST_MPEG2_DECODER (decoder);
+
+  GST_DEBUG_OBJECT (decoder, "Set format");
+
+  if (self->input_state)
+    gst_video_codec_state_unref (self->input_state);
+
+  self->input_state = gst_video_codec_state_ref (state);
+
+  return TRUE;
+}
+
+static void
+gst_mpeg2_decoder_do_output_picture (GstMpeg2Decoder * self,
+    GstMpeg2Picture * picture)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpeg2DecoderClass *klass = GST_MPEG2_DECODER_GET_CLASS (self);
+  GstVideoCodecFrame *frame;
+
+  GST_LOG_OBJECT (self, "Outputting picture %p (type %d, tsn %d)",
+      picture, picture->type, picture->tsn);
+
+  frame = gst_video_decoder_get_frame (GST_VIDEO_DECODER (self),
+      picture->system_frame_number);
+
+  if (!frame) {
+    GST_ERROR_OBJECT (self,
+        "No available codec frame with frame number %d",
+        picture->system_frame_number);
+    priv->last_ret = GST_FLOW_ERROR;
+    gst_mpeg2_picture_unref (picture);
+
+    return;
+  }
+
+  g_assert (klass->output_picture);
+  priv->last_ret = klass->output_picture (self, frame, picture);
+}
+
+/* Without B pictures, the anchor pictures are output as soon as they are
+ * decoded */
+static gboolean
+gst_mpeg2_decoder_is_low_delay (GstMpeg2Decoder * self)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+
+  return (priv->state & GST_MPEG2_DECODER_STATE_GOT_SEQ_EXT)
+      && priv->seq_ext.low_delay;
+}
+
+static void
+gst_mpeg2_decoder_add_to_dpb (GstMpeg2Decoder * self,
+    GstMpeg2Picture * picture)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpeg2Picture *to_output;
+  gboolean drain = gst_mpeg2_decoder_is_low_delay (self);
+
+  gst_mpeg2_dpb_add (priv->dpb, picture);
+
+  while ((to_output = gst_mpeg2_dpb_bump (priv->dpb, drain)))
+    gst_mpeg2_decoder_do_output_picture (self, to_output);
+}
+
+static void
+gst_mpeg2_decoder_drain_internal (GstMpeg2Decoder * self)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpeg2Picture *to_output;
+
+  /* A first field without its second field is output alone */
+  if (priv->first_field) {
+    GST_WARNING_OBJECT (self, "Outputting unpaired field");
+    gst_mpeg2_dpb_add (priv->dpb, priv->first_field);
+    priv->first_field = NULL;
+  }
+
+  while ((to_output = gst_mpeg2_dpb_bump (priv->dpb, TRUE)))
+    gst_mpeg2_decoder_do_output_picture (self, to_output);
+
+  gst_mpeg2_dpb_clear (priv->dpb);
+}
+
+static gboolean
+gst_mpeg2_decoder_flush (GstVideoDecoder * decoder)
+{
+  GstMpeg2Decoder *self = GST_MPEG2_DECODER (decoder);
+
+  GST_DEBUG_OBJECT (self, "flush");
+
+  gst_mpeg2_decoder_reset (self);
+
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_mpeg2_decoder_drain (GstVideoDecoder * decoder)
+{
+  GstMpeg2Decoder *self = GST_MPEG2_DECODER (decoder);
+  GstMpeg2DecoderPrivate *priv = self->priv;
+
+  GST_DEBUG_OBJECT (self, "drain");
+
+  priv->last_ret = GST_FLOW_OK;
+  gst_mpeg2_decoder_drain_internal (self);
+
+  return priv->last_ret;
+}
+
+static GstFlowReturn
+gst_mpeg2_decoder_finish (GstVideoDecoder * decoder)
+{
+  return gst_mpeg2_decoder_drain (decoder);
+}
+
+static gboolean
+gst_mpeg2_decoder_check_codec_change (GstMpeg2Decoder * self)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpeg2DecoderClass *klass = GST_MPEG2_DECODER_GET_CLASS (self);
+  GstMpegVideoSequenceExt *seq_ext = NULL;
+  GstMpegVideoSequenceDisplayExt *seq_display_ext = NULL;
+  GstMpegVideoSequenceScalableExt *seq_scalable_ext = NULL;
+  gint width, height;
+  gboolean progressive = TRUE;
+  guint8 profile = 0, chroma_format = 1;
+
+  if (priv->had_sequence && !priv->seq_changed)
+    return TRUE;
+
+  priv->seq_changed = FALSE;
+
+  width = priv->seq_hdr.width;
+  height = priv->seq_hdr.height;
+
+  if (priv->state & GST_MPEG2_DECODER_STATE_GOT_SEQ_EXT) {
+    seq_ext = &priv->seq_ext;
+    width |= seq_ext->horiz_size_ext << 12;
+    height |= seq_ext->vert_size_ext << 12;
+    progressive = seq_ext->progressive;
+    profile = seq_ext->profile;
+    chroma_format = seq_ext->chroma_format;
+  }
+  if (priv->state & GST_MPEG2_DECODER_STATE_GOT_SEQ_DISPLAY_EXT)
+    seq_display_ext = &priv->seq_display_ext;
+  if (priv->state & GST_MPEG2_DECODER_STATE_GOT_SEQ_SCALABLE_EXT)
+    seq_scalable_ext = &priv->seq_scalable_ext;
+
+  /* The sequence header is repeated at each GOP */
+  if (priv->had_sequence && priv->width == width && priv->height == height
+      && priv->progressive == progressive && priv->profile == profile
+      && priv->chroma_format == chroma_format)
+    return TRUE;
+
+  GST_INFO_OBJECT (self, "sequence changed, %dx%d %s, profile %d",
+      width, height, progressive ? "progressive" : "interlaced", profile);
+
+  /* The pictures of the previous sequence can't be referenced anymore */
+  if (priv->had_sequence)
+    gst_mpeg2_decoder_drain_internal (self);
+
+  priv->width = width;
+  priv->height = height;
+  priv->progressive = progressive;
+  priv->profile = profile;
+  priv->chroma_format = chroma_format;
+  priv->had_sequence = TRUE;
+
+  if (klass->new_sequence && !klass->new_sequence (self, &priv->seq_hdr,
+          seq_ext, seq_display_ext, seq_scalable_ext)) {
+    GST_ERROR_OBJECT (self, "Subclass cannot handle new sequence");
+    priv->had_sequence = FALSE;
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+static gboolean
+gst_mpeg2_decoder_handle_sequence (GstMpeg2Decoder * self,
+    GstMpegVideoPacket * packet)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpegVideoSequenceHdr seq_hdr = { 0, };
+
+  if (!gst_mpeg_video_packet_parse_sequence_header (packet, &seq_hdr)) {
+    GST_ERROR_OBJECT (self, "failed to parse sequence header");
+    return FALSE;
+  }
+
+  priv->seq_hdr = seq_hdr;
+  priv->seq_changed = TRUE;
+  /* The extensions of the previous sequence header don't apply anymore */
+  priv->state = GST_MPEG2_DECODER_STATE_GOT_SEQ_HDR;
+
+  /* Reset to the matrices of the sequence header, the parser filled in the
+   * default ones if they are not loaded */
+  priv->quant_matrix.load_intra_quantiser_matrix = TRUE;
+  memcpy (priv->quant_matrix.intra_quantiser_matrix,
+      seq_hdr.intra_quantizer_matrix, 64);
+  priv->quant_matrix.load_non_intra_quantiser_matrix = TRUE;
+  memcpy (priv->quant_matrix.non_intra_quantiser_matrix,
+      seq_hdr.non_intra_quantizer_matrix, 64);
+  priv->quant_matrix.load_chroma_intra_quantiser_matrix = FALSE;
+  priv->quant_matrix.load_chroma_non_intra_quantiser_matrix = FALSE;
+
+  return TRUE;
+}
+
+static void
+gst_mpeg2_decoder_handle_quant_matrix (GstMpeg2Decoder * self,
+    GstMpegVideoQuantMatrixExt * quant)
+{
+  GstMpegVideoQuantMatrixExt *matrix = &self->priv->quant_matrix;
+
+  if (quant->load_intra_quantiser_matrix) {
+    matrix->load_intra_quantiser_matrix = TRUE;
+    memcpy (matrix->intra_quantiser_matrix, quant->intra_quantiser_matrix, 64);
+  }
+  if (quant->load_non_intra_quantiser_matrix) {
+    matrix->load_non_intra_quantiser_matrix = TRUE;
+    memcpy (matrix->non_intra_quantiser_matrix,
+        quant->non_intra_quantiser_matrix, 64);
+  }
+  if (quant->load_chroma_intra_quantiser_matrix) {
+    matrix->load_chroma_intra_quantiser_matrix = TRUE;
+    memcpy (matrix->chroma_intra_quantiser_matrix,
+        quant->chroma_intra_quantiser_matrix, 64);
+  }
+  if (quant->load_chroma_non_intra_quantiser_matrix) {
+    matrix->load_chroma_non_intra_quantiser_matrix = TRUE;
+    memcpy (matrix->chroma_non_intra_quantiser_matrix,
+        quant->chroma_non_intra_quantiser_matrix, 64);
+  }
+}
+
+static gboolean
+gst_mpeg2_decoder_handle_extension (GstMpeg2Decoder * self,
+    GstMpegVideoPacket * packet)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpegVideoQuantMatrixExt quant;
+  guint8 ext_type;
+
+  if (packet->size < 1)
+    return TRUE;
+
+  ext_type = packet->data[packet->offset] >> 4;
+
+  switch (ext_type) {
+    case GST_MPEG_VIDEO_PACKET_EXT_SEQUENCE:
+      if (!gst_mpeg_video_packet_parse_sequence_extension (packet,
+              &priv->seq_ext)) {
+        GST_ERROR_OBJECT (self, "failed to parse sequence extension");
+        return FALSE;
+      }
+      priv->state |= GST_MPEG2_DECODER_STATE_GOT_SEQ_EXT;
+      break;
+    case GST_MPEG_VIDEO_PACKET_EXT_SEQUENCE_DISPLAY:
+      if (gst_mpeg_video_packet_parse_sequence_display_extension (packet,
+              &priv->seq_display_ext))
+        priv->state |= GST_MPEG2_DECODER_STATE_GOT_SEQ_DISPLAY_EXT;
+      else
+        GST_WARNING_OBJECT (self, "failed to parse sequence display extension");
+      break;
+    case GST_MPEG_VIDEO_PACKET_EXT_SEQUENCE_SCALABLE:
+      if (gst_mpeg_video_packet_parse_sequence_scalable_extension (packet,
+              &priv->seq_scalable_ext))
+        priv->state |= GST_MPEG2_DECODER_STATE_GOT_SEQ_SCALABLE_EXT;
+      else
+        GST_WARNING_OBJECT (self,
+            "failed to parse sequence scalable extension");
+      break;
+    case GST_MPEG_VIDEO_PACKET_EXT_QUANT_MATRIX:
+      if (!gst_mpeg_video_packet_parse_quant_matrix_extension (packet,
+              &quant)) {
+        GST_ERROR_OBJECT (self, "failed to parse quant matrix extension");
+        return FALSE;
+      }
+      gst_mpeg2_decoder_handle_quant_matrix (self, &quant);
+      break;
+    case GST_MPEG_VIDEO_PACKET_EXT_PICTURE:
+      if (!gst_mpeg_video_packet_parse_picture_extension (packet,
+              &priv->pic_ext)) {
+        GST_ERROR_OBJECT (self, "failed to parse picture coding extension");
+        return FALSE;
+      }
+      priv->state |= GST_MPEG2_DECODER_STATE_GOT_PIC_EXT;
+      break;
+    default:
+      break;
+  }
+
+  return TRUE;
+}
+
+static void
+gst_mpeg2_decoder_handle_gop (GstMpeg2Decoder * self,
+    GstMpegVideoPacket * packet)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpegVideoGop gop;
+
+  if (!gst_mpeg_video_packet_parse_gop (packet, &gop)) {
+    GST_WARNING_OBJECT (self, "failed to parse GOP");
+    return;
+  }
+
+  GST_LOG_OBJECT (self, "GOP %02d:%02d:%02d:%02d, closed %d, broken link %d",
+      gop.hour, gop.minute, gop.second, gop.frame, gop.closed_gop,
+      gop.broken_link);
+
+  priv->closed_gop = gop.closed_gop;
+  priv->broken_link = gop.broken_link;
+}
+
+static gboolean
+gst_mpeg2_decoder_finish_current_picture (GstMpeg2Decoder * self)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpeg2DecoderClass *klass = GST_MPEG2_DECODER_GET_CLASS (self);
+  GstMpeg2Picture *picture = priv->current_picture;
+
+  if (!picture)
+    return TRUE;
+
+  priv->current_picture = NULL;
+
+  if (klass->end_picture && !klass->end_picture (self, picture)) {
+    GST_ERROR_OBJECT (self, "subclass cannot handle end picture");
+    gst_mpeg2_picture_unref (picture);
+    return FALSE;
+  }
+
+  if (GST_MPEG2_PICTURE_IS_FIELD (picture) && !picture->first_field) {
+    GST_LOG_OBJECT (self, "First field decoded, waiting for the second one");
+    g_assert (priv->first_field == NULL);
+    priv->first_field = picture;
+    return TRUE;
+  }
+
+  if (picture->first_field) {
+    /* Both fields are decoded, the first field stands for the frame */
+    gst_mpeg2_picture_unref (picture);
+    picture = priv->first_field;
+    priv->first_field = NULL;
+  }
+
+  gst_mpeg2_decoder_add_to_dpb (self, picture);
+
+  return TRUE;
+}
+
+/* Whether @picture, which isn't a second field, can be decoded with the
+ * anchor pictures at hand */
+static gboolean
+gst_mpeg2_decoder_can_decode (GstMpeg2Decoder * self,
+    GstMpeg2Picture * picture)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpeg2Picture *prev_picture, *next_picture;
+
+  switch (picture->type) {
+    case GST_MPEG_VIDEO_PICTURE_TYPE_I:
+      priv->wait_keyframe = FALSE;
+      return TRUE;
+    case GST_MPEG_VIDEO_PICTURE_TYPE_P:
+      /* The following B pictures are predicted from both anchors */
+      priv->closed_gop = FALSE;
+      priv->broken_link = FALSE;
+      break;
+    case GST_MPEG_VIDEO_PICTURE_TYPE_B:
+      break;
+    default:
+      GST_WARNING_OBJECT (self, "unsupported picture type %d", picture->type);
+      return FALSE;
+  }
+
+  if (priv->wait_keyframe) {
+    GST_DEBUG_OBJECT (self, "Waiting for an I picture");
+    return FALSE;
+  }
+
+  gst_mpeg2_dpb_get_neighbours (priv->dpb, picture, &prev_picture,
+      &next_picture);
+
+  if (picture->type == GST_MPEG_VIDEO_PICTURE_TYPE_P)
+    return prev_picture != NULL;
+
+  if (priv->broken_link) {
+    GST_DEBUG_OBJECT (self, "B picture after a broken link");
+    return FALSE;
+  }
+
+  return next_picture != NULL && (prev_picture != NULL || priv->closed_gop);
+}
+
+static gboolean
+gst_mpeg2_decoder_start_current_picture (GstMpeg2Decoder * self,
+    GstMpeg2Slice * slice)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpeg2DecoderClass *klass = GST_MPEG2_DECODER_GET_CLASS (self);
+  GstMpeg2Picture *picture, *first_field = NULL;
+  GstMpeg2Picture *prev_picture, *next_picture;
+  GstMpegVideoPictureStructure structure = priv->pic_ext.picture_structure;
+
+  if (!gst_mpeg2_decoder_check_codec_change (self))
+    return FALSE;
+
+  picture = gst_mpeg2_picture_new ();
+  picture->type = priv->pic_hdr.pic_type;
+  picture->structure = structure;
+  picture->tsn = priv->pic_hdr.tsn;
+  picture->pts = GST_BUFFER_PTS (priv->current_frame->input_buffer);
+
+  if (priv->first_field) {
+    /* The two fields of a frame have opposite parities and follow each
+     * other */
+    if (GST_MPEG2_PICTURE_IS_FIELD (picture)
+        && structure != priv->first_field->structure) {
+      first_field = priv->first_field;
+    } else {
+      GST_WARNING_OBJECT (self, "Field %p has no second field",
+          priv->first_field);
+      gst_mpeg2_decoder_add_to_dpb (self, priv->first_field);
+      priv->first_field = NULL;
+    }
+  }
+
+  if (priv->skipped_field) {
+    gboolean second_field = GST_MPEG2_PICTURE_IS_FIELD (picture)
+        && structure != priv->skipped_field;
+
+    priv->skipped_field = 0;
+    if (second_field) {
+      GST_DEBUG_OBJECT (self, "Skipping the second field of a skipped field");
+      goto skip;
+    }
+  }
+
+  if (first_field) {
+    picture->first_field = gst_mpeg2_picture_ref (first_field);
+    picture->system_frame_number = first_field->system_frame_number;
+
+    if (klass->new_field_picture
+        && !klass->new_field_picture (self, first_field, picture)) {
+      GST_ERROR_OBJECT (self, "subclass cannot handle new field picture");
+      goto error;
+    }
+
+    /* The first field isn't in the DPB yet, the references are the ones of
+     * the frame */
+    gst_mpeg2_dpb_get_neighbours (priv->dpb, picture, &prev_picture,
+        &next_picture);
+  } else {
+    if (!gst_mpeg2_decoder_can_decode (self, picture)) {
+      if (GST_MPEG2_PICTURE_IS_FIELD (picture))
+        priv->skipped_field = structure;
+      goto skip;
+    }
+
+    picture->system_frame_number = priv->current_frame->system_frame_number;
+    picture->needed_for_output = TRUE;
+    priv->frame_has_picture = TRUE;
+
+    if (klass->new_picture
+        && !klass->new_picture (self, priv->current_frame, picture)) {
+      GST_ERROR_OBJECT (self, "subclass cannot handle new picture");
+      goto error;
+    }
+
+    gst_mpeg2_dpb_get_neighbours (priv->dpb, picture, &prev_picture,
+        &next_picture);
+  }
+
+  GST_LOG_OBJECT (self, "Start picture %p (type %d, tsn %d, structure %d)",
+      picture, picture->type, picture->tsn, picture->structure);
+
+  if (klass->start_picture && !klass->start_picture (self, picture, slice,
+          prev_picture, next_picture)) {
+    GST_ERROR_OBJECT (self, "subclass cannot handle start picture");
+    goto error;
+  }
+
+  priv->current_picture = picture;
+
+  return TRUE;
+
+skip:
+  {
+    GST_DEBUG_OBJECT (self, "Skipping picture (type %d, tsn %d)",
+        picture->type, picture->tsn);
+    gst_mpeg2_picture_unref (picture);
+    priv->skip_picture = TRUE;
+    priv->frame_skipped = TRUE;
+    return TRUE;
+  }
+
+error:
+  {
+    gst_mpeg2_picture_unref (picture);
+    return FALSE;
+  }
+}
+
+static gboolean
+gst_mpeg2_decoder_handle_picture (GstMpeg2Decoder * self,
+    GstMpegVideoPacket * packet)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+
+  /* The previous picture of the buffer, a first field */
+  if (!gst_mpeg2_decoder_finish_current_picture (self))
+    return FALSE;
+
+  priv->skip_picture = FALSE;
+  priv->state &= ~(GST_MPEG2_DECODER_STATE_GOT_PIC_HDR |
+      GST_MPEG2_DECODER_STATE_GOT_PIC_EXT);
+
+  if (!gst_mpeg_video_packet_parse_picture_header (packet, &priv->pic_hdr)) {
+    GST_ERROR_OBJECT (self, "failed to parse picture header");
+    return FALSE;
+  }
+
+  priv->state |= GST_MPEG2_DECODER_STATE_GOT_PIC_HDR;
+
+  return TRUE;
+}
+
+/* MPEG-1 has no picture coding extension, use the values it implies */
+static void
+gst_mpeg2_decoder_set_default_picture_extension (GstMpeg2Decoder * self)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpegVideoPictureExt *pic_ext = &priv->pic_ext;
+
+  memset (pic_ext, 0, sizeof (GstMpegVideoPictureExt));
+  memcpy (pic_ext->f_code, priv->pic_hdr.f_code, sizeof (pic_ext->f_code));
+  pic_ext->picture_structure = GST_MPEG_VIDEO_PICTURE_STRUCTURE_FRAME;
+  pic_ext->frame_pred_frame_dct = 1;
+  pic_ext->progressive_frame = 1;
+}
+
+static gboolean
+gst_mpeg2_decoder_handle_slice (GstMpeg2Decoder * self,
+    GstMpegVideoPacket * packet)
+{
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstMpeg2DecoderClass *klass = GST_MPEG2_DECODER_GET_CLASS (self);
+  GstMpegVideoSequenceScalableExt *seq_scalable_ext = NULL;
+  GstMpeg2Slice slice;
+
+  if (priv->skip_picture)
+    return TRUE;
+
+  if (!(priv->state & GST_MPEG2_DECODER_STATE_GOT_SEQ_HDR) ||
+      !(priv->state & GST_MPEG2_DECODER_STATE_GOT_PIC_HDR)) {
+    GST_DEBUG_OBJECT (self, "Skipping slice without sequence or picture");
+    priv->skip_picture = TRUE;
+    priv->frame_skipped = TRUE;
+    return TRUE;
+  }
+
+  if (priv->state & GST_MPEG2_DECODER_STATE_GOT_SEQ_SCALABLE_EXT)
+    seq_scalable_ext = &priv->seq_scalable_ext;
+
+  if (!gst_mpeg_video_packet_parse_slice_header (packet, &slice.header,
+          &priv->seq_hdr, seq_scalable_ext)) {
+    GST_ERROR_OBJECT (self, "failed to parse slice header");
+    return FALSE;
+  }
+
+  slice.quant_matrix = &priv->quant_matrix;
+  slice.pic_hdr = &priv->pic_hdr;
+  slice.pic_ext = &priv->pic_ext;
+  slice.packet = *packet;
+  slice.sc_offset = packet->offset - 4;
+  slice.size = packet->size + 4;
+
+  if (!priv->current_picture) {
+    if (!(priv->state & GST_MPEG2_DECODER_STATE_GOT_PIC_EXT)) {
+      if (priv->state & GST_MPEG2_DECODER_STATE_GOT_SEQ_EXT) {
+        GST_ERROR_OBJECT (self, "Picture without picture coding extension");
+        return FALSE;
+      }
+      gst_mpeg2_decoder_set_default_picture_extension (self);
+      priv->state |= GST_MPEG2_DECODER_STATE_GOT_PIC_EXT;
+    }
+
+    if (!gst_mpeg2_decoder_start_current_picture (self, &slice))
+      return FALSE;
+
+    if (priv->skip_picture)
+      return TRUE;
+  }
+
+  if (!klass->decode_slice (self, priv->current_picture, &slice)) {
+    GST_ERROR_OBJECT (self, "subclass cannot decode slice");
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+static gboolean
+gst_mpeg2_decoder_decode_packet (GstMpeg2Decoder * self,
+    GstMpegVideoPacket * packet)
+{
+  GST_LOG_OBJECT (self, "Packet type 0x%02x, offset %u, size %d",
+      packet->type, packet->offset, packet->size);
+
+  if (GST_MPEG_VIDEO_PACKET_IS_SLICE (packet->type))
+    return gst_mpeg2_decoder_handle_slice (self, packet);
+
+  switch (packet->type) {
+    case GST_MPEG_VIDEO_PACKET_PICTURE:
+      return gst_mpeg2_decoder_handle_picture (self, packet);
+    case GST_MPEG_VIDEO_PACKET_SEQUENCE:
+      return gst_mpeg2_decoder_handle_sequence (self, packet);
+    case GST_MPEG_VIDEO_PACKET_EXTENSION:
+      return gst_mpeg2_decoder_handle_extension (self, packet);
+    case GST_MPEG_VIDEO_PACKET_GOP:
+      gst_mpeg2_decoder_handle_gop (self, packet);
+      break;
+    case GST_MPEG_VIDEO_PACKET_SEQUENCE_END:
+      return gst_mpeg2_decoder_finish_current_picture (self);
+    default:
+      break;
+  }
+
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_mpeg2_decoder_handle_frame (GstVideoDecoder * decoder,
+    GstVideoCodecFrame * frame)
+{
+  GstMpeg2Decoder *self = GST_MPEG2_DECODER (decoder);
+  GstMpeg2DecoderPrivate *priv = self->priv;
+  GstBuffer *in_buf = frame->input_buffer;
+  GstMpegVideoPacket packet;
+  GstMapInfo map;
+  guint offset = 0;
+  gboolean decode_ret = TRUE;
+
+  GST_LOG_OBJECT (self,
+      "handle frame, PTS: %" GST_TIME_FORMAT ", DTS: %"
+      GST_TIME_FORMAT, GST_TIME_ARGS (GST_BUFFER_PTS (in_buf)),
+      GST_TIME_ARGS (GST_BUFFER_DTS (in_buf)));
+
+  priv->current_frame = frame;
+  priv->last_ret = GST_FLOW_OK;
+  priv->frame_has_picture = FALSE;
+  priv->frame_skipped = FALSE;
+
+  if (!gst_buffer_map (in_buf, &map, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Cannot map buffer");
+    decode_ret = FALSE;
+    goto done;
+  }
+
+  while (decode_ret && gst_mpeg_video_parse (&packet, map.data, map.size,
+          offset)) {
+    /* The last packet of the buffer ends with it */
+    if (packet.size < 0)
+      packet.size = map.size - packet.offset;
+
+    decode_ret = gst_mpeg2_decoder_decode_packet (self, &packet);
+    offset = packet.offset + packet.size;
+  }
+
+  gst_buffer_unmap (in_buf, &map);
+
+  /* The last picture of a frame ends with it, unless it is a first field */
+  if (decode_ret)
+    decode_ret = gst_mpeg2_decoder_finish_current_picture (self);
+
+done:
+  if (!decode_ret) {
+    GST_VIDEO_DECODER_ERROR (self, 1, STREAM, DECODE,
+        ("Failed to decode data"), (NULL), priv->last_ret);
+    gst_video_decoder_drop_frame (decoder, frame);
+
+    gst_mpeg2_picture_clear (&priv->current_picture);
+    gst_mpeg2_picture_clear (&priv->first_field);
+    priv->current_frame = NULL;
+
+    return priv->last_ret;
+  }
+
+  if (priv->frame_has_picture) {
+    /* Output later, with its picture */
+    gst_video_codec_frame_unref (frame);
+  } else if (priv->frame_skipped) {
+    gst_video_decoder_drop_frame (decoder, frame);
+  } else {
+    /* Headers only, or the second field of the previous frame */
+    gst_video_decoder_release_frame (decoder, frame);
+  }
+
+  priv->current_frame = NULL;
+
+  return priv->last_ret;
+}
@@ -0,0 +1,258 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "gstmpeg2picture.h"
+
+GST_DEBUG_CATEGORY_EXTERN (gst_mpeg2_decoder_debug);
+#define GST_CAT_DEFAULT gst_mpeg2_decoder_debug
+
+GST_DEFINE_MINI_OBJECT_TYPE (GstMpeg2Picture, gst_mpeg2_picture);
+
+static void
+_gst_mpeg2_picture_free (GstMpeg2Picture * picture)
+{
+  GST_TRACE ("Free picture %p", picture);
+
+  gst_mpeg2_picture_clear (&picture->first_field);
+
+  if (picture->notify)
+    picture->notify (picture->user_data);
+
+  g_free (picture);
+}
+
+/**
+ * gst_mpeg2_picture_new:
+ *
+ * Create new #GstMpeg2Picture
+ *
+ * Returns: a new #GstMpeg2Picture
+ */
+GstMpeg2Picture *
+gst_mpeg2_picture_new (void)
+{
+  GstMpeg2Picture *pic;
+
+  pic = g_new0 (GstMpeg2Picture, 1);
+  pic->pts = GST_CLOCK_TIME_NONE;
+  pic->structure = GST_MPEG_VIDEO_PICTURE_STRUCTURE_FRAME;
+
+  gst_mini_object_init (GST_MINI_OBJECT_CAST (pic), 0,
+      GST_TYPE_MPEG2_PICTURE, NULL, NULL,
+      (GstMiniObjectFreeFunction) _gst_mpeg2_picture_free);
+
+  GST_TRACE ("New picture %p", pic);
+
+  return pic;
+}
+
+/**
+ * gst_mpeg2_picture_set_user_data:
+ * @picture: a #GstMpeg2Picture
+ * @user_data: private data
+ * @notify: (closure user_data): a #GDestroyNotify
+ *
+ * Sets @user_data on the picture and the #GDestroyNotify that will be called when
+ * the picture is freed.
+ *
+ * If a @user_data was previously set, then the previous set @notify will be called
+ * before the @user_data is replaced.
+ */
+void
+gst_mpeg2_picture_set_user_data (GstMpeg2Picture * picture, gpointer user_data,
+    GDestroyNotify notify)
+{
+  g_return_if_fail (GST_IS_MPEG2_PICTURE (picture));
+
+  if (picture->notify)
+    picture->notify (picture->user_data);
+
+  picture->user_data = user_data;
+  picture->notify = notify;
+}
+
+/**
+ * gst_mpeg2_picture_get_user_data:
+ * @picture: a #GstMpeg2Picture
+ *
+ * Gets private data set on the picture via
+ * gst_mpeg2_picture_set_user_data() previously.
+ *
+ * Returns: (transfer none): The previously set user_data
+ */
+gpointer
+gst_mpeg2_picture_get_user_data (GstMpeg2Picture * picture)
+{
+  return picture->user_data;
+}
+
+/**
+ * gst_mpeg2_dpb_new: (skip)
+ *
+ * Create new #GstMpeg2Dpb
+ *
+ * Returns: a new #GstMpeg2Dpb
+ */
+GstMpeg2Dpb *
+gst_mpeg2_dpb_new (void)
+{
+  return g_new0 (GstMpeg2Dpb, 1);
+}
+
+/**
+ * gst_mpeg2_dpb_free:
+ * @dpb: a #GstMpeg2Dpb to free
+ *
+ * Free the @dpb
+ */
+void
+gst_mpeg2_dpb_free (GstMpeg2Dpb * dpb)
+{
+  g_return_if_fail (dpb != NULL);
+
+  gst_mpeg2_dpb_clear (dpb);
+  g_free (dpb);
+}
+
+/**
+ * gst_mpeg2_dpb_clear:
+ * @dpb: a #GstMpeg2Dpb
+ *
+ * Clear all stored #GstMpeg2Picture
+ */
+void
+gst_mpeg2_dpb_clear (GstMpeg2Dpb * dpb)
+{
+  g_return_if_fail (dpb != NULL);
+
+  gst_mpeg2_picture_clear (&dpb->ref_pic_list[0]);
+  gst_mpeg2_picture_clear (&dpb->ref_pic_list[1]);
+  dpb->num_ref_pictures = 0;
+  gst_mpeg2_picture_clear (&dpb->new_pic);
+}
+
+/**
+ * gst_mpeg2_dpb_add:
+ * @dpb: a #GstMpeg2Dpb
+ * @picture: (transfer full): a decoded #GstMpeg2Picture
+ *
+ * Store the @picture. An anchor picture replaces the older of the two
+ * stored anchor pictures, a B picture is kept until it is bumped.
+ */
+void
+gst_mpeg2_dpb_add (GstMpeg2Dpb * dpb, GstMpeg2Picture * picture)
+{
+  g_return_if_fail (dpb != NULL);
+  g_return_if_fail (GST_IS_MPEG2_PICTURE (picture));
+
+  if (!GST_MPEG2_PICTURE_IS_REF (picture)) {
+    g_warn_if_fail (dpb->new_pic == NULL);
+    gst_mpeg2_picture_clear (&dpb->new_pic);
+    dpb->new_pic = picture;
+    return;
+  }
+
+  if (dpb->num_ref_pictures == 2) {
+    /* Output by the latest when the newer anchor was added */
+    g_warn_if_fail (!dpb->ref_pic_list[0]->needed_for_output);
+    gst_mpeg2_picture_unref (dpb->ref_pic_list[0]);
+    dpb->num_ref_pictures--;
+  }
+
+  dpb->ref_pic_list[0] = dpb->ref_pic_list[1];
+  dpb->ref_pic_list[1] = picture;
+  dpb->num_ref_pictures++;
+}
+
+/**
+ * gst_mpeg2_dpb_bump:
+ * @dpb: a #GstMpeg2Dpb
+ * @drain: whether to also return the newest anchor picture
+ *
+ * Returns the next picture to output in display order. Call it until it
+ * returns %NULL after each gst_mpeg2_dpb_add(). When @drain is %TRUE, the
+ * newest anchor picture is returned too, which is otherwise kept until the
+ * next one is added: at the end of the stream, or when the sequence has no
+ * B pictures.
+ *
+ * Returns: (transfer full) (nullable): a #GstMpeg2Picture to output
+ */
+GstMpeg2Picture *
+gst_mpeg2_dpb_bump (GstMpeg2Dpb * dpb, gboolean drain)
+{
+  GstMpeg2Picture *picture = NULL;
+  guint i;
+
+  g_return_val_if_fail (dpb != NULL, NULL);
+
+  if (dpb->new_pic) {
+    picture = dpb->new_pic;
+    dpb->new_pic = NULL;
+  } else {
+    for (i = 0; i < (drain ? 2 : 1); i++) {
+      GstMpeg2Picture *ref = dpb->ref_pic_list[i];
+
+      if (ref && ref->needed_for_output) {
+        picture = gst_mpeg2_picture_ref (ref);
+        break;
+      }
+    }
+  }
+
+  if (picture)
+    picture->needed_for_output = FALSE;
+
+  return picture;
+}
+
+/**
+ * gst_mpeg2_dpb_get_neighbours:
+ * @dpb: a #GstMpeg2Dpb
+ * @picture: the #GstMpeg2Picture about to be decoded
+ * @prev_picture: (out) (transfer none) (nullable): the forward reference
+ * @next_picture: (out) (transfer none) (nullable): the backward reference
+ *
+ * Gets the anchor pictures @picture is predicted from: the newest one for
+ * a P picture, both for a B picture.
+ */
+void
+gst_mpeg2_dpb_get_neighbours (GstMpeg2Dpb * dpb, GstMpeg2Picture * picture,
+    GstMpeg2Picture ** prev_picture, GstMpeg2Picture ** next_picture)
+{
+  g_return_if_fail (dpb != NULL);
+  g_return_if_fail (picture != NULL);
+
+  *prev_picture = NULL;
+  *next_picture = NULL;
+
+  switch (picture->type) {
+    case GST_MPEG_VIDEO_PICTURE_TYPE_P:
+      *prev_picture = dpb->ref_pic_list[1];
+      break;
+    case GST_MPEG_VIDEO_PICTURE_TYPE_B:
+      *prev_picture = dpb->ref_pic_list[0];
+      *next_picture = dpb->ref_pic_list[1];
+      break;
+    default:
+      break;
+  }
+}
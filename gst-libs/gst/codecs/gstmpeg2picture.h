@@ -0,0 +1,206 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_MPEG2_PICTURE_H__
+#define __GST_MPEG2_PICTURE_H__
+
+#include <gst/codecs/codecs-prelude.h>
+#include <gst/codecparsers/gstmpegvideoparser.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_MPEG2_PICTURE     (gst_mpeg2_picture_get_type())
+#define GST_IS_MPEG2_PICTURE(obj)  (GST_IS_MINI_OBJECT_TYPE(obj, GST_TYPE_MPEG2_PICTURE))
+#define GST_MPEG2_PICTURE(obj)     ((GstMpeg2Picture *)obj)
+#define GST_MPEG2_PICTURE_CAST(obj) (GST_MPEG2_PICTURE(obj))
+
+typedef struct _GstMpeg2Slice GstMpeg2Slice;
+typedef struct _GstMpeg2Picture GstMpeg2Picture;
+
+/**
+ * GstMpeg2Slice:
+ * @quant_matrix: the quantization matrices in use, in zigzag scan order
+ * @pic_hdr: the picture header of the slice
+ * @pic_ext: the picture coding extension of the slice
+ * @header: the parsed slice header
+ * @packet: the slice packet, without the start code
+ * @sc_offset: offset of the slice start code in the data of @packet
+ * @size: size of the slice, including its start code
+ *
+ * A slice and the headers it depends on. The pointers and data are only
+ * valid during the call the slice is passed to.
+ */
+struct _GstMpeg2Slice
+{
+  const GstMpegVideoQuantMatrixExt *quant_matrix;
+  const GstMpegVideoPictureHdr *pic_hdr;
+  const GstMpegVideoPictureExt *pic_ext;
+
+  GstMpegVideoSliceHdr header;
+
+  /* parsed packet (doesn't take ownership of raw data) */
+  GstMpegVideoPacket packet;
+  guint sc_offset;
+  guint size;
+};
+
+/**
+ * GstMpeg2Picture:
+ * @system_frame_number: the system_frame_number of the #GstVideoCodecFrame
+ *   the picture is output with
+ * @type: the picture coding type
+ * @structure: whether the picture is a frame, or a top or bottom field
+ * @tsn: the temporal sequence number (temporal_reference)
+ * @first_field: for the second field of a field pair, the first field
+ * @needed_for_output: %TRUE until the picture has been output
+ *
+ * A picture being decoded. A frame coded as two field pictures has one
+ * #GstMpeg2Picture per field, the first field one stands for the frame once
+ * both fields are decoded.
+ */
+struct _GstMpeg2Picture
+{
+  GstMiniObject parent;
+
+  GstClockTime pts;
+  /* From GstVideoCodecFrame */
+  guint32 system_frame_number;
+
+  GstMpegVideoPictureType type;
+  GstMpegVideoPictureStructure structure;
+  guint16 tsn;
+
+  GstMpeg2Picture *first_field;
+
+  gboolean needed_for_output;
+
+  gpointer user_data;
+  GDestroyNotify notify;
+};
+
+/**
+ * GST_MPEG2_PICTURE_IS_REF:
+ * @picture: a #GstMpeg2Picture
+ *
+ * Whether @picture is an anchor picture, which later pictures are predicted
+ * from
+ */
+#define GST_MPEG2_PICTURE_IS_REF(picture) \
+  ((picture)->type == GST_MPEG_VIDEO_PICTURE_TYPE_I || \
+   (picture)->type == GST_MPEG_VIDEO_PICTURE_TYPE_P)
+
+/**
+ * GST_MPEG2_PICTURE_IS_FIELD:
+ * @picture: a #GstMpeg2Picture
+ *
+ * Whether @picture is a field picture
+ */
+#define GST_MPEG2_PICTURE_IS_FIELD(picture) \
+  ((picture)->structure != GST_MPEG_VIDEO_PICTURE_STRUCTURE_FRAME)
+
+GST_CODECS_API
+GType gst_mpeg2_picture_get_type (void);
+
+GST_CODECS_API
+GstMpeg2Picture * gst_mpeg2_picture_new (void);
+
+static inline GstMpeg2Picture *
+gst_mpeg2_picture_ref (GstMpeg2Picture * picture)
+{
+  return (GstMpeg2Picture *) gst_mini_object_ref (GST_MINI_OBJECT_CAST (picture));
+}
+
+static inline void
+gst_mpeg2_picture_unref (GstMpeg2Picture * picture)
+{
+  gst_mini_object_unref (GST_MINI_OBJECT_CAST (picture));
+}
+
+static inline gboolean
+gst_mpeg2_picture_replace (GstMpeg2Picture ** old_picture,
+    GstMpeg2Picture * new_picture)
+{
+  return gst_mini_object_replace ((GstMiniObject **) old_picture,
+      (GstMiniObject *) new_picture);
+}
+
+static inline void
+gst_mpeg2_picture_clear (GstMpeg2Picture ** picture)
+{
+  if (picture && *picture) {
+    gst_mpeg2_picture_unref (*picture);
+    *picture = NULL;
+  }
+}
+
+GST_CODECS_API
+void gst_mpeg2_picture_set_user_data (GstMpeg2Picture * picture,
+                                      gpointer user_data,
+                                      GDestroyNotify notify);
+
+GST_CODECS_API
+gpointer gst_mpeg2_picture_get_user_data (GstMpeg2Picture * picture);
+
+/*******************
+ * GstMpeg2Dpb *
+ *******************/
+typedef struct _GstMpeg2Dpb GstMpeg2Dpb;
+
+/**
+ * GstMpeg2Dpb:
+ *
+ * The two anchor pictures MPEG-2 predicts from, and the B picture which
+ * was decoded last until it is output. Anchor pictures are output when the
+ * next anchor picture is added, B pictures right away.
+ */
+struct _GstMpeg2Dpb
+{
+  /*< private >*/
+  /* [0] is the older anchor, [1] the newer one */
+  GstMpeg2Picture *ref_pic_list[2];
+  guint num_ref_pictures;
+
+  GstMpeg2Picture *new_pic;
+};
+
+GST_CODECS_API
+GstMpeg2Dpb * gst_mpeg2_dpb_new (void);
+
+GST_CODECS_API
+void  gst_mpeg2_dpb_free             (GstMpeg2Dpb * dpb);
+
+GST_CODECS_API
+void  gst_mpeg2_dpb_clear            (GstMpeg2Dpb * dpb);
+
+GST_CODECS_API
+void  gst_mpeg2_dpb_add              (GstMpeg2Dpb * dpb,
+                                      GstMpeg2Picture * picture);
+
+GST_CODECS_API
+GstMpeg2Picture * gst_mpeg2_dpb_bump (GstMpeg2Dpb * dpb,
+                                      gboolean drain);
+
+GST_CODECS_API
+void  gst_mpeg2_dpb_get_neighbours   (GstMpeg2Dpb * dpb,
+                                      GstMpeg2Picture * picture,
+                                      GstMpeg2Picture ** prev_picture,
+                                      GstMpeg2Picture ** next_picture);
+
+G_END_DECLS
+
+#endif /* __GST_MPEG2_PICTURE_H__ */
@@ -1,7 +1,13 @@
-#include <glib.h>
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
 
-/* exported function */
-gchar *aribstr_to_utf8 (const gchar * text, guint length);
+#include <string.h>
+
+#include "mpegts.h"
+#include "gstmpegts-private.h"
+
+#include "arib_b24_tables.h"
 
 #define CODE_ASCII ('\x40')
 #define CODE_JISX0208_1978 ('\x40')
@@ -15,6 +21,9 @@ gchar *aribstr_to_utf8 (const gchar * text, guint length);
 #define CODE_X_KATA ('\x31')
 #define CODE_X_KATA_P ('\x38')
 
+/* Strings shorter than this are converted on the stack */
+#define STACK_BUFFER_SIZE 1024
+
 struct code_state
 {
   int gl;                       /* index of the group invoked to GL */
@@ -27,147 +36,303 @@ struct code_state
   } g[4];
 };
 
-static const gchar trans_hira[] = {
-  '\xB5', '\xB6', '\xBC', '\xA3', '\xD6', '\xD7', '\xA2', '\xA6'
+/* Cells of row 1 for the last characters of the hiragana and katakana sets */
+static const guint8 trans_hira[] = {
+  0x35, 0x36, 0x3C, 0x23, 0x56, 0x57, 0x22, 0x26
 };
 
-static const gchar *trans_kata = trans_hira;
+static const guint8 *trans_kata = trans_hira;
 
+/* The additional symbols, in UTF-8 */
 static const gchar *trans_ext90[] = {
   /* 45-49 */
   "10.", "11.", "12.", "[HV]", "[SD]",
   /* 50-54 */
-  "[P]", "[W]", "[MV]", "[\xBC\xEA]", "[\xBB\xFA]",
+  "[P]", "[W]", "[MV]", "[\xE6\x89\x8B]", "[\xE5\xAD\x97]",
   /* 55-59 */
-  "[\xC1\xD0]", "[\xA5\xC7]", "[S]", "[\xC6\xF3]", "[\xC2\xBF]",
+  "[\xE5\x8F\x8C]", "[\xE3\x83\x87]", "[S]", "[\xE4\xBA\x8C]", "[\xE5\xA4\x9A]",
   /* 60-64 */
-  "[\xB2\xF2]", "[SS]", "[B]", "[N]", "\xA2\xA3",
+  "[\xE8\xA7\xA3]", "[SS]", "[B]", "[N]", "\xE2\x96\xA0",
   /* 65-69 */
-  "\xA1\xFC", "[\xC5\xB7]", "[\xB8\xF2]", "[\xB1\xC7]", "[\xCC\xB5]",
+  "\xE2\x97\x8F", "[\xE5\xA4\xA9]", "[\xE4\xBA\xA4]", "[\xE6\x98\xA0]",
+  "[\xE7\x84\xA1]",
   /* 70-74 */
-  "[\xCE\xC1]", ".", "[\xC1\xB0]", "[\xB8\xE5]", "[\xBA\xC6]",
+  "[\xE6\x96\x99]", ".", "[\xE5\x89\x8D]", "[\xE5\xBE\x8C]", "[\xE5\x86\x8D]",
   /* 75-79 */
-  "[\xBF\xB7]", "[\xBD\xE9]", "[\xBD\xAA]", "[\xC0\xB8]", "[\xC8\xCE]",
+  "[\xE6\x96\xB0]", "[\xE5\x88\x9D]", "[\xE7\xB5\x82]", "[\xE7\x94\x9F]",
+  "[\xE8\xB2\xA9]",
   /* 80-84 */
-  "[\xC0\xBC]", "[\xBF\xE1]", "[PPV]", "(\xC8\xEB)", "\xC2\xBE",
+  "[\xE5\xA3\xB0]", "[\xE5\x90\xB9]", "[PPV]", "(\xE7\xA7\x98)", "\xE4\xBB\x96",
   /* 85-94 */
   ".", ".", ".", ".", ".", ".", ".", ".", ".", "."
 };
 
 static const gchar *trans_ext92[][94] = {
   {                             /* row 92 */
-        "\xA2\xAA", "\xA2\xAB", "\xA2\xAC", "\xA2\xAD", "\xA6\xBB",
-        "\xA6\xBC", "\xC7\xAF", "\xB7\xEE", "\xC6\xFC", "\xB1\xDF",
-        "\xAD\xD6", "m^3", "\xAD\xD1", "\xAD\xD1^2", "\xAD\xD1^3",
-        "\xA3\xB0.", "\xA3\xB1.", "\xA3\xB2.", "\xA3\xB3.", "\xA3\xB4.",
-        "\xA3\xB5.", "\xA3\xB6.", "\xA3\xB7.", "\xA3\xB8.", "\xA3\xB9.",
-        "\xBB\xE1", "\xC9\xFB", "\xB8\xB5", "\xB8\xCE", "\xC1\xB0",
-        "\xBF\xB7", "\xA3\xB0,", "\xA3\xB1,", "\xA3\xB2,", "\xA3\xB3,",
-        "\xA3\xB4,", "\xA3\xB5,", "\xA3\xB6,", "\xA3\xB7,", "\xA3\xB8,",
-        "\xA3\xB9,", "[\xBC\xD2]", "[\xBA\xE2]", "\xAD\xEB", "\xAD\xEA",
-        "\xAD\xEC", "(\xCC\xE4)", "\xA3\xA2", "\xA3\xA4", "\xA2\xDA",
-        "\xA2\xDB", "\xAD\xFD", "^2", "^3", "(CD)",
-        "(vn)", "(ob)", "(cb)", "(ce", "mb)",
-        "(hp)", "(br)", "(p)", "(s)", "(ms)",
-        "(t)", "(bs)", "(b)", "(tb)", "(tp)",
-        "(ds)", "(ag)", "(eg)", "(vo)", "(fl)",
-        "(ke", "y)", "(sa", "x)", "(sy",
-        "n)", "(or", "g)", "(pe", "r)",
-        "(R)", "(C)", "(\xE4\xB7)", "DJ", "[\xB1\xE9]",
+        "\xE2\x86\x92", "\xE2\x86\x90", "\xE2\x86\x91", "\xE2\x86\x93",
+        "\xE2\x99\xA2", "\xE2\x99\xA6", "\xE5\xB9\xB4", "\xE6\x9C\x88",
+        "\xE6\x97\xA5", "\xE5\x86\x86", "\xE3\x8E\xA1", "m^3", "\xE3\x8E\x9D",
+        "\xE3\x8E\x9D^2", "\xE3\x8E\x9D^3", "\xEF\xBC\x90.", "\xEF\xBC\x91.",
+        "\xEF\xBC\x92.", "\xEF\xBC\x93.", "\xEF\xBC\x94.", "\xEF\xBC\x95.",
+        "\xEF\xBC\x96.", "\xEF\xBC\x97.", "\xEF\xBC\x98.", "\xEF\xBC\x99.",
+        "\xE6\xB0\x8F", "\xE5\x89\xAF", "\xE5\x85\x83", "\xE6\x95\x85",
+        "\xE5\x89\x8D", "\xE6\x96\xB0", "\xEF\xBC\x90,", "\xEF\xBC\x91,",
+        "\xEF\xBC\x92,", "\xEF\xBC\x93,", "\xEF\xBC\x94,", "\xEF\xBC\x95,",
+        "\xEF\xBC\x96,", "\xEF\xBC\x97,", "\xEF\xBC\x98,", "\xEF\xBC\x99,",
+        "[\xE7\xA4\xBE]", "[\xE8\xB2\xA1]", "\xE3\x88\xB2", "\xE3\x88\xB1",
+        "\xE3\x88\xB9", "(\xE5\x95\x8F)", "\xE2\x96\xB6", "\xE2\x97\x80",
+        "\xE3\x80\x96", "\xE3\x80\x97", "\xE2\x9D\x96", "^2", "^3", "(CD)",
+        "(vn)", "(ob)", "(cb)", "(ce", "mb)", "(hp)", "(br)", "(p)", "(s)",
+        "(ms)", "(t)", "(bs)", "(b)", "(tb)", "(tp)", "(ds)", "(ag)", "(eg)",
+        "(vo)", "(fl)", "(ke", "y)", "(sa", "x)", "(sy", "n)", "(or", "g)",
+        "(pe", "r)", "(R)", "(C)", "(\xE7\xAE\x8F)", "DJ", "[\xE6\xBC\x94]",
       "Fax", ".", ".", "."},
   {                             /* row 93 */
-        "(\xB7\xEE)", "(\xB2\xD0)", "(\xBF\xE5)", "(\xCC\xDA)", "(\xB6\xE2)",
-        "(\xC5\xDA)", "(\xC6\xFC)", "(\xBD\xCB)", "\xAD\xED", "\xAD\xEE",
-        "\xAD\xEF", "\xAD\xDF", "\xAD\xE2", "\xAD\xE4", "\xA2\xA9",
-        "\xA2\xD3", "[\xCB\xDC]", "[\xBB\xB0]", "[\xC6\xF3]", "[\xB0\xC2]",
-        "[\xC5\xC0]", "[\xC2\xC7]", "[\xC5\xF0]", "[\xBE\xA1]", "[\xC7\xD4]",
-        "[S]", "[\xC5\xEA]", "[\xCA\xE1]", "[\xB0\xEC]", "[\xC6\xF3]",
-        "[\xBB\xB0]", "[\xCD\xB7]", "[\xBA\xB8]", "[\xC3\xE6]", "[\xB1\xA6]",
-        "[\xBB\xD8]", "[\xC1\xF6]", "[\xC2\xC7]", "\xA3\xDF", "\xAD\xD4",
-        "Hz", "ha", "\xAD\xD2", "\xAD\xD2^2", "hPa",
-        ".", ".", "\xA9\xB4", "0/3", "\xA7\xF8",
-        "\xA7\xF9", "\xA9\xB3", "\xA9\xB5", "\xA7\xFA", "2/5",
-        "3/5", "4/5", "1/6", "5/6", "1/7",
-        "1/8", "1/9", "1/10", "\xA6\xE8", "\xA6\xE9",
-        "\xA6\xEA", "\xA6\xEB", "\xA6\xE4", "\xA6\xE5", "\xA6\xE4",
-        "\xA6\xE5", "\xA6\xBC", "\xA6\xBE", "\xA6\xC0", "\xA6\xBA",
-        ".", "\xA3\xBA", "\xA8\xEB", "\xA8\xEE", ".",
+        "(\xE6\x9C\x88)", "(\xE7\x81\xAB)", "(\xE6\xB0\xB4)", "(\xE6\x9C\xA8)",
+        "(\xE9\x87\x91)", "(\xE5\x9C\x9F)", "(\xE6\x97\xA5)", "(\xE7\xA5\x9D)",
+        "\xE3\x8D\xBE", "\xE3\x8D\xBD", "\xE3\x8D\xBC", "\xE3\x8D\xBB",
+        "\xE2\x84\x96", "\xE2\x84\xA1", "\xE3\x80\x92", "\xE2\x8A\x97",
+        "[\xE6\x9C\xAC]", "[\xE4\xB8\x89]", "[\xE4\xBA\x8C]", "[\xE5\xAE\x89]",
+        "[\xE7\x82\xB9]", "[\xE6\x89\x93]", "[\xE7\x9B\x97]", "[\xE5\x8B\x9D]",
+        "[\xE6\x95\x97]", "[S]", "[\xE6\x8A\x95]", "[\xE6\x8D\x95]",
+        "[\xE4\xB8\x80]", "[\xE4\xBA\x8C]", "[\xE4\xB8\x89]", "[\xE9\x81\x8A]",
+        "[\xE5\xB7\xA6]", "[\xE4\xB8\xAD]", "[\xE5\x8F\xB3]", "[\xE6\x8C\x87]",
+        "[\xE8\xB5\xB0]", "[\xE6\x89\x93]", "\xE2\x84\x93", "\xE3\x8E\x8F",
+        "Hz", "ha", "\xE3\x8E\x9E", "\xE3\x8E\x9E^2", "hPa", ".", ".",
+        "\xC2\xBD", "0/3", "\xE2\x85\x93", "\xE2\x85\x94", "\xC2\xBC",
+        "\xC2\xBE", "\xE2\x85\x95", "2/5", "3/5", "4/5", "1/6", "5/6", "1/7",
+        "1/8", "1/9", "1/10", "\xE2\x98\x80", "\xE2\x98\x81", "\xE2\x98\x82",
+        "\xE2\x98\x83", "\xE2\x98\x96", "\xE2\x98\x97", "\xE2\x98\x96",
+        "\xE2\x98\x97", "\xE2\x99\xA6", "\xE2\x99\xA5", "\xE2\x99\xA3",
+        "\xE2\x99\xA0", ".", "\xE2\xA6\xBF", "\xE2\x80\xBC", "\xE2\x81\x89",
+        ".",
         /* 81-90 */
-        ".", ".", ".", ".", ".", ".", ".", ".", ".", "\xA2\xFC",
-      "\xA6\xE7", ".", ".", "."},
+        ".", ".", ".", ".", ".", ".", ".", ".", ".", "\xE2\x99\xAC",
+      "\xE2\x98\x8E", ".", ".", "."},
   {                             /* row 94 */
-        "\xAD\xB5", "\xAD\xB6", "\xAD\xB7", "\xAD\xB8", "\xAD\xB9",
-        "\xAD\xBA", "\xAD\xBB", "\xAD\xBC", "\xAD\xBD", "\xAD\xBE",
-        "\xAD\xBF", "\xAD\xD7", "\xAD\xB1", "\xAD\xB2", "\xAD\xB3",
-        "\xAD\xB4", "(1)", "(2)", "(3)", "(4)",
-        "(5)", "(6)", "(7)", "(8)", "(9)",
-        "(10)", "(11)", "(12)", "\xA8\xC1", "\xA8\xC2",
-        "\xA8\xC3", "\xA8\xC4", "(A)", "(B)", "(C)",
-        "(D)", "(E)", "(F)", "(G)", "(H)",
-        "(I)", "(J)", "(K)", "(L)", "(M)",
-        "(N)", "(O)", "(P)", "(Q)", "(R)",
-        "(S)", "(T)", "(U)", "(V)", "(W)",
-        "(X)", "(Y)", "(Z)", "\xA8\xC5", "\xA8\xC6",
-        "\xA8\xC7", "\xA8\xC8", "\xA8\xC9", "\xA8\xCA", "\xAD\xA1",
-        "\xAD\xA2", "\xAD\xA3", "\xAD\xA4", "\xAD\xA5", "\xAD\xA6",
-        "\xAD\xA7", "\xAD\xA8", "\xAD\xA9", "\xAD\xAA", "\xAD\xAB",
-        "\xAD\xAC", "\xAD\xAD", "\xAD\xAE", "\xAD\xAF", "\xAD\xB0",
-        "\xAC\xA1", "\xAC\xA2", "\xAC\xA3", "\xAC\xA4", "\xAC\xA5",
-        "\xAC\xA6", "\xAC\xA7", "\xAC\xA8", "\xAC\xA9", "\xAC\xAA",
-      "\xAC\xAB", "\xAC\xAC", "\xA8\xCB", "."}
+        "\xE2\x85\xA0", "\xE2\x85\xA1", "\xE2\x85\xA2", "\xE2\x85\xA3",
+        "\xE2\x85\xA4", "\xE2\x85\xA5", "\xE2\x85\xA6", "\xE2\x85\xA7",
+        "\xE2\x85\xA8", "\xE2\x85\xA9", "\xE2\x85\xAA", "\xE2\x85\xAB",
+        "\xE2\x91\xB0", "\xE2\x91\xB1", "\xE2\x91\xB2", "\xE2\x91\xB3", "(1)",
+        "(2)", "(3)", "(4)", "(5)", "(6)", "(7)", "(8)", "(9)", "(10)", "(11)",
+        "(12)", "\xE3\x89\x91", "\xE3\x89\x92", "\xE3\x89\x93", "\xE3\x89\x94",
+        "(A)", "(B)", "(C)", "(D)", "(E)", "(F)", "(G)", "(H)", "(I)", "(J)",
+        "(K)", "(L)", "(M)", "(N)", "(O)", "(P)", "(Q)", "(R)", "(S)", "(T)",
+        "(U)", "(V)", "(W)", "(X)", "(Y)", "(Z)", "\xE3\x89\x95",
+        "\xE3\x89\x96", "\xE3\x89\x97", "\xE3\x89\x98", "\xE3\x89\x99",
+        "\xE3\x89\x9A", "\xE2\x91\xA0", "\xE2\x91\xA1", "\xE2\x91\xA2",
+        "\xE2\x91\xA3", "\xE2\x91\xA4", "\xE2\x91\xA5", "\xE2\x91\xA6",
+        "\xE2\x91\xA7", "\xE2\x91\xA8", "\xE2\x91\xA9", "\xE2\x91\xAA",
+        "\xE2\x91\xAB", "\xE2\x91\xAC", "\xE2\x91\xAD", "\xE2\x91\xAE",
+        "\xE2\x91\xAF", "\xE2\x9D\xB6", "\xE2\x9D\xB7", "\xE2\x9D\xB8",
+        "\xE2\x9D\xB9", "\xE2\x9D\xBA", "\xE2\x9D\xBB", "\xE2\x9D\xBC",
+        "\xE2\x9D\xBD", "\xE2\x9D\xBE", "\xE2\x9D\xBF",
+      "\xE2\x93\xAB", "\xE2\x93\xAC", "\xE3\x89\x9B", "."}
 };
 
 static const gchar *trans_ext85[] = {
   /*   1- 10 */
-  "\xAE\xA3", "\xC4\xE2", "\xAE\xA9", "\xAE\xAA", "\x8F\xA1\xCE",
-  "\xAE\xB9", "\x8F\xA1\xEC", "\xAE\xCD", "\x8F\xA3\xB0", "\x8F\xA3\xC8",
+  "\xE3\x90\x82", "\xE4\xBA\xAD", "\xE4\xBB\xBD", "\xE4\xBB\xBF",
+  "\xE4\xBE\x9A", "\xE4\xBF\x89", "\xE5\x82\x95", "\xE5\x84\x9E",
+  "\xE5\x86\xBC", "\xE3\x94\x9F",
   /*  11- 20 */
-  "\xAE\xEC", "\xAE\xEF", "\x8F\xA3\xD5", "\xFC\xA8", "\xB5\xC8",
-  "\xAE\xF7", "\xAE\xFD", "\xAE\xF8", "\xAF\xA1", "\xAF\xA4",
+  "\xE5\x8C\x87", "\xE5\x8D\xA1", "\xE5\x8D\xAC", "\xE8\xA9\xB9",
+  "\xE5\x90\x89", "\xE5\x91\x8D", "\xE5\x92\x96", "\xE5\x92\x9C",
+  "\xE5\x92\xA9", "\xE5\x94\x8E",
   /*  21- 30 */
-  "\x8F\xA2\xA5", "\xAF\xB9", "\xA2\xA2", "\xAF\xC5", "\xAF\xC6",
-  "\xAF\xD7", "\xBA\xD4", "\x8F\xA5\xD2", "\xAF\xF2", "\x8F\xA5\xDD",
+  ".", "\xE5\x99\xB2", "\xE2\x96\xA1", "\xE5\x9C\xB3", "\xE5\x9C\xB4",
+  "\xEF\xA8\x90", "\xE7\x8A\x80", "\xE5\xA7\xA4", "\xE5\xA8\xA3",
+  "\xE5\xA9\x95",
   /*  31- 40 */
-  "\xCF\xDA", "\xCF\xF2", "\xCF\xEF", "\x8F\xAC\xA5", "\xF4\xB6",
-  "\xF4\xBA", "\xF4\xC5", "\x8F\xAC\xC7", "\xB7\xC3", "\xF4\xDA",
+  "\xE5\xAF\xAC", "\xEF\xA8\x91", "\xE3\x9F\xA2", "\xE5\xBA\xAC",
+  "\xE5\xBC\xB4", "\xE5\xBD\x85", "\xE5\xBE\xB7", "\xE6\x80\x97",
+  "\xE6\x81\xB5", "\xE6\x84\xB0",
   /*  41- 40 */
-  "\xF5\xB2", "\xF5\xC8", "\xBD\xEC", "\xF5\xCC", "\xF5\xB7",
-  "\xDB\xD9", "\xCE\xC2", "\xD0\xEC", "\x8F\xAF\xAB", "\xF6\xAC",
+  "\xE6\x98\xA4", "\xE6\x9B\x88", "\xE6\x9B\x99", "\xE6\x9B\xBA",
+  "\xE6\x9B\xBB", "\xE6\xA0\x9E", "\xE6\xA2\x81", "\xE4\xBF\xBE",
+  "\xE6\xA4\xBB", "\xE6\xA9\x85",
   /*  51- 50 */
-  "\x8F\xAF\xDE", "\xB6\xFB", "\xDB\xB9", "\xC8\xB2", "\xF5\xF2",
-  "\x8F\xEE\xAD", "\xF6\xDB", "\xF6\xE3", "\xF6\xE9", "\xF6\xF0",
+  "\xE6\xAA\x91", "\xE6\xAB\x9B", "\xE6\x9D\x9E", "\xE4\xBC\x90",
+  "\xF0\xA3\x97\x84", "\xE6\xAF\xB1", "\xE6\xB3\x86", "\xE6\xB4\xAE",
+  "\xEF\xA9\x85", "\xE6\xB6\xBF",
   /*  61- 70 */
-  "\xF1\xB2", "\xC0\xB6", "\xF6\xF7", "\xF7\xAB", "\xF7\xB9",
-  "\xF7\xC3", "\xDF\xE6", "\xDF\xE6", "\xF7\xD3", "\xF7\xDE",
+  "\xE9\xA4\xA1", "\xE6\xB8\x85", "\xEF\xA9\x86", "\xE6\xBD\x9E",
+  "\xE6\xBF\xB9", "\xE7\x81\xA4", "\xE7\x85\x95", "\xE7\x85\x95",
+  "\xE7\x85\x87", "\xE7\x87\x81",
   /*  71- 80 */
-  "\xF7\xE2", "\xF7\xF4", "\x8F\xF0\xE0", "\xF7\xF9", "\xF7\xFB",
-  "\xF8\xA4", "\xBD\xCA", "\xF8\xA5", "\xF8\xA6", "\xF8\xA8",
+  "\xE7\x88\x80", "\xE7\x8E\x9F", "\xE7\x8E\xA8", "\xE7\x8F\x89",
+  "\xE7\x8F\x96", "\xE7\x90\x9B", "\xE6\xB7\x91", "\xEF\xA9\x8A",
+  "\xE7\x90\xA6", "\xE7\x90\xAA",
   /*  81- 90 */
-  "\xF8\xAA", "\x8F\xF0\xF0", "\xF8\xB1", "\xBB\xB9", "\xBD\xF1",
-  "\x8F\xF1\xC3", "\x8F\xF2\xA9", "\x8F\xF2\xB9", "\x8F\xF2\xC0",
-  "\x8F\xF2\xC4",
+  "\xE7\x90\xAC", "\xE7\x90\xB9", "\xE7\x91\x8B", "\xE7\x8F\x8A",
+  "\xE6\x9B\xB8", "\xE7\x96\x81", "\xE7\x9D\xB2", "\xE4\x82\x93",
+  "\xE7\xA0\x89", "\xE7\xA0\xAC",
   /*  91-100 */
-  "\xB5\xC0", "\xE3\xB9", "\xE3\xB1", "\xEA\xD6", "\xEB\xA1",
-  "\xEA\xDB", "\x8F\xF2\xFC", "\x8F\xF3\xC9", "\xF9\xE8", "\xF9\xED",
+  "\xE7\xA5\x87", "\xE7\xA6\xAE", "\xE7\xA5\x93", "\xE8\xA2\x82",
+  "\xE8\xA5\xA6", "\xE8\xA2\xA2", "\xE7\xA8\x9E", "\xE7\xAD\xBF",
+  "\xE7\xB0\xB1", "\xE4\x89\xA4",
   /* 101-110 */
-  "\xFA\xA7", "\xC1\xA2", "\xFA\xCE", "\xD0\xE6", "\xB4\xDC",
-  "\xFA\xE3", "\xB3\xEB", "\x8F\xF6\xD5", "\xCB\xA9", "\xFB\xB8",
+  "\xE7\xB6\x8B", "\xE7\xBE\xA8", "\xE8\x84\x98", "\xE5\x80\x85",
+  "\xE8\x88\x98", "\xE8\x8A\xAE", "\xE8\x91\x9B", "\xE8\x93\x9C",
+  "\xE8\x93\xAC", "\xE8\x95\x99",
   /* 111-120 */
-  "\xFB\xC2", "\xBF\xAA", "\xFB\xE2", "\x8F\xF7\xFC", "\xFB\xED",
-  "\xB3\xD1", "\xFC\xAD", "\xFC\xC1", "\xC4\xD4", "\xD0\xD2",
+  "\xE8\x97\x8E", "\xE8\x9D\x95", "\xE8\x9F\xAC", "\xE8\xA0\x8B",
+  "\xE8\xA3\xB5", "\xE8\xA7\x92", "\xE8\xAB\xB6", "\xE8\xB7\x8E",
+  "\xE8\xBE\xBB", "\xE4\xBE\x91",
   /* 121-130 */
-  "\xFC\xE6", "\xFC\xF0", "\xC5\xA2", "\xEE\xD6", "\x8F\xFA\xD8",
-  "\xFD\xAE", "\xFD\xB7", "\xFD\xB9", "\xB4\xD6", "\xFD\xE2",
+  "\xE9\x83\x9D", "\xE9\x84\xA7", "\xE9\x84\xAD", "\xE9\x87\x80",
+  "\xE9\x88\xB3", "\xE9\x8A\x88", "\xE9\x8C\xA1", "\xE9\x8D\x88",
+  "\xE9\x96\x93", "\xE9\x9B\x9E",
   /* 131-137 */
-  "\xF1\xAD", "\x8F\xFC\xE4", "\xB9\xE2", "\xBB\xAA", "\xFE\xE5",
-  "\xFE\xEF", "\xFE\xF0"
+  "\xE9\xA4\x83", "\xE9\xA5\x80", "\xE9\xAB\x98", "\xE9\xAF\x96",
+  "\xE9\xB7\x97", "\xE9\xBA\xB4", "\xE9\xBA\xB5"
 };
 
 static const gchar UNDEF_CHAR = '.';
 
-static void
-append_arib_char (GString * euc_str, const struct code_state *state,
+/* Appends @len bytes of @str to the output, unless there is not enough room
+ * left in it */
+static inline gboolean
+put_str (gchar ** out, const gchar * end, const gchar * str, gsize len)
+{
+  if (G_UNLIKELY (end - *out < len))
+    return FALSE;
+
+  memcpy (*out, str, len);
+  *out += len;
+
+  return TRUE;
+}
+
+static inline gboolean
+put_char (gchar ** out, const gchar * end, gchar c)
+{
+  if (G_UNLIKELY (*out == end))
+    return FALSE;
+
+  *(*out)++ = c;
+
+  return TRUE;
+}
+
+static inline gboolean
+put_unichar (gchar ** out, const gchar * end, gunichar c)
+{
+  gchar *p = *out;
+
+  if (c < 0x80)
+    return put_char (out, end, c);
+
+  if (c < 0x800) {
+    if (G_UNLIKELY (end - p < 2))
+      return FALSE;
+    p[0] = 0xC0 | (c >> 6);
+    p[1] = 0x80 | (c & 0x3F);
+    *out = p + 2;
+  } else if (c < 0x10000) {
+    if (G_UNLIKELY (end - p < 3))
+      return FALSE;
+    p[0] = 0xE0 | (c >> 12);
+    p[1] = 0x80 | ((c >> 6) & 0x3F);
+    p[2] = 0x80 | (c & 0x3F);
+    *out = p + 3;
+  } else {
+    if (G_UNLIKELY (end - p < 4))
+      return FALSE;
+    p[0] = 0xF0 | (c >> 18);
+    p[1] = 0x80 | ((c >> 12) & 0x3F);
+    p[2] = 0x80 | ((c >> 6) & 0x3F);
+    p[3] = 0x80 | (c & 0x3F);
+    *out = p + 4;
+  }
+
+  return TRUE;
+}
+
+/* Appends the character at @c1, @c2 (0x21-0x7E) of a row of one of the JIS
+ * X 0213 tables */
+static inline gboolean
+put_jis (gchar ** out, const gchar * end, const guint32 * table,
     unsigned char c1, unsigned char c2)
+{
+  guint32 u;
+  const gunichar *pair;
+
+  if (G_UNLIKELY (c1 < 0x21 || c1 > 0x7E || c2 < 0x21 || c2 > 0x7E))
+    return put_char (out, end, UNDEF_CHAR);
+
+  u = table[(c1 - 0x21) * 94 + c2 - 0x21];
+  if (G_LIKELY (!(u & JISX0213_PAIR))) {
+    if (G_UNLIKELY (u == 0))
+      return put_char (out, end, UNDEF_CHAR);
+    return put_unichar (out, end, u);
+  }
+
+  /* Base character and combining mark, must be written entirely */
+  pair = jisx0213_pairs[u & ~JISX0213_PAIR];
+  if (G_UNLIKELY (end - *out < 6))
+    return FALSE;
+  put_unichar (out, end, pair[0]);
+  put_unichar (out, end, pair[1]);
+
+  return TRUE;
+}
+
+static inline gboolean
+put_jis_plane2 (gchar ** out, const gchar * end, unsigned char c1,
+    unsigned char c2)
+{
+  gint row;
+
+  if (G_UNLIKELY (c1 < 0x21 || c1 > 0x7E))
+    return put_char (out, end, UNDEF_CHAR);
+
+  row = jisx0213_plane2_rows[c1 - 0x21];
+  if (row < 0)
+    return put_char (out, end, UNDEF_CHAR);
+
+  return put_jis (out, end, jisx0213_plane2 + row * 94, 0x21, c2);
+}
+
+static inline gboolean
+put_ext_str (gchar ** out, const gchar * end, const gchar * str)
+{
+  return put_str (out, end, str, strlen (str));
+}
+
+/* Appends the additional symbol at @c1, @c2 (0x21-0x7E) */
+static gboolean
+put_ext (gchar ** out, const gchar * end, unsigned char c1, unsigned char c2)
+{
+  if (G_UNLIKELY (c2 < 0x21 || c2 > 0x7E))
+    return put_char (out, end, UNDEF_CHAR);
+
+  switch (c1) {
+    case 0x7A:
+      if (c2 < 0x4D)
+        return put_char (out, end, UNDEF_CHAR);
+      return put_ext_str (out, end, trans_ext90[c2 - 0x4D]);
+    case 0x7C:
+    case 0x7D:
+    case 0x7E:
+      return put_ext_str (out, end, trans_ext92[c1 - 0x7C][c2 - 0x21]);
+    case 0x75:
+    case 0x76:
+      c2 -= 0x21;
+      if (c1 == 0x76)
+        c2 += 94;
+      if (c2 < 137)
+        return put_ext_str (out, end, trans_ext85[c2]);
+      return put_char (out, end, UNDEF_CHAR);
+    default:
+      return put_char (out, end, UNDEF_CHAR);
+  }
+}
+
+/* Returns FALSE if there is not enough room left in the output */
+static gboolean
+append_arib_char (gchar ** out, const gchar * end,
+    const struct code_state *state, unsigned char c1, unsigned char c2)
 {
   int gidx;
 
@@ -178,96 +343,68 @@ append_arib_char (GString * euc_str, const struct code_state *state,
   else
     gidx = state->gl;
 
+  c1 &= 0x7F;
+  c2 &= 0x7F;
+
   switch (state->g[gidx].code) {
     case CODE_ASCII:
-      g_string_append_c (euc_str, c1 & 0x7F);
-      break;
+      return put_char (out, end, c1);
     case CODE_JISX0208:
+      /* Rows 85-86 and 90-94 of the Kanji set are the additional symbols */
+      if (c1 == 0x75 || c1 == 0x76 || c1 >= 0x7A)
+        return put_ext (out, end, c1, c2);
+      return put_jis (out, end, jisx0213_plane1, c1, c2);
     case CODE_JISX0213_1:
-      g_string_append_c (euc_str, c1 | 0x80);
-      g_string_append_c (euc_str, c2 | 0x80);
-      break;
+      return put_jis (out, end, jisx0213_plane1, c1, c2);
     case CODE_JISX0201_KATA:
-      g_string_append_c (euc_str, '\x8E');      /* SS2 */
-      g_string_append_c (euc_str, c1 | 0x80);
-      break;
+      /* Half-width katakana */
+      if (c1 >= 0x21 && c1 <= 0x5F)
+        return put_unichar (out, end, 0xFF61 + c1 - 0x21);
+      return put_char (out, end, UNDEF_CHAR);
     case CODE_JISX0213_2:
-      g_string_append_c (euc_str, '\x8F');      /* SS3 */
-      g_string_append_c (euc_str, c1 | 0x80);
-      g_string_append_c (euc_str, c2 | 0x80);
-      break;
+      return put_jis_plane2 (out, end, c1, c2);
     case CODE_X_HIRA:
     case CODE_X_HIRA_P:
       /* map to Row:4,Cell:c1 in JISX0208/0213 */
-      if ((c1 & 0x7F) >= 0x77) {
-        g_string_append_c (euc_str, '\xA1');
-        g_string_append_c (euc_str, trans_hira[(c1 & 0x7F) - 0x77]);
-      } else {
-        g_string_append_c (euc_str, '\xA4');
-        g_string_append_c (euc_str, c1 | 0x80);
-      }
-      break;
+      if (c1 >= 0x77)
+        return put_jis (out, end, jisx0213_plane1, 0x21,
+            trans_hira[c1 - 0x77]);
+      return put_jis (out, end, jisx0213_plane1, 0x24, c1);
     case CODE_X_KATA:
     case CODE_X_KATA_P:
       /* map to Row:5,Cell:c1 in JISX0208/0213 */
-      if ((c1 & 0x7F) >= 0x77) {
-        g_string_append_c (euc_str, '\xA1');
-        g_string_append_c (euc_str, trans_kata[(c1 & 0x7F) - 0x77]);
-      } else {
-        g_string_append_c (euc_str, '\xA5');
-        g_string_append_c (euc_str, c1 | 0x80);
-      }
-      break;
+      if (c1 >= 0x77)
+        return put_jis (out, end, jisx0213_plane1, 0x21,
+            trans_kata[c1 - 0x77]);
+      return put_jis (out, end, jisx0213_plane1, 0x25, c1);
     case CODE_EXT:
-      c1 &= 0x7F;
-      c2 &= 0x7F;
-      switch (c1) {
-        case 0x7A:
-          if (c2 < 0x4D) {
-            g_string_append_c (euc_str, UNDEF_CHAR);
-          } else {
-            c2 -= 0x4D;
-            g_string_append (euc_str, trans_ext90[c2]);
-          }
-          break;
-        case 0x7C:
-        case 0x7D:
-        case 0x7E:
-          c1 -= 0x7C;
-          c2 -= 0x21;
-          g_string_append (euc_str, trans_ext92[c1][c2]);
-          break;
-        case 0x75:
-        case 0x76:
-          c2 -= 0x21;
-          if (c1 == 0x76)
-            c2 += 94;
-          if (c2 < 137)
-            g_string_append (euc_str, trans_ext85[c2]);
-          else
-            g_string_append_c (euc_str, UNDEF_CHAR);
-          break;
-        default:
-          g_string_append_c (euc_str, UNDEF_CHAR);
-      }
-      break;
+      return put_ext (out, end, c1, c2);
     default:                   /* unsupported char-set. */
-      g_string_append_c (euc_str, UNDEF_CHAR);
+      return put_char (out, end, UNDEF_CHAR);
   }
+}
 
-  return;
-};
-
-
-gchar *
-aribstr_to_utf8 (const gchar * source, const guint len)
+/* aribstr_to_utf8_buf:
+ * @source: the ARIB STD-B24 8-bit string
+ * @len: the length of @source
+ * @dest: the buffer to write the UTF-8 string to
+ * @dest_size: the size of @dest
+ *
+ * Converts @source to a NUL-terminated UTF-8 string, directly from the
+ * JIS X 0213 tables. If @dest is too small, the output is truncated at a
+ * character boundary. ARIBSTR_UTF8_MAX_LEN (@len) bytes are always enough.
+ *
+ * Returns: the length of the string written to @dest, without the
+ * terminating NUL.
+ */
+gsize
+aribstr_to_utf8_buf (const gchar * source, guint len, gchar * dest,
+    gsize dest_size)
 {
-  gchar *converted_str;
-
-  int i, idx = 0;
+  const guchar *src = (const guchar *) source;
+  gchar *out = dest, *end;
+  guint i, idx = 0;
   guchar prev = '\0';
-  GString *euc_str;
-  gsize used;
 
   enum
   {
@@ -284,53 +421,45 @@ aribstr_to_utf8 (const gchar * source, const guint len)
     .gr = 2,
     .ss = 0,
     .g = {
-          {.mb = 2,.code = CODE_JISX0213_1},
+          {.mb = 2,.code = CODE_JISX0208},
           {.mb = 1,.code = CODE_ASCII},
           {.mb = 1,.code = CODE_X_HIRA},
           {.mb = 1,.code = CODE_X_KATA},
         }
   };
 
-  g_return_val_if_fail (source != NULL, NULL);
+  g_return_val_if_fail (source != NULL, 0);
+  g_return_val_if_fail (dest != NULL && dest_size > 0, 0);
 
-  if (len == 0)
-    return NULL;
+  /* Keep room for the terminating NUL */
+  end = dest + dest_size - 1;
 
   mode = NORMAL;
   state = state_def;
 
-  /* first, rewrite to EUC-JP/JISX0213 */
-  euc_str = g_string_sized_new (len * 2);
   for (i = 0; i < len; i++) {
-    switch (source[i]) {
+    switch (src[i]) {
       case 0x19:               /* SS2 */
-//        source[i] = '\x8E';
         state.ss = 2;
         mode = NORMAL;
         continue;
-        break;
       case 0x1D:               /* SS3 */
-//        source[i] = '\x8F';
         state.ss = 3;
         mode = NORMAL;
         continue;
-        break;
       case 0x1B:               /* ESC */
         mode = ESCAPE;
         continue;
-        break;
       case 0x0F:               /* LS0 */
         mode = NORMAL;
         state.ss = 0;
         state.gl = 0;
         continue;
-        break;
       case 0x0E:               /* LS1 */
         mode = NORMAL;
         state.ss = 0;
         state.gl = 1;
         continue;
-        break;
       case 0x0A:               /* LF ?? */
       case 0x0D:               /* CR */
         state = state_def;      /* fall through */
@@ -338,65 +467,58 @@ aribstr_to_utf8 (const gchar * source, const guint len)
       case 0x08:               /* BS */
       case 0x09:               /* HT */
       case 0x20:               /* SPACE */
-      case '\xA0':             /* NBSP */
+      case 0xA0:               /* NBSP */
       case 0x7F:               /* DEL */
-      case '\xFF':
+      case 0xFF:
         mode = NORMAL;
-        g_string_append_c (euc_str, source[i] & 0x7F);
+        if (!put_char (&out, end, src[i] & 0x7F))
+          goto done;
         continue;
-        break;
     }
-    if (!(source[i] & 0x60)) {  /* C0 or C1 */
+    if (!(src[i] & 0x60)) {     /* C0 or C1 */
       /* skip */
       continue;
     }
 
     switch (mode) {
       case ESCAPE:
-        switch (source[i]) {
-          case '\x28':
-          case '\x29':
-          case '\x2A':
-          case '\x2B':
-            idx = source[i] - '\x28';
+        switch (src[i]) {
+          case 0x28:
+          case 0x29:
+          case 0x2A:
+          case 0x2B:
+            idx = src[i] - 0x28;
             mode = DESIGNATE_1B;
             continue;
-            break;
-          case '\x24':
+          case 0x24:
             idx = 0;
             mode = DESIGNATE_MB;
             continue;
-            break;
-          case '\x6E':         /* LS2 */
+          case 0x6E:           /* LS2 */
             mode = NORMAL;
             state.ss = 0;
             state.gl = 2;
             continue;
-            break;
-          case '\x6F':         /* LS3 */
+          case 0x6F:           /* LS3 */
             mode = NORMAL;
             state.ss = 0;
             state.gl = 3;
             continue;
-            break;
-          case '\x7E':         /* LS1R */
+          case 0x7E:           /* LS1R */
             mode = NORMAL;
             state.ss = 0;
             state.gr = 1;
             continue;
-            break;
-          case '\x7D':         /* LS2R */
+          case 0x7D:           /* LS2R */
             mode = NORMAL;
             state.ss = 0;
             state.gr = 2;
             continue;
-            break;
-          case '\x7C':         /* LS3R */
+          case 0x7C:           /* LS3R */
             mode = NORMAL;
             state.ss = 0;
             state.gr = 3;
             continue;
-            break;
           default:
             /* skip unknown ESC sequences */
             mode = NORMAL;
@@ -407,68 +529,86 @@ aribstr_to_utf8 (const gchar * source, const guint len)
         mode = NORMAL;
         state.ss = 0;
         state.g[idx].mb = 1;
-        if (source[i] == '\x4a' || source[i] == '\x36')
+        if (src[i] == 0x4a || src[i] == 0x36)
           state.g[idx].code = CODE_ASCII;
         else
-          state.g[idx].code = source[i];
+          state.g[idx].code = src[i];
         continue;
-        break;
       case DESIGNATE_MB:
-        switch (source[i]) {
-          case '\x28':         /* DRCS only */
-          case '\x29':
-          case '\x2A':
-          case '\x2B':
-            idx = source[i] - '\x28';
+        switch (src[i]) {
+          case 0x28:           /* DRCS only */
+          case 0x29:
+          case 0x2A:
+          case 0x2B:
+            idx = src[i] - 0x28;
             continue;
-            break;
-          case '\x39':         /* JISX0213, plane 1 */
+          case 0x39:           /* JISX0213, plane 1 */
             state.g[idx].code = CODE_JISX0213_1;
             break;
-          case '\x3A':         /* JISX0213, plane 2 */
+          case 0x3A:           /* JISX0213, plane 2 */
             state.g[idx].code = CODE_JISX0213_2;
             break;
-          case '\x40':         /* JISX0208_1978 */
+          case 0x40:           /* JISX0208_1978 */
             state.g[idx].code = CODE_JISX0208;
             break;
           default:
-            state.g[idx].code = source[i];
+            state.g[idx].code = src[i];
         }
         mode = NORMAL;
         state.ss = 0;
         state.g[idx].mb = 2;
         continue;
-        break;
       case MB_2ND:
-        /* convert prev, source[i] / state  */
-        append_arib_char (euc_str, &state, prev, source[i]);
+        /* convert prev, src[i] / state  */
         mode = NORMAL;
+        if (!append_arib_char (&out, end, &state, prev, src[i]))
+          goto done;
+        /* The single shift only ends with the second byte */
+        state.ss = 0;
         continue;
-        break;
       case NORMAL:
         if ((state.ss > 0 && state.g[state.ss].mb > 1)
-            || (!state.ss && (source[i] & 0x80) && state.g[state.gr].mb > 1)
-            || (!state.ss && !(source[i] & 0x80) && state.g[state.gl].mb > 1)) {
-          prev = source[i];
+            || (!state.ss && (src[i] & 0x80) && state.g[state.gr].mb > 1)
+            || (!state.ss && !(src[i] & 0x80) && state.g[state.gl].mb > 1)) {
+          prev = src[i];
           mode = MB_2ND;
-          state.ss = 0;
           continue;
         }
-        /* convert source[i] / state  */
-        append_arib_char (euc_str, &state, source[i], '\0');
+        /* convert src[i] / state  */
+        if (!append_arib_char (&out, end, &state, src[i], '\0'))
+          goto done;
         state.ss = 0;
         break;
     }
   }
 
-  g_string_append_c (euc_str, '\0');
+done:
+  *out = '\0';
+
+  return out - dest;
+}
 
-  converted_str = g_convert_with_fallback (euc_str->str, euc_str->len,
-      "utf-8", "EUC-JISX0213", "<?>", &used, NULL, NULL);
-  if (!converted_str) {
-    converted_str = g_strdup_printf ("<charset conversion failed>"
-        "0x%04hhx at %" G_GSIZE_FORMAT, euc_str->str[used], used);
+gchar *
+aribstr_to_utf8 (const gchar * source, const guint len)
+{
+  gchar stack_buf[STACK_BUFFER_SIZE];
+  gchar *converted_str;
+  gsize size, used;
+
+  g_return_val_if_fail (source != NULL, NULL);
+
+  if (len == 0)
+    return NULL;
+
+  /* Descriptor strings are at most 255 bytes, so this is the common case */
+  size = ARIBSTR_UTF8_MAX_LEN (len);
+  if (size <= STACK_BUFFER_SIZE) {
+    used = aribstr_to_utf8_buf (source, len, stack_buf, size);
+    return g_strndup (stack_buf, used);
   }
-  g_string_free (euc_str, TRUE);
+
+  converted_str = g_malloc (size);
+  aribstr_to_utf8_buf (source, len, converted_str, size);
+
   return converted_str;
 }
@@ -44,7 +44,7 @@ _gst_mpegts_atsc_vct_source_copy (GstMpegtsAtscVCTSource * source)
   GstMpegtsAtscVCTSource *copy;
 
   copy = g_slice_dup (GstMpegtsAtscVCTSource, source);
-  copy->descriptors = g_ptr_array_ref (source->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (source->descriptors);
 
   return copy;
 }
@@ -68,8 +68,10 @@ _gst_mpegts_atsc_vct_copy (GstMpegtsAtscVCT * vct)
   GstMpegtsAtscVCT *copy;
 
   copy = g_slice_dup (GstMpegtsAtscVCT, vct);
-  copy->sources = g_ptr_array_ref (vct->sources);
-  copy->descriptors = g_ptr_array_ref (vct->descriptors);
+  copy->sources = _gst_mpegts_entries_copy (vct->sources,
+      (GBoxedCopyFunc) _gst_mpegts_atsc_vct_source_copy,
+      (GDestroyNotify) _gst_mpegts_atsc_vct_source_free);
+  copy->descriptors = _gst_mpegts_descriptors_copy (vct->descriptors);
 
   return copy;
 }
@@ -180,7 +182,8 @@ _parse_atsc_vct (GstMpegtsSection * section)
       goto error;
 
     source->descriptors =
-        gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+        _gst_mpegts_section_parse_descriptors (section, data,
+        descriptors_loop_length);
     if (source->descriptors == NULL)
       goto error;
     data += descriptors_loop_length;
@@ -193,7 +196,8 @@ _parse_atsc_vct (GstMpegtsSection * section)
     goto error;
 
   vct->descriptors =
-      gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+      _gst_mpegts_section_parse_descriptors (section, data,
+      descriptors_loop_length);
   if (vct->descriptors == NULL)
     goto error;
 
@@ -261,7 +265,7 @@ _gst_mpegts_atsc_mgt_table_copy (GstMpegtsAtscMGTTable * mgt_table)
   GstMpegtsAtscMGTTable *copy;
 
   copy = g_slice_dup (GstMpegtsAtscMGTTable, mgt_table);
-  copy->descriptors = g_ptr_array_ref (mgt_table->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (mgt_table->descriptors);
 
   return copy;
 }
@@ -283,8 +287,10 @@ _gst_mpegts_atsc_mgt_copy (GstMpegtsAtscMGT * mgt)
   GstMpegtsAtscMGT *copy;
 
   copy = g_slice_dup (GstMpegtsAtscMGT, mgt);
-  copy->tables = g_ptr_array_ref (mgt->tables);
-  copy->descriptors = g_ptr_array_ref (mgt->descriptors);
+  copy->tables = _gst_mpegts_entries_copy (mgt->tables,
+      (GBoxedCopyFunc) _gst_mpegts_atsc_mgt_table_copy,
+      (GDestroyNotify) _gst_mpegts_atsc_mgt_table_free);
+  copy->descriptors = _gst_mpegts_descriptors_copy (mgt->descriptors);
 
   return copy;
 }
@@ -351,7 +357,8 @@ _parse_atsc_mgt (GstMpegtsSection * section)
       goto error;
     }
     mgt_table->descriptors =
-        gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+        _gst_mpegts_section_parse_descriptors (section, data,
+        descriptors_loop_length);
     data += descriptors_loop_length;
   }
 
@@ -362,7 +369,8 @@ _parse_atsc_mgt (GstMpegtsSection * section)
     goto error;
   }
   mgt->descriptors =
-      gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+      _gst_mpegts_section_parse_descriptors (section, data,
+      descriptors_loop_length);
 
   return (gpointer) mgt;
 
@@ -867,7 +875,7 @@ _gst_mpegts_atsc_eit_event_copy (GstMpegtsAtscEITEvent * event)
 
   copy = g_slice_dup (GstMpegtsAtscEITEvent, event);
   copy->titles = g_ptr_array_ref (event->titles);
-  copy->descriptors = g_ptr_array_ref (event->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (event->descriptors);
 
   return copy;
 }
@@ -892,7 +900,9 @@ _gst_mpegts_atsc_eit_copy (GstMpegtsAtscEIT * eit)
   GstMpegtsAtscEIT *copy;
 
   copy = g_slice_dup (GstMpegtsAtscEIT, eit);
-  copy->events = g_ptr_array_ref (eit->events);
+  copy->events = _gst_mpegts_entries_copy (eit->events,
+      (GBoxedCopyFunc) _gst_mpegts_atsc_eit_event_copy,
+      (GDestroyNotify) _gst_mpegts_atsc_eit_event_free);
 
   return copy;
 }
@@ -979,7 +989,8 @@ _parse_atsc_eit (GstMpegtsSection * section)
     }
 
     event->descriptors =
-        gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+        _gst_mpegts_section_parse_descriptors (section, data,
+        descriptors_loop_length);
     data += descriptors_loop_length;
   }
 
@@ -1116,7 +1127,7 @@ _gst_mpegts_atsc_stt_copy (GstMpegtsAtscSTT * stt)
   GstMpegtsAtscSTT *copy;
 
   copy = g_slice_dup (GstMpegtsAtscSTT, stt);
-  copy->descriptors = g_ptr_array_ref (stt->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (stt->descriptors);
 
   return copy;
 }
@@ -1164,7 +1175,8 @@ _parse_atsc_stt (GstMpegtsSection * section)
   stt->ds_dayofmonth = (daylight_saving >> 8) & 0x1F;
   stt->ds_hour = daylight_saving & 0xFF;
 
-  stt->descriptors = gst_mpegts_parse_descriptors (data, end - data - 4);
+  stt->descriptors =
+      _gst_mpegts_section_parse_descriptors (section, data, end - data - 4);
   if (stt->descriptors == NULL)
     goto error;
 
@@ -1384,7 +1396,7 @@ _gst_mpegts_atsc_rrt_copy (GstMpegtsAtscRRT * rrt)
   copy = g_slice_dup (GstMpegtsAtscRRT, rrt);
   copy->names = g_ptr_array_ref (rrt->names);
   copy->dimensions = g_ptr_array_ref (rrt->dimensions);
-  copy->descriptors = g_ptr_array_ref (rrt->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (rrt->descriptors);
 
   return copy;
 }
@@ -1479,7 +1491,8 @@ _parse_rrt (GstMpegtsSection * section)
   descriptors_loop_length = GST_READ_UINT16_BE (data) & 0x3FF;
   data += 2;
   rrt->descriptors =
-      gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+      _gst_mpegts_section_parse_descriptors (section, data,
+      descriptors_loop_length);
 
   return (gpointer) rrt;
 }
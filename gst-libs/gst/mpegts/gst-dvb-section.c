@@ -145,18 +145,24 @@ _gst_mpegts_eit_event_copy (GstMpegtsEITEvent * eit)
 
   copy = g_slice_dup (GstMpegtsEITEvent, eit);
   copy->start_time = gst_date_time_ref (eit->start_time);
-  copy->descriptors = g_ptr_array_ref (eit->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (eit->descriptors);
 
   return copy;
 }
 
 static void
-_gst_mpegts_eit_event_free (GstMpegtsEITEvent * eit)
+_gst_mpegts_eit_event_clear (GstMpegtsEITEvent * eit)
 {
   if (eit->start_time)
     gst_date_time_unref (eit->start_time);
   if (eit->descriptors)
     g_ptr_array_unref (eit->descriptors);
+}
+
+static void
+_gst_mpegts_eit_event_free (GstMpegtsEITEvent * eit)
+{
+  _gst_mpegts_eit_event_clear (eit);
   g_slice_free (GstMpegtsEITEvent, eit);
 }
 
@@ -170,7 +176,9 @@ _gst_mpegts_eit_copy (GstMpegtsEIT * eit)
   GstMpegtsEIT *copy;
 
   copy = g_slice_dup (GstMpegtsEIT, eit);
-  copy->events = g_ptr_array_ref (eit->events);
+  copy->events = _gst_mpegts_entries_copy (eit->events,
+      (GBoxedCopyFunc) _gst_mpegts_eit_event_copy,
+      (GDestroyNotify) _gst_mpegts_eit_event_free);
 
   return copy;
 }
@@ -213,9 +221,9 @@ _parse_eit (GstMpegtsSection * section)
   eit->present_following = (section->table_id == 0x4E
       || section->table_id == 0x4F);
 
-  eit->events =
-      g_ptr_array_new_full (allocated_events,
-      (GDestroyNotify) _gst_mpegts_eit_event_free);
+  eit->events = _gst_mpegts_section_new_entries (section, allocated_events,
+      (GDestroyNotify) _gst_mpegts_eit_event_free,
+      (GDestroyNotify) _gst_mpegts_eit_event_clear);
 
   while (data < end - 4) {
     GstMpegtsEITEvent *event;
@@ -227,7 +235,7 @@ _parse_eit (GstMpegtsSection * section)
       goto error;
     }
 
-    event = g_slice_new0 (GstMpegtsEITEvent);
+    event = _gst_mpegts_section_new_entry (section, GstMpegtsEITEvent);
     g_ptr_array_add (eit->events, event);
 
     event->event_id = GST_READ_UINT16_BE (data);
@@ -249,7 +257,8 @@ _parse_eit (GstMpegtsSection * section)
     data += 2;
 
     event->descriptors =
-        gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+        _gst_mpegts_section_parse_descriptors (section, data,
+        descriptors_loop_length);
     if (event->descriptors == NULL)
       goto error;
     data += descriptors_loop_length;
@@ -302,16 +311,22 @@ _gst_mpegts_bat_stream_copy (GstMpegtsBATStream * bat)
   GstMpegtsBATStream *copy;
 
   copy = g_slice_dup (GstMpegtsBATStream, bat);
-  copy->descriptors = g_ptr_array_ref (bat->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (bat->descriptors);
 
   return copy;
 }
 
 static void
-_gst_mpegts_bat_stream_free (GstMpegtsBATStream * bat)
+_gst_mpegts_bat_stream_clear (GstMpegtsBATStream * bat)
 {
   if (bat->descriptors)
     g_ptr_array_unref (bat->descriptors);
+}
+
+static void
+_gst_mpegts_bat_stream_free (GstMpegtsBATStream * bat)
+{
+  _gst_mpegts_bat_stream_clear (bat);
   g_slice_free (GstMpegtsBATStream, bat);
 }
 
@@ -325,8 +340,10 @@ _gst_mpegts_bat_copy (GstMpegtsBAT * bat)
   GstMpegtsBAT *copy;
 
   copy = g_slice_dup (GstMpegtsBAT, bat);
-  copy->descriptors = g_ptr_array_ref (bat->descriptors);
-  copy->streams = g_ptr_array_ref (bat->streams);
+  copy->descriptors = _gst_mpegts_descriptors_copy (bat->descriptors);
+  copy->streams = _gst_mpegts_entries_copy (bat->streams,
+      (GBoxedCopyFunc) _gst_mpegts_bat_stream_copy,
+      (GDestroyNotify) _gst_mpegts_bat_stream_free);
 
   return copy;
 }
@@ -372,7 +389,8 @@ _parse_bat (GstMpegtsSection * section)
     goto error;
   }
   bat->descriptors =
-      gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+      _gst_mpegts_section_parse_descriptors (section, data,
+      descriptors_loop_length);
   if (bat->descriptors == NULL)
     goto error;
   data += descriptors_loop_length;
@@ -386,13 +404,14 @@ _parse_bat (GstMpegtsSection * section)
     goto error;
   }
 
-  bat->streams =
-      g_ptr_array_new_full (allocated_streams,
-      (GDestroyNotify) _gst_mpegts_bat_stream_free);
+  bat->streams = _gst_mpegts_section_new_entries (section, allocated_streams,
+      (GDestroyNotify) _gst_mpegts_bat_stream_free,
+      (GDestroyNotify) _gst_mpegts_bat_stream_clear);
 
   /* read up to the CRC */
   while (transport_stream_loop_length - 4 > 0) {
-    GstMpegtsBATStream *stream = g_slice_new0 (GstMpegtsBATStream);
+    GstMpegtsBATStream *stream =
+        _gst_mpegts_section_new_entry (section, GstMpegtsBATStream);
 
     g_ptr_array_add (bat->streams, stream);
 
@@ -424,7 +443,8 @@ _parse_bat (GstMpegtsSection * section)
       goto error;
     }
     stream->descriptors =
-        gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+        _gst_mpegts_section_parse_descriptors (section, data,
+        descriptors_loop_length);
     if (stream->descriptors == NULL)
       goto error;
 
@@ -481,16 +501,22 @@ _gst_mpegts_nit_stream_copy (GstMpegtsNITStream * nit)
   GstMpegtsNITStream *copy;
 
   copy = g_slice_dup (GstMpegtsNITStream, nit);
-  copy->descriptors = g_ptr_array_ref (nit->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (nit->descriptors);
 
   return copy;
 }
 
 static void
-_gst_mpegts_nit_stream_free (GstMpegtsNITStream * nit)
+_gst_mpegts_nit_stream_clear (GstMpegtsNITStream * nit)
 {
   if (nit->descriptors)
     g_ptr_array_unref (nit->descriptors);
+}
+
+static void
+_gst_mpegts_nit_stream_free (GstMpegtsNITStream * nit)
+{
+  _gst_mpegts_nit_stream_clear (nit);
   g_slice_free (GstMpegtsNITStream, nit);
 }
 
@@ -503,8 +529,10 @@ _gst_mpegts_nit_copy (GstMpegtsNIT * nit)
 {
   GstMpegtsNIT *copy = g_slice_dup (GstMpegtsNIT, nit);
 
-  copy->descriptors = g_ptr_array_ref (nit->descriptors);
-  copy->streams = g_ptr_array_ref (nit->streams);
+  copy->descriptors = _gst_mpegts_descriptors_copy (nit->descriptors);
+  copy->streams = _gst_mpegts_entries_copy (nit->streams,
+      (GBoxedCopyFunc) _gst_mpegts_nit_stream_copy,
+      (GDestroyNotify) _gst_mpegts_nit_stream_free);
 
   return copy;
 }
@@ -553,7 +581,8 @@ _parse_nit (GstMpegtsSection * section)
     goto error;
   }
   nit->descriptors =
-      gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+      _gst_mpegts_section_parse_descriptors (section, data,
+      descriptors_loop_length);
   if (nit->descriptors == NULL)
     goto error;
   data += descriptors_loop_length;
@@ -567,13 +596,14 @@ _parse_nit (GstMpegtsSection * section)
     goto error;
   }
 
-  nit->streams =
-      g_ptr_array_new_full (allocated_streams,
-      (GDestroyNotify) _gst_mpegts_nit_stream_free);
+  nit->streams = _gst_mpegts_section_new_entries (section, allocated_streams,
+      (GDestroyNotify) _gst_mpegts_nit_stream_free,
+      (GDestroyNotify) _gst_mpegts_nit_stream_clear);
 
   /* read up to the CRC */
   while (transport_stream_loop_length - 4 > 0) {
-    GstMpegtsNITStream *stream = g_slice_new0 (GstMpegtsNITStream);
+    GstMpegtsNITStream *stream =
+        _gst_mpegts_section_new_entry (section, GstMpegtsNITStream);
 
     g_ptr_array_add (nit->streams, stream);
 
@@ -605,7 +635,8 @@ _parse_nit (GstMpegtsSection * section)
       goto error;
     }
     stream->descriptors =
-        gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+        _gst_mpegts_section_parse_descriptors (section, data,
+        descriptors_loop_length);
     if (stream->descriptors == NULL)
       goto error;
 
@@ -826,16 +857,22 @@ _gst_mpegts_sdt_service_copy (GstMpegtsSDTService * sdt)
 {
   GstMpegtsSDTService *copy = g_slice_dup (GstMpegtsSDTService, sdt);
 
-  copy->descriptors = g_ptr_array_ref (sdt->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (sdt->descriptors);
 
   return copy;
 }
 
 static void
-_gst_mpegts_sdt_service_free (GstMpegtsSDTService * sdt)
+_gst_mpegts_sdt_service_clear (GstMpegtsSDTService * sdt)
 {
   if (sdt->descriptors)
     g_ptr_array_unref (sdt->descriptors);
+}
+
+static void
+_gst_mpegts_sdt_service_free (GstMpegtsSDTService * sdt)
+{
+  _gst_mpegts_sdt_service_clear (sdt);
   g_slice_free (GstMpegtsSDTService, sdt);
 }
 
@@ -848,7 +885,9 @@ _gst_mpegts_sdt_copy (GstMpegtsSDT * sdt)
 {
   GstMpegtsSDT *copy = g_slice_dup (GstMpegtsSDT, sdt);
 
-  copy->services = g_ptr_array_ref (sdt->services);
+  copy->services = _gst_mpegts_entries_copy (sdt->services,
+      (GBoxedCopyFunc) _gst_mpegts_sdt_service_copy,
+      (GDestroyNotify) _gst_mpegts_sdt_service_free);
 
   return copy;
 }
@@ -896,12 +935,14 @@ _parse_sdt (GstMpegtsSection * section)
 
   sdt_info_length = section->section_length - 11;
 
-  sdt->services = g_ptr_array_new_full (allocated_services,
-      (GDestroyNotify) _gst_mpegts_sdt_service_free);
+  sdt->services = _gst_mpegts_section_new_entries (section, allocated_services,
+      (GDestroyNotify) _gst_mpegts_sdt_service_free,
+      (GDestroyNotify) _gst_mpegts_sdt_service_clear);
 
   /* read up to the CRC */
   while (sdt_info_length - 4 > 0) {
-    GstMpegtsSDTService *service = g_slice_new0 (GstMpegtsSDTService);
+    GstMpegtsSDTService *service =
+        _gst_mpegts_section_new_entry (section, GstMpegtsSDTService);
     g_ptr_array_add (sdt->services, service);
 
     entry_begin = data;
@@ -934,7 +975,8 @@ _parse_sdt (GstMpegtsSection * section)
       goto error;
     }
     service->descriptors =
-        gst_mpegts_parse_descriptors (data, descriptors_loop_length);
+        _gst_mpegts_section_parse_descriptors (section, data,
+        descriptors_loop_length);
     if (!service->descriptors)
       goto error;
     data += descriptors_loop_length;
@@ -1181,7 +1223,7 @@ _gst_mpegts_tot_copy (GstMpegtsTOT * tot)
 
   if (tot->utc_time)
     copy->utc_time = gst_date_time_ref (tot->utc_time);
-  copy->descriptors = g_ptr_array_ref (tot->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (tot->descriptors);
 
   return copy;
 }
@@ -1217,7 +1259,8 @@ _parse_tot (GstMpegtsSection * section)
 
   desc_len = GST_READ_UINT16_BE (data) & 0xFFF;
   data += 2;
-  tot->descriptors = gst_mpegts_parse_descriptors (data, desc_len);
+  tot->descriptors =
+      _gst_mpegts_section_parse_descriptors (section, data, desc_len);
 
   return (gpointer) tot;
 }
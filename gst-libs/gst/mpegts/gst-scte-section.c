@@ -147,7 +147,7 @@ _gst_mpegts_scte_sit_copy (GstMpegtsSCTESIT * sit)
   GstMpegtsSCTESIT *copy = g_slice_dup (GstMpegtsSCTESIT, sit);
 
   copy->splices = g_ptr_array_ref (sit->splices);
-  copy->descriptors = g_ptr_array_ref (sit->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (sit->descriptors);
 
   return copy;
 }
@@ -272,7 +272,7 @@ _parse_sit (GstMpegtsSection * section)
   tmp = GST_READ_UINT16_BE (data);
   data += 2;
   GST_MEMDUMP ("desc ?", data, tmp);
-  sit->descriptors = gst_mpegts_parse_descriptors (data, tmp);
+  sit->descriptors = _gst_mpegts_section_parse_descriptors (section, data, tmp);
   if (!sit->descriptors) {
     GST_DEBUG ("no descriptors %d", tmp);
     goto error;
@@ -31,11 +31,33 @@ GST_DEBUG_CATEGORY_EXTERN (mpegts_debug);
 
 G_GNUC_INTERNAL void __initialize_descriptors (void);
 G_GNUC_INTERNAL gchar *get_encoding_and_convert (const gchar *text, guint length);
+G_GNUC_INTERNAL gchar *aribstr_to_utf8 (const gchar *text, guint length);
+G_GNUC_INTERNAL gsize aribstr_to_utf8_buf (const gchar *text, guint length,
+    gchar *dest, gsize dest_size);
+/* Size of a buffer large enough for any ARIB string of @length bytes */
+#define ARIBSTR_UTF8_MAX_LEN(length) ((length) * 3 + 1)
 G_GNUC_INTERNAL gchar *convert_lang_code (guint8 * data);
 G_GNUC_INTERNAL guint8 *dvb_text_from_utf8 (const gchar * text, gsize *out_size);
 G_GNUC_INTERNAL GstMpegtsDescriptor *_new_descriptor (guint8 tag, guint8 length);
 G_GNUC_INTERNAL GstMpegtsDescriptor *_new_descriptor_with_extension (guint8 tag,
     guint8 tag_extension, guint8 length);
+typedef struct _GstMpegtsArena GstMpegtsArena;
+G_GNUC_INTERNAL GstMpegtsArena *_gst_mpegts_arena_new (void);
+G_GNUC_INTERNAL gpointer _gst_mpegts_arena_alloc0 (GstMpegtsArena * arena, gsize size);
+G_GNUC_INTERNAL void _gst_mpegts_arena_free (GstMpegtsArena * arena);
+G_GNUC_INTERNAL GPtrArray *_gst_mpegts_parse_descriptors_full (guint8 * buffer,
+    gsize buf_len, GstMpegtsArena * arena);
+G_GNUC_INTERNAL GPtrArray *_gst_mpegts_section_parse_descriptors (GstMpegtsSection * section,
+    guint8 * buffer, gsize buf_len);
+G_GNUC_INTERNAL gpointer _gst_mpegts_section_alloc0 (GstMpegtsSection * section,
+    gsize size);
+#define _gst_mpegts_section_new_entry(section, type) \
+    ((type *) _gst_mpegts_section_alloc0 ((section), sizeof (type)))
+G_GNUC_INTERNAL GPtrArray *_gst_mpegts_section_new_entries (GstMpegtsSection * section,
+    guint reserved, GDestroyNotify free_func, GDestroyNotify clear_func);
+G_GNUC_INTERNAL GPtrArray *_gst_mpegts_descriptors_copy (GPtrArray * descriptors);
+G_GNUC_INTERNAL GPtrArray *_gst_mpegts_entries_copy (GPtrArray * entries,
+    GBoxedCopyFunc copy_func, GDestroyNotify free_func);
 G_GNUC_INTERNAL void _packetize_descriptor_array (GPtrArray * array,
     guint8 ** out_data);
 G_GNUC_INTERNAL GstMpegtsSection *_gst_mpegts_section_init (guint16 pid, guint8 table_id);
@@ -679,8 +679,6 @@ convert_to_utf8 (const gchar * text, gint length, guint start,
   return new_text;
 }
 
-extern gchar *aribstr_to_utf8 (const gchar * text, guint length);
-
 gchar *
 get_encoding_and_convert (const gchar * text, guint length)
 {
@@ -870,6 +868,26 @@ G_DEFINE_BOXED_TYPE (GstMpegtsDescriptor, gst_mpegts_descriptor,
     (GBoxedCopyFunc) _copy_descriptor,
     (GBoxedFreeFunc) gst_mpegts_descriptor_free);
 
+/* Deep copy of a descriptor array, whose descriptors may belong to the arena
+ * of a section */
+GPtrArray *
+_gst_mpegts_descriptors_copy (GPtrArray * descriptors)
+{
+  GPtrArray *copy;
+  guint i;
+
+  if (descriptors == NULL)
+    return NULL;
+
+  copy = g_ptr_array_new_full (descriptors->len,
+      (GDestroyNotify) gst_mpegts_descriptor_free);
+  for (i = 0; i < descriptors->len; i++)
+    g_ptr_array_add (copy,
+        _copy_descriptor (g_ptr_array_index (descriptors, i)));
+
+  return copy;
+}
+
 /**
  * gst_mpegts_parse_descriptors:
  * @buffer: (transfer none): descriptors to parse
@@ -886,8 +904,19 @@ G_DEFINE_BOXED_TYPE (GstMpegtsDescriptor, gst_mpegts_descriptor,
  */
 GPtrArray *
 gst_mpegts_parse_descriptors (guint8 * buffer, gsize buf_len)
+{
+  return _gst_mpegts_parse_descriptors_full (buffer, buf_len, NULL);
+}
+
+/* Parses the descriptors in @buffer. With an @arena, the descriptors are
+ * allocated from it and point to @buffer instead of copying it, and the
+ * returned array doesn't own them. */
+GPtrArray *
+_gst_mpegts_parse_descriptors_full (guint8 * buffer, gsize buf_len,
+    GstMpegtsArena * arena)
 {
   GPtrArray *res;
+  GstMpegtsDescriptor *descs = NULL;
   guint8 length;
   guint8 *data;
   guint i, nb_desc = 0;
@@ -923,20 +952,31 @@ gst_mpegts_parse_descriptors (guint8 * buffer, gsize buf_len)
     return NULL;
   }
 
-  res =
-      g_ptr_array_new_full (nb_desc + 1,
-      (GDestroyNotify) gst_mpegts_descriptor_free);
+  if (arena) {
+    res = g_ptr_array_sized_new (nb_desc);
+    descs = _gst_mpegts_arena_alloc0 (arena,
+        nb_desc * sizeof (GstMpegtsDescriptor));
+  } else {
+    res = g_ptr_array_new_full (nb_desc + 1,
+        (GDestroyNotify) gst_mpegts_descriptor_free);
+  }
 
   data = buffer;
 
   for (i = 0; i < nb_desc; i++) {
-    GstMpegtsDescriptor *desc = g_slice_new0 (GstMpegtsDescriptor);
+    GstMpegtsDescriptor *desc;
+
+    if (arena)
+      desc = &descs[i];
+    else
+      desc = g_slice_new0 (GstMpegtsDescriptor);
 
     desc->data = data;
     desc->tag = *data++;
     desc->length = *data++;
     /* Copy the data now that we known the size */
-    desc->data = g_memdup (desc->data, desc->length + 2);
+    if (!arena)
+      desc->data = g_memdup (desc->data, desc->length + 2);
     GST_LOG ("descriptor 0x%02x length:%d", desc->tag, desc->length);
     GST_MEMDUMP ("descriptor", desc->data + 2, desc->length);
     /* extended descriptors */
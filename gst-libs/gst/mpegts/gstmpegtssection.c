@@ -171,16 +171,48 @@ static const guint32 crc_tab[256] = {
   0xbcb4666d, 0xb8757bda, 0xb5365d03, 0xb1f740b4
 };
 
+/* Tables for slicing-by-8: crc_tables[n][i] is the CRC contribution of
+ * byte i followed by n zero bytes, crc_tables[0] being crc_tab */
+static guint32 crc_tables[8][256];
+
+static gpointer
+_init_crc_tables (gpointer data)
+{
+  guint i, n;
+
+  for (i = 0; i < 256; i++) {
+    crc_tables[0][i] = crc_tab[i];
+    for (n = 1; n < 8; n++)
+      crc_tables[n][i] = (crc_tables[n - 1][i] << 8) ^
+          crc_tab[crc_tables[n - 1][i] >> 24];
+  }
+
+  return NULL;
+}
+
 /* _calc_crc32 relicensed to LGPL from fluendo ts demuxer */
 guint32
 _calc_crc32 (const guint8 * data, guint datalen)
 {
-  gint i;
+  static GOnce crc_once = G_ONCE_INIT;
   guint32 crc = 0xffffffff;
 
-  for (i = 0; i < datalen; i++) {
-    crc = (crc << 8) ^ crc_tab[((crc >> 24) ^ *data++) & 0xff];
+  g_once (&crc_once, _init_crc_tables, NULL);
+
+  /* Process 8 bytes per iteration with independent table lookups */
+  for (; datalen >= 8; datalen -= 8, data += 8) {
+    guint32 hi = crc ^ GST_READ_UINT32_BE (data);
+    guint32 lo = GST_READ_UINT32_BE (data + 4);
+
+    crc = crc_tables[7][hi >> 24] ^ crc_tables[6][(hi >> 16) & 0xff] ^
+        crc_tables[5][(hi >> 8) & 0xff] ^ crc_tables[4][hi & 0xff] ^
+        crc_tables[3][lo >> 24] ^ crc_tables[2][(lo >> 16) & 0xff] ^
+        crc_tables[1][(lo >> 8) & 0xff] ^ crc_tables[0][lo & 0xff];
   }
+
+  while (datalen--)
+    crc = (crc << 8) ^ crc_tab[((crc >> 24) ^ *data++) & 0xff];
+
   return crc;
 }
 
@@ -217,6 +249,123 @@ __common_section_checks (GstMpegtsSection * section, guint min_size,
 }
 
 
+/*
+ * ARENA
+ *
+ * Bump allocator for the table entries and descriptors of a section, freed
+ * all at once with the section.
+ */
+#define ARENA_ALIGN (2 * sizeof (gpointer))
+#define ARENA_CHUNK_SIZE 4096
+
+struct _GstMpegtsArena
+{
+  guint8 *pos;
+  guint8 *end;
+  /* Each chunk starts with a pointer to the previous one */
+  gpointer *chunks;
+};
+
+/* Private part of a section, allocated along with it */
+typedef struct
+{
+  GstMpegtsSection section;
+
+  /* Arena of the parsed table, in arena parsing mode */
+  GstMpegtsArena *arena;
+} GstMpegtsSectionImpl;
+
+#define SECTION_ARENA(section) (((GstMpegtsSectionImpl *) (section))->arena)
+
+GstMpegtsArena *
+_gst_mpegts_arena_new (void)
+{
+  return g_new0 (GstMpegtsArena, 1);
+}
+
+gpointer
+_gst_mpegts_arena_alloc0 (GstMpegtsArena * arena, gsize size)
+{
+  guint8 *res;
+
+  size = GST_ROUND_UP_N (size, ARENA_ALIGN);
+
+  if (G_UNLIKELY (arena->end - arena->pos < size)) {
+    gsize chunk_size = MAX (ARENA_CHUNK_SIZE, size + ARENA_ALIGN);
+    gpointer *chunk = g_malloc (chunk_size);
+
+    chunk[0] = arena->chunks;
+    arena->chunks = chunk;
+    arena->pos = (guint8 *) chunk + ARENA_ALIGN;
+    arena->end = (guint8 *) chunk + chunk_size;
+  }
+
+  res = arena->pos;
+  arena->pos += size;
+  memset (res, 0, size);
+
+  return res;
+}
+
+void
+_gst_mpegts_arena_free (GstMpegtsArena * arena)
+{
+  gpointer *chunk, *prev;
+
+  for (chunk = arena->chunks; chunk; chunk = prev) {
+    prev = chunk[0];
+    g_free (chunk);
+  }
+
+  g_free (arena);
+}
+
+GPtrArray *
+_gst_mpegts_section_parse_descriptors (GstMpegtsSection * section,
+    guint8 * buffer, gsize buf_len)
+{
+  return _gst_mpegts_parse_descriptors_full (buffer, buf_len,
+      SECTION_ARENA (section));
+}
+
+gpointer
+_gst_mpegts_section_alloc0 (GstMpegtsSection * section, gsize size)
+{
+  if (SECTION_ARENA (section))
+    return _gst_mpegts_arena_alloc0 (SECTION_ARENA (section), size);
+
+  return g_slice_alloc0 (size);
+}
+
+/* Creates the array holding the entries of a table. Entries allocated from
+ * the arena are only cleared with @clear_func when the array is freed. */
+GPtrArray *
+_gst_mpegts_section_new_entries (GstMpegtsSection * section, guint reserved,
+    GDestroyNotify free_func, GDestroyNotify clear_func)
+{
+  return g_ptr_array_new_full (reserved,
+      SECTION_ARENA (section) ? clear_func : free_func);
+}
+
+/* Deep copy of an entries array, which may have been created by
+ * _gst_mpegts_section_new_entries() */
+GPtrArray *
+_gst_mpegts_entries_copy (GPtrArray * entries, GBoxedCopyFunc copy_func,
+    GDestroyNotify free_func)
+{
+  GPtrArray *copy;
+  guint i;
+
+  if (entries == NULL)
+    return NULL;
+
+  copy = g_ptr_array_new_full (entries->len, free_func);
+  for (i = 0; i < entries->len; i++)
+    g_ptr_array_add (copy, copy_func (g_ptr_array_index (entries, i)));
+
+  return copy;
+}
+
 /*
  * GENERIC MPEG-TS SECTION
  */
@@ -228,9 +377,13 @@ _gst_mpegts_section_free (GstMpegtsSection * section)
   if (section->cached_parsed && section->destroy_parsed)
     section->destroy_parsed (section->cached_parsed);
 
+  /* After the parsed tables, which may still reference descriptors */
+  if (SECTION_ARENA (section))
+    _gst_mpegts_arena_free (SECTION_ARENA (section));
+
   g_free (section->data);
 
-  g_slice_free (GstMpegtsSection, section);
+  g_slice_free (GstMpegtsSectionImpl, (GstMpegtsSectionImpl *) section);
 }
 
 static GstMpegtsSection *
@@ -238,7 +391,7 @@ _gst_mpegts_section_copy (GstMpegtsSection * section)
 {
   GstMpegtsSection *copy;
 
-  copy = g_slice_new0 (GstMpegtsSection);
+  copy = (GstMpegtsSection *) g_slice_new0 (GstMpegtsSectionImpl);
   gst_mini_object_init (GST_MINI_OBJECT_CAST (copy), 0, MPEG_TYPE_TS_SECTION,
       (GstMiniObjectCopyFunction) _gst_mpegts_section_copy, NULL,
       (GstMiniObjectFreeFunction) _gst_mpegts_section_free);
@@ -260,10 +413,54 @@ _gst_mpegts_section_copy (GstMpegtsSection * section)
   copy->cached_parsed = NULL;
   copy->offset = section->offset;
   copy->short_section = section->short_section;
+  if (SECTION_ARENA (section))
+    SECTION_ARENA (copy) = _gst_mpegts_arena_new ();
 
   return copy;
 }
 
+/**
+ * gst_mpegts_section_set_arena_parsing:
+ * @section: a #GstMpegtsSection
+ * @arena: whether to parse the table in an arena
+ *
+ * Makes the parsing of @section allocate the entries of its table (the
+ * streams of the PMT, NIT and BAT, the services of the SDT and the events
+ * of the EIT) and all their descriptors from a single arena, released at
+ * once with @section. The descriptors then point to the section data
+ * instead of copying it.
+ *
+ * The table is still parsed in full when it is first retrieved, but this
+ * avoids most of the small allocations done for tables with many entries
+ * and descriptors, such as the EIT schedule. In exchange, the entries and
+ * descriptors of the parsed table are only valid as long as @section is,
+ * even if the arrays holding them are referenced. The boxed copies of the
+ * table and of its entries copy all their descriptors, and can be kept
+ * after @section is released. The
+ * arrays returned by gst_mpegts_section_get_cat() and
+ * gst_mpegts_section_get_tsdt() are not affected.
+ *
+ * Must be called before the section is parsed.
+ *
+ * This is unstable API and may change in future.
+ *
+ * Since: 1.20
+ */
+void
+gst_mpegts_section_set_arena_parsing (GstMpegtsSection * section,
+    gboolean arena)
+{
+  g_return_if_fail (section != NULL);
+  g_return_if_fail (section->cached_parsed == NULL);
+
+  if (arena && !SECTION_ARENA (section)) {
+    SECTION_ARENA (section) = _gst_mpegts_arena_new ();
+  } else if (!arena && SECTION_ARENA (section)) {
+    _gst_mpegts_arena_free (SECTION_ARENA (section));
+    SECTION_ARENA (section) = NULL;
+  }
+}
+
 /**
  * gst_mpegts_section_get_data:
  * @section: a #GstMpegtsSection
@@ -644,16 +841,22 @@ _gst_mpegts_pmt_stream_copy (GstMpegtsPMTStream * pmt)
   GstMpegtsPMTStream *copy;
 
   copy = g_slice_dup (GstMpegtsPMTStream, pmt);
-  copy->descriptors = g_ptr_array_ref (pmt->descriptors);
+  copy->descriptors = _gst_mpegts_descriptors_copy (pmt->descriptors);
 
   return copy;
 }
 
 static void
-_gst_mpegts_pmt_stream_free (GstMpegtsPMTStream * pmt)
+_gst_mpegts_pmt_stream_clear (GstMpegtsPMTStream * pmt)
 {
   if (pmt->descriptors)
     g_ptr_array_unref (pmt->descriptors);
+}
+
+static void
+_gst_mpegts_pmt_stream_free (GstMpegtsPMTStream * pmt)
+{
+  _gst_mpegts_pmt_stream_clear (pmt);
   g_slice_free (GstMpegtsPMTStream, pmt);
 }
 
@@ -667,9 +870,10 @@ _gst_mpegts_pmt_copy (GstMpegtsPMT * pmt)
   GstMpegtsPMT *copy;
 
   copy = g_slice_dup (GstMpegtsPMT, pmt);
-  if (pmt->descriptors)
-    copy->descriptors = g_ptr_array_ref (pmt->descriptors);
-  copy->streams = g_ptr_array_ref (pmt->streams);
+  copy->descriptors = _gst_mpegts_descriptors_copy (pmt->descriptors);
+  copy->streams = _gst_mpegts_entries_copy (pmt->streams,
+      (GBoxedCopyFunc) _gst_mpegts_pmt_stream_copy,
+      (GDestroyNotify) _gst_mpegts_pmt_stream_free);
 
   return copy;
 }
@@ -722,19 +926,21 @@ _parse_pmt (GstMpegtsSection * section)
         section->pid, program_info_length, (gint) (end - data));
     goto error;
   }
-  pmt->descriptors = gst_mpegts_parse_descriptors (data, program_info_length);
+  pmt->descriptors = _gst_mpegts_section_parse_descriptors (section, data,
+      program_info_length);
   if (pmt->descriptors == NULL)
     goto error;
   data += program_info_length;
 
-  pmt->streams =
-      g_ptr_array_new_full (allocated_streams,
-      (GDestroyNotify) _gst_mpegts_pmt_stream_free);
+  pmt->streams = _gst_mpegts_section_new_entries (section, allocated_streams,
+      (GDestroyNotify) _gst_mpegts_pmt_stream_free,
+      (GDestroyNotify) _gst_mpegts_pmt_stream_clear);
 
   /* parse entries, cycle until there's space for another entry (at least 5
    * bytes) plus the CRC */
   while (data <= end - 4 - 5) {
-    GstMpegtsPMTStream *stream = g_slice_new0 (GstMpegtsPMTStream);
+    GstMpegtsPMTStream *stream =
+        _gst_mpegts_section_new_entry (section, GstMpegtsPMTStream);
 
     g_ptr_array_add (pmt->streams, stream);
 
@@ -754,7 +960,8 @@ _parse_pmt (GstMpegtsSection * section)
     }
 
     stream->descriptors =
-        gst_mpegts_parse_descriptors (data, stream_info_length);
+        _gst_mpegts_section_parse_descriptors (section, data,
+        stream_info_length);
     if (stream->descriptors == NULL)
       goto error;
     data += stream_info_length;
@@ -1149,7 +1356,7 @@ _gst_mpegts_section_init (guint16 pid, guint8 table_id)
 {
   GstMpegtsSection *section;
 
-  section = g_slice_new0 (GstMpegtsSection);
+  section = (GstMpegtsSection *) g_slice_new0 (GstMpegtsSectionImpl);
   gst_mini_object_init (GST_MINI_OBJECT_CAST (section), 0, MPEG_TYPE_TS_SECTION,
       (GstMiniObjectCopyFunction) _gst_mpegts_section_copy, NULL,
       (GstMiniObjectFreeFunction) _gst_mpegts_section_free);
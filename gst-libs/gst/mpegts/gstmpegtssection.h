@@ -186,6 +186,10 @@ struct _GstMpegtsSection
 GST_MPEGTS_API
 GBytes *gst_mpegts_section_get_data (GstMpegtsSection *section);
 
+GST_MPEGTS_API
+void gst_mpegts_section_set_arena_parsing (GstMpegtsSection *section,
+					   gboolean arena);
+
 /* PAT */
 #define GST_TYPE_MPEGTS_PAT_PROGRAM (gst_mpegts_pat_program_get_type())
 
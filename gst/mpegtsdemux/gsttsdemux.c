@@ -25,6 +25,8 @@
 #include "mpegtsbase.h"
 #include "mpegtspacketizer.h"
 #include "mpegtsparse.h"
+#include "mpegtsremux.h"
+#include "mpegtsvalidator.h"
 #include "tsdemux.h"
 
 
@@ -36,6 +38,10 @@ plugin_init (GstPlugin * plugin)
     return FALSE;
   if (!gst_mpegtsparse_plugin_init (plugin))
     return FALSE;
+  if (!gst_mpegtsremux_plugin_init (plugin))
+    return FALSE;
+  if (!gst_mpegtsvalidator_plugin_init (plugin))
+    return FALSE;
   if (!gst_ts_demux_plugin_init (plugin))
     return FALSE;
   return TRUE;
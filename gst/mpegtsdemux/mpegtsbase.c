@@ -64,6 +64,10 @@ static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
     );
 
 #define DEFAULT_IGNORE_PCR FALSE
+#define DEFAULT_CACHE_EIT FALSE
+
+/* Number of packets parsed at once by the chain function */
+#define MPEGTS_BASE_PACKET_BATCH 64
 
 enum
 {
@@ -71,6 +75,7 @@ enum
   PROP_PARSE_PRIVATE_SECTIONS,
   PROP_IGNORE_PCR,
   PROP_BCAS_DESCRAMBLE,
+  PROP_CACHE_EIT,
   /* FILL ME */
 };
 
@@ -101,6 +106,8 @@ static gboolean mpegts_base_get_tags_from_eit (MpegTSBase * base,
     GstMpegtsSection * section);
 static gboolean mpegts_base_parse_atsc_mgt (MpegTSBase * base,
     GstMpegtsSection * section);
+static GstStructure *mpegts_base_get_eit_schedule (MpegTSBase * base,
+    guint service_id);
 static gboolean remove_each_program (gpointer key, MpegTSBaseProgram * program,
     MpegTSBase * base);
 
@@ -167,6 +174,46 @@ mpegts_base_class_init (MpegTSBaseClass * klass)
           "Ignore PCR stream for timing", DEFAULT_IGNORE_PCR,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstMpegtsBase:cache-eit:
+   *
+   * Keep the events of the EIT schedule tables in the element, by service
+   * and event_id, instead of posting every EIT schedule section on the bus.
+   *
+   * Whenever a section adds, changes or removes events, a
+   * "mpegts-eit-update" element message is posted with the
+   * "original-network-id", "transport-stream-id" and "service-id" of the
+   * service, the added or changed #GstMpegtsEITEvent in "events" and the
+   * event_id of the removed events in "removed". The whole schedule of a
+   * service can be retrieved with #GstMpegtsBase::get-eit-schedule.
+   *
+   * EIT present/following sections are still posted as usual.
+   */
+  g_object_class_install_property (gobject_class, PROP_CACHE_EIT,
+      g_param_spec_boolean ("cache-eit", "Cache EIT schedule",
+          "Cache the EIT schedule and only post the changes",
+          DEFAULT_CACHE_EIT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstMpegtsBase::get-eit-schedule:
+   * @base: the element
+   * @service_id: the service_id (program number) of the service
+   *
+   * Action signal to retrieve the EIT schedule cached for a service when
+   * #GstMpegtsBase:cache-eit is enabled.
+   *
+   * Returns: (transfer full) (nullable): a "mpegts-eit-schedule"
+   * #GstStructure with the "original-network-id", "transport-stream-id"
+   * and "service-id" of the service and its #GstMpegtsEITEvent sorted by
+   * start time in "events", or %NULL if the service has no schedule.
+   */
+  g_signal_new ("get-eit-schedule", G_TYPE_FROM_CLASS (klass),
+      G_SIGNAL_RUN_LAST | G_SIGNAL_ACTION,
+      G_STRUCT_OFFSET (MpegTSBaseClass, get_eit_schedule), NULL, NULL, NULL,
+      GST_TYPE_STRUCTURE, 1, G_TYPE_UINT);
+
+  klass->get_eit_schedule = GST_DEBUG_FUNCPTR (mpegts_base_get_eit_schedule);
+
   klass->sink_query = GST_DEBUG_FUNCPTR (mpegts_base_default_sink_query);
 
   gst_type_mark_as_plugin_api (GST_TYPE_MPEGTS_BASE, 0);
@@ -185,6 +232,9 @@ mpegts_base_set_property (GObject * object, guint prop_id,
     case PROP_IGNORE_PCR:
       base->ignore_pcr = g_value_get_boolean (value);
       break;
+    case PROP_CACHE_EIT:
+      base->cache_eit = g_value_get_boolean (value);
+      break;
     case PROP_BCAS_DESCRAMBLE:
     {
       gboolean onoff = FALSE;
@@ -229,6 +279,9 @@ mpegts_base_get_property (GObject * object, guint prop_id,
     case PROP_IGNORE_PCR:
       g_value_set_boolean (value, base->ignore_pcr);
       break;
+    case PROP_CACHE_EIT:
+      g_value_set_boolean (value, base->cache_eit);
+      break;
     case PROP_BCAS_DESCRAMBLE:
       g_value_set_boolean (value, base->descramble);
       break;
@@ -238,37 +291,49 @@ mpegts_base_get_property (GObject * object, guint prop_id,
 }
 
 
+static inline void
+mpegts_base_wait_pushed (MpegTSBase * base)
+{
+  MpegTSBaseClass *klass = GST_MPEGTS_BASE_GET_CLASS (base);
+
+  if (klass->wait_pushed)
+    klass->wait_pushed (base);
+}
+
 static void
 mpegts_base_reset (MpegTSBase * base)
 {
   MpegTSBaseClass *klass = GST_MPEGTS_BASE_GET_CLASS (base);
 
+  mpegts_base_wait_pushed (base);
+
   mpegts_packetizer_clear (base->packetizer);
-  memset (base->is_pes, 0, 1024);
-  memset (base->known_psi, 0, 1024);
+  memset (base->pids, 0, MPEGTS_BASE_N_PIDS * sizeof (MpegTSBasePID));
 
   /* FIXME : Actually these are not *always* know SI streams
    * depending on the variant of mpeg-ts being used. */
 
   /* Known PIDs : PAT, TSDT, IPMP CIT */
-  MPEGTS_BIT_SET (base->known_psi, 0);
-  MPEGTS_BIT_SET (base->known_psi, 2);
-  MPEGTS_BIT_SET (base->known_psi, 3);
+  MPEGTS_BASE_SET_PSI (base, 0);
+  MPEGTS_BASE_SET_PSI (base, 2);
+  MPEGTS_BASE_SET_PSI (base, 3);
   /* EIT for ISDB */
-  MPEGTS_BIT_SET (base->known_psi, 0x12);
+  MPEGTS_BASE_SET_PSI (base, 0x12);
   /* TDT, TOT, ST */
-  MPEGTS_BIT_SET (base->known_psi, 0x14);
+  MPEGTS_BASE_SET_PSI (base, 0x14);
   /* network synchronization */
-  MPEGTS_BIT_SET (base->known_psi, 0x15);
+  MPEGTS_BASE_SET_PSI (base, 0x15);
 
   /* ATSC */
-  MPEGTS_BIT_SET (base->known_psi, 0x1ffb);
+  MPEGTS_BASE_SET_PSI (base, 0x1ffb);
 
   if (base->pat) {
     g_ptr_array_unref (base->pat);
     base->pat = NULL;
   }
 
+  mpegts_eit_cache_clear (base->eit_cache);
+
   gst_segment_init (&base->segment, GST_FORMAT_UNDEFINED);
   gst_segment_init (&base->out_segment, GST_FORMAT_UNDEFINED);
   base->last_seek_seqnum = GST_SEQNUM_INVALID;
@@ -280,7 +345,6 @@ mpegts_base_reset (MpegTSBase * base)
   g_hash_table_foreach_remove (base->programs, (GHRFunc) remove_each_program,
       base);
   g_hash_table_remove_all (base->ecms);
-  g_hash_table_remove_all (base->stream_map);
 
   base->streams_aware = GST_OBJECT_PARENT (base)
       && GST_OBJECT_FLAG_IS_SET (GST_OBJECT_PARENT (base),
@@ -309,19 +373,18 @@ mpegts_base_init (MpegTSBase * base)
       NULL, (GDestroyNotify) mpegts_base_free_program);
   base->ecms = g_hash_table_new_full (g_direct_hash, g_direct_equal,
       NULL, (GDestroyNotify) g_free);
-  base->stream_map = g_hash_table_new_full (g_direct_hash, g_direct_equal,
-      NULL, NULL);
 
   base->parse_private_sections = FALSE;
   base->descramble = FALSE;
-  base->is_pes = g_new0 (guint8, 1024);
-  base->known_psi = g_new0 (guint8, 1024);
+  base->pids = g_new0 (MpegTSBasePID, MPEGTS_BASE_N_PIDS);
   base->program_size = sizeof (MpegTSBaseProgram);
   base->stream_size = sizeof (MpegTSBaseStream);
 
   base->push_data = TRUE;
   base->push_section = TRUE;
   base->ignore_pcr = DEFAULT_IGNORE_PCR;
+  base->cache_eit = DEFAULT_CACHE_EIT;
+  base->eit_cache = mpegts_eit_cache_new ();
 
   mpegts_base_reset (base);
 }
@@ -334,8 +397,7 @@ mpegts_base_dispose (GObject * object)
   if (!base->disposed) {
     g_object_unref (base->packetizer);
     base->disposed = TRUE;
-    g_free (base->known_psi);
-    g_free (base->is_pes);
+    g_free (base->pids);
   }
 
   if (G_OBJECT_CLASS (parent_class)->dispose)
@@ -353,7 +415,7 @@ mpegts_base_finalize (GObject * object)
   }
   g_hash_table_destroy (base->programs);
   g_hash_table_destroy (base->ecms);
-  g_hash_table_destroy (base->stream_map);
+  mpegts_eit_cache_free (base->eit_cache);
 
   if (G_OBJECT_CLASS (parent_class)->finalize)
     G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -493,11 +555,11 @@ mpegts_base_add_program (MpegTSBase * base,
   program = mpegts_base_new_program (base, program_number, pmt_pid);
 
   /* Mark the PMT PID as being a known PSI PID */
-  if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->known_psi, pmt_pid))) {
+  if (G_UNLIKELY (MPEGTS_BASE_IS_PSI (base, pmt_pid))) {
     GST_FIXME ("Refcounting. Setting twice a PID (0x%04x) as known PSI",
         pmt_pid);
   }
-  MPEGTS_BIT_SET (base->known_psi, pmt_pid);
+  MPEGTS_BASE_SET_PSI (base, pmt_pid);
 
   g_hash_table_insert (base->programs,
       GINT_TO_POINTER (program_number), program);
@@ -627,7 +689,7 @@ mpegts_base_add_ecm (MpegTSBase * base, guint cas_id, guint ecm_pid)
   ecm->cas_id = (guint16) cas_id;
   ecm->refcount = 1;
   g_hash_table_insert (base->ecms, GUINT_TO_POINTER (ecm_pid), ecm);
-  MPEGTS_BIT_SET (base->known_psi, ecm_pid);
+  MPEGTS_BASE_SET_PSI (base, ecm_pid);
   GST_LOG_OBJECT (base, "added ecm:0x%04x\n", ecm_pid);
   return ecm;
 }
@@ -642,7 +704,7 @@ mpegts_base_remove_ecm (MpegTSBase * base, guint ecm_pid)
     return;
 
   g_hash_table_remove (base->ecms, GUINT_TO_POINTER (ecm_pid));
-  MPEGTS_BIT_UNSET (base->known_psi, ecm_pid);
+  MPEGTS_BASE_UNSET_PSI (base, ecm_pid);
   GST_LOG_OBJECT (base, "removed ecm:0x%04x\n", ecm_pid);
 }
 
@@ -706,7 +768,7 @@ mpegts_base_program_add_stream (MpegTSBase * base,
 
   program->streams[pid] = bstream;
   program->stream_list = g_list_append (program->stream_list, bstream);
-  g_hash_table_insert (base->stream_map, GUINT_TO_POINTER (pid), bstream);
+  base->pids[pid].stream = bstream;
 
   if (klass->stream_added)
     if (klass->stream_added (base, bstream, program))
@@ -740,6 +802,8 @@ mpegts_base_program_remove_stream (MpegTSBase * base,
 
   mpegts_base_remove_ecm (base, stream->ecm_pid);
   program->stream_list = g_list_remove_all (program->stream_list, stream);
+  if (base->pids[pid].stream == stream)
+    base->pids[pid].stream = NULL;
   mpegts_base_free_stream (stream);
   program->streams[pid] = NULL;
 }
@@ -837,7 +901,7 @@ mpegts_base_update_program (MpegTSBase * base, MpegTSBaseProgram * program,
     }
   }
   mpegts_base_program_add_stream (base, program, pmt->pcr_pid, -1, NULL);
-  MPEGTS_BIT_SET (base->is_pes, pmt->pcr_pid);
+  MPEGTS_BASE_SET_PES (base, pmt->pcr_pid);
   old_pcr_pid = program->pcr_pid;
   program->pcr_pid = pmt->pcr_pid;
 
@@ -858,7 +922,7 @@ mpegts_base_update_program (MpegTSBase * base, MpegTSBaseProgram * program,
   }
   if (old_pcr_pid != 0xFFFF &&
       old_pcr_pid != pmt->pcr_pid && !program->streams[old_pcr_pid])
-    MPEGTS_BIT_UNSET (base->is_pes, old_pcr_pid);
+    MPEGTS_BASE_UNSET_PES (base, old_pcr_pid);
   return TRUE;
 }
 
@@ -1064,16 +1128,15 @@ mpegts_base_deactivate_program (MpegTSBase * base, MpegTSBaseProgram * program)
 
       mpegts_base_program_remove_stream (base, program, stream->pid);
 
-      /* Only unset the is_pes/known_psi bit if the PID isn't used in any other active
+      /* Only unset the PES/PSI flag if the PID isn't used in any other active
        * program */
       if (!mpegts_pid_in_active_programs (base, stream->pid)) {
         if (_stream_is_private_section (program->pmt, stream)) {
           if (base->parse_private_sections)
-            MPEGTS_BIT_UNSET (base->known_psi, stream->pid);
+            MPEGTS_BASE_UNSET_PSI (base, stream->pid);
         } else {
-          MPEGTS_BIT_UNSET (base->is_pes, stream->pid);
+          MPEGTS_BASE_UNSET_PES (base, stream->pid);
         }
-        g_hash_table_remove (base->stream_map, GUINT_TO_POINTER (stream->pid));
       }
     }
 
@@ -1082,7 +1145,7 @@ mpegts_base_deactivate_program (MpegTSBase * base, MpegTSBaseProgram * program)
     /* FIXME : This might actually be shared with another stream ? */
     mpegts_base_program_remove_stream (base, program, program->pcr_pid);
     if (!mpegts_pid_in_active_programs (base, program->pcr_pid))
-      MPEGTS_BIT_UNSET (base->is_pes, program->pcr_pid);
+      MPEGTS_BASE_UNSET_PES (base, program->pcr_pid);
 
     GST_DEBUG ("program stream_list is now %p", program->stream_list);
   }
@@ -1138,19 +1201,19 @@ mpegts_base_activate_program (MpegTSBase * base, MpegTSBaseProgram * program,
     GstMpegtsPMTStream *stream = g_ptr_array_index (pmt->streams, i);
     if (_stream_is_private_section (pmt, stream)) {
       if (base->parse_private_sections)
-        MPEGTS_BIT_SET (base->known_psi, stream->pid);
+        MPEGTS_BASE_SET_PSI (base, stream->pid);
     } else {
-      if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->is_pes, stream->pid)))
+      if (G_UNLIKELY (MPEGTS_BASE_IS_PES (base, stream->pid)))
         GST_FIXME
             ("Refcounting issue. Setting twice a PID (0x%04x) as known PES",
             stream->pid);
-      if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->known_psi, stream->pid))) {
+      if (G_UNLIKELY (MPEGTS_BASE_IS_PSI (base, stream->pid))) {
         GST_FIXME
             ("Refcounting issue. Setting a known PSI PID (0x%04x) as known PES",
             stream->pid);
-        MPEGTS_BIT_UNSET (base->known_psi, stream->pid);
+        MPEGTS_BASE_UNSET_PSI (base, stream->pid);
       }
-      MPEGTS_BIT_SET (base->is_pes, stream->pid);
+      MPEGTS_BASE_SET_PES (base, stream->pid);
     }
     mpegts_base_program_add_stream (base, program,
         stream->pid, stream->stream_type, stream);
@@ -1158,7 +1221,7 @@ mpegts_base_activate_program (MpegTSBase * base, MpegTSBaseProgram * program,
   /* We add the PCR pid last. If that PID is already used by one of the media
    * streams above, no new stream will be created */
   mpegts_base_program_add_stream (base, program, program->pcr_pid, -1, NULL);
-  MPEGTS_BIT_SET (base->is_pes, program->pcr_pid);
+  MPEGTS_BASE_SET_PES (base, program->pcr_pid);
 
   program->active = TRUE;
   program->initial_program = initial_program;
@@ -1211,15 +1274,15 @@ mpegts_base_apply_pat (MpegTSBase * base, GstMpegtsSection * section)
           /* FIXME: when this happens it may still be pmt pid of another
            * program, so setting to False may make it go through expensive
            * path in is_psi unnecessarily */
-          MPEGTS_BIT_UNSET (base->known_psi, program->pmt_pid);
+          MPEGTS_BASE_UNSET_PSI (base, program->pmt_pid);
         }
 
         program->pmt_pid = patp->network_or_program_map_PID;
-        if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->known_psi, program->pmt_pid)))
+        if (G_UNLIKELY (MPEGTS_BASE_IS_PSI (base, program->pmt_pid)))
           GST_FIXME
               ("Refcounting issue. Setting twice a PMT PID (0x%04x) as know PSI",
               program->pmt_pid);
-        MPEGTS_BIT_SET (base->known_psi, patp->network_or_program_map_PID);
+        MPEGTS_BASE_SET_PSI (base, patp->network_or_program_map_PID);
       }
     } else {
       /* Create a new program */
@@ -1265,13 +1328,13 @@ mpegts_base_apply_pat (MpegTSBase * base, GstMpegtsSection * section)
       /* FIXME: when this happens it may still be pmt pid of another
        * program, so setting to False may make it go through expensive
        * path in is_psi unnecessarily */
-      if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->known_psi,
+      if (G_UNLIKELY (MPEGTS_BASE_IS_PSI (base,
                   patp->network_or_program_map_PID))) {
         GST_FIXME
             ("Program refcounting : Setting twice a pid (0x%04x) as known PSI",
             patp->network_or_program_map_PID);
       }
-      MPEGTS_BIT_UNSET (base->known_psi, patp->network_or_program_map_PID);
+      MPEGTS_BASE_UNSET_PSI (base, patp->network_or_program_map_PID);
       mpegts_packetizer_remove_stream (base->packetizer,
           patp->network_or_program_map_PID);
     }
@@ -1404,6 +1467,23 @@ mpegts_base_apply_ecm (MpegTSBase * base, GstMpegtsSection * section)
   return;
 }
 
+static void
+mpegts_base_update_eit_cache (MpegTSBase * base, GstMpegtsSection * section)
+{
+  GstStructure *update;
+
+  update = mpegts_eit_cache_update (base->eit_cache, section);
+  if (update)
+    gst_element_post_message (GST_ELEMENT_CAST (base),
+        gst_message_new_element (GST_OBJECT (base), update));
+}
+
+static GstStructure *
+mpegts_base_get_eit_schedule (MpegTSBase * base, guint service_id)
+{
+  return mpegts_eit_cache_get_schedule (base->eit_cache, service_id);
+}
+
 static void
 mpegts_base_handle_psi (MpegTSBase * base, GstMpegtsSection * section)
 {
@@ -1426,6 +1506,15 @@ mpegts_base_handle_psi (MpegTSBase * base, GstMpegtsSection * section)
       post_message = mpegts_base_apply_pmt (base, section);
       break;
     case GST_MPEGTS_SECTION_EIT:
+      if (base->cache_eit && MPEGTS_EIT_IS_SCHEDULE (section->table_id)) {
+        /* The section is not posted and the cache copies what it keeps, so
+         * its events can be parsed in the section arena */
+        if (section->cached_parsed == NULL)
+          gst_mpegts_section_set_arena_parsing (section, TRUE);
+        mpegts_base_update_eit_cache (base, section);
+        post_message = FALSE;
+        break;
+      }
       /* some tag xtraction + posting */
       post_message = mpegts_base_get_tags_from_eit (base, section);
       break;
@@ -1464,7 +1553,7 @@ mpegts_base_parse_atsc_mgt (MpegTSBase * base, GstMpegtsSection * section)
             table->table_type <= GST_MPEGTS_ATSC_MGT_TABLE_TYPE_EIT127) ||
         (table->table_type >= GST_MPEGTS_ATSC_MGT_TABLE_TYPE_ETT0 &&
             table->table_type <= GST_MPEGTS_ATSC_MGT_TABLE_TYPE_ETT127)) {
-      MPEGTS_BIT_SET (base->known_psi, table->pid);
+      MPEGTS_BASE_SET_PSI (base, table->pid);
     }
   }
 
@@ -1579,6 +1668,9 @@ mpegts_base_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
   GST_DEBUG_OBJECT (base, "Got event %s",
       gst_event_type_get_name (GST_EVENT_TYPE (event)));
 
+  if (GST_EVENT_IS_SERIALIZED (event))
+    mpegts_base_wait_pushed (base);
+
   switch (GST_EVENT_TYPE (event)) {
     case GST_EVENT_SEGMENT:
       gst_event_copy_segment (event, &base->segment);
@@ -1650,8 +1742,7 @@ mpegts_base_packet_scrambled (MpegTSBase * base,
   int ret;
   static guint8 buf[MPEGTS_MAX_PACKETSIZE];
 
-  stream =
-      g_hash_table_lookup (base->stream_map, GUINT_TO_POINTER (packet->pid));
+  stream = base->pids[packet->pid].stream;
   if (stream == NULL) {
     GST_LOG ("PMT not ready yet for pid:0x%04hx.", packet->pid);
     return;
@@ -1681,15 +1772,77 @@ mpegts_base_packet_scrambled (MpegTSBase * base,
   return;
 }
 
+static inline GstFlowReturn
+mpegts_base_handle_packet (MpegTSBase * base, MpegTSBaseClass * klass,
+    MpegTSPacketizerPacket * packet)
+{
+  GstFlowReturn res = GST_FLOW_OK;
+  guint8 flags;
+
+  mpegts_packetizer_process_pcr (base->packetizer, packet);
+
+  if (klass->inspect_packet)
+    klass->inspect_packet (base, packet);
+
+  if (FLAGS_SCRAMBLED (packet->scram_afc_cc)) {
+    if (!base->descramble || !base->dm2_handle)
+      return GST_FLOW_OK;
+    mpegts_base_packet_scrambled (base, packet);
+    if (FLAGS_SCRAMBLED (packet->scram_afc_cc))
+      return GST_FLOW_OK;
+  }
+
+  flags = base->pids[packet->pid].flags;
+
+  /* If it's a known PES, push it */
+  if (flags & MPEGTS_BASE_PID_PES) {
+    /* push the packet downstream */
+    if (base->push_data)
+      res = klass->push (base, packet, NULL);
+  } else if (packet->payload && (flags & MPEGTS_BASE_PID_PSI)) {
+    /* base PSI data */
+    GList *others, *tmp;
+    GstMpegtsSection *section;
+
+    section = mpegts_packetizer_push_section (base->packetizer, packet,
+        &others);
+    /* Only new or updated sections are returned */
+    if (section || others)
+      mpegts_base_wait_pushed (base);
+    /* Handling the section might release it (e.g. when it's merged into
+     * the EIT cache), keep it alive until it has been pushed */
+    if (section)
+      mpegts_base_handle_psi (base, gst_mpegts_section_ref (section));
+    if (G_UNLIKELY (others)) {
+      for (tmp = others; tmp; tmp = tmp->next)
+        mpegts_base_handle_psi (base, (GstMpegtsSection *) tmp->data);
+      g_list_free (others);
+    }
+
+    /* we need to push section packet downstream */
+    if (base->push_section)
+      res = klass->push (base, packet, section);
+
+    if (section)
+      gst_mpegts_section_unref (section);
+
+  } else if (base->push_unknown) {
+    res = klass->push (base, packet, NULL);
+  } else if (packet->payload && packet->pid != 0x1fff)
+    GST_LOG ("PID 0x%04x Saw packet on a pid we don't handle", packet->pid);
+
+  return res;
+}
+
 static GstFlowReturn
 mpegts_base_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 {
   GstFlowReturn res = GST_FLOW_OK;
   MpegTSBase *base;
-  MpegTSPacketizerPacketReturn pret;
   MpegTSPacketizer2 *packetizer;
-  MpegTSPacketizerPacket packet;
+  MpegTSPacketizerPacket packets[MPEGTS_BASE_PACKET_BATCH];
   MpegTSBaseClass *klass;
+  guint i, n_packets;
 
   base = GST_MPEGTS_BASE (parent);
   klass = GST_MPEGTS_BASE_GET_CLASS (base);
@@ -1698,6 +1851,7 @@ mpegts_base_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 
   if (GST_BUFFER_IS_DISCONT (buf)) {
     GST_DEBUG_OBJECT (base, "Got DISCONT buffer, flushing");
+    mpegts_base_wait_pushed (base);
     res = mpegts_base_drain (base);
     if (G_UNLIKELY (res != GST_FLOW_OK))
       return res;
@@ -1714,67 +1868,31 @@ mpegts_base_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       mpegts_packetizer_flush (base->packetizer, FALSE);
   }
 
+  /* Kept for input_done(), the packetizer only reads it */
+  if (klass->input_done)
+    gst_buffer_ref (buf);
   mpegts_packetizer_push (base->packetizer, buf);
 
   while (res == GST_FLOW_OK) {
-    pret = mpegts_packetizer_next_packet (base->packetizer, &packet);
+    n_packets = mpegts_packetizer_next_packets (packetizer, packets,
+        G_N_ELEMENTS (packets));
 
     /* If we don't have enough data, return */
-    if (G_UNLIKELY (pret == PACKET_NEED_MORE))
+    if (G_UNLIKELY (n_packets == 0))
       break;
 
-    if (G_UNLIKELY (pret == PACKET_BAD)) {
-      /* bad header, skip the packet */
-      GST_DEBUG_OBJECT (base, "bad packet, skipping");
-      goto next;
-    }
-
-    if (klass->inspect_packet)
-      klass->inspect_packet (base, &packet);
+    for (i = 0; i < n_packets && res == GST_FLOW_OK; i++)
+      res = mpegts_base_handle_packet (base, klass, &packets[i]);
 
-    if (FLAGS_SCRAMBLED (packet.scram_afc_cc)) {
-      if (!base->descramble || !base->dm2_handle)
-        goto next;
-      mpegts_base_packet_scrambled (base, &packet);
-      if (FLAGS_SCRAMBLED (packet.scram_afc_cc))
-        goto next;
-    }
-
-    /* If it's a known PES, push it */
-    if (MPEGTS_BIT_IS_SET (base->is_pes, packet.pid)) {
-      /* push the packet downstream */
-      if (base->push_data)
-        res = klass->push (base, &packet, NULL);
-    } else if (packet.payload
-        && MPEGTS_BIT_IS_SET (base->known_psi, packet.pid)) {
-      /* base PSI data */
-      GList *others, *tmp;
-      GstMpegtsSection *section;
-
-      section = mpegts_packetizer_push_section (packetizer, &packet, &others);
-      if (section)
-        mpegts_base_handle_psi (base, section);
-      if (G_UNLIKELY (others)) {
-        for (tmp = others; tmp; tmp = tmp->next)
-          mpegts_base_handle_psi (base, (GstMpegtsSection *) tmp->data);
-        g_list_free (others);
-      }
-
-      /* we need to push section packet downstream */
-      if (base->push_section)
-        res = klass->push (base, &packet, section);
-
-    } else if (base->push_unknown) {
-      res = klass->push (base, &packet, NULL);
-    } else if (packet.payload && packet.pid != 0x1fff)
-      GST_LOG ("PID 0x%04x Saw packet on a pid we don't handle", packet.pid);
-
-  next:
-    mpegts_packetizer_clear_packet (base->packetizer, &packet);
+    /* Only release what was handled, the rest will be parsed again */
+    mpegts_packetizer_clear_packets (packetizer, &packets[i - 1]);
   }
 
-  if (res == GST_FLOW_OK && klass->input_done)
-    res = klass->input_done (base);
+  if (klass->input_done) {
+    if (res == GST_FLOW_OK)
+      res = klass->input_done (base, buf);
+    gst_buffer_unref (buf);
+  }
 
   return res;
 }
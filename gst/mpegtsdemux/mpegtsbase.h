@@ -32,6 +32,7 @@
 
 #include <gst/gst.h>
 #include "mpegtspacketizer.h"
+#include "mpegtseit.h"
 
 G_BEGIN_DECLS
 
@@ -108,6 +109,30 @@ struct _MpegTSBaseECM
   guint   refcount;
 };
 
+#define MPEGTS_BASE_N_PIDS 0x2000
+
+typedef enum {
+  /* the pid carries sections handled by the base class */
+  MPEGTS_BASE_PID_PSI = 1 << 0,
+  /* the pid carries PES (or PCR) data of an active program */
+  MPEGTS_BASE_PID_PES = 1 << 1
+} MpegTSBasePIDFlags;
+
+typedef struct
+{
+  guint8 flags;
+  /* The last stream added with this pid, for efficient pid ->
+   * (MpegTSBaseStream *) mapping without searching through all programs */
+  MpegTSBaseStream *stream;
+} MpegTSBasePID;
+
+#define MPEGTS_BASE_SET_PSI(base, pid)   ((base)->pids[pid].flags |= MPEGTS_BASE_PID_PSI)
+#define MPEGTS_BASE_UNSET_PSI(base, pid) ((base)->pids[pid].flags &= ~MPEGTS_BASE_PID_PSI)
+#define MPEGTS_BASE_IS_PSI(base, pid)    ((base)->pids[pid].flags & MPEGTS_BASE_PID_PSI)
+#define MPEGTS_BASE_SET_PES(base, pid)   ((base)->pids[pid].flags |= MPEGTS_BASE_PID_PES)
+#define MPEGTS_BASE_UNSET_PES(base, pid) ((base)->pids[pid].flags &= ~MPEGTS_BASE_PID_PES)
+#define MPEGTS_BASE_IS_PES(base, pid)    ((base)->pids[pid].flags & MPEGTS_BASE_PID_PES)
+
 typedef enum {
   /* PULL MODE */
   BASE_MODE_SCANNING,		/* Looking for PAT/PMT */
@@ -136,17 +161,13 @@ struct _MpegTSBase {
    * accessed from the application thread and the streaming thread */
   GHashTable *programs;
   GHashTable *ecms;
-  /* for efficient pid -> (MpegTSBaseStream *) mapping in descrambling process,
-   * without searching through all programs */
-  GHashTable *stream_map;
 
   GPtrArray  *pat;
   MpegTSPacketizer2 *packetizer;
 
-  /* arrays that say whether a pid is a known psi pid or a pes pid */
-  /* Use MPEGTS_BIT_* to set/unset/check the values */
-  guint8 *known_psi;
-  guint8 *is_pes;
+  /* Per-PID dispatch table (MPEGTS_BASE_N_PIDS entries), indexed by pid.
+   * Use MPEGTS_BASE_{SET,UNSET,IS}_* to set/unset/check the flags */
+  MpegTSBasePID *pids;
 
   gboolean disposed;
 
@@ -189,6 +210,11 @@ struct _MpegTSBase {
   /* Do not use the PCR stream for timestamp calculation. Useful for
    * streams with broken/invalid PCR streams. */
   gboolean ignore_pcr;
+
+  /* Whether to store the EIT schedule sections in eit_cache instead of
+   * posting them */
+  gboolean cache_eit;
+  MpegTSEITCache *eit_cache;
 };
 
 struct _MpegTSBaseClass {
@@ -230,8 +256,14 @@ struct _MpegTSBaseClass {
    * or partially in pull mode seeks of tsdemux */
   void (*flush) (MpegTSBase * base, gboolean hard);
 
-  /* Notifies subclasses input buffer has been handled */
-  GstFlowReturn (*input_done) (MpegTSBase *base);
+  /* Notifies subclasses input @buffer has been handled. @buffer isn't
+   * owned by the subclass, which can take a reference to forward it */
+  GstFlowReturn (*input_done) (MpegTSBase *base, GstBuffer *buffer);
+
+  /* Wait until all packets given to push() have been processed, for
+   * subclasses handling them asynchronously. Called from the streaming
+   * thread before programs, streams or segments get modified */
+  void (*wait_pushed) (MpegTSBase *base);
 
   /* signals */
   void (*pat_info) (GstStructure *pat);
@@ -242,6 +274,9 @@ struct _MpegTSBaseClass {
 
   /* takes ownership of @query */
   gboolean (*sink_query) (MpegTSBase *base, GstQuery * query);
+
+  /* actions */
+  GstStructure * (*get_eit_schedule) (MpegTSBase *base, guint service_id);
 };
 
 #define MPEGTS_BIT_SET(field, offs)    ((field)[(offs) >> 3] |=  (1 << ((offs) & 0x7)))
@@ -0,0 +1,409 @@
+/*
+ * mpegtseit.c - EIT schedule cache
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "mpegtseit.h"
+
+GST_DEBUG_CATEGORY_STATIC (mpegts_eit_debug);
+#define GST_CAT_DEFAULT mpegts_eit_debug
+
+/* The cache stores the events of the EIT schedule tables by service and
+ * event_id. The packetizer only hands over new or updated sections, each of
+ * which is compared against the cached events, so that only the events which
+ * were added, changed or removed get reported.
+ *
+ * An event is removed when a new version of the section it was last seen in
+ * doesn't contain it anymore. */
+
+#define SERVICE_KEY(onid, tsid, sid) \
+  (((guint64) (onid) << 32) | ((guint64) (tsid) << 16) | (sid))
+
+struct _MpegTSEITCache
+{
+  /* Protects services, which are updated from the streaming thread and
+   * queried from the application thread */
+  GMutex lock;
+
+  /* MpegTSEITService, by SERVICE_KEY */
+  GHashTable *services;
+
+  /* Incremented for each section handled */
+  guint serial;
+};
+
+typedef struct
+{
+  guint64 key;
+  guint16 original_network_id;
+  guint16 transport_stream_id;
+  guint16 service_id;
+
+  /* MpegTSEITEntry, by event_id */
+  GHashTable *events;
+} MpegTSEITService;
+
+typedef struct
+{
+  GstMpegtsEITEvent *event;
+
+  /* Section the event was last seen in */
+  guint8 table_id;
+  guint8 section_number;
+  guint serial;
+} MpegTSEITEntry;
+
+/* Like the boxed copy, but also handles events without start time, and
+ * copies the descriptors since those of a section parsed lazily are only
+ * valid as long as the section */
+static GstMpegtsEITEvent *
+eit_event_copy (const GstMpegtsEITEvent * event)
+{
+  GstMpegtsEITEvent *copy;
+  guint i;
+
+  copy = g_slice_dup (GstMpegtsEITEvent, event);
+  if (copy->start_time)
+    gst_date_time_ref (copy->start_time);
+  if (event->descriptors) {
+    copy->descriptors = g_ptr_array_new_full (event->descriptors->len,
+        (GDestroyNotify) gst_mpegts_descriptor_free);
+    for (i = 0; i < event->descriptors->len; i++)
+      g_ptr_array_add (copy->descriptors,
+          g_boxed_copy (GST_TYPE_MPEGTS_DESCRIPTOR,
+              g_ptr_array_index (event->descriptors, i)));
+  }
+
+  return copy;
+}
+
+static void
+eit_entry_free (MpegTSEITEntry * entry)
+{
+  if (entry->event)
+    g_boxed_free (GST_TYPE_MPEGTS_EIT_EVENT, entry->event);
+  g_slice_free (MpegTSEITEntry, entry);
+}
+
+static void
+eit_service_free (MpegTSEITService * service)
+{
+  g_hash_table_unref (service->events);
+  g_slice_free (MpegTSEITService, service);
+}
+
+static gboolean
+date_time_equal (GstDateTime * a, GstDateTime * b)
+{
+  if (a == b)
+    return TRUE;
+  if (a == NULL || b == NULL)
+    return FALSE;
+
+  return gst_date_time_get_year (a) == gst_date_time_get_year (b) &&
+      gst_date_time_get_month (a) == gst_date_time_get_month (b) &&
+      gst_date_time_get_day (a) == gst_date_time_get_day (b) &&
+      gst_date_time_get_hour (a) == gst_date_time_get_hour (b) &&
+      gst_date_time_get_minute (a) == gst_date_time_get_minute (b) &&
+      gst_date_time_get_second (a) == gst_date_time_get_second (b);
+}
+
+static gboolean
+eit_event_equal (const GstMpegtsEITEvent * a, const GstMpegtsEITEvent * b)
+{
+  guint i, n_a, n_b;
+
+  if (a->duration != b->duration || a->running_status != b->running_status
+      || a->free_CA_mode != b->free_CA_mode)
+    return FALSE;
+
+  if (!date_time_equal (a->start_time, b->start_time))
+    return FALSE;
+
+  n_a = a->descriptors ? a->descriptors->len : 0;
+  n_b = b->descriptors ? b->descriptors->len : 0;
+  if (n_a != n_b)
+    return FALSE;
+
+  for (i = 0; i < n_a; i++) {
+    GstMpegtsDescriptor *desc_a = g_ptr_array_index (a->descriptors, i);
+    GstMpegtsDescriptor *desc_b = g_ptr_array_index (b->descriptors, i);
+
+    /* data includes the tag and length */
+    if (desc_a->length != desc_b->length ||
+        memcmp (desc_a->data, desc_b->data, desc_a->length + 2) != 0)
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/* Sort key for the start time, events without one are sorted last */
+static gint64
+eit_event_start_key (const GstMpegtsEITEvent * event)
+{
+  GstDateTime *t = event->start_time;
+
+  if (t == NULL)
+    return G_MAXINT64;
+
+  return (((((gint64) gst_date_time_get_year (t) * 13 +
+                  gst_date_time_get_month (t)) * 32 +
+              gst_date_time_get_day (t)) * 24 +
+          gst_date_time_get_hour (t)) * 60 +
+      gst_date_time_get_minute (t)) * 60 + gst_date_time_get_second (t);
+}
+
+static gint
+eit_entry_compare (MpegTSEITEntry ** a, MpegTSEITEntry ** b)
+{
+  gint64 start_a = eit_event_start_key ((*a)->event);
+  gint64 start_b = eit_event_start_key ((*b)->event);
+
+  if (start_a != start_b)
+    return start_a < start_b ? -1 : 1;
+
+  return (gint) (*a)->event->event_id - (gint) (*b)->event->event_id;
+}
+
+static GstStructure *
+eit_service_structure_new (const gchar * name, MpegTSEITService * service)
+{
+  return gst_structure_new (name,
+      "original-network-id", G_TYPE_UINT, service->original_network_id,
+      "transport-stream-id", G_TYPE_UINT, service->transport_stream_id,
+      "service-id", G_TYPE_UINT, service->service_id, NULL);
+}
+
+static void
+append_event (GValue * array, const GstMpegtsEITEvent * event)
+{
+  GValue value = G_VALUE_INIT;
+
+  g_value_init (&value, GST_TYPE_MPEGTS_EIT_EVENT);
+  g_value_take_boxed (&value, eit_event_copy (event));
+  gst_value_array_append_and_take_value (array, &value);
+}
+
+static void
+append_event_id (GValue * array, guint event_id)
+{
+  GValue value = G_VALUE_INIT;
+
+  g_value_init (&value, G_TYPE_UINT);
+  g_value_set_uint (&value, event_id);
+  gst_value_array_append_and_take_value (array, &value);
+}
+
+MpegTSEITCache *
+mpegts_eit_cache_new (void)
+{
+  MpegTSEITCache *cache;
+
+  GST_DEBUG_CATEGORY_INIT (mpegts_eit_debug, "mpegtseit", 0,
+      "MPEG transport stream EIT cache");
+
+  cache = g_slice_new0 (MpegTSEITCache);
+  g_mutex_init (&cache->lock);
+  cache->services = g_hash_table_new_full (g_int64_hash, g_int64_equal, NULL,
+      (GDestroyNotify) eit_service_free);
+
+  return cache;
+}
+
+void
+mpegts_eit_cache_free (MpegTSEITCache * cache)
+{
+  g_hash_table_unref (cache->services);
+  g_mutex_clear (&cache->lock);
+  g_slice_free (MpegTSEITCache, cache);
+}
+
+void
+mpegts_eit_cache_clear (MpegTSEITCache * cache)
+{
+  g_mutex_lock (&cache->lock);
+  g_hash_table_remove_all (cache->services);
+  g_mutex_unlock (&cache->lock);
+}
+
+/* mpegts_eit_cache_update:
+ * @cache: the cache
+ * @section: a new or updated EIT schedule section
+ *
+ * Merges the events of @section into @cache.
+ *
+ * Returns: (transfer full) (nullable): a "mpegts-eit-update" structure
+ * listing the events of the service which were added or changed ("events")
+ * and the event_id of the ones which were removed ("removed"), or %NULL if
+ * the section is invalid or didn't change anything.
+ */
+GstStructure *
+mpegts_eit_cache_update (MpegTSEITCache * cache, GstMpegtsSection * section)
+{
+  const GstMpegtsEIT *eit;
+  MpegTSEITService *service;
+  MpegTSEITEntry *entry;
+  GHashTableIter iter;
+  GValue events = G_VALUE_INIT, removed = G_VALUE_INIT;
+  GstStructure *res = NULL;
+  guint64 key;
+  guint i;
+
+  eit = gst_mpegts_section_get_eit (section);
+  if (G_UNLIKELY (eit == NULL))
+    return NULL;
+
+  g_value_init (&events, GST_TYPE_ARRAY);
+  g_value_init (&removed, GST_TYPE_ARRAY);
+
+  key = SERVICE_KEY (eit->original_network_id, eit->transport_stream_id,
+      section->subtable_extension);
+
+  g_mutex_lock (&cache->lock);
+
+  service = g_hash_table_lookup (cache->services, &key);
+  if (service == NULL) {
+    service = g_slice_new0 (MpegTSEITService);
+    service->key = key;
+    service->original_network_id = eit->original_network_id;
+    service->transport_stream_id = eit->transport_stream_id;
+    service->service_id = section->subtable_extension;
+    service->events = g_hash_table_new_full (NULL, NULL, NULL,
+        (GDestroyNotify) eit_entry_free);
+    g_hash_table_insert (cache->services, &service->key, service);
+  }
+
+  cache->serial++;
+
+  for (i = 0; i < eit->events->len; i++) {
+    GstMpegtsEITEvent *event = g_ptr_array_index (eit->events, i);
+
+    entry = g_hash_table_lookup (service->events,
+        GUINT_TO_POINTER (event->event_id));
+    if (entry == NULL) {
+      entry = g_slice_new0 (MpegTSEITEntry);
+      g_hash_table_insert (service->events,
+          GUINT_TO_POINTER (event->event_id), entry);
+    }
+
+    /* Events can move from one segment to another */
+    entry->table_id = section->table_id;
+    entry->section_number = section->section_number;
+    entry->serial = cache->serial;
+
+    if (entry->event && eit_event_equal (entry->event, event))
+      continue;
+
+    GST_LOG ("service 0x%04x event 0x%04x %s", service->service_id,
+        event->event_id, entry->event ? "changed" : "added");
+
+    if (entry->event)
+      g_boxed_free (GST_TYPE_MPEGTS_EIT_EVENT, entry->event);
+    entry->event = eit_event_copy (event);
+    append_event (&events, event);
+  }
+
+  /* Whatever was in the previous version of this section and isn't
+   * anymore is gone */
+  g_hash_table_iter_init (&iter, service->events);
+  while (g_hash_table_iter_next (&iter, NULL, (gpointer *) & entry)) {
+    if (entry->table_id != section->table_id ||
+        entry->section_number != section->section_number ||
+        entry->serial == cache->serial)
+      continue;
+
+    GST_LOG ("service 0x%04x event 0x%04x removed", service->service_id,
+        entry->event->event_id);
+    append_event_id (&removed, entry->event->event_id);
+    g_hash_table_iter_remove (&iter);
+  }
+
+  if (gst_value_array_get_size (&events)
+      || gst_value_array_get_size (&removed)) {
+    res = eit_service_structure_new ("mpegts-eit-update", service);
+    gst_structure_take_value (res, "events", &events);
+    gst_structure_take_value (res, "removed", &removed);
+  } else {
+    g_value_unset (&events);
+    g_value_unset (&removed);
+  }
+
+  g_mutex_unlock (&cache->lock);
+
+  return res;
+}
+
+/* mpegts_eit_cache_get_schedule:
+ * @cache: the cache
+ * @service_id: the service (program number) to look for
+ *
+ * Returns: (transfer full) (nullable): a "mpegts-eit-schedule" structure
+ * containing all the cached events of the service ("events"), sorted by
+ * start time, or %NULL if the service isn't known.
+ */
+GstStructure *
+mpegts_eit_cache_get_schedule (MpegTSEITCache * cache, guint service_id)
+{
+  MpegTSEITService *service = NULL, *tmp;
+  GHashTableIter iter;
+  GPtrArray *entries;
+  GValue events = G_VALUE_INIT;
+  GstStructure *res = NULL;
+  MpegTSEITEntry *entry;
+  guint i;
+
+  g_mutex_lock (&cache->lock);
+
+  /* The service_id is only unique within a transport stream, prefer the
+   * service with the most events */
+  g_hash_table_iter_init (&iter, cache->services);
+  while (g_hash_table_iter_next (&iter, NULL, (gpointer *) & tmp)) {
+    if (tmp->service_id == service_id && (service == NULL ||
+            g_hash_table_size (tmp->events) >
+            g_hash_table_size (service->events)))
+      service = tmp;
+  }
+
+  if (service) {
+    entries = g_ptr_array_sized_new (g_hash_table_size (service->events));
+    g_hash_table_iter_init (&iter, service->events);
+    while (g_hash_table_iter_next (&iter, NULL, (gpointer *) & entry))
+      g_ptr_array_add (entries, entry);
+    g_ptr_array_sort (entries, (GCompareFunc) eit_entry_compare);
+
+    g_value_init (&events, GST_TYPE_ARRAY);
+    for (i = 0; i < entries->len; i++) {
+      entry = g_ptr_array_index (entries, i);
+      append_event (&events, entry->event);
+    }
+    g_ptr_array_free (entries, TRUE);
+
+    res = eit_service_structure_new ("mpegts-eit-schedule", service);
+    gst_structure_take_value (res, "events", &events);
+  }
+
+  g_mutex_unlock (&cache->lock);
+
+  return res;
+}
@@ -0,0 +1,53 @@
+/*
+ * mpegtseit.h - EIT schedule cache
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef GST_MPEGTS_EIT_H
+#define GST_MPEGTS_EIT_H
+
+#include <gst/gst.h>
+#include <gst/mpegts/mpegts.h>
+
+G_BEGIN_DECLS
+
+#define MPEGTS_EIT_IS_SCHEDULE(table_id) \
+  ((table_id) >= GST_MTS_TABLE_ID_EVENT_INFORMATION_ACTUAL_TS_SCHEDULE_1 && \
+   (table_id) <= GST_MTS_TABLE_ID_EVENT_INFORMATION_OTHER_TS_SCHEDULE_N)
+
+typedef struct _MpegTSEITCache MpegTSEITCache;
+
+G_GNUC_INTERNAL
+MpegTSEITCache *mpegts_eit_cache_new (void);
+
+G_GNUC_INTERNAL
+void mpegts_eit_cache_free (MpegTSEITCache * cache);
+
+G_GNUC_INTERNAL
+void mpegts_eit_cache_clear (MpegTSEITCache * cache);
+
+G_GNUC_INTERNAL
+GstStructure *mpegts_eit_cache_update (MpegTSEITCache * cache,
+                                       GstMpegtsSection * section);
+
+G_GNUC_INTERNAL
+GstStructure *mpegts_eit_cache_get_schedule (MpegTSEITCache * cache,
+                                             guint service_id);
+
+G_END_DECLS
+
+#endif /* GST_MPEGTS_EIT_H */
@@ -0,0 +1,396 @@
+/*
+ * mpegtsindex.c - Sidecar seek index
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "mpegtsindex.h"
+#include "gstmpegdefs.h"
+
+GST_DEBUG_CATEGORY_STATIC (mpegts_index_debug);
+#define GST_CAT_DEFAULT mpegts_index_debug
+
+/* The index maps the time elapsed since the first PCR of a program to byte
+ * offsets in the stream, with one entry per PCR_INTERVAL and one entry per
+ * keyframe. It is collected during a linear playback and written when it
+ * reaches EOS.
+ *
+ * The file is used in place once mapped, all fields are little-endian:
+ *
+ *   header, 24 bytes
+ *     magic            4  "TSIX"
+ *     version          4
+ *     n_entries        4
+ *     reserved         4
+ *     stream_size      8  size of the indexed stream, 0 if unknown
+ *
+ *   n_entries entries of 24 bytes, sorted by PCR PID, type and time
+ *     ts               8  time since the first PCR of the PID, in ns
+ *     offset           8  offset of the packet
+ *     pcr_pid          2
+ *     type             2  MpegTSIndexEntryType
+ *     reserved         4
+ */
+
+#define INDEX_MAGIC "TSIX"
+#define INDEX_VERSION 1
+#define INDEX_HEADER_SIZE 24
+#define INDEX_ENTRY_SIZE 24
+
+/* Minimum time between two PCR entries */
+#define PCR_INTERVAL (500 * GST_MSECOND)
+/* Bigger PCR jumps start a new group of contiguous PCRs, as in the
+ * packetizer */
+#define PCR_GROUP_GAP (500 * PCR_MSECOND)
+
+#define PCR_MAX (G_GUINT64_CONSTANT (0x200000000) * 300)
+
+typedef struct
+{
+  GstClockTime ts;
+  guint64 offset;
+  guint16 pcr_pid;
+  guint16 type;
+} MpegTSIndexEntry;
+
+struct _MpegTSIndex
+{
+  /* Loaded index */
+  GMappedFile *mapped;
+  const guint8 *entries;
+  guint n_entries;
+
+  /* MpegTSIndexEntry collected while playing */
+  GArray *pending;
+
+  /* PCR tracking of the indexed program */
+  guint16 pcr_pid;
+  guint64 last_pcr;
+  guint64 last_offset;
+  guint64 elapsed;
+  GstClockTime next_pcr_entry;
+
+  /* Start of the current group of contiguous PCRs */
+  guint64 group_elapsed;
+  guint64 group_offset;
+};
+
+MpegTSIndex *
+mpegts_index_new (void)
+{
+  MpegTSIndex *index;
+
+  GST_DEBUG_CATEGORY_INIT (mpegts_index_debug, "mpegtsindex", 0,
+      "MPEG transport stream seek index");
+
+  index = g_slice_new0 (MpegTSIndex);
+  index->pending = g_array_new (FALSE, FALSE, sizeof (MpegTSIndexEntry));
+  mpegts_index_clear (index);
+
+  return index;
+}
+
+void
+mpegts_index_free (MpegTSIndex * index)
+{
+  mpegts_index_clear (index);
+  g_array_free (index->pending, TRUE);
+  g_slice_free (MpegTSIndex, index);
+}
+
+void
+mpegts_index_clear (MpegTSIndex * index)
+{
+  if (index->mapped)
+    g_mapped_file_unref (index->mapped);
+  index->mapped = NULL;
+  index->entries = NULL;
+  index->n_entries = 0;
+
+  g_array_set_size (index->pending, 0);
+  index->pcr_pid = G_MAXUINT16;
+  index->last_pcr = G_MAXUINT64;
+  index->last_offset = 0;
+  index->elapsed = 0;
+  index->next_pcr_entry = 0;
+  index->group_elapsed = 0;
+  index->group_offset = 0;
+}
+
+gboolean
+mpegts_index_load (MpegTSIndex * index, const gchar * location,
+    guint64 stream_size)
+{
+  GMappedFile *mapped;
+  GError *err = NULL;
+  const guint8 *data;
+  guint64 indexed_size;
+  gsize size;
+  guint n_entries;
+
+  mpegts_index_clear (index);
+
+  mapped = g_mapped_file_new (location, FALSE, &err);
+  if (mapped == NULL) {
+    GST_DEBUG ("No index at %s: %s", location, err->message);
+    g_error_free (err);
+    return FALSE;
+  }
+
+  data = (const guint8 *) g_mapped_file_get_contents (mapped);
+  size = g_mapped_file_get_length (mapped);
+
+  if (size < INDEX_HEADER_SIZE || memcmp (data, INDEX_MAGIC, 4) != 0
+      || GST_READ_UINT32_LE (data + 4) != INDEX_VERSION)
+    goto invalid;
+
+  n_entries = GST_READ_UINT32_LE (data + 8);
+  if (size != INDEX_HEADER_SIZE + (gsize) n_entries * INDEX_ENTRY_SIZE)
+    goto invalid;
+
+  /* Don't use the index of another version of the stream */
+  indexed_size = GST_READ_UINT64_LE (data + 16);
+  if (indexed_size != 0 && stream_size != 0 && indexed_size != stream_size) {
+    GST_INFO ("Index %s is for a stream of %" G_GUINT64_FORMAT " bytes, not %"
+        G_GUINT64_FORMAT, location, indexed_size, stream_size);
+    g_mapped_file_unref (mapped);
+    return FALSE;
+  }
+
+  index->mapped = mapped;
+  index->entries = data + INDEX_HEADER_SIZE;
+  index->n_entries = n_entries;
+
+  GST_INFO ("Loaded index %s, %u entries", location, n_entries);
+
+  return TRUE;
+
+invalid:
+  GST_WARNING ("Invalid index %s", location);
+  g_mapped_file_unref (mapped);
+  return FALSE;
+}
+
+gboolean
+mpegts_index_is_loaded (MpegTSIndex * index)
+{
+  return index->mapped != NULL;
+}
+
+static gint
+compare_entry (const guint8 * entry, guint16 pcr_pid, guint16 type,
+    GstClockTime ts)
+{
+  guint16 entry_pid = GST_READ_UINT16_LE (entry + 16);
+  guint16 entry_type = GST_READ_UINT16_LE (entry + 18);
+  GstClockTime entry_ts = GST_READ_UINT64_LE (entry);
+
+  if (entry_pid != pcr_pid)
+    return entry_pid < pcr_pid ? -1 : 1;
+  if (entry_type != type)
+    return entry_type < type ? -1 : 1;
+  if (entry_ts != ts)
+    return entry_ts < ts ? -1 : 1;
+  return 0;
+}
+
+/* Find the last entry of @type at or before @ts */
+gboolean
+mpegts_index_lookup (MpegTSIndex * index, guint16 pcr_pid,
+    MpegTSIndexEntryType type, GstClockTime ts, guint64 * offset,
+    GstClockTime * entry_ts)
+{
+  const guint8 *entry;
+  guint low = 0, high = index->n_entries;
+
+  while (low < high) {
+    guint mid = low + (high - low) / 2;
+
+    if (compare_entry (index->entries + mid * INDEX_ENTRY_SIZE, pcr_pid,
+            type, ts) <= 0)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+
+  if (low == 0)
+    return FALSE;
+
+  entry = index->entries + (low - 1) * INDEX_ENTRY_SIZE;
+  if (GST_READ_UINT16_LE (entry + 16) != pcr_pid
+      || GST_READ_UINT16_LE (entry + 18) != type)
+    return FALSE;
+
+  *offset = GST_READ_UINT64_LE (entry + 8);
+  if (entry_ts)
+    *entry_ts = GST_READ_UINT64_LE (entry);
+
+  GST_DEBUG ("PID 0x%04x %s entry at %" GST_TIME_FORMAT " for %"
+      GST_TIME_FORMAT ", offset %" G_GUINT64_FORMAT, pcr_pid,
+      type == MPEGTS_INDEX_ENTRY_KEYFRAME ? "keyframe" : "PCR",
+      GST_TIME_ARGS (GST_READ_UINT64_LE (entry)), GST_TIME_ARGS (ts),
+      *offset);
+
+  return TRUE;
+}
+
+static void
+mpegts_index_add_entry (MpegTSIndex * index, MpegTSIndexEntryType type,
+    guint64 offset)
+{
+  MpegTSIndexEntry entry;
+
+  entry.ts = PCRTIME_TO_GSTTIME (index->elapsed);
+  entry.offset = offset;
+  entry.pcr_pid = index->pcr_pid;
+  entry.type = type;
+  g_array_append_val (index->pending, entry);
+}
+
+/* The time line follows mpegts_packetizer_ts_to_offset(): gaps are part of
+ * it, and the time spent before a PCR reset is estimated from the bitrate of
+ * the group of PCRs preceding it, plus 100ms */
+static guint64
+mpegts_index_elapsed_at_reset (MpegTSIndex * index, guint64 offset)
+{
+  guint64 duration = index->elapsed - index->group_elapsed;
+  guint64 size = index->last_offset - index->group_offset;
+
+  if (duration == 0 || size == 0)
+    return index->elapsed + 100 * PCR_MSECOND;
+
+  return index->group_elapsed + gst_util_uint64_scale (offset -
+      index->group_offset, duration, size) + 100 * PCR_MSECOND;
+}
+
+void
+mpegts_index_add_pcr (MpegTSIndex * index, guint16 pcr_pid, guint64 pcr,
+    guint64 offset)
+{
+  if (pcr_pid != index->pcr_pid) {
+    /* Like the packetizer, start the time line of a new PID at 0 */
+    index->pcr_pid = pcr_pid;
+    index->elapsed = 0;
+    index->next_pcr_entry = 0;
+    index->group_elapsed = 0;
+    index->group_offset = offset;
+  } else if (index->last_pcr != G_MAXUINT64) {
+    if (pcr >= index->last_pcr) {
+      index->elapsed += pcr - index->last_pcr;
+      if (pcr - index->last_pcr > PCR_GROUP_GAP) {
+        index->group_elapsed = index->elapsed;
+        index->group_offset = offset;
+      }
+    } else {
+      if (index->last_pcr - pcr > PCR_MAX * 9 / 10) {
+        GST_DEBUG ("PCR wraparound at offset %" G_GUINT64_FORMAT, offset);
+        index->elapsed += PCR_MAX - index->last_pcr + pcr;
+      } else {
+        GST_DEBUG ("PCR reset at offset %" G_GUINT64_FORMAT, offset);
+        index->elapsed = mpegts_index_elapsed_at_reset (index, offset);
+      }
+      index->group_elapsed = index->elapsed;
+      index->group_offset = offset;
+    }
+  }
+  index->last_pcr = pcr;
+  index->last_offset = offset;
+
+  if (PCRTIME_TO_GSTTIME (index->elapsed) < index->next_pcr_entry)
+    return;
+
+  mpegts_index_add_entry (index, MPEGTS_INDEX_ENTRY_PCR, offset);
+  index->next_pcr_entry = PCRTIME_TO_GSTTIME (index->elapsed) + PCR_INTERVAL;
+}
+
+void
+mpegts_index_add_keyframe (MpegTSIndex * index, guint16 pcr_pid,
+    guint64 offset)
+{
+  /* Keyframes are placed on the time line of the latest PCR */
+  if (pcr_pid != index->pcr_pid || index->last_pcr == G_MAXUINT64)
+    return;
+
+  mpegts_index_add_entry (index, MPEGTS_INDEX_ENTRY_KEYFRAME, offset);
+}
+
+static gint
+compare_pending (const MpegTSIndexEntry * a, const MpegTSIndexEntry * b)
+{
+  if (a->pcr_pid != b->pcr_pid)
+    return a->pcr_pid < b->pcr_pid ? -1 : 1;
+  if (a->type != b->type)
+    return a->type < b->type ? -1 : 1;
+  if (a->ts != b->ts)
+    return a->ts < b->ts ? -1 : 1;
+  if (a->offset != b->offset)
+    return a->offset < b->offset ? -1 : 1;
+  return 0;
+}
+
+gboolean
+mpegts_index_save (MpegTSIndex * index, const gchar * location,
+    guint64 stream_size)
+{
+  GError *err = NULL;
+  guint8 *data, *entry;
+  gsize size;
+  gboolean ret;
+  guint i;
+
+  if (index->pending->len == 0)
+    return FALSE;
+
+  g_array_sort (index->pending, (GCompareFunc) compare_pending);
+
+  size = INDEX_HEADER_SIZE + index->pending->len * INDEX_ENTRY_SIZE;
+  data = g_malloc0 (size);
+
+  memcpy (data, INDEX_MAGIC, 4);
+  GST_WRITE_UINT32_LE (data + 4, INDEX_VERSION);
+  GST_WRITE_UINT32_LE (data + 8, index->pending->len);
+  GST_WRITE_UINT64_LE (data + 16, stream_size);
+
+  entry = data + INDEX_HEADER_SIZE;
+  for (i = 0; i < index->pending->len; i++) {
+    MpegTSIndexEntry *e = &g_array_index (index->pending, MpegTSIndexEntry, i);
+
+    GST_WRITE_UINT64_LE (entry, e->ts);
+    GST_WRITE_UINT64_LE (entry + 8, e->offset);
+    GST_WRITE_UINT16_LE (entry + 16, e->pcr_pid);
+    GST_WRITE_UINT16_LE (entry + 18, e->type);
+    entry += INDEX_ENTRY_SIZE;
+  }
+
+  /* Written to a temporary file and renamed, readers never see a partial
+   * index */
+  ret = g_file_set_contents (location, (const gchar *) data, size, &err);
+  if (!ret) {
+    GST_WARNING ("Failed to write index %s: %s", location, err->message);
+    g_error_free (err);
+  } else {
+    GST_INFO ("Wrote index %s, %u entries", location, index->pending->len);
+  }
+  g_free (data);
+
+  return ret;
+}
@@ -34,6 +34,7 @@
 #define PTS_DTS_MAX_VALUE (((guint64)1) << 33)
 
 #include "mpegtspacketizer.h"
+#include "mpegtssync.h"
 #include "gstmpegdesc.h"
 
 GST_DEBUG_CATEGORY_STATIC (mpegts_packetizer_debug);
@@ -50,6 +51,7 @@ G_DEFINE_TYPE_EXTENDED (MpegTSPacketizer2, mpegts_packetizer, G_TYPE_OBJECT, 0,
 
 static void mpegts_packetizer_dispose (GObject * object);
 static void mpegts_packetizer_finalize (GObject * object);
+static void mpegts_packetizer_unmap (MpegTSPacketizer2 * packetizer);
 static GstClockTime calculate_skew (MpegTSPacketizer2 * packetizer,
     MpegTSPCR * pcr, guint64 pcrtime, GstClockTime time);
 static void _close_current_group (MpegTSPCR * pcrtable);
@@ -134,21 +136,16 @@ mpegts_packetizer_get_current_time (MpegTSPacketizer2 * packetizer,
       pcr_pid);
 }
 
+#define SUBTABLE_KEY(table_id, subtable_extension) \
+  GUINT_TO_POINTER (((table_id) << 16) | (subtable_extension))
+
 static inline MpegTSPacketizerStreamSubtable *
-find_subtable (GSList * subtables, guint8 table_id, guint16 subtable_extension)
+find_subtable (GHashTable * subtables, guint8 table_id,
+    guint16 subtable_extension)
 {
-  GSList *tmp;
-
-  /* FIXME: Make this an array ! */
-  for (tmp = subtables; tmp; tmp = tmp->next) {
-    MpegTSPacketizerStreamSubtable *sub =
-        (MpegTSPacketizerStreamSubtable *) tmp->data;
-    if (sub->table_id == table_id
-        && sub->subtable_extension == subtable_extension)
-      return sub;
-  }
-
-  return NULL;
+  /* EIT PIDs carry hundreds of subtables (one per service and table_id) */
+  return g_hash_table_lookup (subtables, SUBTABLE_KEY (table_id,
+          subtable_extension));
 }
 
 static gboolean
@@ -192,6 +189,13 @@ mpegts_packetizer_stream_subtable_new (guint8 table_id,
   return subtable;
 }
 
+static void
+mpegts_packetizer_stream_subtable_free (MpegTSPacketizerStreamSubtable *
+    subtable)
+{
+  g_free (subtable);
+}
+
 static MpegTSPacketizerStream *
 mpegts_packetizer_stream_new (guint16 pid)
 {
@@ -199,7 +203,8 @@ mpegts_packetizer_stream_new (guint16 pid)
 
   stream = (MpegTSPacketizerStream *) g_new0 (MpegTSPacketizerStream, 1);
   stream->continuity_counter = CONTINUITY_UNSET;
-  stream->subtables = NULL;
+  stream->subtables = g_hash_table_new_full (NULL, NULL, NULL,
+      (GDestroyNotify) mpegts_packetizer_stream_subtable_free);
   stream->table_id = TABLE_ID_UNSET;
   stream->pid = pid;
   return stream;
@@ -217,20 +222,39 @@ mpegts_packetizer_clear_section (MpegTSPacketizerStream * stream)
 }
 
 static void
-mpegts_packetizer_stream_subtable_free (MpegTSPacketizerStreamSubtable *
-    subtable)
+mpegts_packetizer_stream_free (MpegTSPacketizerStream * stream)
 {
-  g_free (subtable);
+  mpegts_packetizer_clear_section (stream);
+  g_hash_table_unref (stream->subtables);
+  g_free (stream);
+}
+
+static inline MpegTSPacketizerStream *
+mpegts_packetizer_get_stream (MpegTSPacketizer2 * packetizer, guint16 pid)
+{
+  MpegTSPacketizerStream **page =
+      packetizer->streams[pid / MPEGTS_STREAMS_PAGE_SIZE];
+
+  return page ? page[pid % MPEGTS_STREAMS_PAGE_SIZE] : NULL;
 }
 
 static void
-mpegts_packetizer_stream_free (MpegTSPacketizerStream * stream)
+mpegts_packetizer_free_streams (MpegTSPacketizer2 * packetizer)
 {
-  mpegts_packetizer_clear_section (stream);
-  g_slist_foreach (stream->subtables,
-      (GFunc) mpegts_packetizer_stream_subtable_free, NULL);
-  g_slist_free (stream->subtables);
-  g_free (stream);
+  guint i, j;
+
+  for (i = 0; i < MPEGTS_STREAMS_N_PAGES; i++) {
+    MpegTSPacketizerStream **page = packetizer->streams[i];
+
+    if (page == NULL)
+      continue;
+    for (j = 0; j < MPEGTS_STREAMS_PAGE_SIZE; j++) {
+      if (page[j])
+        mpegts_packetizer_stream_free (page[j]);
+    }
+    g_free (page);
+    packetizer->streams[i] = NULL;
+  }
 }
 
 static void
@@ -252,11 +276,11 @@ mpegts_packetizer_init (MpegTSPacketizer2 * packetizer)
   packetizer->adapter = gst_adapter_new ();
   packetizer->offset = 0;
   packetizer->empty = TRUE;
-  packetizer->streams = g_new0 (MpegTSPacketizerStream *, 8192);
   packetizer->packet_size = 0;
   packetizer->calculate_skew = FALSE;
   packetizer->calculate_offset = FALSE;
 
+  packetizer->map_buffer = NULL;
   packetizer->map_data = NULL;
   packetizer->map_size = 0;
   packetizer->map_offset = 0;
@@ -280,15 +304,9 @@ mpegts_packetizer_dispose (GObject * object)
   if (!packetizer->disposed) {
     if (packetizer->packet_size)
       packetizer->packet_size = 0;
-    if (packetizer->streams) {
-      int i;
-      for (i = 0; i < 8192; i++) {
-        if (packetizer->streams[i])
-          mpegts_packetizer_stream_free (packetizer->streams[i]);
-      }
-      g_free (packetizer->streams);
-    }
+    mpegts_packetizer_free_streams (packetizer);
 
+    mpegts_packetizer_unmap (packetizer);
     gst_adapter_clear (packetizer->adapter);
     g_object_unref (packetizer->adapter);
     g_mutex_clear (&packetizer->group_lock);
@@ -394,28 +412,13 @@ mpegts_packetizer_parse_adaptation_field_control (MpegTSPacketizer2 *
       afcflags & 0x02 ? "transport_private_data " : "",
       afcflags & 0x01 ? "extension " : "", afcflags == 0x00 ? "<none>" : "");
 
-  /* PCR */
+  /* PCR, the observation is recorded by mpegts_packetizer_process_pcr() */
   if (afcflags & MPEGTS_AFC_PCR_FLAG) {
-    MpegTSPCR *pcrtable = NULL;
     packet->pcr = mpegts_packetizer_compute_pcr (data);
     data += 6;
     GST_DEBUG ("pcr 0x%04x %" G_GUINT64_FORMAT " (%" GST_TIME_FORMAT
         ") offset:%" G_GUINT64_FORMAT, packet->pid, packet->pcr,
         GST_TIME_ARGS (PCRTIME_TO_GSTTIME (packet->pcr)), packet->offset);
-
-    PACKETIZER_GROUP_LOCK (packetizer);
-    if (packetizer->calculate_skew
-        && GST_CLOCK_TIME_IS_VALID (packetizer->last_in_time)) {
-      pcrtable = get_pcr_table (packetizer, packet->pid);
-      calculate_skew (packetizer, pcrtable, packet->pcr,
-          packetizer->last_in_time);
-    }
-    if (packetizer->calculate_offset) {
-      if (!pcrtable)
-        pcrtable = get_pcr_table (packetizer, packet->pid);
-      record_pcr (packetizer, pcrtable, packet->pcr, packet->offset);
-    }
-    PACKETIZER_GROUP_UNLOCK (packetizer);
   }
 #ifndef GST_DISABLE_GST_DEBUG
   /* OPCR */
@@ -455,6 +458,32 @@ mpegts_packetizer_parse_adaptation_field_control (MpegTSPacketizer2 *
   return TRUE;
 }
 
+/* Feeds the PCR carried by @packet (if any) to the skew and offset
+ * calculators. Packets must be processed in order */
+void
+mpegts_packetizer_process_pcr (MpegTSPacketizer2 * packetizer,
+    MpegTSPacketizerPacket * packet)
+{
+  MpegTSPCR *pcrtable = NULL;
+
+  if (G_LIKELY (packet->pcr == G_MAXUINT64))
+    return;
+
+  PACKETIZER_GROUP_LOCK (packetizer);
+  if (packetizer->calculate_skew
+      && GST_CLOCK_TIME_IS_VALID (packetizer->last_in_time)) {
+    pcrtable = get_pcr_table (packetizer, packet->pid);
+    calculate_skew (packetizer, pcrtable, packet->pcr,
+        packetizer->last_in_time);
+  }
+  if (packetizer->calculate_offset) {
+    if (!pcrtable)
+      pcrtable = get_pcr_table (packetizer, packet->pid);
+    record_pcr (packetizer, pcrtable, packet->pcr, packet->offset);
+  }
+  PACKETIZER_GROUP_UNLOCK (packetizer);
+}
+
 static MpegTSPacketizerPacketReturn
 mpegts_packetizer_parse_packet (MpegTSPacketizer2 * packetizer,
     MpegTSPacketizerPacket * packet)
@@ -527,7 +556,8 @@ mpegts_packetizer_parse_section_header (MpegTSPacketizer2 * packetizer,
         stream->subtable_extension, stream->last_section_number);
     subtable->version_number = stream->version_number;
 
-    stream->subtables = g_slist_prepend (stream->subtables, subtable);
+    g_hash_table_insert (stream->subtables,
+        SUBTABLE_KEY (stream->table_id, stream->subtable_extension), subtable);
   }
 
   GST_MEMDUMP ("Full section data", stream->section_data,
@@ -572,23 +602,13 @@ mpegts_packetizer_clear (MpegTSPacketizer2 * packetizer)
 
   packetizer->packet_size = 0;
 
-  if (packetizer->streams) {
-    int i;
-    for (i = 0; i < 8192; i++) {
-      if (packetizer->streams[i]) {
-        mpegts_packetizer_stream_free (packetizer->streams[i]);
-      }
-    }
-    memset (packetizer->streams, 0, 8192 * sizeof (MpegTSPacketizerStream *));
-  }
+  mpegts_packetizer_free_streams (packetizer);
 
+  mpegts_packetizer_unmap (packetizer);
   gst_adapter_clear (packetizer->adapter);
   packetizer->offset = 0;
   packetizer->empty = TRUE;
   packetizer->need_sync = FALSE;
-  packetizer->map_data = NULL;
-  packetizer->map_size = 0;
-  packetizer->map_offset = 0;
   packetizer->last_in_time = GST_CLOCK_TIME_NONE;
 
   pcrtable = packetizer->observations[packetizer->pcrtablelut[0x1fff]];
@@ -614,21 +634,23 @@ mpegts_packetizer_flush (MpegTSPacketizer2 * packetizer, gboolean hard)
   MpegTSPCR *pcrtable;
   GST_DEBUG ("Flushing");
 
-  if (packetizer->streams) {
-    for (i = 0; i < 8192; i++) {
-      if (packetizer->streams[i]) {
-        mpegts_packetizer_clear_section (packetizer->streams[i]);
-      }
+  for (i = 0; i < MPEGTS_STREAMS_N_PAGES; i++) {
+    MpegTSPacketizerStream **page = packetizer->streams[i];
+    guint j;
+
+    if (page == NULL)
+      continue;
+    for (j = 0; j < MPEGTS_STREAMS_PAGE_SIZE; j++) {
+      if (page[j])
+        mpegts_packetizer_clear_section (page[j]);
     }
   }
+  mpegts_packetizer_unmap (packetizer);
   gst_adapter_clear (packetizer->adapter);
 
   packetizer->offset = 0;
   packetizer->empty = TRUE;
   packetizer->need_sync = FALSE;
-  packetizer->map_data = NULL;
-  packetizer->map_size = 0;
-  packetizer->map_offset = 0;
   packetizer->last_in_time = GST_CLOCK_TIME_NONE;
 
   pcrtable = packetizer->observations[packetizer->pcrtablelut[0x1fff]];
@@ -654,14 +676,54 @@ mpegts_packetizer_flush (MpegTSPacketizer2 * packetizer, gboolean hard)
 void
 mpegts_packetizer_remove_stream (MpegTSPacketizer2 * packetizer, gint16 pid)
 {
-  MpegTSPacketizerStream *stream = packetizer->streams[pid];
+  MpegTSPacketizerStream *stream = mpegts_packetizer_get_stream (packetizer,
+      pid);
   if (stream) {
     GST_INFO ("Removing stream for PID 0x%04x", pid);
     mpegts_packetizer_stream_free (stream);
-    packetizer->streams[pid] = NULL;
+    packetizer->streams[pid / MPEGTS_STREAMS_PAGE_SIZE][pid %
+        MPEGTS_STREAMS_PAGE_SIZE] = NULL;
   }
 }
 
+/* Returns a new #GstMemory sharing @size bytes at @data with the currently
+ * mapped input, or %NULL if @data doesn't point into the mapped input
+ * (for example if the packet was descrambled into a separate buffer) or if
+ * the input memory can't be shared. */
+GstMemory *
+mpegts_packetizer_share_data (MpegTSPacketizer2 * packetizer,
+    const guint8 * data, gsize size)
+{
+  if (G_UNLIKELY (packetizer->map_buffer == NULL))
+    return NULL;
+
+  return mpegts_packetizer_share_buffer_data (packetizer->map_buffer,
+      packetizer->map_data, packetizer->map_size, data, size);
+}
+
+/* Same as mpegts_packetizer_share_data(), for @buffer mapped by the caller
+ * at @map_data. Used to share packets handled after the packetizer moved
+ * on, from a reference to the input it had mapped at the time. */
+GstMemory *
+mpegts_packetizer_share_buffer_data (GstBuffer * buffer,
+    const guint8 * map_data, gsize map_size, const guint8 * data, gsize size)
+{
+  GstMemory *mem;
+
+  if (data < map_data || data + size > map_data + map_size)
+    return NULL;
+
+  /* If the input is made of several memories, map_data is a merged copy */
+  if (gst_buffer_n_memory (buffer) != 1)
+    return NULL;
+
+  mem = gst_buffer_peek_memory (buffer, 0);
+  if (GST_MEMORY_FLAG_IS_SET (mem, GST_MEMORY_FLAG_NO_SHARE))
+    return NULL;
+
+  return gst_memory_share (mem, data - map_data, size);
+}
+
 MpegTSPacketizer2 *
 mpegts_packetizer_new (void)
 {
@@ -694,11 +756,12 @@ mpegts_packetizer_push (MpegTSPacketizer2 * packetizer, GstBuffer * buffer)
 }
 
 static void
-mpegts_packetizer_flush_bytes (MpegTSPacketizer2 * packetizer, gsize size)
+mpegts_packetizer_unmap (MpegTSPacketizer2 * packetizer)
 {
-  if (size > 0) {
-    GST_LOG ("flushing %" G_GSIZE_FORMAT " bytes from adapter", size);
-    gst_adapter_flush (packetizer->adapter, size);
+  if (packetizer->map_buffer) {
+    gst_buffer_unmap (packetizer->map_buffer, &packetizer->map_info);
+    gst_buffer_unref (packetizer->map_buffer);
+    packetizer->map_buffer = NULL;
   }
 
   packetizer->map_data = NULL;
@@ -706,6 +769,18 @@ mpegts_packetizer_flush_bytes (MpegTSPacketizer2 * packetizer, gsize size)
   packetizer->map_offset = 0;
 }
 
+static void
+mpegts_packetizer_flush_bytes (MpegTSPacketizer2 * packetizer, gsize size)
+{
+  /* Release our view on the data before the adapter drops it */
+  mpegts_packetizer_unmap (packetizer);
+
+  if (size > 0) {
+    GST_LOG ("flushing %" G_GSIZE_FORMAT " bytes from adapter", size);
+    gst_adapter_flush (packetizer->adapter, size);
+  }
+}
+
 static gboolean
 mpegts_packetizer_map (MpegTSPacketizer2 * packetizer, gsize size)
 {
@@ -720,11 +795,22 @@ mpegts_packetizer_map (MpegTSPacketizer2 * packetizer, gsize size)
   if (available < size)
     return FALSE;
 
-  packetizer->map_data =
-      (guint8 *) gst_adapter_map (packetizer->adapter, available);
-  if (!packetizer->map_data)
+  /* We map a buffer (and not the adapter directly) so that the payload
+   * of the packets can be shared with downstream without copying it
+   * (see mpegts_packetizer_share_data()) */
+  packetizer->map_buffer =
+      gst_adapter_get_buffer (packetizer->adapter, available);
+  if (!packetizer->map_buffer)
+    return FALSE;
+
+  if (!gst_buffer_map (packetizer->map_buffer, &packetizer->map_info,
+          GST_MAP_READ)) {
+    gst_buffer_unref (packetizer->map_buffer);
+    packetizer->map_buffer = NULL;
     return FALSE;
+  }
 
+  packetizer->map_data = packetizer->map_info.data;
   packetizer->map_size = available;
   packetizer->map_offset = 0;
 
@@ -737,7 +823,8 @@ static gboolean
 mpegts_try_discover_packet_size (MpegTSPacketizer2 * packetizer)
 {
   guint8 *data;
-  gsize size, i, j;
+  gsize size, end, i;
+  guint packet_size;
 
   static const guint psizes[] = {
     MPEGTS_NORMAL_PACKETSIZE,
@@ -752,25 +839,13 @@ mpegts_try_discover_packet_size (MpegTSPacketizer2 * packetizer)
   size = packetizer->map_size - packetizer->map_offset;
   data = packetizer->map_data + packetizer->map_offset;
 
-  for (i = 0; i + 3 * MPEGTS_MAX_PACKETSIZE < size; i++) {
-    /* find a sync byte */
-    if (data[i] != PACKET_SYNC_BYTE)
-      continue;
-
-    /* check for 4 consecutive sync bytes with each possible packet size */
-    for (j = 0; j < G_N_ELEMENTS (psizes); j++) {
-      guint packet_size = psizes[j];
-
-      if (data[i + packet_size] == PACKET_SYNC_BYTE &&
-          data[i + 2 * packet_size] == PACKET_SYNC_BYTE &&
-          data[i + 3 * packet_size] == PACKET_SYNC_BYTE) {
-        packetizer->packet_size = packet_size;
-        goto out;
-      }
-    }
-  }
+  /* look for 4 consecutive sync bytes with each possible packet size */
+  end = size - 3 * MPEGTS_MAX_PACKETSIZE;
+  i = mpegts_sync_scan (data, 0, end, psizes, G_N_ELEMENTS (psizes), 4,
+      &packet_size);
+  if (i < end)
+    packetizer->packet_size = packet_size;
 
-out:
   packetizer->map_offset += i;
 
   if (packetizer->packet_size == 0) {
@@ -792,10 +867,10 @@ out:
 static gboolean
 mpegts_packetizer_sync (MpegTSPacketizer2 * packetizer)
 {
-  gboolean found = FALSE;
+  gboolean found;
   guint8 *data;
   guint packet_size;
-  gsize size, sync_offset, i;
+  gsize size, sync_offset, end, i;
 
   packet_size = packetizer->packet_size;
 
@@ -810,14 +885,9 @@ mpegts_packetizer_sync (MpegTSPacketizer2 * packetizer)
   else
     sync_offset = 0;
 
-  for (i = sync_offset; i + 2 * packet_size < size; i++) {
-    if (data[i] == PACKET_SYNC_BYTE &&
-        data[i + packet_size] == PACKET_SYNC_BYTE &&
-        data[i + 2 * packet_size] == PACKET_SYNC_BYTE) {
-      found = TRUE;
-      break;
-    }
-  }
+  end = MAX (size - 2 * packet_size, sync_offset);
+  i = mpegts_sync_scan (data, sync_offset, end, &packet_size, 1, 3, NULL);
+  found = (i < end);
 
   packetizer->map_offset += i - sync_offset;
 
@@ -875,11 +945,125 @@ mpegts_packetizer_next_packet (MpegTSPacketizer2 * packetizer,
       packetizer->offset += packet_size;
       GST_MEMDUMP ("data_start", packet->data_start, 16);
 
-      return mpegts_packetizer_parse_packet (packetizer, packet);
+      if (mpegts_packetizer_parse_packet (packetizer, packet) != PACKET_OK)
+        return PACKET_BAD;
+
+      mpegts_packetizer_process_pcr (packetizer, packet);
+      return PACKET_OK;
     }
   }
 }
 
+/* Parses up to @n_packets consecutive packets from the mapped data into
+ * @packets, mapping the adapter only once for the whole batch. Bad packets
+ * are skipped. Returns the number of packets filled in, 0 if more data is
+ * needed.
+ *
+ * The returned packets point into the mapped data and stay valid until
+ * mpegts_packetizer_clear_packets() is called. Unlike
+ * mpegts_packetizer_next_packet(), the PCR observations are not recorded
+ * while parsing: mpegts_packetizer_process_pcr() has to be called on each
+ * packet, in order, before handling it. */
+guint
+mpegts_packetizer_next_packets (MpegTSPacketizer2 * packetizer,
+    MpegTSPacketizerPacket * packets, guint n_packets)
+{
+  guint8 *packet_data;
+  guint packet_size, n = 0;
+  gsize sync_offset, offset;
+
+  packet_size = packetizer->packet_size;
+  if (G_UNLIKELY (!packet_size)) {
+    if (!mpegts_try_discover_packet_size (packetizer))
+      return 0;
+    packet_size = packetizer->packet_size;
+  }
+
+  /* M2TS packets don't start with the sync byte, all other variants do */
+  if (packet_size == MPEGTS_M2TS_PACKETSIZE)
+    sync_offset = 4;
+  else
+    sync_offset = 0;
+
+  while (n == 0) {
+    if (packetizer->need_sync) {
+      if (!mpegts_packetizer_sync (packetizer))
+        return 0;
+      packetizer->need_sync = FALSE;
+    }
+
+    if (!mpegts_packetizer_map (packetizer, packet_size))
+      return 0;
+
+    for (offset = packetizer->map_offset;
+        n < n_packets && offset + packet_size <= packetizer->map_size;
+        offset += packet_size) {
+      MpegTSPacketizerPacket *packet = &packets[n];
+
+      packet_data = &packetizer->map_data[offset + sync_offset];
+
+      /* Check sync byte */
+      if (G_UNLIKELY (*packet_data != PACKET_SYNC_BYTE)) {
+        GST_DEBUG ("lost sync");
+        packetizer->need_sync = TRUE;
+        break;
+      }
+
+      packet->data_start = packet_data;
+      packet->data_end = packet->data_start + 188;
+      packet->offset = packetizer->offset + offset - packetizer->map_offset;
+
+      if (G_LIKELY (mpegts_packetizer_parse_packet (packetizer,
+                  packet) == PACKET_OK))
+        n++;
+      else
+        GST_DEBUG ("bad packet at offset %" G_GUINT64_FORMAT ", skipping",
+            packet->offset);
+    }
+
+    if (G_UNLIKELY (n == 0)) {
+      /* Nothing but bad packets, drop them and carry on */
+      packetizer->offset += offset - packetizer->map_offset;
+      packetizer->map_offset = offset;
+    }
+  }
+
+  GST_LOG ("parsed %u packets", n);
+
+  return n;
+}
+
+/* Releases all the packets up to (and including) @last, which must have
+ * been returned by the last call to mpegts_packetizer_next_packets().
+ *
+ * The position is derived from the stream offset of @last and not from its
+ * data pointers, which might have been redirected to a copy of the packet
+ * (e.g. when descrambling it) */
+void
+mpegts_packetizer_clear_packets (MpegTSPacketizer2 * packetizer,
+    MpegTSPacketizerPacket * last)
+{
+  guint packet_size = packetizer->packet_size;
+  guint64 consumed;
+
+  if (G_UNLIKELY (packetizer->map_data == NULL))
+    return;
+
+  /* The packetizer was flushed or moved while handling the packets */
+  if (G_UNLIKELY (last->offset < packetizer->offset))
+    return;
+
+  consumed = last->offset - packetizer->offset + packet_size;
+  if (G_UNLIKELY (packetizer->map_offset + consumed > packetizer->map_size))
+    return;
+
+  packetizer->offset += consumed;
+  packetizer->map_offset += consumed;
+
+  if (packetizer->map_size - packetizer->map_offset < packet_size)
+    mpegts_packetizer_flush_bytes (packetizer, packetizer->map_offset);
+}
+
 MpegTSPacketizerPacketReturn
 mpegts_packetizer_process_next_packet (MpegTSPacketizer2 * packetizer)
 {
@@ -956,15 +1140,22 @@ mpegts_packetizer_push_section (MpegTSPacketizer2 * packetizer,
   packet_cc = FLAGS_CONTINUITY_COUNTER (packet->scram_afc_cc);
 
   /* Get our filter */
-  stream = packetizer->streams[packet->pid];
+  stream = mpegts_packetizer_get_stream (packetizer, packet->pid);
   if (G_UNLIKELY (stream == NULL)) {
+    MpegTSPacketizerStream **page;
+
     if (!packet->payload_unit_start_indicator) {
       /* Early exit (we need to start with a section start) */
       GST_DEBUG ("PID 0x%04x  waiting for section start", packet->pid);
       goto out;
     }
+    page = packetizer->streams[packet->pid / MPEGTS_STREAMS_PAGE_SIZE];
+    if (page == NULL) {
+      page = g_new0 (MpegTSPacketizerStream *, MPEGTS_STREAMS_PAGE_SIZE);
+      packetizer->streams[packet->pid / MPEGTS_STREAMS_PAGE_SIZE] = page;
+    }
     stream = mpegts_packetizer_stream_new (packet->pid);
-    packetizer->streams[packet->pid] = stream;
+    page[packet->pid % MPEGTS_STREAMS_PAGE_SIZE] = stream;
   }
 
   GST_MEMDUMP ("Full packet data", packet->data,
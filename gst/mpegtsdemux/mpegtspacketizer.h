@@ -50,6 +50,9 @@
 
 #define MAX_WINDOW 512
 
+#define MPEGTS_STREAMS_PAGE_SIZE 256
+#define MPEGTS_STREAMS_N_PAGES (0x2000 / MPEGTS_STREAMS_PAGE_SIZE)
+
 G_BEGIN_DECLS
 
 #define GST_TYPE_MPEGTS_PACKETIZER \
@@ -85,7 +88,8 @@ typedef struct
   guint8  section_number;
   guint8  last_section_number;
 
-  GSList *subtables;
+  /* MpegTSPacketizerStreamSubtable, by table_id and subtable_extension */
+  GHashTable *subtables;
 
   /* Upstream offset of the data contained in the section */
   guint64 offset;
@@ -247,9 +251,10 @@ struct _MpegTSPacketizer2 {
   GMutex group_lock;
 
   GstAdapter *adapter;
-  /* streams hashed by pid */
-  /* FIXME : be more memory efficient (see how it's done in mpegtsbase) */
-  MpegTSPacketizerStream **streams;
+  /* section streams indexed by pid, in pages of MPEGTS_STREAMS_PAGE_SIZE
+   * entries only allocated once a section is seen on one of their pids.
+   * Use mpegts_packetizer_get_stream() to look them up */
+  MpegTSPacketizerStream **streams[MPEGTS_STREAMS_N_PAGES];
   gboolean    disposed;
   guint16     packet_size;
 
@@ -264,6 +269,8 @@ struct _MpegTSPacketizer2 {
   gboolean       calculate_offset;
 
   /* Shortcuts for adapter usage */
+  GstBuffer *map_buffer;
+  GstMapInfo map_info;
   guint8 *map_data;
   gsize map_offset;
   gsize map_size;
@@ -346,10 +353,20 @@ G_GNUC_INTERNAL MpegTSPacketizerPacketReturn mpegts_packetizer_next_packet (Mpeg
   MpegTSPacketizerPacket *packet);
 G_GNUC_INTERNAL MpegTSPacketizerPacketReturn
 mpegts_packetizer_process_next_packet(MpegTSPacketizer2 * packetizer);
+G_GNUC_INTERNAL guint mpegts_packetizer_next_packets (MpegTSPacketizer2 *packetizer,
+  MpegTSPacketizerPacket *packets, guint n_packets);
+G_GNUC_INTERNAL void mpegts_packetizer_process_pcr (MpegTSPacketizer2 *packetizer,
+  MpegTSPacketizerPacket *packet);
+G_GNUC_INTERNAL void mpegts_packetizer_clear_packets (MpegTSPacketizer2 *packetizer,
+  MpegTSPacketizerPacket *last);
 G_GNUC_INTERNAL void mpegts_packetizer_clear_packet (MpegTSPacketizer2 *packetizer,
 				     MpegTSPacketizerPacket *packet);
 G_GNUC_INTERNAL void mpegts_packetizer_remove_stream(MpegTSPacketizer2 *packetizer,
   gint16 pid);
+G_GNUC_INTERNAL GstMemory *mpegts_packetizer_share_data (MpegTSPacketizer2 *packetizer,
+  const guint8 *data, gsize size);
+G_GNUC_INTERNAL GstMemory *mpegts_packetizer_share_buffer_data (GstBuffer *buffer,
+  const guint8 *map_data, gsize map_size, const guint8 *data, gsize size);
 
 G_GNUC_INTERNAL GstMpegtsSection *mpegts_packetizer_push_section (MpegTSPacketizer2 *packetzer,
 								  MpegTSPacketizerPacket *packet, GList **remaining);
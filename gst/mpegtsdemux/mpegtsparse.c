@@ -90,6 +90,8 @@ enum
   PROP_ALIGNMENT,
   PROP_SPLIT_ON_RAI,
   PROP_SHRINK_PAT,
+  PROP_BUFFER_LIST,
+  PROP_BATCH_LATENCY,
   /* FILL ME */
 };
 
@@ -127,10 +129,42 @@ static gboolean push_event (MpegTSBase * base, GstEvent * event);
 #define mpegts_parse_parent_class parent_class
 G_DEFINE_TYPE (MpegTSParse2, mpegts_parse, GST_TYPE_MPEGTS_BASE);
 static void mpegts_parse_reset (MpegTSBase * base);
-static GstFlowReturn mpegts_parse_input_done (MpegTSBase * base);
+static GstFlowReturn mpegts_parse_input_done (MpegTSBase * base,
+    GstBuffer * buffer);
 static GstFlowReturn
 drain_pending_buffers (MpegTSParse2 * parse, gboolean drain_all);
 
+static void
+mpegts_parse_adapter_init (MpegTSParse2Adapter * ts_adapter)
+{
+  ts_adapter->adapter = gst_adapter_new ();
+  ts_adapter->list = NULL;
+  ts_adapter->packets_in_adapter = 0;
+  ts_adapter->first_is_keyframe = TRUE;
+  ts_adapter->first_ts = GST_CLOCK_TIME_NONE;
+}
+
+static void
+mpegts_parse_adapter_clear (MpegTSParse2Adapter * ts_adapter)
+{
+  gst_adapter_clear (ts_adapter->adapter);
+  if (ts_adapter->list) {
+    gst_buffer_list_unref (ts_adapter->list);
+    ts_adapter->list = NULL;
+  }
+  ts_adapter->packets_in_adapter = 0;
+  ts_adapter->first_is_keyframe = TRUE;
+  ts_adapter->first_ts = GST_CLOCK_TIME_NONE;
+}
+
+static void
+mpegts_parse_adapter_free (MpegTSParse2Adapter * ts_adapter)
+{
+  mpegts_parse_adapter_clear (ts_adapter);
+  g_object_unref (ts_adapter->adapter);
+  ts_adapter->adapter = NULL;
+}
+
 static void
 mpegts_parse_finalize (GObject * object)
 {
@@ -138,8 +172,7 @@ mpegts_parse_finalize (GObject * object)
 
   gst_flow_combiner_free (parse->flowcombiner);
 
-  gst_adapter_clear (parse->ts_adapter.adapter);
-  g_object_unref (parse->ts_adapter.adapter);
+  mpegts_parse_adapter_free (&parse->ts_adapter);
 
   GST_CALL_PARENT (G_OBJECT_CLASS, finalize, (object));
 }
@@ -182,6 +215,16 @@ mpegts_parse_class_init (MpegTSParse2Class * klass)
       g_param_spec_boolean ("shrink-pat", "Rewrite PAT for one program",
           "At each program pad, rewrite PAT to contain just the program", TRUE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_BUFFER_LIST,
+      g_param_spec_boolean ("buffer-list", "Buffer List",
+          "Push aggregated packets as buffer lists of one buffer per packet, "
+          "keeping per-packet timestamps, instead of merging them into a "
+          "single buffer", FALSE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_BATCH_LATENCY,
+      g_param_spec_uint ("batch-latency", "Batch Latency",
+          "Maximum time in microseconds packets are held back to fill an "
+          "aligned buffer or list (0 = unlimited)",
+          0, G_MAXUINT, 0, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   element_class = GST_ELEMENT_CLASS (klass);
   element_class->pad_removed = mpegts_parse_pad_removed;
@@ -231,10 +274,10 @@ mpegts_parse_init (MpegTSParse2 * parse)
   parse->have_group_id = FALSE;
   parse->group_id = G_MAXUINT;
 
-  parse->ts_adapter.adapter = gst_adapter_new ();
-  parse->ts_adapter.packets_in_adapter = 0;
-  parse->ts_adapter.first_is_keyframe = TRUE;
+  mpegts_parse_adapter_init (&parse->ts_adapter);
   parse->alignment = 0;
+  parse->buffer_list = FALSE;
+  parse->batch_latency = 0;
   parse->is_eos = FALSE;
   parse->header = 0;
   parse->split_on_rai = FALSE;
@@ -248,25 +291,25 @@ mpegts_parse_reset (MpegTSBase * base)
   /* Set the various know PIDs we are interested in */
 
   /* CAT */
-  MPEGTS_BIT_SET (base->known_psi, 1);
+  MPEGTS_BASE_SET_PSI (base, 1);
   /* NIT, ST */
-  MPEGTS_BIT_SET (base->known_psi, 0x10);
+  MPEGTS_BASE_SET_PSI (base, 0x10);
   /* SDT, BAT, ST */
-  MPEGTS_BIT_SET (base->known_psi, 0x11);
+  MPEGTS_BASE_SET_PSI (base, 0x11);
   /* EIT, ST, CIT (TS 102 323) */
-  MPEGTS_BIT_SET (base->known_psi, 0x12);
+  MPEGTS_BASE_SET_PSI (base, 0x12);
   /* RST, ST */
-  MPEGTS_BIT_SET (base->known_psi, 0x13);
+  MPEGTS_BASE_SET_PSI (base, 0x13);
   /* RNT (TS 102 323) */
-  MPEGTS_BIT_SET (base->known_psi, 0x16);
+  MPEGTS_BASE_SET_PSI (base, 0x16);
   /* inband signalling */
-  MPEGTS_BIT_SET (base->known_psi, 0x1c);
+  MPEGTS_BASE_SET_PSI (base, 0x1c);
   /* measurement */
-  MPEGTS_BIT_SET (base->known_psi, 0x1d);
+  MPEGTS_BASE_SET_PSI (base, 0x1d);
   /* DIT */
-  MPEGTS_BIT_SET (base->known_psi, 0x1e);
+  MPEGTS_BASE_SET_PSI (base, 0x1e);
   /* SIT */
-  MPEGTS_BIT_SET (base->known_psi, 0x1f);
+  MPEGTS_BASE_SET_PSI (base, 0x1f);
 
   parse->first = TRUE;
   parse->have_group_id = FALSE;
@@ -283,9 +326,7 @@ mpegts_parse_reset (MpegTSBase * base)
   parse->pcr_pid = parse->user_pcr_pid;
   parse->ts_offset = 0;
 
-  gst_adapter_clear (parse->ts_adapter.adapter);
-  parse->ts_adapter.packets_in_adapter = 0;
-  parse->ts_adapter.first_is_keyframe = TRUE;
+  mpegts_parse_adapter_clear (&parse->ts_adapter);
   parse->is_eos = FALSE;
   parse->header = 0;
 }
@@ -317,6 +358,12 @@ mpegts_parse_set_property (GObject * object, guint prop_id,
     case PROP_SHRINK_PAT:
       parse->shrink_pat = g_value_get_boolean (value);
       break;
+    case PROP_BUFFER_LIST:
+      parse->buffer_list = g_value_get_boolean (value);
+      break;
+    case PROP_BATCH_LATENCY:
+      parse->batch_latency = GST_USECOND * g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -347,6 +394,12 @@ mpegts_parse_get_property (GObject * object, guint prop_id,
     case PROP_SHRINK_PAT:
       g_value_set_boolean (value, parse->shrink_pat);
       break;
+    case PROP_BUFFER_LIST:
+      g_value_set_boolean (value, parse->buffer_list);
+      break;
+    case PROP_BATCH_LATENCY:
+      g_value_set_uint (value, parse->batch_latency / GST_USECOND);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -488,7 +541,10 @@ push_event (MpegTSBase * base, GstEvent * event)
         data += packet_size;
       }
       gst_buffer_unmap (buf, &map);
-      gst_adapter_push (parse->ts_adapter.adapter, buf);
+      if (parse->ts_adapter.list)
+        gst_buffer_list_add (parse->ts_adapter.list, buf);
+      else
+        gst_adapter_push (parse->ts_adapter.adapter, buf);
       parse->ts_adapter.packets_in_adapter += missing_packets;
     }
     drain_pending_buffers (parse, TRUE);
@@ -527,9 +583,7 @@ mpegts_parse_create_tspad (MpegTSParse2 * parse, const gchar * pad_name)
   tspad->program = NULL;
   tspad->pushed = FALSE;
   tspad->flow_return = GST_FLOW_NOT_LINKED;
-  tspad->ts_adapter.adapter = gst_adapter_new ();
-  tspad->ts_adapter.packets_in_adapter = 0;
-  tspad->ts_adapter.first_is_keyframe = TRUE;
+  mpegts_parse_adapter_init (&tspad->ts_adapter);
   gst_pad_set_element_private (pad, tspad);
   gst_flow_combiner_add_pad (parse->flowcombiner, pad);
 
@@ -539,8 +593,7 @@ mpegts_parse_create_tspad (MpegTSParse2 * parse, const gchar * pad_name)
 static void
 mpegts_parse_destroy_tspad (MpegTSParse2 * parse, MpegTSParsePad * tspad)
 {
-  gst_adapter_clear (tspad->ts_adapter.adapter);
-  g_object_unref (tspad->ts_adapter.adapter);
+  mpegts_parse_adapter_free (&tspad->ts_adapter);
 
   /* free the wrapper */
   g_free (tspad);
@@ -683,6 +736,7 @@ static GstFlowReturn
 empty_adapter_into_pad (MpegTSParse2Adapter * ts_adapter, GstPad * pad)
 {
   GstAdapter *adapter = ts_adapter->adapter;
+  GstBufferList *list = ts_adapter->list;
   GstBuffer *buf = NULL;
   GstClockTime ts = gst_adapter_prev_pts (adapter, NULL);
   gsize avail = gst_adapter_available (adapter);
@@ -691,7 +745,9 @@ empty_adapter_into_pad (MpegTSParse2Adapter * ts_adapter, GstPad * pad)
   if (avail > 0)
     buf = gst_adapter_take_buffer (adapter, avail);
 
+  ts_adapter->list = NULL;
   ts_adapter->packets_in_adapter = 0;
+  ts_adapter->first_ts = GST_CLOCK_TIME_NONE;
 
   if (buf) {
     GST_BUFFER_PTS (buf) = ts;
@@ -700,14 +756,49 @@ empty_adapter_into_pad (MpegTSParse2Adapter * ts_adapter, GstPad * pad)
     ret = gst_pad_push (pad, buf);
   }
 
+  /* Buffers in the list keep their own timestamps and flags */
+  if (list) {
+    if (ret == GST_FLOW_OK && gst_buffer_list_length (list) > 0)
+      ret = gst_pad_push_list (pad, list);
+    else
+      gst_buffer_list_unref (list);
+  }
+
   return ret;
 }
 
+/* Returns the time used to bound how long packets wait in an adapter: the
+ * input timestamp, common to all pads, else the (possibly smoothed) timestamp
+ * of @buffer if any */
+static GstClockTime
+mpegts_parse_batch_time (MpegTSParse2 * parse, GstBuffer * buffer)
+{
+  GstClockTime ts = GST_MPEGTS_BASE (parse)->packetizer->last_in_time;
+
+  if (!GST_CLOCK_TIME_IS_VALID (ts) && buffer)
+    ts = GST_BUFFER_DTS_OR_PTS (buffer);
+
+  return ts;
+}
+
+/* Whether the packets pending in @ts_adapter have waited batch-latency at
+ * time @ts */
+static gboolean
+mpegts_parse_batch_expired (MpegTSParse2 * parse,
+    MpegTSParse2Adapter * ts_adapter, GstClockTime ts)
+{
+  return parse->batch_latency > 0 && ts_adapter->packets_in_adapter > 0
+      && GST_CLOCK_TIME_IS_VALID (ts_adapter->first_ts)
+      && GST_CLOCK_TIME_IS_VALID (ts) && ts >= ts_adapter->first_ts
+      && ts - ts_adapter->first_ts >= parse->batch_latency;
+}
+
 static GstFlowReturn
 enqueue_and_maybe_push_buffer (MpegTSParse2 * parse, GstPad * pad,
     MpegTSParse2Adapter * ts_adapter, GstBuffer * buffer)
 {
   GstFlowReturn ret = GST_FLOW_OK;
+  GstClockTime ts;
 
   if (buffer != NULL) {
     if (parse->alignment == 1) {
@@ -719,7 +810,19 @@ enqueue_and_maybe_push_buffer (MpegTSParse2 * parse, GstPad * pad,
         ret = empty_adapter_into_pad (ts_adapter, pad);
         ret = gst_flow_combiner_update_flow (parse->flowcombiner, ret);
       }
-      gst_adapter_push (ts_adapter->adapter, buffer);
+
+      ts = mpegts_parse_batch_time (parse, buffer);
+      if (ts_adapter->packets_in_adapter == 0)
+        ts_adapter->first_ts = ts;
+
+      if (parse->buffer_list) {
+        if (ts_adapter->list == NULL)
+          ts_adapter->list =
+              gst_buffer_list_new_sized (MAX (parse->alignment, 16));
+        gst_buffer_list_add (ts_adapter->list, buffer);
+      } else {
+        gst_adapter_push (ts_adapter->adapter, buffer);
+      }
       ts_adapter->packets_in_adapter++;
       if (ts_adapter->packets_in_adapter == 1 && parse->split_on_rai) {
         ts_adapter->first_is_keyframe =
@@ -730,6 +833,12 @@ enqueue_and_maybe_push_buffer (MpegTSParse2 * parse, GstPad * pad,
           && ts_adapter->packets_in_adapter > 0) {
         ret = empty_adapter_into_pad (ts_adapter, pad);
         ret = gst_flow_combiner_update_flow (parse->flowcombiner, ret);
+      } else if (mpegts_parse_batch_expired (parse, ts_adapter, ts)) {
+        GST_LOG_OBJECT (pad, "Pushing %u packets after %" GST_TIME_FORMAT,
+            ts_adapter->packets_in_adapter,
+            GST_TIME_ARGS (ts - ts_adapter->first_ts));
+        ret = empty_adapter_into_pad (ts_adapter, pad);
+        ret = gst_flow_combiner_update_flow (parse->flowcombiner, ret);
       }
     }
   }
@@ -739,7 +848,8 @@ enqueue_and_maybe_push_buffer (MpegTSParse2 * parse, GstPad * pad,
 
 static GstFlowReturn
 mpegts_parse_tspad_push_section (MpegTSParse2 * parse, MpegTSParsePad * tspad,
-    GstMpegtsSection * section, MpegTSPacketizerPacket * packet)
+    GstMpegtsSection * section, MpegTSPacketizerPacket * packet,
+    GstBuffer * packet_buf)
 {
   GstFlowReturn ret = GST_FLOW_OK;
   gboolean to_push = TRUE;
@@ -766,7 +876,7 @@ mpegts_parse_tspad_push_section (MpegTSParse2 * parse, MpegTSParsePad * tspad,
       tspad->program_number, section ? section->table_id : -1);
 
   if (to_push) {
-    GstBuffer *buf = mpegts_packet_to_buffer (packet);
+    GstBuffer *buf = gst_buffer_ref (packet_buf);
 
     if (packet->pid == 0x00 && parse->shrink_pat) {
       GstMapInfo mapinfo;
@@ -790,7 +900,7 @@ mpegts_parse_tspad_push_section (MpegTSParse2 * parse, MpegTSParsePad * tspad,
 
 static GstFlowReturn
 mpegts_parse_tspad_push (MpegTSParse2 * parse, MpegTSParsePad * tspad,
-    MpegTSPacketizerPacket * packet)
+    MpegTSPacketizerPacket * packet, GstBuffer * packet_buf)
 {
   GstFlowReturn ret = GST_FLOW_OK;
   MpegTSBaseProgram *bp = NULL;
@@ -806,11 +916,10 @@ mpegts_parse_tspad_push (MpegTSParse2 * parse, MpegTSParsePad * tspad,
   if (bp) {
     if (packet->pid == bp->pmt_pid || bp->streams == NULL
         || bp->streams[packet->pid]) {
-      GstBuffer *buf = mpegts_packet_to_buffer (packet);
       /* push if there's no filter or if the pid is in the filter */
       ret =
           enqueue_and_maybe_push_buffer (parse, tspad->pad, &tspad->ts_adapter,
-          buf);
+          gst_buffer_ref (packet_buf));
     }
   }
   GST_DEBUG_OBJECT (parse, "Returning %s", gst_flow_get_name (ret));
@@ -838,7 +947,7 @@ mpegts_parse_push (MpegTSBase * base, MpegTSPacketizerPacket * packet,
   MpegTSParsePad *tspad;
   GstFlowReturn ret;
   GList *srcpads;
-  GstBuffer *buf;
+  GstBuffer *buf, *pad_buf;
 
   GST_OBJECT_LOCK (parse);
   srcpads = parse->srcpads;
@@ -863,6 +972,11 @@ mpegts_parse_push (MpegTSBase * base, MpegTSPacketizerPacket * packet,
       && !(packet->afc_flags & MPEGTS_AFC_RANDOM_ACCESS_FLAG)) {
     gst_buffer_set_flags (buf, GST_BUFFER_FLAG_DELTA_UNIT);
   }
+  /* The program pads share one buffer using the memory of the src pad one,
+   * which thus stays writable for its timestamps to be set without a copy.
+   * The memory is only copied where it needs to be modified */
+  pad_buf = pad ? gst_buffer_copy_region (buf, GST_BUFFER_COPY_FLAGS |
+      GST_BUFFER_COPY_MEMORY, 0, -1) : NULL;
   ret = mpegts_parse_have_buffer (base, buf);
 
   while (pad && !done) {
@@ -870,17 +984,19 @@ mpegts_parse_push (MpegTSBase * base, MpegTSPacketizerPacket * packet,
 
     if (G_LIKELY (!tspad->pushed)) {
       if (section ||
-          (!MPEGTS_BIT_IS_SET (base->is_pes, packet->pid) &&
-              MPEGTS_BIT_IS_SET (base->known_psi, packet->pid))) {
+          (!MPEGTS_BASE_IS_PES (base, packet->pid) &&
+              MPEGTS_BASE_IS_PSI (base, packet->pid))) {
         /* exclude foreign PMTs */
         if (packet->pid >= 0x30 && tspad->program
             && tspad->program->program.pmt_pid != packet->pid)
           tspad->flow_return = GST_FLOW_OK;
         else
           tspad->flow_return =
-              mpegts_parse_tspad_push_section (parse, tspad, section, packet);
+              mpegts_parse_tspad_push_section (parse, tspad, section, packet,
+              pad_buf);
       } else {
-        tspad->flow_return = mpegts_parse_tspad_push (parse, tspad, packet);
+        tspad->flow_return =
+            mpegts_parse_tspad_push (parse, tspad, packet, pad_buf);
       }
       tspad->pushed = TRUE;
 
@@ -920,6 +1036,9 @@ mpegts_parse_push (MpegTSBase * base, MpegTSPacketizerPacket * packet,
     }
   }
 
+  if (pad_buf)
+    gst_buffer_unref (pad_buf);
+
   return ret;
 }
 
@@ -1163,8 +1282,21 @@ empty_pad (GstPad * pad, MpegTSParse2 * parse)
   ret = gst_flow_combiner_update_flow (parse->flowcombiner, ret);
 }
 
+static void
+empty_pad_if_expired (GstPad * pad, MpegTSParse2 * parse)
+{
+  MpegTSParsePad *tspad = (MpegTSParsePad *) gst_pad_get_element_private (pad);
+
+  if (mpegts_parse_batch_expired (parse, &tspad->ts_adapter,
+          mpegts_parse_batch_time (parse, NULL))) {
+    GST_LOG_OBJECT (pad, "Pushing %u packets after batch latency",
+        tspad->ts_adapter.packets_in_adapter);
+    empty_pad (pad, parse);
+  }
+}
+
 static GstFlowReturn
-mpegts_parse_input_done (MpegTSBase * base)
+mpegts_parse_input_done (MpegTSBase * base, GstBuffer * buffer)
 {
   MpegTSParse2 *parse = GST_MPEGTS_PARSE (base);
   GstFlowReturn ret = GST_FLOW_OK;
@@ -1176,6 +1308,15 @@ mpegts_parse_input_done (MpegTSBase * base)
     ret = empty_adapter_into_pad (&parse->ts_adapter, parse->srcpad);
     ret = gst_flow_combiner_update_flow (parse->flowcombiner, ret);
     g_list_foreach (parse->srcpads, (GFunc) empty_pad, parse);
+  } else if (parse->batch_latency > 0) {
+    /* Pads that got no packet from this input still have to be pushed
+     * once their packets waited long enough */
+    if (mpegts_parse_batch_expired (parse, &parse->ts_adapter,
+            mpegts_parse_batch_time (parse, NULL))) {
+      ret = empty_adapter_into_pad (&parse->ts_adapter, parse->srcpad);
+      ret = gst_flow_combiner_update_flow (parse->flowcombiner, ret);
+    }
+    g_list_foreach (parse->srcpads, (GFunc) empty_pad_if_expired, parse);
   }
   return ret;
 }
@@ -48,8 +48,12 @@ typedef struct _MpegTSParse2Class MpegTSParse2Class;
 
 typedef struct _MpegTSParse2Adapter {
   GstAdapter *adapter;
+  /* pending packets when pushing buffer lists */
+  GstBufferList *list;
   guint packets_in_adapter;
   gboolean first_is_keyframe;
+  /* time at which the first pending packet was queued */
+  GstClockTime first_ts;
 } MpegTSParse2Adapter;
 
 struct _MpegTSParse2 {
@@ -86,6 +90,8 @@ struct _MpegTSParse2 {
   /* Combine several packets into a larger buffer */
   MpegTSParse2Adapter ts_adapter;
   guint alignment;
+  gboolean buffer_list;
+  GstClockTime batch_latency;
   gboolean split_on_rai;
   gboolean is_eos;
   guint32 header;
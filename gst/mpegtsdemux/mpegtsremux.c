@@ -0,0 +1,1157 @@
+/*
+ * mpegtsremux.c - GStreamer MPEG transport stream remultiplexer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:element-tsremux
+ * @title: tsremux
+ *
+ * Remultiplexes an MPEG transport stream at the packet level. The programs
+ * listed in #MpegTSRemux:programs are kept, PIDs are renumbered according
+ * to #MpegTSRemux:pid-map and the PAT, the CAT, the PMTs and the SDT are
+ * rewritten to describe the output. Elementary stream packets are passed
+ * through untouched apart from their PID, no PES is ever reassembled. The
+ * NIT and the ECM and EMM streams the CA descriptors point to are kept as
+ * well.
+ *
+ * With #MpegTSRemux:keep-timing, every input packet position is kept in the
+ * output, dropped packets being replaced by null packets, and the PCRs
+ * carried by packets that moved are corrected so that the output can
+ * replace the input in a constant bitrate chain.
+ *
+ * ## Example launch line
+ * |[
+ * gst-launch-1.0 filesrc location=mux.ts ! tsremux programs=2,3 \
+ *     pid-map="0x100=0x40,0x101=0x41" ! filesink location=out.ts
+ * ]|
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "mpegtsbase.h"
+#include "mpegtsremux.h"
+
+#define SYNC_BYTE 0x47
+#define NULL_PID 0x1fff
+#define TS_PACKET_SIZE MPEGTS_NORMAL_PACKETSIZE
+
+/* PCR wrap-around, 2^33 * 300 */
+#define PCR_MAX (G_GUINT64_CONSTANT (0x200000000) * 300)
+
+GST_DEBUG_CATEGORY_STATIC (mpegts_remux_debug);
+#define GST_CAT_DEFAULT mpegts_remux_debug
+
+typedef enum
+{
+  MPEGTS_REMUX_PID_DROP = 0,
+  /* packets are copied with their PID remapped */
+  MPEGTS_REMUX_PID_PASS = 1 << 0,
+  /* packets are replaced by the rewritten sections */
+  MPEGTS_REMUX_PID_REWRITE = 1 << 1
+} MpegTSRemuxPIDFlags;
+
+typedef struct
+{
+  /* input PID and identification of the input section */
+  guint16 pid;
+  guint8 table_id;
+  guint16 extension;
+  guint8 section_number;
+
+  guint16 out_pid;
+  /* TS packets of the rewritten section, with blank continuity counters */
+  GByteArray *packets;
+} MpegTSRemuxSection;
+
+typedef struct
+{
+  guint16 pid;
+
+  /* latest input PCR and the input packet carrying it */
+  guint64 last_pcr;
+  guint64 last_packet;
+
+  /* PCR ticks over input packets between the two latest PCRs */
+  guint64 ticks;
+  guint64 packets;
+} MpegTSRemuxPCR;
+
+static GstStaticPadTemplate src_template =
+GST_STATIC_PAD_TEMPLATE ("src", GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("video/mpegts, " "systemstream = (boolean) true, "
+        "packetsize = (int) " G_STRINGIFY (MPEGTS_NORMAL_PACKETSIZE))
+    );
+
+enum
+{
+  PROP_0,
+  PROP_PROGRAMS,
+  PROP_PID_MAP,
+  PROP_KEEP_TIMING,
+  /* FILL ME */
+};
+
+static void mpegts_remux_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void mpegts_remux_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+
+static GstFlowReturn
+mpegts_remux_push (MpegTSBase * base, MpegTSPacketizerPacket * packet,
+    GstMpegtsSection * section);
+static void mpegts_remux_inspect_packet (MpegTSBase * base,
+    MpegTSPacketizerPacket * packet);
+static gboolean mpegts_remux_push_event (MpegTSBase * base, GstEvent * event);
+static void mpegts_remux_reset (MpegTSBase * base);
+static GstFlowReturn mpegts_remux_input_done (MpegTSBase * base,
+    GstBuffer * buffer);
+static void mpegts_remux_update_pids (MpegTSRemux * remux);
+
+#define mpegts_remux_parent_class parent_class
+G_DEFINE_TYPE (MpegTSRemux, mpegts_remux, GST_TYPE_MPEGTS_BASE);
+
+static void
+mpegts_remux_section_clear (MpegTSRemuxSection * section)
+{
+  g_byte_array_unref (section->packets);
+}
+
+static void
+mpegts_remux_finalize (GObject * object)
+{
+  MpegTSRemux *remux = (MpegTSRemux *) object;
+
+  g_free (remux->programs_str);
+  g_free (remux->pid_map_str);
+  g_array_free (remux->programs, TRUE);
+  g_free (remux->pid_map);
+  g_free (remux->pid_flags);
+  g_free (remux->cc);
+
+  if (remux->pat)
+    gst_mpegts_section_unref (remux->pat);
+  if (remux->cat)
+    gst_mpegts_section_unref (remux->cat);
+  g_hash_table_unref (remux->pmts);
+  g_array_free (remux->sections, TRUE);
+  g_array_free (remux->pcrs, TRUE);
+  g_byte_array_unref (remux->out);
+
+  GST_CALL_PARENT (G_OBJECT_CLASS, finalize, (object));
+}
+
+static void
+mpegts_remux_class_init (MpegTSRemuxClass * klass)
+{
+  GObjectClass *gobject_class = (GObjectClass *) (klass);
+  GstElementClass *element_class;
+  MpegTSBaseClass *ts_class;
+
+  gobject_class->set_property = mpegts_remux_set_property;
+  gobject_class->get_property = mpegts_remux_get_property;
+  gobject_class->finalize = mpegts_remux_finalize;
+
+  g_object_class_install_property (gobject_class, PROP_PROGRAMS,
+      g_param_spec_string ("programs", "Programs",
+          "Comma separated list of the program numbers to keep "
+          "(NULL = all)", NULL,
+          G_PARAM_READWRITE | GST_PARAM_MUTABLE_READY |
+          G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_PID_MAP,
+      g_param_spec_string ("pid-map", "PID map",
+          "Comma separated list of input=output PID pairs, other PIDs are "
+          "kept as they are (e.g. \"0x100=0x40,0x101=0x41\"). A kept PID "
+          "another one is mapped onto is dropped", NULL,
+          G_PARAM_READWRITE | GST_PARAM_MUTABLE_READY |
+          G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_KEEP_TIMING,
+      g_param_spec_boolean ("keep-timing", "Keep timing",
+          "Replace dropped packets with null packets and correct the PCRs "
+          "of moved packets so that the output keeps the input bitrate",
+          FALSE, G_PARAM_READWRITE | GST_PARAM_MUTABLE_READY |
+          G_PARAM_STATIC_STRINGS));
+
+  element_class = GST_ELEMENT_CLASS (klass);
+
+  gst_element_class_add_static_pad_template (element_class, &src_template);
+
+  gst_element_class_set_static_metadata (element_class,
+      "MPEG transport stream remuxer", "Codec/Muxer",
+      "Selects programs, remaps PIDs and rewrites the PSI of MPEG2 "
+      "transport streams without demuxing them",
+      "GStreamer maintainers <gstreamer-devel@lists.freedesktop.org>");
+
+  ts_class = GST_MPEGTS_BASE_CLASS (klass);
+  ts_class->push = GST_DEBUG_FUNCPTR (mpegts_remux_push);
+  ts_class->push_event = GST_DEBUG_FUNCPTR (mpegts_remux_push_event);
+  ts_class->reset = GST_DEBUG_FUNCPTR (mpegts_remux_reset);
+  ts_class->input_done = GST_DEBUG_FUNCPTR (mpegts_remux_input_done);
+  ts_class->inspect_packet = GST_DEBUG_FUNCPTR (mpegts_remux_inspect_packet);
+}
+
+static void
+mpegts_remux_init (MpegTSRemux * remux)
+{
+  MpegTSBase *base = (MpegTSBase *) remux;
+  guint i;
+
+  base->push_data = TRUE;
+  base->push_section = TRUE;
+  base->push_unknown = TRUE;
+
+  remux->programs = g_array_new (FALSE, FALSE, sizeof (guint16));
+  remux->pid_map = g_new (guint16, MPEGTS_BASE_N_PIDS);
+  for (i = 0; i < MPEGTS_BASE_N_PIDS; i++)
+    remux->pid_map[i] = i;
+  remux->pid_flags = g_new0 (guint8, MPEGTS_BASE_N_PIDS);
+  remux->cc = g_new0 (guint8, MPEGTS_BASE_N_PIDS);
+
+  remux->pmts = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL,
+      (GDestroyNotify) gst_mpegts_section_unref);
+  remux->sections = g_array_new (FALSE, FALSE, sizeof (MpegTSRemuxSection));
+  g_array_set_clear_func (remux->sections,
+      (GDestroyNotify) mpegts_remux_section_clear);
+  remux->pcrs = g_array_new (FALSE, FALSE, sizeof (MpegTSRemuxPCR));
+  remux->out = g_byte_array_new ();
+
+  remux->srcpad = gst_pad_new_from_static_template (&src_template, "src");
+  gst_element_add_pad (GST_ELEMENT (remux), remux->srcpad);
+
+  remux->first = TRUE;
+  remux->have_group_id = FALSE;
+  remux->group_id = G_MAXUINT;
+
+  mpegts_remux_update_pids (remux);
+}
+
+static gboolean
+mpegts_remux_program_selected (MpegTSRemux * remux, guint16 program_number)
+{
+  guint i;
+
+  if (remux->programs->len == 0)
+    return TRUE;
+
+  for (i = 0; i < remux->programs->len; i++) {
+    if (g_array_index (remux->programs, guint16, i) == program_number)
+      return TRUE;
+  }
+
+  return FALSE;
+}
+
+/* Pass the ECM or EMM PIDs the CA descriptors of @descriptors point to */
+static void
+mpegts_remux_pass_ca_pids (MpegTSRemux * remux, GPtrArray * descriptors)
+{
+  guint i;
+
+  for (i = 0; i < descriptors->len; i++) {
+    GstMpegtsDescriptor *desc = g_ptr_array_index (descriptors, i);
+    guint16 ca_system_id, ca_pid;
+
+    if (desc->tag == GST_MTS_DESC_CA
+        && gst_mpegts_descriptor_parse_ca (desc, &ca_system_id, &ca_pid,
+            NULL, NULL) && ca_pid != NULL_PID)
+      remux->pid_flags[ca_pid] |= MPEGTS_REMUX_PID_PASS;
+  }
+}
+
+/* A kept PID another one is mapped onto would mix both streams in the
+ * output, drop it */
+static void
+mpegts_remux_drop_colliding_pids (MpegTSRemux * remux)
+{
+  guint i;
+
+  for (i = 0; i < MPEGTS_BASE_N_PIDS; i++) {
+    guint16 out = remux->pid_map[i];
+
+    if (out == i || remux->pid_flags[i] == MPEGTS_REMUX_PID_DROP)
+      continue;
+
+    if (remux->pid_map[out] == out
+        && remux->pid_flags[out] != MPEGTS_REMUX_PID_DROP) {
+      GST_WARNING_OBJECT (remux, "PID 0x%04x is mapped onto PID 0x%04x, "
+          "dropping the packets of the latter", i, out);
+      remux->pid_flags[out] = MPEGTS_REMUX_PID_DROP;
+    }
+  }
+}
+
+/* Recompute what happens to each input PID from the latest PAT, CAT and the
+ * PMTs of the kept programs */
+static void
+mpegts_remux_update_pids (MpegTSRemux * remux)
+{
+  GHashTableIter iter;
+  gpointer value;
+  GPtrArray *programs, *descriptors;
+  guint i;
+
+  memset (remux->pid_flags, MPEGTS_REMUX_PID_DROP, MPEGTS_BASE_N_PIDS);
+
+  /* PAT, CAT and SDT are rewritten, NIT, EIT and TDT/TOT are passed
+   * through */
+  remux->pid_flags[0x00] = MPEGTS_REMUX_PID_REWRITE;
+  remux->pid_flags[0x01] = MPEGTS_REMUX_PID_REWRITE;
+  remux->pid_flags[0x10] = MPEGTS_REMUX_PID_PASS;
+  remux->pid_flags[0x11] = MPEGTS_REMUX_PID_REWRITE;
+  remux->pid_flags[0x12] = MPEGTS_REMUX_PID_PASS;
+  remux->pid_flags[0x14] = MPEGTS_REMUX_PID_PASS;
+
+  if (remux->pat && (programs = gst_mpegts_section_get_pat (remux->pat))) {
+    for (i = 0; i < programs->len; i++) {
+      GstMpegtsPatProgram *program = g_ptr_array_index (programs, i);
+
+      if (program->program_number == 0)
+        remux->pid_flags[program->network_or_program_map_PID] |=
+            MPEGTS_REMUX_PID_PASS;
+      else if (mpegts_remux_program_selected (remux, program->program_number))
+        remux->pid_flags[program->network_or_program_map_PID] |=
+            MPEGTS_REMUX_PID_REWRITE;
+    }
+    g_ptr_array_unref (programs);
+  }
+
+  /* EMM streams */
+  if (remux->cat && (descriptors = gst_mpegts_section_get_cat (remux->cat))) {
+    mpegts_remux_pass_ca_pids (remux, descriptors);
+    g_ptr_array_unref (descriptors);
+  }
+
+  g_hash_table_iter_init (&iter, remux->pmts);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    const GstMpegtsPMT *pmt = gst_mpegts_section_get_pmt (value);
+
+    if (pmt == NULL)
+      continue;
+
+    /* ECM streams of the program and of its elementary streams */
+    mpegts_remux_pass_ca_pids (remux, pmt->descriptors);
+    if (pmt->pcr_pid != NULL_PID)
+      remux->pid_flags[pmt->pcr_pid] |= MPEGTS_REMUX_PID_PASS;
+    for (i = 0; i < pmt->streams->len; i++) {
+      GstMpegtsPMTStream *stream = g_ptr_array_index (pmt->streams, i);
+
+      remux->pid_flags[stream->pid] |= MPEGTS_REMUX_PID_PASS;
+      mpegts_remux_pass_ca_pids (remux, stream->descriptors);
+    }
+  }
+
+  mpegts_remux_drop_colliding_pids (remux);
+}
+
+static void
+mpegts_remux_parse_programs (MpegTSRemux * remux)
+{
+  gchar **numbers;
+  guint i;
+
+  g_array_set_size (remux->programs, 0);
+  if (remux->programs_str == NULL)
+    return;
+
+  numbers = g_strsplit (remux->programs_str, ",", -1);
+  for (i = 0; numbers[i]; i++) {
+    gchar *str = g_strstrip (numbers[i]), *end;
+    guint64 number;
+    guint16 program_number;
+
+    if (*str == '\0')
+      continue;
+
+    number = g_ascii_strtoull (str, &end, 0);
+    if (*end != '\0' || number == 0 || number > G_MAXUINT16) {
+      GST_WARNING_OBJECT (remux, "Ignoring invalid program number '%s'", str);
+      continue;
+    }
+    program_number = number;
+    g_array_append_val (remux->programs, program_number);
+  }
+  g_strfreev (numbers);
+}
+
+static gboolean
+mpegts_remux_parse_pid (const gchar * str, guint16 * pid)
+{
+  gchar *end;
+  guint64 value;
+
+  value = g_ascii_strtoull (str, &end, 0);
+  /* PIDs below 0x10 have a fixed meaning and 0x1fff is the null PID */
+  if (end == str || *end != '\0' || value < 0x10 || value >= NULL_PID)
+    return FALSE;
+
+  *pid = value;
+  return TRUE;
+}
+
+/* Whether another input PID is already mapped onto @pid */
+static gboolean
+mpegts_remux_is_mapped_onto (MpegTSRemux * remux, guint16 in, guint16 pid)
+{
+  guint i;
+
+  for (i = 0; i < MPEGTS_BASE_N_PIDS; i++) {
+    if (i != in && i != pid && remux->pid_map[i] == pid)
+      return TRUE;
+  }
+
+  return FALSE;
+}
+
+static void
+mpegts_remux_parse_pid_map (MpegTSRemux * remux)
+{
+  gchar **pairs;
+  guint i;
+
+  for (i = 0; i < MPEGTS_BASE_N_PIDS; i++)
+    remux->pid_map[i] = i;
+  if (remux->pid_map_str == NULL)
+    return;
+
+  pairs = g_strsplit (remux->pid_map_str, ",", -1);
+  for (i = 0; pairs[i]; i++) {
+    gchar **pids = g_strsplit (pairs[i], "=", 2);
+    guint16 in, out;
+
+    if (g_strv_length (pids) == 2
+        && mpegts_remux_parse_pid (g_strstrip (pids[0]), &in)
+        && mpegts_remux_parse_pid (g_strstrip (pids[1]), &out)) {
+      if (mpegts_remux_is_mapped_onto (remux, in, out))
+        GST_WARNING_OBJECT (remux, "Ignoring PID mapping '%s', another PID "
+            "is already mapped onto 0x%04x", pairs[i], out);
+      else
+        remux->pid_map[in] = out;
+    } else if (*g_strstrip (pairs[i]) != '\0') {
+      GST_WARNING_OBJECT (remux, "Ignoring invalid PID mapping '%s'",
+          pairs[i]);
+    }
+    g_strfreev (pids);
+  }
+  g_strfreev (pairs);
+}
+
+static void
+mpegts_remux_reset (MpegTSBase * base)
+{
+  MpegTSRemux *remux = (MpegTSRemux *) base;
+
+  /* CAT */
+  MPEGTS_BASE_SET_PSI (base, 0x01);
+  /* SDT, BAT */
+  MPEGTS_BASE_SET_PSI (base, 0x11);
+
+  /* Called from the base class init, before ours */
+  if (G_UNLIKELY (remux->sections == NULL))
+    return;
+
+  remux->first = TRUE;
+  remux->have_group_id = FALSE;
+  remux->group_id = G_MAXUINT;
+
+  if (remux->pat)
+    gst_mpegts_section_unref (remux->pat);
+  remux->pat = NULL;
+  if (remux->cat)
+    gst_mpegts_section_unref (remux->cat);
+  remux->cat = NULL;
+  g_hash_table_remove_all (remux->pmts);
+  g_array_set_size (remux->sections, 0);
+  g_array_set_size (remux->pcrs, 0);
+  g_byte_array_set_size (remux->out, 0);
+  memset (remux->cc, 0, MPEGTS_BASE_N_PIDS);
+
+  remux->in_packets = 0;
+  remux->out_packets = 0;
+
+  mpegts_remux_update_pids (remux);
+}
+
+static void
+mpegts_remux_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  MpegTSRemux *remux = (MpegTSRemux *) object;
+
+  switch (prop_id) {
+    case PROP_PROGRAMS:
+      g_free (remux->programs_str);
+      remux->programs_str = g_value_dup_string (value);
+      mpegts_remux_parse_programs (remux);
+      break;
+    case PROP_PID_MAP:
+      g_free (remux->pid_map_str);
+      remux->pid_map_str = g_value_dup_string (value);
+      mpegts_remux_parse_pid_map (remux);
+      break;
+    case PROP_KEEP_TIMING:
+      remux->keep_timing = g_value_get_boolean (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+  }
+}
+
+static void
+mpegts_remux_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  MpegTSRemux *remux = (MpegTSRemux *) object;
+
+  switch (prop_id) {
+    case PROP_PROGRAMS:
+      g_value_set_string (value, remux->programs_str);
+      break;
+    case PROP_PID_MAP:
+      g_value_set_string (value, remux->pid_map_str);
+      break;
+    case PROP_KEEP_TIMING:
+      g_value_set_boolean (value, remux->keep_timing);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+  }
+}
+
+static gboolean
+prepare_src_pad (MpegTSBase * base, MpegTSRemux * remux)
+{
+  GstEvent *event;
+  GstCaps *caps;
+  gchar *stream_id;
+
+  if (!remux->first)
+    return TRUE;
+
+  /* If there's no packet_size yet, we can't set caps yet */
+  if (G_UNLIKELY (base->packetizer->packet_size == 0))
+    return FALSE;
+
+  event = gst_pad_get_sticky_event (base->sinkpad, GST_EVENT_STREAM_START, 0);
+  if (event) {
+    remux->have_group_id = gst_event_parse_group_id (event, &remux->group_id);
+    gst_event_unref (event);
+  } else if (!remux->have_group_id) {
+    remux->have_group_id = TRUE;
+    remux->group_id = gst_util_group_id_next ();
+  }
+
+  stream_id =
+      gst_pad_create_stream_id (remux->srcpad, GST_ELEMENT_CAST (base),
+      "remux");
+  event = gst_event_new_stream_start (stream_id);
+  if (remux->have_group_id)
+    gst_event_set_group_id (event, remux->group_id);
+  gst_pad_push_event (remux->srcpad, event);
+  g_free (stream_id);
+
+  /* Whatever the input packet size, 188 bytes packets are written */
+  caps = gst_caps_new_simple ("video/mpegts",
+      "systemstream", G_TYPE_BOOLEAN, TRUE,
+      "packetsize", G_TYPE_INT, TS_PACKET_SIZE, NULL);
+  gst_pad_set_caps (remux->srcpad, caps);
+  gst_caps_unref (caps);
+
+  base->out_segment = base->segment;
+  gst_pad_push_event (remux->srcpad,
+      gst_event_new_segment (&base->out_segment));
+
+  remux->first = FALSE;
+
+  return TRUE;
+}
+
+static gboolean
+mpegts_remux_push_event (MpegTSBase * base, GstEvent * event)
+{
+  MpegTSRemux *remux = (MpegTSRemux *) base;
+
+  if (G_UNLIKELY (remux->first)) {
+    /* We will send the segment when really starting  */
+    if (G_UNLIKELY (GST_EVENT_TYPE (event) == GST_EVENT_SEGMENT)) {
+      gst_event_unref (event);
+      return TRUE;
+    }
+    prepare_src_pad (base, remux);
+  }
+
+  if (GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_STOP)
+    g_byte_array_set_size (remux->out, 0);
+
+  return gst_pad_push_event (remux->srcpad, event);
+}
+
+static guint8 *
+mpegts_remux_next_packet (MpegTSRemux * remux)
+{
+  guint len = remux->out->len;
+
+  g_byte_array_set_size (remux->out, len + TS_PACKET_SIZE);
+  remux->out_packets++;
+
+  return remux->out->data + len;
+}
+
+static void
+mpegts_remux_write_null_packet (MpegTSRemux * remux)
+{
+  guint8 *data = mpegts_remux_next_packet (remux);
+
+  data[0] = SYNC_BYTE;
+  GST_WRITE_UINT16_BE (data + 1, NULL_PID);
+  data[3] = 0x10;
+  memset (data + 4, 0xff, TS_PACKET_SIZE - 4);
+}
+
+/* With keep-timing, each input packet gives at least one output packet */
+static void
+mpegts_remux_fill (MpegTSRemux * remux)
+{
+  if (!remux->keep_timing)
+    return;
+
+  while (remux->out_packets < remux->in_packets)
+    mpegts_remux_write_null_packet (remux);
+}
+
+static MpegTSRemuxPCR *
+mpegts_remux_get_pcr (MpegTSRemux * remux, guint16 pid)
+{
+  MpegTSRemuxPCR *pcr;
+  guint i;
+
+  for (i = 0; i < remux->pcrs->len; i++) {
+    pcr = &g_array_index (remux->pcrs, MpegTSRemuxPCR, i);
+    if (pcr->pid == pid)
+      return pcr;
+  }
+
+  g_array_set_size (remux->pcrs, remux->pcrs->len + 1);
+  pcr = &g_array_index (remux->pcrs, MpegTSRemuxPCR, remux->pcrs->len - 1);
+  pcr->pid = pid;
+  pcr->last_pcr = G_MAXUINT64;
+  pcr->last_packet = 0;
+  pcr->ticks = 0;
+  pcr->packets = 0;
+
+  return pcr;
+}
+
+static void
+mpegts_remux_write_pcr (guint8 * data, guint64 pcr)
+{
+  guint64 pcr_base = pcr / 300;
+  guint16 pcr_ext = pcr % 300;
+
+  data[0] = pcr_base >> 25;
+  data[1] = pcr_base >> 17;
+  data[2] = pcr_base >> 9;
+  data[3] = pcr_base >> 1;
+  data[4] = ((pcr_base & 1) << 7) | 0x7e | (pcr_ext >> 8);
+  data[5] = pcr_ext & 0xff;
+}
+
+/* Move the PCR of @packet, written at @data, by the distance between its
+ * input and output position, using the PCR rate measured on its PID */
+static void
+mpegts_remux_restamp_pcr (MpegTSRemux * remux,
+    MpegTSPacketizerPacket * packet, guint8 * data, guint64 out_packet)
+{
+  MpegTSRemuxPCR *rate = mpegts_remux_get_pcr (remux, packet->pid);
+  guint64 in_packet = remux->in_packets - 1;
+  gint64 shift = (gint64) out_packet - (gint64) in_packet;
+
+  if (remux->keep_timing && shift != 0 && rate->packets > 0) {
+    gint64 pcr;
+
+    pcr = packet->pcr + shift * (gint64) rate->ticks / (gint64) rate->packets;
+    pcr = (pcr + PCR_MAX) % PCR_MAX;
+    GST_LOG_OBJECT (remux, "PID 0x%04x moved by %" G_GINT64_FORMAT
+        " packets, PCR %" G_GUINT64_FORMAT " -> %" G_GINT64_FORMAT,
+        packet->pid, shift, packet->pcr, pcr);
+    mpegts_remux_write_pcr (data + 6, pcr);
+  }
+
+  if (rate->last_pcr != G_MAXUINT64 && in_packet > rate->last_packet) {
+    rate->ticks = (packet->pcr + PCR_MAX - rate->last_pcr) % PCR_MAX;
+    rate->packets = in_packet - rate->last_packet;
+  }
+  rate->last_pcr = packet->pcr;
+  rate->last_packet = in_packet;
+}
+
+static void
+mpegts_remux_write_packet (MpegTSRemux * remux,
+    MpegTSPacketizerPacket * packet)
+{
+  guint64 out_packet = remux->out_packets;
+  guint16 pid = remux->pid_map[packet->pid];
+  guint8 *data;
+
+  data = mpegts_remux_next_packet (remux);
+  memcpy (data, packet->data_start, TS_PACKET_SIZE);
+  data[1] = (data[1] & 0xe0) | (pid >> 8);
+  data[2] = pid & 0xff;
+
+  if (packet->afc_flags & MPEGTS_AFC_PCR_FLAG)
+    mpegts_remux_restamp_pcr (remux, packet, data, out_packet);
+}
+
+static MpegTSRemuxSection *
+mpegts_remux_find_section (MpegTSRemux * remux, guint16 pid,
+    guint8 table_id, guint16 extension, guint8 section_number)
+{
+  guint i;
+
+  for (i = 0; i < remux->sections->len; i++) {
+    MpegTSRemuxSection *section =
+        &g_array_index (remux->sections, MpegTSRemuxSection, i);
+
+    if (section->pid == pid && section->table_id == table_id
+        && section->extension == extension
+        && section->section_number == section_number)
+      return section;
+  }
+
+  return NULL;
+}
+
+/* Look up the rewritten version of the section starting in @packet */
+static MpegTSRemuxSection *
+mpegts_remux_find_packet_section (MpegTSRemux * remux,
+    MpegTSPacketizerPacket * packet)
+{
+  guint8 *data = packet->payload;
+
+  if (data == NULL || data >= packet->data_end)
+    return NULL;
+
+  /* pointer_field */
+  data += 1 + *data;
+  if (data + 7 > packet->data_end || data[0] == 0xff || !(data[1] & 0x80))
+    return NULL;
+
+  return mpegts_remux_find_section (remux, packet->pid, data[0],
+      GST_READ_UINT16_BE (data + 3), data[6]);
+}
+
+static void
+mpegts_remux_packetize (GByteArray * packets, guint16 pid,
+    const guint8 * data, gsize size)
+{
+  gboolean first = TRUE;
+
+  while (first || size > 0) {
+    gsize avail = TS_PACKET_SIZE - 4, len;
+    guint8 *p;
+
+    g_byte_array_set_size (packets, packets->len + TS_PACKET_SIZE);
+    p = packets->data + packets->len - TS_PACKET_SIZE;
+
+    p[0] = SYNC_BYTE;
+    p[1] = (first ? 0x40 : 0) | (pid >> 8);
+    p[2] = pid & 0xff;
+    /* payload only, the continuity counter is set when writing */
+    p[3] = 0x10;
+    p += 4;
+
+    if (first) {
+      /* pointer_field */
+      *p++ = 0;
+      avail--;
+    }
+
+    len = MIN (size, avail);
+    memcpy (p, data, len);
+    memset (p + len, 0xff, avail - len);
+
+    data += len;
+    size -= len;
+    first = FALSE;
+  }
+}
+
+/* Cache the TS packets of @data, the rewritten version of @in */
+static MpegTSRemuxSection *
+mpegts_remux_cache_section (MpegTSRemux * remux, guint16 pid,
+    GstMpegtsSection * in, const guint8 * data, gsize size)
+{
+  MpegTSRemuxSection *section;
+
+  section = mpegts_remux_find_section (remux, pid, in->table_id,
+      in->subtable_extension, in->section_number);
+  if (section == NULL) {
+    g_array_set_size (remux->sections, remux->sections->len + 1);
+    section = &g_array_index (remux->sections, MpegTSRemuxSection,
+        remux->sections->len - 1);
+    section->pid = pid;
+    section->table_id = in->table_id;
+    section->extension = in->subtable_extension;
+    section->section_number = in->section_number;
+    section->packets = g_byte_array_new ();
+  } else {
+    g_byte_array_set_size (section->packets, 0);
+  }
+
+  section->out_pid = remux->pid_map[pid];
+  mpegts_remux_packetize (section->packets, section->out_pid, data, size);
+
+  GST_DEBUG_OBJECT (remux, "Rewrote table 0x%02x on PID 0x%04x -> 0x%04x, "
+      "%u packets", in->table_id, pid, section->out_pid,
+      section->packets->len / TS_PACKET_SIZE);
+
+  return section;
+}
+
+static void
+mpegts_remux_write_section (MpegTSRemux * remux, MpegTSRemuxSection * section)
+{
+  guint i;
+
+  for (i = 0; i < section->packets->len; i += TS_PACKET_SIZE) {
+    guint8 *data = mpegts_remux_next_packet (remux);
+
+    memcpy (data, section->packets->data + i, TS_PACKET_SIZE);
+    data[3] |= remux->cc[section->out_pid];
+    remux->cc[section->out_pid] = (remux->cc[section->out_pid] + 1) & 0xf;
+  }
+}
+
+/* Remap the ECM or EMM PID of the descriptor at @data if it is a CA
+ * descriptor */
+static void
+mpegts_remux_remap_ca_descriptor (MpegTSRemux * remux, guint8 * data)
+{
+  guint16 ca_pid;
+
+  if (data[0] != GST_MTS_DESC_CA || data[1] < 4)
+    return;
+
+  ca_pid = GST_READ_UINT16_BE (data + 4) & 0x1fff;
+  GST_WRITE_UINT16_BE (data + 4, (data[4] & 0xe0) << 8 |
+      remux->pid_map[ca_pid]);
+}
+
+static void
+mpegts_remux_copy_descriptors (MpegTSRemux * remux, GPtrArray * to,
+    GPtrArray * from)
+{
+  guint i;
+
+  for (i = 0; i < from->len; i++) {
+    GstMpegtsDescriptor *desc = g_boxed_copy (GST_TYPE_MPEGTS_DESCRIPTOR,
+        g_ptr_array_index (from, i));
+
+    mpegts_remux_remap_ca_descriptor (remux, desc->data);
+    g_ptr_array_add (to, desc);
+  }
+}
+
+static gboolean
+pmt_is_stale (gpointer key, gpointer value, gpointer user_data)
+{
+  GPtrArray *programs = user_data;
+  GstMpegtsSection *pmt = value;
+  guint i;
+
+  for (i = 0; i < programs->len; i++) {
+    GstMpegtsPatProgram *program = g_ptr_array_index (programs, i);
+
+    if (program->program_number == GPOINTER_TO_UINT (key))
+      return program->network_or_program_map_PID != pmt->pid;
+  }
+
+  return TRUE;
+}
+
+static GstMpegtsSection *
+mpegts_remux_rewrite_pat (MpegTSRemux * remux, GstMpegtsSection * section)
+{
+  GPtrArray *programs, *out_programs;
+  guint i;
+
+  programs = gst_mpegts_section_get_pat (section);
+  if (programs == NULL)
+    return NULL;
+
+  if (remux->pat)
+    gst_mpegts_section_unref (remux->pat);
+  remux->pat = gst_mpegts_section_ref (section);
+  g_hash_table_foreach_remove (remux->pmts, pmt_is_stale, programs);
+
+  out_programs = gst_mpegts_pat_new ();
+  for (i = 0; i < programs->len; i++) {
+    GstMpegtsPatProgram *in = g_ptr_array_index (programs, i), *out;
+
+    /* The NIT is carried over along with the kept programs */
+    if (in->program_number != 0
+        && !mpegts_remux_program_selected (remux, in->program_number))
+      continue;
+
+    out = gst_mpegts_pat_program_new ();
+    out->program_number = in->program_number;
+    out->network_or_program_map_PID =
+        remux->pid_map[in->network_or_program_map_PID];
+    g_ptr_array_add (out_programs, out);
+  }
+  g_ptr_array_unref (programs);
+
+  mpegts_remux_update_pids (remux);
+
+  return gst_mpegts_section_from_pat (out_programs,
+      section->subtable_extension);
+}
+
+static GstMpegtsSection *
+mpegts_remux_rewrite_pmt (MpegTSRemux * remux, GstMpegtsSection * section)
+{
+  const GstMpegtsPMT *pmt;
+  GstMpegtsPMT *out;
+  guint i;
+
+  pmt = gst_mpegts_section_get_pmt (section);
+  if (pmt == NULL)
+    return NULL;
+
+  g_hash_table_replace (remux->pmts, GUINT_TO_POINTER (pmt->program_number),
+      gst_mpegts_section_ref (section));
+
+  out = gst_mpegts_pmt_new ();
+  out->program_number = pmt->program_number;
+  out->pcr_pid = remux->pid_map[pmt->pcr_pid];
+  mpegts_remux_copy_descriptors (remux, out->descriptors, pmt->descriptors);
+
+  for (i = 0; i < pmt->streams->len; i++) {
+    GstMpegtsPMTStream *in = g_ptr_array_index (pmt->streams, i);
+    GstMpegtsPMTStream *stream = gst_mpegts_pmt_stream_new ();
+
+    stream->stream_type = in->stream_type;
+    stream->pid = remux->pid_map[in->pid];
+    mpegts_remux_copy_descriptors (remux, stream->descriptors, in->descriptors);
+    g_ptr_array_add (out->streams, stream);
+  }
+
+  mpegts_remux_update_pids (remux);
+
+  return gst_mpegts_section_from_pmt (out, remux->pid_map[section->pid]);
+}
+
+static GstMpegtsSection *
+mpegts_remux_rewrite_sdt (MpegTSRemux * remux, GstMpegtsSection * section)
+{
+  const GstMpegtsSDT *sdt;
+  GstMpegtsSDT *out;
+  guint i;
+
+  /* Only the SDT of the actual transport stream describes the output, BAT
+   * and SDT other are dropped */
+  if (section->table_id != GST_MTS_TABLE_ID_SERVICE_DESCRIPTION_ACTUAL_TS)
+    return NULL;
+
+  sdt = gst_mpegts_section_get_sdt (section);
+  if (sdt == NULL)
+    return NULL;
+
+  out = gst_mpegts_sdt_new ();
+  out->original_network_id = sdt->original_network_id;
+  out->actual_ts = TRUE;
+  out->transport_stream_id = sdt->transport_stream_id;
+
+  for (i = 0; i < sdt->services->len; i++) {
+    GstMpegtsSDTService *in = g_ptr_array_index (sdt->services, i);
+    GstMpegtsSDTService *service;
+
+    if (!mpegts_remux_program_selected (remux, in->service_id))
+      continue;
+
+    service = gst_mpegts_sdt_service_new ();
+    service->service_id = in->service_id;
+    service->EIT_schedule_flag = in->EIT_schedule_flag;
+    service->EIT_present_following_flag = in->EIT_present_following_flag;
+    service->running_status = in->running_status;
+    service->free_CA_mode = in->free_CA_mode;
+    mpegts_remux_copy_descriptors (remux, service->descriptors,
+        in->descriptors);
+    g_ptr_array_add (out->services, service);
+  }
+
+  return gst_mpegts_section_from_sdt (out);
+}
+
+/* The CAT is only made of descriptors and there is no API to build one,
+ * the ECM PIDs are remapped in a copy of the input section */
+static MpegTSRemuxSection *
+mpegts_remux_rewrite_cat (MpegTSRemux * remux, guint16 pid,
+    GstMpegtsSection * section)
+{
+  MpegTSRemuxSection *cached;
+  GPtrArray *descriptors;
+  guint8 *data, *desc, *end;
+
+  descriptors = gst_mpegts_section_get_cat (section);
+  if (descriptors == NULL)
+    return NULL;
+  g_ptr_array_unref (descriptors);
+
+  if (remux->cat)
+    gst_mpegts_section_unref (remux->cat);
+  remux->cat = gst_mpegts_section_ref (section);
+  mpegts_remux_update_pids (remux);
+
+  data = g_memdup (section->data, section->section_length);
+  end = data + section->section_length - 4;
+  for (desc = data + 8; desc + 2 <= end && desc + 2 + desc[1] <= end;
+      desc += 2 + desc[1])
+    mpegts_remux_remap_ca_descriptor (remux, desc);
+  GST_WRITE_UINT32_BE (end, _calc_crc32 (data, end - data));
+
+  cached = mpegts_remux_cache_section (remux, pid, section, data,
+      section->section_length);
+  g_free (data);
+
+  return cached;
+}
+
+/* Rewrite a new or updated input section and cache its packets */
+static MpegTSRemuxSection *
+mpegts_remux_handle_section (MpegTSRemux * remux, guint16 pid,
+    GstMpegtsSection * section)
+{
+  MpegTSRemuxSection *cached;
+  GstMpegtsSection *out;
+  guint8 *data;
+  gsize size;
+
+  switch (section->section_type) {
+    case GST_MPEGTS_SECTION_PAT:
+      out = mpegts_remux_rewrite_pat (remux, section);
+      break;
+    case GST_MPEGTS_SECTION_CAT:
+      return mpegts_remux_rewrite_cat (remux, pid, section);
+    case GST_MPEGTS_SECTION_PMT:
+      out = mpegts_remux_rewrite_pmt (remux, section);
+      break;
+    case GST_MPEGTS_SECTION_SDT:
+      out = mpegts_remux_rewrite_sdt (remux, section);
+      break;
+    default:
+      out = NULL;
+      break;
+  }
+
+  if (out == NULL)
+    return NULL;
+
+  out->version_number = section->version_number;
+  out->current_next_indicator = section->current_next_indicator;
+  out->section_number = section->section_number;
+  out->last_section_number = section->last_section_number;
+
+  data = gst_mpegts_section_packetize (out, &size);
+  if (data == NULL) {
+    GST_WARNING_OBJECT (remux, "Failed to packetize table 0x%02x on PID "
+        "0x%04x", section->table_id, pid);
+    gst_mpegts_section_unref (out);
+    return NULL;
+  }
+
+  cached = mpegts_remux_cache_section (remux, pid, section, data, size);
+  gst_mpegts_section_unref (out);
+
+  return cached;
+}
+
+static GstFlowReturn
+mpegts_remux_push (MpegTSBase * base, MpegTSPacketizerPacket * packet,
+    GstMpegtsSection * section)
+{
+  MpegTSRemux *remux = (MpegTSRemux *) base;
+  MpegTSRemuxSection *cached = NULL;
+
+  if (remux->pid_flags[packet->pid] & MPEGTS_REMUX_PID_REWRITE) {
+    /* Rewritten sections are written where the input section starts, or
+     * as soon as they are complete for a new version */
+    if (section)
+      cached = mpegts_remux_handle_section (remux, packet->pid, section);
+    else if (packet->payload_unit_start_indicator)
+      cached = mpegts_remux_find_packet_section (remux, packet);
+
+    if (cached)
+      mpegts_remux_write_section (remux, cached);
+  } else if (remux->pid_flags[packet->pid] & MPEGTS_REMUX_PID_PASS) {
+    mpegts_remux_write_packet (remux, packet);
+  }
+
+  mpegts_remux_fill (remux);
+
+  return GST_FLOW_OK;
+}
+
+static void
+mpegts_remux_inspect_packet (MpegTSBase * base,
+    MpegTSPacketizerPacket * packet)
+{
+  MpegTSRemux *remux = (MpegTSRemux *) base;
+
+  remux->in_packets++;
+
+  /* Scrambled packets never reach push(), they are passed through from
+   * here unless the base class descrambles them */
+  if (FLAGS_SCRAMBLED (packet->scram_afc_cc) && !base->descramble) {
+    if (remux->pid_flags[packet->pid] & MPEGTS_REMUX_PID_PASS)
+      mpegts_remux_write_packet (remux, packet);
+    mpegts_remux_fill (remux);
+  }
+}
+
+static GstFlowReturn
+mpegts_remux_input_done (MpegTSBase * base, GstBuffer * buffer)
+{
+  MpegTSRemux *remux = (MpegTSRemux *) base;
+  GstBuffer *buf;
+  guint len = remux->out->len;
+
+  if (len == 0)
+    return GST_FLOW_OK;
+
+  if (G_UNLIKELY (!prepare_src_pad (base, remux)))
+    return GST_FLOW_OK;
+
+  buf = gst_buffer_new_wrapped (g_byte_array_free (remux->out, FALSE), len);
+  remux->out = g_byte_array_sized_new (len);
+
+  return gst_pad_push (remux->srcpad, buf);
+}
+
+gboolean
+gst_mpegtsremux_plugin_init (GstPlugin * plugin)
+{
+  GST_DEBUG_CATEGORY_INIT (mpegts_remux_debug, "tsremux", 0,
+      "MPEG transport stream remuxer");
+
+  return gst_element_register (plugin, "tsremux",
+      GST_RANK_NONE, GST_TYPE_MPEGTS_REMUX);
+}
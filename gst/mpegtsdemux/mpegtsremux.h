@@ -0,0 +1,97 @@
+/*
+ * mpegtsremux.h - GStreamer MPEG transport stream remultiplexer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef GST_MPEG_TS_REMUX_H
+#define GST_MPEG_TS_REMUX_H
+
+#include <gst/gst.h>
+#include "mpegtsbase.h"
+#include "mpegtspacketizer.h"
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_MPEGTS_REMUX \
+  (mpegts_remux_get_type())
+#define GST_MPEGTS_REMUX(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_MPEGTS_REMUX,MpegTSRemux))
+#define GST_MPEGTS_REMUX_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_MPEGTS_REMUX,MpegTSRemuxClass))
+#define GST_IS_MPEGTS_REMUX(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_MPEGTS_REMUX))
+#define GST_IS_MPEGTS_REMUX_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_MPEGTS_REMUX))
+
+typedef struct _MpegTSRemux MpegTSRemux;
+typedef struct _MpegTSRemuxClass MpegTSRemuxClass;
+
+struct _MpegTSRemux {
+  MpegTSBase parent;
+
+  GstPad *srcpad;
+
+  /* properties */
+  gchar *programs_str;
+  gchar *pid_map_str;
+  gboolean keep_timing;
+
+  /* program numbers to keep, all if empty */
+  GArray *programs;
+  /* output PID of each input PID */
+  guint16 *pid_map;
+
+  /* MpegTSRemuxPIDFlags of each input PID */
+  guint8 *pid_flags;
+  /* continuity counters of the rewritten tables, per output PID */
+  guint8 *cc;
+
+  /* latest PAT and CAT, and PMTs of the kept programs by program number */
+  GstMpegtsSection *pat;
+  GstMpegtsSection *cat;
+  GHashTable *pmts;
+
+  /* MpegTSRemuxSection, rewritten tables ready to be repeated */
+  GArray *sections;
+  /* MpegTSRemuxPCR, input PCR rate per PID */
+  GArray *pcrs;
+
+  /* packets written since the last input buffer */
+  GByteArray *out;
+
+  /* input and output packet counts, their difference shifts the PCRs when
+   * keeping the timing */
+  guint64 in_packets;
+  guint64 out_packets;
+
+  gboolean first;
+  gboolean have_group_id;
+  guint group_id;
+};
+
+struct _MpegTSRemuxClass {
+  MpegTSBaseClass parent_class;
+};
+
+G_GNUC_INTERNAL GType mpegts_remux_get_type(void);
+
+G_GNUC_INTERNAL gboolean gst_mpegtsremux_plugin_init (GstPlugin * plugin);
+
+G_END_DECLS
+
+#endif /* GST_MPEG_TS_REMUX_H */
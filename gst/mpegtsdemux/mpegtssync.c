@@ -0,0 +1,201 @@
+/*
+ * mpegtssync.c - MPEG-TS sync byte scanner
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "mpegtssync.h"
+
+/* The vectorized scanners compare a block of SYNC_BLOCK_SIZE bytes against
+ * the sync byte at once, and turn the result into a mask with
+ * SYNC_MASK_BITS bits per byte. The masks of the blocks located one packet
+ * further are then ANDed together, leaving only the positions which are
+ * followed by enough sync bytes.
+ *
+ * Only the instruction sets the compiler targets are used, there is no
+ * runtime CPU detection. */
+#if defined(__GNUC__) && defined(__AVX2__)
+#include <immintrin.h>
+#define SYNC_IMPLEMENTATION "avx2"
+#define SYNC_BLOCK_SIZE 32
+#define SYNC_MASK_BITS 1
+
+static inline guint64
+sync_mask (const guint8 * data)
+{
+  __m256i v = _mm256_loadu_si256 ((const __m256i *) data);
+
+  return (guint32) _mm256_movemask_epi8 (_mm256_cmpeq_epi8 (v,
+          _mm256_set1_epi8 (MPEGTS_SYNC_BYTE)));
+}
+#elif defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+#define SYNC_IMPLEMENTATION "sse2"
+#define SYNC_BLOCK_SIZE 16
+#define SYNC_MASK_BITS 1
+
+static inline guint64
+sync_mask (const guint8 * data)
+{
+  __m128i v = _mm_loadu_si128 ((const __m128i *) data);
+
+  return (guint16) _mm_movemask_epi8 (_mm_cmpeq_epi8 (v,
+          _mm_set1_epi8 (MPEGTS_SYNC_BYTE)));
+}
+#elif defined(__GNUC__) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define SYNC_IMPLEMENTATION "neon"
+#define SYNC_BLOCK_SIZE 16
+#define SYNC_MASK_BITS 4
+
+static inline guint64
+sync_mask (const guint8 * data)
+{
+  uint8x16_t eq = vceqq_u8 (vld1q_u8 (data), vdupq_n_u8 (MPEGTS_SYNC_BYTE));
+
+  /* NEON has no movemask, narrow each byte to a nibble instead */
+  return vget_lane_u64 (vreinterpret_u64_u8 (vshrn_n_u16 (vreinterpretq_u16_u8
+              (eq), 4)), 0);
+}
+#else
+#define SYNC_IMPLEMENTATION "scalar"
+#endif
+
+static inline gboolean
+sync_check (const guint8 * data, gsize offset, guint packet_size,
+    guint n_syncs)
+{
+  guint i;
+
+  for (i = 0; i < n_syncs; i++) {
+    if (data[offset + i * packet_size] != MPEGTS_SYNC_BYTE)
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/* Returns the first packet size (in order) for which @offset starts
+ * @n_syncs consecutive packets, or 0 */
+static inline guint
+sync_check_sizes (const guint8 * data, gsize offset,
+    const guint * packet_sizes, guint n_packet_sizes, guint n_syncs)
+{
+  guint i;
+
+  for (i = 0; i < n_packet_sizes; i++) {
+    if (sync_check (data, offset, packet_sizes[i], n_syncs))
+      return packet_sizes[i];
+  }
+
+  return 0;
+}
+
+/* mpegts_sync_scan_scalar:
+ *
+ * Reference byte-by-byte implementation of mpegts_sync_scan().
+ */
+gsize
+mpegts_sync_scan_scalar (const guint8 * data, gsize start, gsize end,
+    const guint * packet_sizes, guint n_packet_sizes, guint n_syncs,
+    guint * packet_size)
+{
+  gsize i;
+  guint size;
+
+  for (i = start; i < end; i++) {
+    if (data[i] != MPEGTS_SYNC_BYTE)
+      continue;
+
+    size = sync_check_sizes (data, i, packet_sizes, n_packet_sizes, n_syncs);
+    if (size) {
+      if (packet_size)
+        *packet_size = size;
+      return i;
+    }
+  }
+
+  return end;
+}
+
+/* mpegts_sync_scan:
+ * @data: the data to scan
+ * @start: the first offset to check
+ * @end: the offset to stop at
+ * @packet_sizes: the packet sizes to check, by order of preference
+ * @n_packet_sizes: the number of entries in @packet_sizes
+ * @n_syncs: the number of consecutive sync bytes to look for
+ * @packet_size: (allow NULL): the matching packet size
+ *
+ * Looks for the first offset (the phase) in [@start, @end[ at which
+ * @n_syncs sync bytes are located one packet apart, for any of the given
+ * packet sizes. If several packet sizes match at that offset, the first
+ * one in @packet_sizes is returned.
+ *
+ * The caller must make sure that @data contains at least
+ * @end + (@n_syncs - 1) * MAX (@packet_sizes) bytes.
+ *
+ * Returns: the offset of the first sync byte found, or @end if none.
+ */
+gsize
+mpegts_sync_scan (const guint8 * data, gsize start, gsize end,
+    const guint * packet_sizes, guint n_packet_sizes, guint n_syncs,
+    guint * packet_size)
+{
+  gsize i = start;
+
+#ifdef SYNC_BLOCK_SIZE
+  for (; i + SYNC_BLOCK_SIZE <= end; i += SYNC_BLOCK_SIZE) {
+    guint64 first, found = 0;
+    guint j, k;
+
+    /* Garbage and payload bytes are mostly not sync bytes */
+    first = sync_mask (data + i);
+    if (G_LIKELY (first == 0))
+      continue;
+
+    for (j = 0; j < n_packet_sizes; j++) {
+      guint64 mask = first;
+
+      for (k = 1; k < n_syncs && mask; k++)
+        mask &= sync_mask (data + i + k * packet_sizes[j]);
+      found |= mask;
+    }
+
+    if (found) {
+      i += __builtin_ctzll (found) / SYNC_MASK_BITS;
+      if (packet_size)
+        *packet_size = sync_check_sizes (data, i, packet_sizes,
+            n_packet_sizes, n_syncs);
+      return i;
+    }
+  }
+#endif
+
+  /* Leftover which doesn't fill a block */
+  return mpegts_sync_scan_scalar (data, i, end, packet_sizes, n_packet_sizes,
+      n_syncs, packet_size);
+}
+
+const gchar *
+mpegts_sync_get_implementation (void)
+{
+  return SYNC_IMPLEMENTATION;
+}
@@ -0,0 +1,44 @@
+/*
+ * mpegtssync.h - MPEG-TS sync byte scanner
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef GST_MPEGTS_SYNC_H
+#define GST_MPEGTS_SYNC_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+#define MPEGTS_SYNC_BYTE 0x47
+
+G_GNUC_INTERNAL
+gsize mpegts_sync_scan (const guint8 * data, gsize start, gsize end,
+                        const guint * packet_sizes, guint n_packet_sizes,
+                        guint n_syncs, guint * packet_size);
+
+G_GNUC_INTERNAL
+gsize mpegts_sync_scan_scalar (const guint8 * data, gsize start, gsize end,
+                               const guint * packet_sizes, guint n_packet_sizes,
+                               guint n_syncs, guint * packet_size);
+
+G_GNUC_INTERNAL
+const gchar *mpegts_sync_get_implementation (void);
+
+G_END_DECLS
+
+#endif /* GST_MPEGTS_SYNC_H */
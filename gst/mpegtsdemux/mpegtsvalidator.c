@@ -0,0 +1,835 @@
+/*
+ * mpegtsvalidator.c - GStreamer MPEG transport stream validator
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:element-tsvalidator
+ * @title: tsvalidator
+ *
+ * Passes an MPEG transport stream through unchanged while checking it
+ * against the first and second priority indicators of ETSI TR 101 290:
+ *
+ * * sync byte errors and sync losses
+ * * continuity counter errors
+ * * PAT and PMT errors (wrong table, scrambled, or more than 0.5 s
+ *   between two sections)
+ * * PCR repetition (more than 40 ms), discontinuity (more than 100 ms
+ *   without discontinuity indicator) and accuracy (more than 500 ns away
+ *   from the position given by the transport rate) errors
+ * * PTS errors (more than 700 ms between two PTS)
+ *
+ * Intervals are measured in transport time, derived from the byte
+ * position and the rate measured between the PCRs of the program, so that
+ * captures can be checked faster than real time. The PAT is measured
+ * against the first PCR PID.
+ *
+ * The counters are available in #MpegTSValidator:stats, and posted in a
+ * "tsvalidator-stats" element message every #MpegTSValidator:stats-interval.
+ * The structure holds the totals and a "pids" array with one structure
+ * per PID.
+ *
+ * ## Example launch line
+ * |[
+ * gst-launch-1.0 -m udpsrc uri=udp://239.1.1.1:1234 ! tsvalidator ! fakesink
+ * ]|
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+
+#include "mpegtsbase.h"
+#include "mpegtsvalidator.h"
+
+#define NULL_PID 0x1fff
+
+/* Input kept while waiting for the packet size, beyond that it isn't a
+ * transport stream */
+#define MAX_PENDING_SIZE (64 * MPEGTS_MAX_PACKETSIZE)
+
+/* PCR wrap-around, 2^33 * 300 */
+#define PCR_MAX (G_GUINT64_CONSTANT (0x200000000) * 300)
+
+/* TR 101 290 limits, in 27 MHz ticks */
+#define TICKS_PER_MS 27000
+#define PSI_MAX_INTERVAL (500 * TICKS_PER_MS)
+#define PCR_MAX_INTERVAL (40 * TICKS_PER_MS)
+#define PCR_MAX_DISCONTINUITY (100 * TICKS_PER_MS)
+#define PCR_MAX_INACCURACY 13.5 /* 500 ns */
+#define PTS_MAX_INTERVAL (700 * TICKS_PER_MS)
+
+#define NO_TIME -1.0
+
+GST_DEBUG_CATEGORY_STATIC (mpegts_validator_debug);
+#define GST_CAT_DEFAULT mpegts_validator_debug
+
+typedef enum
+{
+  MPEGTS_VALIDATOR_PID_OTHER,
+  MPEGTS_VALIDATOR_PID_PAT,
+  MPEGTS_VALIDATOR_PID_PMT
+} MpegTSValidatorPIDType;
+
+struct _MpegTSValidatorPID
+{
+  guint16 pid;
+  MpegTSValidatorPIDType type;
+
+  guint64 packets;
+  gboolean scrambled;
+
+  /* PCR PID of the program, whose time line intervals are measured on */
+  guint16 pcr_pid;
+
+  /* continuity counter of the latest packet, -1 if none yet */
+  gint last_cc;
+  gboolean duplicate;
+  guint cc_errors;
+
+  /* PAT or PMT errors */
+  gdouble last_section;
+  guint psi_errors;
+
+  /* Transport time line of a PCR PID, in 27 MHz ticks: the time at the
+   * latest PCR and the rate measured before it */
+  guint64 last_pcr;
+  guint64 last_pcr_offset;
+  gdouble clock;
+  gdouble ticks_per_byte;
+  guint pcr_repetition_errors;
+  guint pcr_discontinuity_errors;
+  guint pcr_accuracy_errors;
+
+  gdouble last_pts;
+  guint pts_errors;
+};
+
+static GstStaticPadTemplate src_template =
+GST_STATIC_PAD_TEMPLATE ("src", GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("video/mpegts, " "systemstream = (boolean) true, "
+        "packetsize = (int) { 188, 192, 204, 208 }")
+    );
+
+#define DEFAULT_STATS_INTERVAL 1000
+
+enum
+{
+  PROP_0,
+  PROP_STATS_INTERVAL,
+  PROP_STATS,
+  /* FILL ME */
+};
+
+static void mpegts_validator_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void mpegts_validator_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+
+static void mpegts_validator_inspect_packet (MpegTSBase * base,
+    MpegTSPacketizerPacket * packet);
+static gboolean mpegts_validator_push_event (MpegTSBase * base,
+    GstEvent * event);
+static void mpegts_validator_reset (MpegTSBase * base);
+static void mpegts_validator_flush (MpegTSBase * base, gboolean hard);
+static void mpegts_validator_program_started (MpegTSBase * base,
+    MpegTSBaseProgram * program);
+static void mpegts_validator_program_stopped (MpegTSBase * base,
+    MpegTSBaseProgram * program);
+static GstFlowReturn mpegts_validator_input_done (MpegTSBase * base,
+    GstBuffer * buffer);
+
+#define mpegts_validator_parent_class parent_class
+G_DEFINE_TYPE (MpegTSValidator, mpegts_validator, GST_TYPE_MPEGTS_BASE);
+
+static void
+mpegts_validator_free_pids (MpegTSValidator * validator)
+{
+  guint i;
+
+  for (i = 0; i < validator->seen_pids->len; i++) {
+    guint16 pid = g_array_index (validator->seen_pids, guint16, i);
+
+    g_free (validator->pids[pid]);
+    validator->pids[pid] = NULL;
+  }
+  g_array_set_size (validator->seen_pids, 0);
+}
+
+static void
+mpegts_validator_finalize (GObject * object)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) object;
+
+  mpegts_validator_free_pids (validator);
+  g_free (validator->pids);
+  g_array_free (validator->seen_pids, TRUE);
+  if (validator->pending)
+    gst_buffer_list_unref (validator->pending);
+
+  GST_CALL_PARENT (G_OBJECT_CLASS, finalize, (object));
+}
+
+static void
+mpegts_validator_class_init (MpegTSValidatorClass * klass)
+{
+  GObjectClass *gobject_class = (GObjectClass *) (klass);
+  GstElementClass *element_class;
+  MpegTSBaseClass *ts_class;
+
+  gobject_class->set_property = mpegts_validator_set_property;
+  gobject_class->get_property = mpegts_validator_get_property;
+  gobject_class->finalize = mpegts_validator_finalize;
+
+  g_object_class_install_property (gobject_class, PROP_STATS_INTERVAL,
+      g_param_spec_uint ("stats-interval", "Statistics interval",
+          "Milliseconds of transport time between two statistics messages "
+          "(0 = no messages)", 0, G_MAXUINT, DEFAULT_STATS_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "TR 101 290 error counters, in total and per PID",
+          GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  element_class = GST_ELEMENT_CLASS (klass);
+
+  gst_element_class_add_static_pad_template (element_class, &src_template);
+
+  gst_element_class_set_static_metadata (element_class,
+      "MPEG transport stream validator", "Codec/Parser",
+      "Measures the TR 101 290 priority 1 and 2 indicators of MPEG2 "
+      "transport streams",
+      "GStreamer maintainers <gstreamer-devel@lists.freedesktop.org>");
+
+  ts_class = GST_MPEGTS_BASE_CLASS (klass);
+  ts_class->push_event = GST_DEBUG_FUNCPTR (mpegts_validator_push_event);
+  ts_class->reset = GST_DEBUG_FUNCPTR (mpegts_validator_reset);
+  ts_class->flush = GST_DEBUG_FUNCPTR (mpegts_validator_flush);
+  ts_class->input_done = GST_DEBUG_FUNCPTR (mpegts_validator_input_done);
+  ts_class->inspect_packet =
+      GST_DEBUG_FUNCPTR (mpegts_validator_inspect_packet);
+  ts_class->program_started =
+      GST_DEBUG_FUNCPTR (mpegts_validator_program_started);
+  ts_class->program_stopped =
+      GST_DEBUG_FUNCPTR (mpegts_validator_program_stopped);
+}
+
+static void
+mpegts_validator_init (MpegTSValidator * validator)
+{
+  MpegTSBase *base = (MpegTSBase *) validator;
+
+  /* Everything is looked at from inspect_packet() */
+  base->push_data = FALSE;
+  base->push_section = FALSE;
+  base->push_unknown = FALSE;
+
+  validator->stats_interval = DEFAULT_STATS_INTERVAL;
+  validator->pids = g_new0 (MpegTSValidatorPID *, MPEGTS_BASE_N_PIDS);
+  validator->seen_pids = g_array_new (FALSE, FALSE, sizeof (guint16));
+
+  validator->srcpad = gst_pad_new_from_static_template (&src_template, "src");
+  gst_element_add_pad (GST_ELEMENT (validator), validator->srcpad);
+
+  mpegts_validator_reset (base);
+}
+
+static MpegTSValidatorPID *
+mpegts_validator_get_pid (MpegTSValidator * validator, guint16 pid)
+{
+  MpegTSValidatorPID *vpid = validator->pids[pid];
+
+  if (G_LIKELY (vpid))
+    return vpid;
+
+  vpid = g_new0 (MpegTSValidatorPID, 1);
+  vpid->pid = pid;
+  vpid->type = pid == 0 ? MPEGTS_VALIDATOR_PID_PAT :
+      MPEGTS_VALIDATOR_PID_OTHER;
+  vpid->pcr_pid = NULL_PID;
+  vpid->last_cc = -1;
+  vpid->last_section = NO_TIME;
+  vpid->last_pcr = G_MAXUINT64;
+  vpid->last_pts = NO_TIME;
+
+  /* The stats can be read from the application thread */
+  GST_OBJECT_LOCK (validator);
+  validator->pids[pid] = vpid;
+  g_array_append_val (validator->seen_pids, pid);
+  GST_OBJECT_UNLOCK (validator);
+
+  return vpid;
+}
+
+static void
+mpegts_validator_reset (MpegTSBase * base)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) base;
+
+  /* Called from the base class init, before ours */
+  if (G_UNLIKELY (validator->pids == NULL))
+    return;
+
+  GST_OBJECT_LOCK (validator);
+  mpegts_validator_free_pids (validator);
+  validator->packets = 0;
+  validator->sync_byte_errors = 0;
+  validator->sync_losses = 0;
+  GST_OBJECT_UNLOCK (validator);
+
+  validator->next_offset = G_MAXUINT64;
+  validator->clock_pid = NULL_PID;
+  validator->next_stats = NO_TIME;
+
+  if (validator->pending) {
+    gst_buffer_list_unref (validator->pending);
+    validator->pending = NULL;
+  }
+
+  validator->first = TRUE;
+  validator->have_group_id = FALSE;
+  validator->group_id = G_MAXUINT;
+}
+
+static void
+mpegts_validator_flush (MpegTSBase * base, gboolean hard)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) base;
+  guint i;
+
+  /* Don't report the discontinuity as errors, and measure the rates
+   * again from the new position */
+  validator->next_offset = G_MAXUINT64;
+  validator->next_stats = NO_TIME;
+  for (i = 0; i < validator->seen_pids->len; i++) {
+    MpegTSValidatorPID *vpid =
+        validator->pids[g_array_index (validator->seen_pids, guint16, i)];
+
+    vpid->last_cc = -1;
+    vpid->last_section = NO_TIME;
+    vpid->last_pcr = G_MAXUINT64;
+    vpid->ticks_per_byte = 0;
+    vpid->last_pts = NO_TIME;
+  }
+}
+
+static void
+mpegts_validator_program_started (MpegTSBase * base,
+    MpegTSBaseProgram * program)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) base;
+  MpegTSValidatorPID *vpid;
+  GList *tmp;
+
+  vpid = mpegts_validator_get_pid (validator, program->pmt_pid);
+  vpid->type = MPEGTS_VALIDATOR_PID_PMT;
+  vpid->pcr_pid = program->pcr_pid;
+
+  /* The PCR PID is part of the streams */
+  for (tmp = program->stream_list; tmp; tmp = tmp->next) {
+    MpegTSBaseStream *stream = (MpegTSBaseStream *) tmp->data;
+
+    mpegts_validator_get_pid (validator, stream->pid)->pcr_pid =
+        program->pcr_pid;
+  }
+}
+
+static void
+mpegts_validator_program_stopped (MpegTSBase * base,
+    MpegTSBaseProgram * program)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) base;
+  MpegTSValidatorPID *vpid = validator->pids[program->pmt_pid];
+
+  if (vpid && vpid->type == MPEGTS_VALIDATOR_PID_PMT) {
+    vpid->type = MPEGTS_VALIDATOR_PID_OTHER;
+    vpid->last_section = NO_TIME;
+  }
+}
+
+/* Bitrate measured on the time line of @pcr_vpid, 0 if unknown */
+static guint64
+mpegts_validator_bitrate (MpegTSValidatorPID * pcr_vpid)
+{
+  if (pcr_vpid == NULL || pcr_vpid->ticks_per_byte == 0)
+    return 0;
+
+  return (guint64) (8 * 27000000 / pcr_vpid->ticks_per_byte);
+}
+
+static void
+mpegts_validator_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) object;
+
+  switch (prop_id) {
+    case PROP_STATS_INTERVAL:
+      validator->stats_interval = g_value_get_uint (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+  }
+}
+
+/* Called with the object lock. The counters are updated without it by the
+ * streaming thread, values may be a packet late */
+static GstStructure *
+mpegts_validator_build_stats (MpegTSValidator * validator)
+{
+  GstStructure *s;
+  GValue pids = G_VALUE_INIT, value = G_VALUE_INIT;
+  guint cc_errors = 0, pat_errors = 0, pmt_errors = 0, pts_errors = 0;
+  guint pcr_repetition_errors = 0, pcr_discontinuity_errors = 0;
+  guint pcr_accuracy_errors = 0;
+  guint i;
+
+  g_value_init (&pids, GST_TYPE_ARRAY);
+  g_value_init (&value, GST_TYPE_STRUCTURE);
+
+  for (i = 0; i < validator->seen_pids->len; i++) {
+    MpegTSValidatorPID *vpid =
+        validator->pids[g_array_index (validator->seen_pids, guint16, i)];
+
+    cc_errors += vpid->cc_errors;
+    if (vpid->pid == 0)
+      pat_errors += vpid->psi_errors;
+    else
+      pmt_errors += vpid->psi_errors;
+    pcr_repetition_errors += vpid->pcr_repetition_errors;
+    pcr_discontinuity_errors += vpid->pcr_discontinuity_errors;
+    pcr_accuracy_errors += vpid->pcr_accuracy_errors;
+    pts_errors += vpid->pts_errors;
+
+    /* Nothing to report about PIDs never referenced */
+    if (vpid->packets == 0)
+      continue;
+
+    gst_value_take_structure (&value, gst_structure_new ("pid",
+            "pid", G_TYPE_UINT, (guint) vpid->pid,
+            "packets", G_TYPE_UINT64, vpid->packets,
+            "bitrate", G_TYPE_UINT64, mpegts_validator_bitrate (vpid),
+            "scrambled", G_TYPE_BOOLEAN, vpid->scrambled,
+            "cc-errors", G_TYPE_UINT, vpid->cc_errors,
+            "psi-errors", G_TYPE_UINT, vpid->psi_errors,
+            "pcr-repetition-errors", G_TYPE_UINT,
+            vpid->pcr_repetition_errors,
+            "pcr-discontinuity-errors", G_TYPE_UINT,
+            vpid->pcr_discontinuity_errors,
+            "pcr-accuracy-errors", G_TYPE_UINT, vpid->pcr_accuracy_errors,
+            "pts-errors", G_TYPE_UINT, vpid->pts_errors, NULL));
+    gst_value_array_append_value (&pids, &value);
+  }
+
+  s = gst_structure_new ("tsvalidator-stats",
+      "packets", G_TYPE_UINT64, validator->packets,
+      "bitrate", G_TYPE_UINT64,
+      mpegts_validator_bitrate (validator->pids[validator->clock_pid]),
+      "sync-byte-errors", G_TYPE_UINT, validator->sync_byte_errors,
+      "sync-losses", G_TYPE_UINT, validator->sync_losses,
+      "cc-errors", G_TYPE_UINT, cc_errors,
+      "pat-errors", G_TYPE_UINT, pat_errors,
+      "pmt-errors", G_TYPE_UINT, pmt_errors,
+      "pcr-repetition-errors", G_TYPE_UINT, pcr_repetition_errors,
+      "pcr-discontinuity-errors", G_TYPE_UINT, pcr_discontinuity_errors,
+      "pcr-accuracy-errors", G_TYPE_UINT, pcr_accuracy_errors,
+      "pts-errors", G_TYPE_UINT, pts_errors, NULL);
+  gst_structure_take_value (s, "pids", &pids);
+  g_value_unset (&value);
+
+  return s;
+}
+
+static void
+mpegts_validator_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) object;
+
+  switch (prop_id) {
+    case PROP_STATS_INTERVAL:
+      g_value_set_uint (value, validator->stats_interval);
+      break;
+    case PROP_STATS:
+      GST_OBJECT_LOCK (validator);
+      g_value_take_boxed (value, mpegts_validator_build_stats (validator));
+      GST_OBJECT_UNLOCK (validator);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+  }
+}
+
+static gboolean
+prepare_src_pad (MpegTSBase * base, MpegTSValidator * validator)
+{
+  GstEvent *event;
+  GstCaps *caps;
+  gchar *stream_id;
+
+  if (!validator->first)
+    return TRUE;
+
+  /* If there's no packet_size yet, we can't set caps yet */
+  if (G_UNLIKELY (base->packetizer->packet_size == 0))
+    return FALSE;
+
+  event = gst_pad_get_sticky_event (base->sinkpad, GST_EVENT_STREAM_START, 0);
+  if (event) {
+    validator->have_group_id =
+        gst_event_parse_group_id (event, &validator->group_id);
+    gst_event_unref (event);
+  } else if (!validator->have_group_id) {
+    validator->have_group_id = TRUE;
+    validator->group_id = gst_util_group_id_next ();
+  }
+
+  stream_id =
+      gst_pad_create_stream_id (validator->srcpad, GST_ELEMENT_CAST (base),
+      "validator");
+  event = gst_event_new_stream_start (stream_id);
+  if (validator->have_group_id)
+    gst_event_set_group_id (event, validator->group_id);
+  gst_pad_push_event (validator->srcpad, event);
+  g_free (stream_id);
+
+  /* The input is forwarded as is */
+  caps = gst_caps_new_simple ("video/mpegts",
+      "systemstream", G_TYPE_BOOLEAN, TRUE,
+      "packetsize", G_TYPE_INT, base->packetizer->packet_size, NULL);
+  gst_pad_set_caps (validator->srcpad, caps);
+  gst_caps_unref (caps);
+
+  base->out_segment = base->segment;
+  gst_pad_push_event (validator->srcpad,
+      gst_event_new_segment (&base->out_segment));
+
+  validator->first = FALSE;
+
+  return TRUE;
+}
+
+static gboolean
+mpegts_validator_push_event (MpegTSBase * base, GstEvent * event)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) base;
+
+  if (G_UNLIKELY (validator->first)) {
+    /* We will send the segment when really starting  */
+    if (G_UNLIKELY (GST_EVENT_TYPE (event) == GST_EVENT_SEGMENT)) {
+      gst_event_unref (event);
+      return TRUE;
+    }
+    prepare_src_pad (base, validator);
+  }
+
+  if (GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_STOP && validator->pending) {
+    gst_buffer_list_unref (validator->pending);
+    validator->pending = NULL;
+  }
+
+  return gst_pad_push_event (validator->srcpad, event);
+}
+
+/* Transport time at @offset on the time line of @pcr_vpid, or NO_TIME
+ * before its rate is known */
+static gdouble
+mpegts_validator_time (MpegTSValidatorPID * pcr_vpid, guint64 offset)
+{
+  if (pcr_vpid == NULL || pcr_vpid->ticks_per_byte == 0)
+    return NO_TIME;
+
+  return pcr_vpid->clock +
+      ((gdouble) offset - pcr_vpid->last_pcr_offset) *
+      pcr_vpid->ticks_per_byte;
+}
+
+/* Count an error when the previous occurrence on the PID of @packet is more
+ * than @max ago, on the time line of the PCRs of its program */
+static gboolean
+mpegts_validator_check_interval (MpegTSValidator * validator,
+    MpegTSValidatorPID * vpid, MpegTSPacketizerPacket * packet,
+    gdouble * last, guint64 max)
+{
+  guint16 pcr_pid = vpid->pcr_pid;
+  gboolean late = FALSE;
+  gdouble now;
+
+  /* PIDs outside of programs, or of programs without PCR */
+  if (pcr_pid == NULL_PID)
+    pcr_pid = validator->clock_pid;
+
+  /* Nothing can be measured before the transport rate is known */
+  now = mpegts_validator_time (validator->pids[pcr_pid], packet->offset);
+  if (now == NO_TIME)
+    return FALSE;
+
+  if (*last != NO_TIME)
+    late = now - *last > max;
+  *last = now;
+
+  return late;
+}
+
+static void
+mpegts_validator_check_cc (MpegTSValidatorPID * vpid,
+    MpegTSPacketizerPacket * packet)
+{
+  gint cc = FLAGS_CONTINUITY_COUNTER (packet->scram_afc_cc);
+  gint last_cc = vpid->last_cc;
+
+  vpid->last_cc = cc;
+
+  if (last_cc == -1 || (packet->afc_flags & MPEGTS_AFC_DISCONTINUITY_FLAG)) {
+    vpid->duplicate = FALSE;
+    return;
+  }
+
+  /* Packets without payload don't increment the counter */
+  if (!FLAGS_HAS_PAYLOAD (packet->scram_afc_cc)) {
+    if (cc != last_cc)
+      vpid->cc_errors++;
+    return;
+  }
+
+  /* A packet may be sent twice, but not more */
+  if (cc == last_cc) {
+    if (vpid->duplicate)
+      vpid->cc_errors++;
+    vpid->duplicate = TRUE;
+    return;
+  }
+
+  vpid->duplicate = FALSE;
+  if (cc != ((last_cc + 1) & 0xf)) {
+    GST_LOG ("PID 0x%04x CC error, %d after %d", vpid->pid, cc, last_cc);
+    vpid->cc_errors++;
+  }
+}
+
+static void
+mpegts_validator_check_pcr (MpegTSValidator * validator,
+    MpegTSValidatorPID * vpid, MpegTSPacketizerPacket * packet)
+{
+  guint64 delta, bytes;
+
+  if (vpid->last_pcr == G_MAXUINT64 || packet->offset <= vpid->last_pcr_offset)
+    goto done;
+
+  delta = (packet->pcr + PCR_MAX - vpid->last_pcr) % PCR_MAX;
+  bytes = packet->offset - vpid->last_pcr_offset;
+
+  /* The time line goes on at the previous rate over discontinuities */
+  if (packet->afc_flags & MPEGTS_AFC_DISCONTINUITY_FLAG) {
+    vpid->clock += bytes * vpid->ticks_per_byte;
+    goto done;
+  }
+
+  if (delta > PCR_MAX_DISCONTINUITY) {
+    GST_LOG ("PID 0x%04x PCR jumped by %" G_GUINT64_FORMAT, vpid->pid, delta);
+    vpid->pcr_discontinuity_errors++;
+    vpid->clock += bytes * vpid->ticks_per_byte;
+    goto done;
+  }
+
+  if (delta > PCR_MAX_INTERVAL)
+    vpid->pcr_repetition_errors++;
+
+  /* Compare the PCR with the one expected at the previous rate */
+  if (vpid->ticks_per_byte > 0
+      && fabs (delta - bytes * vpid->ticks_per_byte) > PCR_MAX_INACCURACY)
+    vpid->pcr_accuracy_errors++;
+
+  vpid->clock += delta;
+  vpid->ticks_per_byte = (gdouble) delta / bytes;
+  if (validator->clock_pid == NULL_PID)
+    validator->clock_pid = vpid->pid;
+
+done:
+  vpid->last_pcr = packet->pcr;
+  vpid->last_pcr_offset = packet->offset;
+}
+
+static void
+mpegts_validator_check_section (MpegTSValidator * validator,
+    MpegTSValidatorPID * vpid, MpegTSPacketizerPacket * packet)
+{
+  const guint8 *data = packet->payload;
+  guint8 table_id;
+
+  if (data == NULL || !packet->payload_unit_start_indicator)
+    return;
+
+  /* pointer_field */
+  data += *data + 1;
+  if (data >= packet->data_end)
+    return;
+  table_id = *data;
+
+  if (vpid->type == MPEGTS_VALIDATOR_PID_PAT) {
+    if (table_id != GST_MTS_TABLE_ID_PROGRAM_ASSOCIATION) {
+      vpid->psi_errors++;
+      return;
+    }
+  } else if (table_id != GST_MTS_TABLE_ID_TS_PROGRAM_MAP) {
+    return;
+  }
+
+  if (mpegts_validator_check_interval (validator, vpid, packet,
+          &vpid->last_section, PSI_MAX_INTERVAL)) {
+    GST_LOG ("PID 0x%04x section repetition error", vpid->pid);
+    vpid->psi_errors++;
+  }
+}
+
+static void
+mpegts_validator_check_pts (MpegTSValidator * validator,
+    MpegTSValidatorPID * vpid, MpegTSPacketizerPacket * packet)
+{
+  const guint8 *data = packet->payload;
+
+  if (data == NULL || !packet->payload_unit_start_indicator
+      || packet->data_end - data < 9 || GST_READ_UINT24_BE (data) != 0x000001)
+    return;
+
+  /* Stream ids without the optional PES header */
+  switch (data[3]) {
+    case 0xbc:                 /* program_stream_map */
+    case 0xbe:                 /* padding_stream */
+    case 0xbf:                 /* private_stream_2 */
+    case 0xf0:                 /* ECM */
+    case 0xf1:                 /* EMM */
+    case 0xf2:                 /* DSMCC */
+    case 0xf8:                 /* ITU-T H.222.1 type E */
+    case 0xff:                 /* program_stream_directory */
+      return;
+    default:
+      break;
+  }
+
+  if (!(data[7] & 0x80))
+    return;
+
+  if (mpegts_validator_check_interval (validator, vpid, packet,
+          &vpid->last_pts, PTS_MAX_INTERVAL)) {
+    GST_LOG ("PID 0x%04x PTS repetition error", vpid->pid);
+    vpid->pts_errors++;
+  }
+}
+
+static void
+mpegts_validator_inspect_packet (MpegTSBase * base,
+    MpegTSPacketizerPacket * packet)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) base;
+  MpegTSValidatorPID *vpid;
+  guint packet_size = base->packetizer->packet_size;
+
+  validator->packets++;
+
+  /* The packetizer resynchronised, skipping bytes */
+  if (validator->next_offset != G_MAXUINT64
+      && packet->offset != validator->next_offset) {
+    validator->sync_byte_errors++;
+    if (packet->offset >= validator->next_offset + 2 * packet_size)
+      validator->sync_losses++;
+  }
+  validator->next_offset = packet->offset + packet_size;
+
+  if (packet->pid == NULL_PID)
+    return;
+
+  vpid = mpegts_validator_get_pid (validator, packet->pid);
+  vpid->packets++;
+
+  mpegts_validator_check_cc (vpid, packet);
+
+  if (packet->afc_flags & MPEGTS_AFC_PCR_FLAG)
+    mpegts_validator_check_pcr (validator, vpid, packet);
+
+  if (FLAGS_SCRAMBLED (packet->scram_afc_cc)) {
+    vpid->scrambled = TRUE;
+    /* PSI is never scrambled */
+    if (vpid->type != MPEGTS_VALIDATOR_PID_OTHER)
+      vpid->psi_errors++;
+    return;
+  }
+
+  if (vpid->type != MPEGTS_VALIDATOR_PID_OTHER)
+    mpegts_validator_check_section (validator, vpid, packet);
+  else if (MPEGTS_BASE_IS_PES (base, packet->pid))
+    mpegts_validator_check_pts (validator, vpid, packet);
+}
+
+static GstFlowReturn
+mpegts_validator_input_done (MpegTSBase * base, GstBuffer * buffer)
+{
+  MpegTSValidator *validator = (MpegTSValidator *) base;
+  GstBufferList *list;
+  gdouble now;
+
+  now = mpegts_validator_time (validator->pids[validator->clock_pid],
+      validator->next_offset);
+  if (validator->stats_interval && now != NO_TIME
+      && now >= validator->next_stats) {
+    GstStructure *s;
+
+    GST_OBJECT_LOCK (validator);
+    s = mpegts_validator_build_stats (validator);
+    GST_OBJECT_UNLOCK (validator);
+    gst_element_post_message (GST_ELEMENT_CAST (validator),
+        gst_message_new_element (GST_OBJECT (validator), s));
+
+    validator->next_stats =
+        now + (gdouble) validator->stats_interval * TICKS_PER_MS;
+  }
+
+  if (G_LIKELY (validator->pending == NULL && !validator->first))
+    return gst_pad_push (validator->srcpad, gst_buffer_ref (buffer));
+
+  if (validator->pending == NULL)
+    validator->pending = gst_buffer_list_new ();
+  gst_buffer_list_add (validator->pending, gst_buffer_ref (buffer));
+
+  if (G_UNLIKELY (!prepare_src_pad (base, validator))) {
+    if (gst_buffer_list_calculate_size (validator->pending) >
+        MAX_PENDING_SIZE) {
+      GST_DEBUG_OBJECT (validator, "No packet size found, dropping input");
+      gst_buffer_list_unref (validator->pending);
+      validator->pending = NULL;
+    }
+    return GST_FLOW_OK;
+  }
+
+  list = validator->pending;
+  validator->pending = NULL;
+
+  return gst_pad_push_list (validator->srcpad, list);
+}
+
+gboolean
+gst_mpegtsvalidator_plugin_init (GstPlugin * plugin)
+{
+  GST_DEBUG_CATEGORY_INIT (mpegts_validator_debug, "tsvalidator", 0,
+      "MPEG transport stream validator");
+
+  return gst_element_register (plugin, "tsvalidator",
+      GST_RANK_NONE, GST_TYPE_MPEGTS_VALIDATOR);
+}
@@ -0,0 +1,87 @@
+/*
+ * mpegtsvalidator.h - GStreamer MPEG transport stream validator
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef GST_MPEG_TS_VALIDATOR_H
+#define GST_MPEG_TS_VALIDATOR_H
+
+#include <gst/gst.h>
+#include "mpegtsbase.h"
+#include "mpegtspacketizer.h"
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_MPEGTS_VALIDATOR \
+  (mpegts_validator_get_type())
+#define GST_MPEGTS_VALIDATOR(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_MPEGTS_VALIDATOR,MpegTSValidator))
+#define GST_MPEGTS_VALIDATOR_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_MPEGTS_VALIDATOR,MpegTSValidatorClass))
+#define GST_IS_MPEGTS_VALIDATOR(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_MPEGTS_VALIDATOR))
+#define GST_IS_MPEGTS_VALIDATOR_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_MPEGTS_VALIDATOR))
+
+typedef struct _MpegTSValidator MpegTSValidator;
+typedef struct _MpegTSValidatorClass MpegTSValidatorClass;
+typedef struct _MpegTSValidatorPID MpegTSValidatorPID;
+
+struct _MpegTSValidator {
+  MpegTSBase parent;
+
+  GstPad *srcpad;
+
+  /* properties */
+  guint stats_interval;
+
+  /* MpegTSValidatorPID of each PID, allocated when first seen */
+  MpegTSValidatorPID **pids;
+  /* PIDs seen, in order of appearance */
+  GArray *seen_pids;
+
+  guint64 packets;
+  guint sync_byte_errors;
+  guint sync_losses;
+  /* offset of the packet following the last one, G_MAXUINT64 if unknown */
+  guint64 next_offset;
+
+  /* PCR PID whose time line is used for the PIDs outside of programs and
+   * the statistics, the first one to get a rate, or the null PID */
+  guint16 clock_pid;
+  gdouble next_stats;
+
+  /* input buffers to forward once the packet size is known */
+  GstBufferList *pending;
+
+  gboolean first;
+  gboolean have_group_id;
+  guint group_id;
+};
+
+struct _MpegTSValidatorClass {
+  MpegTSBaseClass parent_class;
+};
+
+G_GNUC_INTERNAL GType mpegts_validator_get_type(void);
+
+G_GNUC_INTERNAL gboolean gst_mpegtsvalidator_plugin_init (GstPlugin * plugin);
+
+G_END_DECLS
+
+#endif /* GST_MPEG_TS_VALIDATOR_H */
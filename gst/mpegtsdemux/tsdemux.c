@@ -75,6 +75,16 @@
 /* latency in msecs */
 #define DEFAULT_LATENCY (700)
 
+#define DEFAULT_ZERO_COPY_PES FALSE
+
+#define DEFAULT_PARALLEL_STREAMS FALSE
+
+/* Maximum number of TS packets queued for a stream worker before the
+ * streaming thread blocks */
+#define WORKER_QUEUE_SIZE 1024
+/* Maximum number of TS packets handed over to a worker at once */
+#define WORKER_BATCH_SIZE 64
+
 /* Limit PES packet collection to a maximum of 32MB
  * which is more than large enough to support an H264 frame at
  * maximum profile/level/bitrate at 30fps or above.
@@ -119,6 +129,61 @@ typedef struct
 
 typedef struct _TSDemuxStream TSDemuxStream;
 
+/* TS packet queued for a stream worker */
+typedef struct
+{
+  guint64 offset;
+  /* Offset of the payload in the batch input, or in its copies */
+  gsize payload;
+  guint8 payload_size;
+  guint8 scram_afc_cc;
+  guint8 payload_unit_start_indicator;
+  gboolean copied;
+
+  /* For packets starting a PES, the PES header timestamps and their
+   * conversion with the PCR mapping in use when the packet was queued */
+  guint64 raw_pts, raw_dts;
+  GstClockTime pts, dts;
+} TSDemuxWorkerPacket;
+
+/* TS packets of one stream taken from the same packetizer input */
+typedef struct
+{
+  GstBuffer *buffer;
+  /* Array of TSDemuxWorkerPacket */
+  GArray *packets;
+  /* Payloads which didn't point into the input (descrambled, ...) */
+  GByteArray *copies;
+} TSDemuxWorkerBatch;
+
+/* Thread assembling and pushing the PES of one stream (parallel-streams) */
+typedef struct
+{
+  GstTSDemux *demux;
+  TSDemuxStream *stream;
+  GThread *thread;
+
+  /* Batch being filled by the streaming thread, only accessed from it */
+  TSDemuxWorkerBatch *pending;
+
+  GMutex lock;
+  GCond cond;
+  /* Queued TSDemuxWorkerBatch and their total number of packets,
+   * protected by lock */
+  GQueue queue;
+  guint queued;
+  /* TRUE while a batch is being processed */
+  gboolean busy;
+  gboolean flushing;
+  gboolean quit;
+
+  /* Only accessed from the worker thread: the packet being handled and
+   * the input it points into */
+  TSDemuxWorkerPacket *packet;
+  GstBuffer *map_buffer;
+  GstMapInfo map;
+} TSDemuxWorker;
+
 typedef struct _TSDemuxH264ParsingInfos TSDemuxH264ParsingInfos;
 typedef struct _TSDemuxJP2KParsingInfos TSDemuxJP2KParsingInfos;
 typedef struct _TSDemuxADTSParsingInfos TSDemuxADTSParsingInfos;
@@ -175,6 +240,11 @@ struct _TSDemuxStream
   /* Data being reconstructed (allocated) */
   guint8 *data;
 
+  /* Data being reconstructed in zero-copy mode: array of GstMemory, one
+   * per TS packet payload, shared with the upstream buffers. Exclusive
+   * with ->data */
+  GPtrArray *slices;
+
   /* Size of data being reconstructed (if known, else 0) */
   guint expected_size;
 
@@ -219,6 +289,11 @@ struct _TSDemuxStream
 
   GstClockTime seeked_pts, seeked_dts;
 
+  /* Worker thread handling the packets of this stream, or NULL */
+  TSDemuxWorker *worker;
+  /* Set by the worker when the gap check is due for this stream */
+  gboolean need_gap_check;
+
   GstTsDemuxKeyFrameScanFunction scan_function;
   TSDemuxH264ParsingInfos h264infos;
   TSDemuxJP2KParsingInfos jp2kInfos;
@@ -297,6 +372,9 @@ enum
   PROP_PROGRAM_NUMBER,
   PROP_EMIT_STATS,
   PROP_LATENCY,
+  PROP_ZERO_COPY_PES,
+  PROP_PARALLEL_STREAMS,
+  PROP_INDEX_LOCATION,
   /* FILL ME */
 };
 
@@ -317,6 +395,9 @@ static void gst_ts_demux_reset (MpegTSBase * base);
 static GstFlowReturn
 gst_ts_demux_push (MpegTSBase * base, MpegTSPacketizerPacket * packet,
     GstMpegtsSection * section);
+static void gst_ts_demux_wait_pushed (MpegTSBase * base);
+static GstFlowReturn gst_ts_demux_input_done (MpegTSBase * base,
+    GstBuffer * buffer);
 static void gst_ts_demux_flush (MpegTSBase * base, gboolean hard);
 static GstFlowReturn gst_ts_demux_drain (MpegTSBase * base);
 static gboolean
@@ -335,6 +416,10 @@ gst_ts_demux_push_pending_data (GstTSDemux * demux, TSDemuxStream * stream,
     MpegTSBaseProgram * program);
 static void gst_ts_demux_stream_flush (TSDemuxStream * stream,
     GstTSDemux * demux, gboolean hard);
+static void gst_ts_demux_stream_stop_worker (GstTSDemux * demux,
+    TSDemuxStream * stream);
+static void gst_ts_demux_set_workers_flushing (GstTSDemux * demux,
+    gboolean flushing);
 
 static gboolean push_event (MpegTSBase * base, GstEvent * event);
 static gboolean sink_query (MpegTSBase * base, GstQuery * query);
@@ -367,6 +452,18 @@ gst_ts_demux_dispose (GObject * object)
   GST_CALL_PARENT (G_OBJECT_CLASS, dispose, (object));
 }
 
+static void
+gst_ts_demux_finalize (GObject * object)
+{
+  GstTSDemux *demux = GST_TS_DEMUX_CAST (object);
+
+  g_mutex_clear (&demux->output_lock);
+  mpegts_index_free (demux->index);
+  g_free (demux->index_location);
+
+  GST_CALL_PARENT (G_OBJECT_CLASS, finalize, (object));
+}
+
 static void
 gst_ts_demux_class_init (GstTSDemuxClass * klass)
 {
@@ -378,6 +475,7 @@ gst_ts_demux_class_init (GstTSDemuxClass * klass)
   gobject_class->set_property = gst_ts_demux_set_property;
   gobject_class->get_property = gst_ts_demux_get_property;
   gobject_class->dispose = gst_ts_demux_dispose;
+  gobject_class->finalize = gst_ts_demux_finalize;
 
   g_object_class_install_property (gobject_class, PROP_PROGRAM_NUMBER,
       g_param_spec_int ("program-number", "Program number",
@@ -395,6 +493,68 @@ gst_ts_demux_class_init (GstTSDemuxClass * klass)
           G_MAXINT, DEFAULT_LATENCY,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTSDemux:zero-copy-pes:
+   *
+   * Collect the PES payload by referencing the upstream memory of each
+   * TS packet instead of copying it into a contiguous buffer. Outputted
+   * buffers will then be made of several memories, which are only merged
+   * if a downstream element needs to map them. PES with more TS packets
+   * than a buffer can hold memories are pushed as a #GstBufferList, only
+   * the first buffer of which is timestamped.
+   *
+   * Streams for which tsdemux needs to inspect the payload (keyframe
+   * scanning after accurate seeks, Opus, JPEG 2000 and ADTS) always use a
+   * copy.
+   */
+  g_object_class_install_property (gobject_class, PROP_ZERO_COPY_PES,
+      g_param_spec_boolean ("zero-copy-pes", "Zero-copy PES",
+          "Reference upstream memory instead of copying PES payload",
+          DEFAULT_ZERO_COPY_PES, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTSDemux:parallel-streams:
+   *
+   * In push mode, only classify the TS packets in the streaming thread and
+   * hand them over to one thread per elementary stream of the program,
+   * which assembles and pushes its PES. Each stream thread has a bounded
+   * queue, the streaming thread blocks when it is full.
+   *
+   * Ordering within each stream is preserved. The PES timestamps are still
+   * converted by the streaming thread, with the PCR observations made up to
+   * the start of each PES. Until the initial timestamps and segment are
+   * known, and before events, program changes and flushes are handled, the
+   * stream threads are drained and the packets handled by the streaming
+   * thread.
+   *
+   * This is only worth it for programs with several high bitrate
+   * elementary streams.
+   */
+  g_object_class_install_property (gobject_class, PROP_PARALLEL_STREAMS,
+      g_param_spec_boolean ("parallel-streams", "Parallel streams",
+          "Assemble and push the PES of each stream in its own thread",
+          DEFAULT_PARALLEL_STREAMS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTSDemux:index-location:
+   *
+   * Location of a sidecar seek index for the stream.
+   *
+   * If the file exists and was made for a stream of the same size, seeks are
+   * resolved with a lookup of the closest preceding keyframe (or PCR) in it
+   * instead of bisecting the stream.
+   *
+   * Otherwise the index is collected while playing, and written at EOS if
+   * the stream was played linearly from its start: in pull mode, or in push
+   * mode from a byte segment starting at 0.
+   */
+  g_object_class_install_property (gobject_class, PROP_INDEX_LOCATION,
+      g_param_spec_string ("index-location", "Index location",
+          "Location of the sidecar seek index (NULL = no index)", NULL,
+          G_PARAM_READWRITE | GST_PARAM_MUTABLE_READY |
+          G_PARAM_STATIC_STRINGS));
+
   element_class = GST_ELEMENT_CLASS (klass);
   gst_element_class_add_pad_template (element_class,
       gst_static_pad_template_get (&video_template));
@@ -415,6 +575,8 @@ gst_ts_demux_class_init (GstTSDemuxClass * klass)
   ts_class = GST_MPEGTS_BASE_CLASS (klass);
   ts_class->reset = GST_DEBUG_FUNCPTR (gst_ts_demux_reset);
   ts_class->push = GST_DEBUG_FUNCPTR (gst_ts_demux_push);
+  ts_class->wait_pushed = GST_DEBUG_FUNCPTR (gst_ts_demux_wait_pushed);
+  ts_class->input_done = GST_DEBUG_FUNCPTR (gst_ts_demux_input_done);
   ts_class->push_event = GST_DEBUG_FUNCPTR (push_event);
   ts_class->sink_query = GST_DEBUG_FUNCPTR (sink_query);
   ts_class->program_started = GST_DEBUG_FUNCPTR (gst_ts_demux_program_started);
@@ -434,6 +596,15 @@ gst_ts_demux_reset (MpegTSBase * base)
   GstTSDemux *demux = (GstTSDemux *) base;
 
   demux->rate = 1.0;
+
+  while (demux->workers) {
+    TSDemuxWorker *worker = demux->workers->data;
+
+    gst_ts_demux_stream_stop_worker (demux, worker->stream);
+  }
+  demux->worker_flow = GST_FLOW_OK;
+  demux->need_gap_check = FALSE;
+
   if (demux->segment_event) {
     gst_event_unref (demux->segment_event);
     demux->segment_event = NULL;
@@ -454,6 +625,11 @@ gst_ts_demux_reset (MpegTSBase * base)
 
   demux->last_seek_offset = -1;
   demux->program_generation = 0;
+
+  /* Called from the base class init, before ours */
+  if (demux->index)
+    mpegts_index_clear (demux->index);
+  demux->index_state = GST_TS_DEMUX_INDEX_UNKNOWN;
 }
 
 static void
@@ -472,6 +648,10 @@ gst_ts_demux_init (GstTSDemux * demux)
   demux->requested_program_number = -1;
   demux->program_number = -1;
   demux->latency = DEFAULT_LATENCY;
+  demux->zero_copy_pes = DEFAULT_ZERO_COPY_PES;
+  demux->parallel_streams = DEFAULT_PARALLEL_STREAMS;
+  g_mutex_init (&demux->output_lock);
+  demux->index = mpegts_index_new ();
   gst_ts_demux_reset (base);
 }
 
@@ -494,6 +674,16 @@ gst_ts_demux_set_property (GObject * object, guint prop_id,
     case PROP_LATENCY:
       demux->latency = g_value_get_int (value);
       break;
+    case PROP_ZERO_COPY_PES:
+      demux->zero_copy_pes = g_value_get_boolean (value);
+      break;
+    case PROP_PARALLEL_STREAMS:
+      demux->parallel_streams = g_value_get_boolean (value);
+      break;
+    case PROP_INDEX_LOCATION:
+      g_free (demux->index_location);
+      demux->index_location = g_value_dup_string (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -515,6 +705,15 @@ gst_ts_demux_get_property (GObject * object, guint prop_id,
     case PROP_LATENCY:
       g_value_set_int (value, demux->latency);
       break;
+    case PROP_ZERO_COPY_PES:
+      g_value_set_boolean (value, demux->zero_copy_pes);
+      break;
+    case PROP_PARALLEL_STREAMS:
+      g_value_set_boolean (value, demux->parallel_streams);
+      break;
+    case PROP_INDEX_LOCATION:
+      g_value_set_string (value, demux->index_location);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -856,6 +1055,60 @@ gst_ts_demux_adjust_seek_offset_for_keyframe (TSDemuxStream * stream,
   return TRUE;
 }
 
+static guint64
+gst_ts_demux_stream_byte_size (GstTSDemux * demux)
+{
+  gint64 size;
+
+  if (!gst_pad_peer_query_duration (((MpegTSBase *) demux)->sinkpad,
+          GST_FORMAT_BYTES, &size) || size < 0)
+    return 0;
+
+  return size;
+}
+
+/* Whether packet offsets are byte positions in the stream, which is read
+ * from its start */
+static gboolean
+gst_ts_demux_index_from_start (MpegTSBase * base)
+{
+  if (base->mode == BASE_MODE_PUSHING)
+    return base->segment.format == GST_FORMAT_BYTES
+        && base->segment.start == 0;
+
+  return base->mode == BASE_MODE_STREAMING;
+}
+
+/* Load the index if there is one for this stream, else start collecting it
+ * if we are playing from the start */
+static void
+gst_ts_demux_index_start (GstTSDemux * demux, gboolean from_start)
+{
+  if (mpegts_index_load (demux->index, demux->index_location,
+          gst_ts_demux_stream_byte_size (demux)))
+    demux->index_state = GST_TS_DEMUX_INDEX_LOADED;
+  else if (from_start)
+    demux->index_state = GST_TS_DEMUX_INDEX_RECORDING;
+  else
+    demux->index_state = GST_TS_DEMUX_INDEX_DISABLED;
+}
+
+/* Closest preceding keyframe, else PCR, in the index */
+static guint64
+gst_ts_demux_index_lookup (GstTSDemux * demux, GstClockTime target)
+{
+  guint16 pcr_pid = demux->program->pcr_pid;
+  guint64 offset;
+
+  if (mpegts_index_lookup (demux->index, pcr_pid,
+          MPEGTS_INDEX_ENTRY_KEYFRAME, target, &offset, NULL)
+      || mpegts_index_lookup (demux->index, pcr_pid,
+          MPEGTS_INDEX_ENTRY_PCR, target, &offset, NULL))
+    return offset;
+
+  return -1;
+}
+
 static GstFlowReturn
 gst_ts_demux_do_seek (MpegTSBase * base, GstEvent * event)
 {
@@ -912,9 +1165,34 @@ gst_ts_demux_do_seek (MpegTSBase * base, GstEvent * event)
     else
       target = 0;
 
-    start_offset =
-        mpegts_packetizer_ts_to_offset (base->packetizer, target,
-        demux->program->pcr_pid);
+    start_offset = -1;
+    if (demux->index_location && base->mode == BASE_MODE_PUSHING) {
+      /* Not called from the streaming thread, which stops collecting the
+       * index itself when the new data comes */
+      if (demux->index_state == GST_TS_DEMUX_INDEX_LOADED)
+        start_offset = gst_ts_demux_index_lookup (demux, target);
+    } else if (demux->index_location) {
+      switch (demux->index_state) {
+        case GST_TS_DEMUX_INDEX_UNKNOWN:
+          gst_ts_demux_index_start (demux, FALSE);
+          break;
+        case GST_TS_DEMUX_INDEX_RECORDING:
+          /* Not a linear playback anymore */
+          GST_DEBUG_OBJECT (demux, "Seeking, stop collecting the index");
+          mpegts_index_clear (demux->index);
+          demux->index_state = GST_TS_DEMUX_INDEX_DISABLED;
+          break;
+        default:
+          break;
+      }
+      if (demux->index_state == GST_TS_DEMUX_INDEX_LOADED)
+        start_offset = gst_ts_demux_index_lookup (demux, target);
+    }
+
+    if (start_offset == -1)
+      start_offset =
+          mpegts_packetizer_ts_to_offset (base->packetizer, target,
+          demux->program->pcr_pid);
     if (G_UNLIKELY (start_offset == -1)) {
       GST_WARNING ("Couldn't convert start position to an offset");
       goto done;
@@ -997,8 +1275,24 @@ push_event (MpegTSBase * base, GstEvent * event)
   GList *tmp;
   gboolean early_ret = FALSE;
 
+  /* Stream workers were drained before any serialized event, FLUSH_START
+   * needs to unblock them instead */
+  if (GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_START) {
+    gst_ts_demux_set_workers_flushing (demux, TRUE);
+  } else if (GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_STOP) {
+    gst_ts_demux_set_workers_flushing (demux, FALSE);
+    g_atomic_int_set ((gint *) & demux->worker_flow, GST_FLOW_OK);
+  }
+
   if (GST_EVENT_TYPE (event) == GST_EVENT_SEGMENT) {
     GST_DEBUG_OBJECT (base, "Ignoring segment event (recreated later)");
+    if (demux->index_state == GST_TS_DEMUX_INDEX_RECORDING
+        && !gst_ts_demux_index_from_start (base)) {
+      /* Upstream moved to another position */
+      GST_DEBUG_OBJECT (demux, "New segment, stop collecting the index");
+      mpegts_index_clear (demux->index);
+      demux->index_state = GST_TS_DEMUX_INDEX_DISABLED;
+    }
     gst_event_unref (event);
     return TRUE;
 
@@ -1028,6 +1322,17 @@ push_event (MpegTSBase * base, GstEvent * event)
     early_ret = TRUE;
   }
 
+  if (GST_EVENT_TYPE (event) == GST_EVENT_EOS
+      && demux->index_state == GST_TS_DEMUX_INDEX_RECORDING) {
+    guint64 size = gst_ts_demux_stream_byte_size (demux);
+
+    if (mpegts_index_save (demux->index, demux->index_location, size)
+        && mpegts_index_load (demux->index, demux->index_location, size))
+      demux->index_state = GST_TS_DEMUX_INDEX_LOADED;
+    else
+      demux->index_state = GST_TS_DEMUX_INDEX_DISABLED;
+  }
+
   if (G_UNLIKELY (demux->program == NULL)) {
     gst_event_unref (event);
     return early_ret;
@@ -1903,6 +2208,8 @@ gst_ts_demux_stream_removed (MpegTSBase * base, MpegTSBaseStream * bstream)
 {
   TSDemuxStream *stream = (TSDemuxStream *) bstream;
 
+  gst_ts_demux_stream_stop_worker (GST_TS_DEMUX_CAST (base), stream);
+
   if (stream->pad) {
     gst_flow_combiner_remove_pad (GST_TS_DEMUX_CAST (base)->flowcombiner,
         stream->pad);
@@ -1962,6 +2269,7 @@ gst_ts_demux_stream_flush (TSDemuxStream * stream, GstTSDemux * tsdemux,
 
   g_free (stream->data);
   stream->data = NULL;
+  g_clear_pointer (&stream->slices, g_ptr_array_unref);
   stream->state = PENDING_PACKET_EMPTY;
   stream->expected_size = 0;
   stream->allocated_size = 0;
@@ -1975,6 +2283,7 @@ gst_ts_demux_stream_flush (TSDemuxStream * stream, GstTSDemux * tsdemux,
   stream->nb_out_buffers = 0;
   stream->gap_ref_buffers = 0;
   stream->gap_ref_pts = GST_CLOCK_TIME_NONE;
+  stream->need_gap_check = FALSE;
   stream->continuity_counter = CONTINUITY_UNSET;
 
   if (G_UNLIKELY (stream->pending)) {
@@ -2185,6 +2494,26 @@ gst_ts_demux_program_stopped (MpegTSBase * base, MpegTSBaseProgram * program)
 }
 
 
+/* Converts a PTS/DTS of the PES header being parsed. Stream workers run
+ * behind the streaming thread and the PCR observations it records, so they
+ * use the conversion made when the packet starting the PES was queued */
+static inline GstClockTime
+gst_ts_demux_pes_time_to_ts (GstTSDemux * demux, TSDemuxStream * stream,
+    guint64 time)
+{
+  TSDemuxWorker *worker = stream->worker;
+
+  if (worker && worker->packet) {
+    if (time == worker->packet->raw_pts)
+      return worker->packet->pts;
+    if (time == worker->packet->raw_dts)
+      return worker->packet->dts;
+  }
+
+  return mpegts_packetizer_pts_to_ts (MPEG_TS_BASE_PACKETIZER (demux),
+      MPEGTIME_TO_GSTTIME (time), demux->program->pcr_pid);
+}
+
 static inline void
 gst_ts_demux_record_pts (GstTSDemux * demux, TSDemuxStream * stream,
     guint64 pts, guint64 offset)
@@ -2201,9 +2530,7 @@ gst_ts_demux_record_pts (GstTSDemux * demux, TSDemuxStream * stream,
       G_GUINT64_FORMAT, bs->pid, pts, offset);
 
   /* Compute PTS in GstClockTime */
-  stream->pts =
-      mpegts_packetizer_pts_to_ts (MPEG_TS_BASE_PACKETIZER (demux),
-      MPEGTIME_TO_GSTTIME (pts), demux->program->pcr_pid);
+  stream->pts = gst_ts_demux_pes_time_to_ts (demux, stream, pts);
 
   GST_LOG ("pid 0x%04x Stored PTS %" G_GUINT64_FORMAT, bs->pid, stream->pts);
 
@@ -2235,9 +2562,7 @@ gst_ts_demux_record_dts (GstTSDemux * demux, TSDemuxStream * stream,
       G_GUINT64_FORMAT, bs->pid, dts, offset);
 
   /* Compute DTS in GstClockTime */
-  stream->dts =
-      mpegts_packetizer_pts_to_ts (MPEG_TS_BASE_PACKETIZER (demux),
-      MPEGTIME_TO_GSTTIME (dts), demux->program->pcr_pid);
+  stream->dts = gst_ts_demux_pes_time_to_ts (demux, stream, dts);
 
   GST_LOG ("pid 0x%04x Stored DTS %" G_GUINT64_FORMAT, bs->pid, stream->dts);
 
@@ -2391,6 +2716,142 @@ check_pending_buffers (GstTSDemux * demux)
   return TRUE;
 }
 
+/* Whether the payload of @stream can be collected as memories shared with
+ * the upstream buffers instead of being copied */
+static inline gboolean
+gst_ts_demux_stream_can_share_payload (GstTSDemux * demux,
+    TSDemuxStream * stream)
+{
+  MpegTSBaseStream *bs = (MpegTSBaseStream *) stream;
+
+  if (!demux->zero_copy_pes || stream->needs_keyframe)
+    return FALSE;
+
+  /* Those need to parse the reconstructed payload before pushing it */
+  if (bs->stream_type == GST_MPEGTS_STREAM_TYPE_VIDEO_JP2K ||
+      bs->stream_type == GST_MPEGTS_STREAM_TYPE_AUDIO_AAC_ADTS ||
+      (bs->stream_type == GST_MPEGTS_STREAM_TYPE_PRIVATE_PES_PACKETS &&
+          bs->registration_id == DRF_ID_OPUS))
+    return FALSE;
+
+  return TRUE;
+}
+
+/* Switch @stream from zero-copy collection to the contiguous ->data
+ * storage, copying what was collected so far. Returns FALSE, dropping the
+ * PES, if a slice couldn't be read */
+static gboolean
+gst_ts_demux_stream_merge_slices (TSDemuxStream * stream, gsize extra)
+{
+  gsize size = stream->current_size, offset = 0;
+  GstMapInfo map;
+  guint i;
+
+  GST_LOG ("merging %u slices (%" G_GSIZE_FORMAT " bytes)",
+      stream->slices->len, size);
+
+  if (stream->expected_size)
+    stream->allocated_size = MAX (stream->expected_size, size + extra);
+  else
+    stream->allocated_size = MAX (8192, 2 * (size + extra));
+
+  stream->data = g_malloc (stream->allocated_size);
+  for (i = 0; i < stream->slices->len; i++) {
+    GstMemory *mem = g_ptr_array_index (stream->slices, i);
+
+    if (G_UNLIKELY (!gst_memory_map (mem, &map, GST_MAP_READ)))
+      goto map_failed;
+
+    memcpy (stream->data + offset, map.data, map.size);
+    offset += map.size;
+    gst_memory_unmap (mem, &map);
+  }
+  stream->current_size = offset;
+  g_clear_pointer (&stream->slices, g_ptr_array_unref);
+
+  return TRUE;
+
+map_failed:
+  {
+    GST_WARNING ("pid: 0x%04x failed to map slice %u of the PES, dropping it",
+        stream->stream.pid, i);
+    g_free (stream->data);
+    stream->data = NULL;
+    g_clear_pointer (&stream->slices, g_ptr_array_unref);
+    stream->current_size = 0;
+    stream->state = PENDING_PACKET_DISCONT;
+    stream->discont = TRUE;
+    return FALSE;
+  }
+}
+
+/* Wraps the slices of @stream into a buffer, or into a list of buffers if
+ * a single one can't hold all of them without merging */
+static void
+gst_ts_demux_stream_take_slices (TSDemuxStream * stream, GstBuffer ** buffer,
+    GstBufferList ** buffer_list)
+{
+  guint max_memory = gst_buffer_get_max_memory ();
+  guint i, n = stream->slices->len;
+  GstBuffer *buf = NULL;
+
+  *buffer = NULL;
+  *buffer_list = NULL;
+
+  if (n > max_memory)
+    *buffer_list =
+        gst_buffer_list_new_sized ((n + max_memory - 1) / max_memory);
+
+  for (i = 0; i < n; i++) {
+    if (i % max_memory == 0) {
+      buf = gst_buffer_new ();
+      if (*buffer_list)
+        gst_buffer_list_add (*buffer_list, buf);
+      else
+        *buffer = buf;
+    }
+    gst_buffer_append_memory (buf,
+        gst_memory_ref (g_ptr_array_index (stream->slices, i)));
+  }
+
+  if (n == 0)
+    *buffer = gst_buffer_new ();
+
+  GST_LOG ("took %u slices in %u buffers", n,
+      *buffer_list ? gst_buffer_list_length (*buffer_list) : 1);
+
+  g_clear_pointer (&stream->slices, g_ptr_array_unref);
+}
+
+/* Returns FALSE if the data couldn't be shared, in which case the caller
+ * should copy it instead */
+static inline gboolean
+gst_ts_demux_stream_add_slice (GstTSDemux * demux, TSDemuxStream * stream,
+    const guint8 * data, guint size)
+{
+  TSDemuxWorker *worker = stream->worker;
+  GstMemory *mem;
+
+  if (worker && worker->packet) {
+    /* Stream workers handle packets of an input the packetizer might be
+     * done with */
+    if (G_UNLIKELY (worker->map_buffer == NULL))
+      return FALSE;
+    mem = mpegts_packetizer_share_buffer_data (worker->map_buffer,
+        worker->map.data, worker->map.size, data, size);
+  } else {
+    mem = mpegts_packetizer_share_data (MPEG_TS_BASE_PACKETIZER (demux), data,
+        size);
+  }
+  if (G_UNLIKELY (mem == NULL))
+    return FALSE;
+
+  g_ptr_array_add (stream->slices, mem);
+  stream->current_size += size;
+
+  return TRUE;
+}
+
 static void
 gst_ts_demux_parse_pes_header (GstTSDemux * demux, TSDemuxStream * stream,
     guint8 * data, guint32 length, guint64 bufferoffset)
@@ -2449,13 +2910,27 @@ gst_ts_demux_parse_pes_header (GstTSDemux * demux, TSDemuxStream * stream,
   data += header.header_size;
   length -= header.header_size;
 
+  g_assert (stream->data == NULL && stream->slices == NULL);
+  stream->current_size = 0;
+
+  if (gst_ts_demux_stream_can_share_payload (demux, stream)) {
+    stream->slices =
+        g_ptr_array_new_with_free_func ((GDestroyNotify) gst_memory_unref);
+    if (length == 0
+        || gst_ts_demux_stream_add_slice (demux, stream, data, length)) {
+      stream->state = PENDING_PACKET_BUFFER;
+      return;
+    }
+    /* Payload not shareable (descrambled, merged, ...), copy it */
+    g_clear_pointer (&stream->slices, g_ptr_array_unref);
+  }
+
   /* Create the output buffer */
   if (stream->expected_size)
     stream->allocated_size = MAX (stream->expected_size, length);
   else
     stream->allocated_size = MAX (8192, length);
 
-  g_assert (stream->data == NULL);
   stream->data = g_malloc (stream->allocated_size);
   memcpy (stream->data, data, length);
   stream->current_size = length;
@@ -2500,6 +2975,7 @@ gst_ts_demux_queue_data (GstTSDemux * demux, TSDemuxStream * stream,
           g_free (stream->data);
           stream->data = NULL;
         }
+        g_clear_pointer (&stream->slices, g_ptr_array_unref);
         stream->state = PENDING_PACKET_HEADER;
       } else {
         GST_WARNING ("CONTINUITY: Mismatch packet %d, stream %d",
@@ -2536,6 +3012,13 @@ gst_ts_demux_queue_data (GstTSDemux * demux, TSDemuxStream * stream,
     case PENDING_PACKET_BUFFER:
     {
       GST_LOG ("BUFFER: appending data");
+      if (stream->slices) {
+        if (G_LIKELY (gst_ts_demux_stream_add_slice (demux, stream, data,
+                    size)))
+          break;
+        if (G_UNLIKELY (!gst_ts_demux_stream_merge_slices (stream, size)))
+          break;
+      }
       if (G_UNLIKELY (stream->current_size + size > stream->allocated_size)) {
         GST_LOG ("resizing buffer");
         do {
@@ -2554,6 +3037,7 @@ gst_ts_demux_queue_data (GstTSDemux * demux, TSDemuxStream * stream,
         g_free (stream->data);
         stream->data = NULL;
       }
+      g_clear_pointer (&stream->slices, g_ptr_array_unref);
       stream->continuity_counter = CONTINUITY_UNSET;
       break;
     }
@@ -2730,6 +3214,25 @@ gst_ts_demux_check_and_sync_streams (GstTSDemux * demux, GstClockTime time)
   }
 }
 
+/* Called when the PTS of @stream advanced enough since the last gap check */
+static void
+gst_ts_demux_sync_streams_to_stream (GstTSDemux * demux, TSDemuxStream * stream)
+{
+  if (demux->program->pcr_pid != 0x1fff) {
+    GstClockTime curpcr =
+        mpegts_packetizer_get_current_time (MPEG_TS_BASE_PACKETIZER (demux),
+        demux->program->pcr_pid);
+    if (curpcr == GST_CLOCK_TIME_NONE || curpcr < 800 * GST_MSECOND)
+      return;
+    curpcr -= 800 * GST_MSECOND;
+    /* Use the current PCR (with a safety margin) to sync against */
+    gst_ts_demux_check_and_sync_streams (demux, curpcr);
+  } else {
+    /* If we don't have a PCR track, just use the current stream PTS */
+    gst_ts_demux_check_and_sync_streams (demux, stream->pts);
+  }
+}
+
 static GstBufferList *
 parse_opus_access_unit (TSDemuxStream * stream)
 {
@@ -3071,7 +3574,7 @@ gst_ts_demux_push_pending_data (GstTSDemux * demux, TSDemuxStream * stream,
       "stream:%p, pid:0x%04x stream_type:%d state:%d", stream, bs->pid,
       bs->stream_type, stream->state);
 
-  if (G_UNLIKELY (stream->data == NULL)) {
+  if (G_UNLIKELY (stream->data == NULL && stream->slices == NULL)) {
     GST_LOG ("stream->data == NULL");
     goto beach;
   }
@@ -3092,6 +3595,11 @@ gst_ts_demux_push_pending_data (GstTSDemux * demux, TSDemuxStream * stream,
     goto beach;
   }
 
+  /* The payload needs to be inspected, make it contiguous */
+  if (stream->slices && !gst_ts_demux_stream_can_share_payload (demux, stream)
+      && !gst_ts_demux_stream_merge_slices (stream, 0))
+    goto beach;
+
   if (stream->needs_keyframe) {
     MpegTSBase *base = (MpegTSBase *) demux;
 
@@ -3166,6 +3674,8 @@ gst_ts_demux_push_pending_data (GstTSDemux * demux, TSDemuxStream * stream,
         res = GST_FLOW_ERROR;
         goto beach;
       }
+    } else if (stream->slices) {
+      gst_ts_demux_stream_take_slices (stream, &buffer, &buffer_list);
     } else {
       buffer = gst_buffer_new_wrapped (stream->data, stream->current_size);
     }
@@ -3265,6 +3775,7 @@ gst_ts_demux_push_pending_data (GstTSDemux * demux, TSDemuxStream * stream,
       GST_TIME_FORMAT, (buffer_list ? "list" : ""), GST_TIME_ARGS (stream->pts),
       GST_TIME_ARGS (stream->dts));
 
+  g_mutex_lock (&demux->output_lock);
   if (GST_CLOCK_TIME_IS_VALID (stream->dts)) {
     if (stream->dts > base->out_segment.position)
       base->out_segment.position = stream->dts;
@@ -3272,6 +3783,7 @@ gst_ts_demux_push_pending_data (GstTSDemux * demux, TSDemuxStream * stream,
     if (stream->pts > base->out_segment.position)
       base->out_segment.position = stream->pts;
   }
+  g_mutex_unlock (&demux->output_lock);
 
   if (buffer) {
     res = gst_pad_push (stream->pad, buffer);
@@ -3284,7 +3796,9 @@ gst_ts_demux_push_pending_data (GstTSDemux * demux, TSDemuxStream * stream,
     stream->nb_out_buffers += n;
   }
   GST_DEBUG_OBJECT (stream->pad, "Returned %s", gst_flow_get_name (res));
+  g_mutex_lock (&demux->output_lock);
   res = gst_flow_combiner_update_flow (demux->flowcombiner, res);
+  g_mutex_unlock (&demux->output_lock);
   GST_DEBUG_OBJECT (stream->pad, "combined %s", gst_flow_get_name (res));
 
   /* GAP / sparse stream tracking */
@@ -3296,18 +3810,13 @@ gst_ts_demux_push_pending_data (GstTSDemux * demux, TSDemuxStream * stream,
      * hit this will trigger a gap check */
     if (G_UNLIKELY (stream->pts != GST_CLOCK_TIME_NONE &&
             stream->pts > stream->gap_ref_pts + 2 * GST_SECOND)) {
-      if (demux->program->pcr_pid != 0x1fff) {
-        GstClockTime curpcr =
-            mpegts_packetizer_get_current_time (MPEG_TS_BASE_PACKETIZER (demux),
-            demux->program->pcr_pid);
-        if (curpcr == GST_CLOCK_TIME_NONE || curpcr < 800 * GST_MSECOND)
-          goto beach;
-        curpcr -= 800 * GST_MSECOND;
-        /* Use the current PCR (with a safety margin) to sync against */
-        gst_ts_demux_check_and_sync_streams (demux, curpcr);
+      if (stream->worker && stream->worker->packet) {
+        /* This goes over all the streams, let the streaming thread do it
+         * once the workers are idle */
+        stream->need_gap_check = TRUE;
+        g_atomic_int_set (&demux->need_gap_check, TRUE);
       } else {
-        /* If we don't have a PCR track, just use the current stream PTS */
-        gst_ts_demux_check_and_sync_streams (demux, stream->pts);
+        gst_ts_demux_sync_streams_to_stream (demux, stream);
       }
     }
   }
@@ -3323,6 +3832,7 @@ beach:
       stream->expected_size -= stream->current_size;
   }
   stream->data = NULL;
+  g_clear_pointer (&stream->slices, g_ptr_array_unref);
   stream->allocated_size = 0;
   stream->current_size = 0;
 
@@ -3377,6 +3887,13 @@ gst_ts_demux_flush (MpegTSBase * base, gboolean hard)
 
   gst_ts_demux_flush_streams (demux, hard);
 
+  if (demux->index_state == GST_TS_DEMUX_INDEX_RECORDING) {
+    /* Not a linear playback anymore */
+    GST_DEBUG_OBJECT (demux, "Flushing, stop collecting the index");
+    mpegts_index_clear (demux->index);
+    demux->index_state = GST_TS_DEMUX_INDEX_DISABLED;
+  }
+
   if (demux->segment_event) {
     gst_event_unref (demux->segment_event);
     demux->segment_event = NULL;
@@ -3414,6 +3931,477 @@ gst_ts_demux_drain (MpegTSBase * base)
   return res;
 }
 
+static void
+gst_ts_demux_worker_batch_free (TSDemuxWorkerBatch * batch)
+{
+  if (batch->buffer)
+    gst_buffer_unref (batch->buffer);
+  g_array_free (batch->packets, TRUE);
+  if (batch->copies)
+    g_byte_array_unref (batch->copies);
+  g_slice_free (TSDemuxWorkerBatch, batch);
+}
+
+/* Called with the worker lock taken */
+static void
+gst_ts_demux_worker_clear_queue (TSDemuxWorker * worker)
+{
+  TSDemuxWorkerBatch *batch;
+
+  while ((batch = g_queue_pop_head (&worker->queue)))
+    gst_ts_demux_worker_batch_free (batch);
+  worker->queued = 0;
+}
+
+/* Called from a stream worker thread */
+static GstFlowReturn
+gst_ts_demux_worker_handle_batch (TSDemuxWorker * worker,
+    TSDemuxWorkerBatch * batch)
+{
+  TSDemuxStream *stream = worker->stream;
+  GstFlowReturn res, ret = GST_FLOW_OK;
+  guint i;
+
+  if (batch->buffer) {
+    if (G_UNLIKELY (!gst_buffer_map (batch->buffer, &worker->map,
+                GST_MAP_READ))) {
+      GST_ERROR_OBJECT (worker->demux, "pid 0x%04x failed to map input",
+          stream->stream.pid);
+      return GST_FLOW_ERROR;
+    }
+    worker->map_buffer = batch->buffer;
+  }
+
+  for (i = 0; i < batch->packets->len; i++) {
+    TSDemuxWorkerPacket *wpacket =
+        &g_array_index (batch->packets, TSDemuxWorkerPacket, i);
+    MpegTSPacketizerPacket packet = { 0, };
+
+    packet.pid = stream->stream.pid;
+    packet.payload_unit_start_indicator = wpacket->payload_unit_start_indicator;
+    packet.scram_afc_cc = wpacket->scram_afc_cc;
+    packet.offset = wpacket->offset;
+    if (FLAGS_HAS_PAYLOAD (wpacket->scram_afc_cc)) {
+      if (wpacket->copied)
+        packet.payload = batch->copies->data + wpacket->payload;
+      else
+        packet.payload = worker->map.data + wpacket->payload;
+      packet.data_end = packet.payload + wpacket->payload_size;
+    }
+
+    worker->packet = wpacket;
+    res = gst_ts_demux_handle_packet (worker->demux, stream, &packet, NULL);
+    worker->packet = NULL;
+
+    if (G_UNLIKELY (res != GST_FLOW_OK && ret == GST_FLOW_OK))
+      ret = res;
+  }
+
+  if (worker->map_buffer) {
+    gst_buffer_unmap (worker->map_buffer, &worker->map);
+    worker->map_buffer = NULL;
+  }
+
+  return ret;
+}
+
+static gpointer
+gst_ts_demux_worker_loop (TSDemuxWorker * worker)
+{
+  GstTSDemux *demux = worker->demux;
+  TSDemuxWorkerBatch *batch;
+  GstFlowReturn res;
+
+  g_mutex_lock (&worker->lock);
+  while (!worker->quit) {
+    if (G_UNLIKELY (worker->flushing))
+      gst_ts_demux_worker_clear_queue (worker);
+
+    batch = g_queue_pop_head (&worker->queue);
+    if (batch == NULL) {
+      worker->busy = FALSE;
+      g_cond_broadcast (&worker->cond);
+      g_cond_wait (&worker->cond, &worker->lock);
+      continue;
+    }
+
+    /* Wake up the streaming thread if it was waiting for room */
+    worker->queued -= batch->packets->len;
+    worker->busy = TRUE;
+    g_cond_broadcast (&worker->cond);
+    g_mutex_unlock (&worker->lock);
+
+    res = gst_ts_demux_worker_handle_batch (worker, batch);
+    gst_ts_demux_worker_batch_free (batch);
+
+    /* Reported to upstream on the next push, until the next flush */
+    if (G_UNLIKELY (res != GST_FLOW_OK)) {
+      GST_DEBUG_OBJECT (demux, "pid 0x%04x worker got %s",
+          worker->stream->stream.pid, gst_flow_get_name (res));
+      g_atomic_int_compare_and_exchange ((gint *) & demux->worker_flow,
+          GST_FLOW_OK, res);
+    }
+
+    g_mutex_lock (&worker->lock);
+  }
+  worker->busy = FALSE;
+  g_mutex_unlock (&worker->lock);
+
+  return NULL;
+}
+
+static TSDemuxWorker *
+gst_ts_demux_stream_start_worker (GstTSDemux * demux, TSDemuxStream * stream)
+{
+  TSDemuxWorker *worker;
+  gchar *name;
+
+  GST_DEBUG_OBJECT (demux, "Starting worker for pid 0x%04x",
+      stream->stream.pid);
+
+  worker = g_slice_new0 (TSDemuxWorker);
+  worker->demux = demux;
+  worker->stream = stream;
+  g_mutex_init (&worker->lock);
+  g_cond_init (&worker->cond);
+  g_queue_init (&worker->queue);
+
+  stream->worker = worker;
+  GST_OBJECT_LOCK (demux);
+  demux->workers = g_list_prepend (demux->workers, worker);
+  GST_OBJECT_UNLOCK (demux);
+
+  name = g_strdup_printf ("tsdemux:%04x", stream->stream.pid);
+  worker->thread = g_thread_new (name,
+      (GThreadFunc) gst_ts_demux_worker_loop, worker);
+  g_free (name);
+
+  return worker;
+}
+
+/* The queue of the worker must have been drained */
+static void
+gst_ts_demux_stream_stop_worker (GstTSDemux * demux, TSDemuxStream * stream)
+{
+  TSDemuxWorker *worker = stream->worker;
+
+  if (worker == NULL)
+    return;
+
+  GST_DEBUG_OBJECT (demux, "Stopping worker for pid 0x%04x",
+      stream->stream.pid);
+
+  g_mutex_lock (&worker->lock);
+  worker->quit = TRUE;
+  g_cond_broadcast (&worker->cond);
+  g_mutex_unlock (&worker->lock);
+  g_thread_join (worker->thread);
+
+  GST_OBJECT_LOCK (demux);
+  demux->workers = g_list_remove (demux->workers, worker);
+  GST_OBJECT_UNLOCK (demux);
+  stream->worker = NULL;
+
+  if (worker->pending)
+    gst_ts_demux_worker_batch_free (worker->pending);
+  gst_ts_demux_worker_clear_queue (worker);
+  g_cond_clear (&worker->cond);
+  g_mutex_clear (&worker->lock);
+  g_slice_free (TSDemuxWorker, worker);
+}
+
+static void
+gst_ts_demux_set_workers_flushing (GstTSDemux * demux, gboolean flushing)
+{
+  GList *tmp;
+
+  GST_OBJECT_LOCK (demux);
+  for (tmp = demux->workers; tmp; tmp = tmp->next) {
+    TSDemuxWorker *worker = tmp->data;
+
+    g_mutex_lock (&worker->lock);
+    worker->flushing = flushing;
+    g_cond_broadcast (&worker->cond);
+    g_mutex_unlock (&worker->lock);
+  }
+  GST_OBJECT_UNLOCK (demux);
+}
+
+/* Hands the batch being filled over to the worker */
+static GstFlowReturn
+gst_ts_demux_worker_queue_batch (TSDemuxWorker * worker)
+{
+  TSDemuxWorkerBatch *batch = worker->pending;
+
+  if (batch == NULL)
+    return GST_FLOW_OK;
+  worker->pending = NULL;
+
+  g_mutex_lock (&worker->lock);
+  while (worker->queued >= WORKER_QUEUE_SIZE && !worker->flushing)
+    g_cond_wait (&worker->cond, &worker->lock);
+
+  if (G_UNLIKELY (worker->flushing)) {
+    g_mutex_unlock (&worker->lock);
+    gst_ts_demux_worker_batch_free (batch);
+    return GST_FLOW_FLUSHING;
+  }
+
+  g_queue_push_tail (&worker->queue, batch);
+  worker->queued += batch->packets->len;
+  g_cond_broadcast (&worker->cond);
+  g_mutex_unlock (&worker->lock);
+
+  return GST_FLOW_OK;
+}
+
+static GstFlowReturn
+gst_ts_demux_queue_worker_batches (GstTSDemux * demux)
+{
+  GstFlowReturn res = GST_FLOW_OK;
+  GList *tmp;
+
+  for (tmp = demux->workers; tmp; tmp = tmp->next) {
+    GstFlowReturn ret = gst_ts_demux_worker_queue_batch (tmp->data);
+
+    if (ret != GST_FLOW_OK)
+      res = ret;
+  }
+
+  return res;
+}
+
+/* Parses the timestamps of the PES header starting in @wpacket, and
+ * converts them while the PCR observations are the ones recorded up to
+ * this packet */
+static void
+gst_ts_demux_worker_packet_set_times (GstTSDemux * demux,
+    TSDemuxWorkerPacket * wpacket, const guint8 * data, guint size)
+{
+  MpegTSPacketizer2 *packetizer = MPEG_TS_BASE_PACKETIZER (demux);
+  PESHeader header;
+
+  wpacket->raw_pts = wpacket->raw_dts = -1;
+  wpacket->pts = wpacket->dts = GST_CLOCK_TIME_NONE;
+
+  if (mpegts_parse_pes_header (data, size, &header) != PES_PARSING_OK)
+    return;
+
+  wpacket->raw_pts = header.PTS;
+  wpacket->raw_dts = header.DTS;
+  if (header.PTS != -1)
+    wpacket->pts = mpegts_packetizer_pts_to_ts (packetizer,
+        MPEGTIME_TO_GSTTIME (header.PTS), demux->program->pcr_pid);
+  if (header.DTS != -1)
+    wpacket->dts = mpegts_packetizer_pts_to_ts (packetizer,
+        MPEGTIME_TO_GSTTIME (header.DTS), demux->program->pcr_pid);
+}
+
+static GstFlowReturn
+gst_ts_demux_worker_queue_packet (GstTSDemux * demux, TSDemuxWorker * worker,
+    MpegTSPacketizerPacket * packet)
+{
+  MpegTSPacketizer2 *packetizer = MPEG_TS_BASE_PACKETIZER (demux);
+  TSDemuxWorkerBatch *batch = worker->pending;
+  TSDemuxWorkerPacket *wpacket;
+  GstFlowReturn res;
+
+  /* The packets of a batch all point into the same input */
+  if (batch && (batch->buffer != packetizer->map_buffer
+          || batch->packets->len == WORKER_BATCH_SIZE)) {
+    res = gst_ts_demux_worker_queue_batch (worker);
+    if (G_UNLIKELY (res != GST_FLOW_OK))
+      return res;
+    batch = NULL;
+  }
+
+  if (batch == NULL) {
+    batch = g_slice_new0 (TSDemuxWorkerBatch);
+    if (packetizer->map_buffer)
+      batch->buffer = gst_buffer_ref (packetizer->map_buffer);
+    batch->packets = g_array_sized_new (FALSE, FALSE,
+        sizeof (TSDemuxWorkerPacket), WORKER_BATCH_SIZE);
+    worker->pending = batch;
+  }
+
+  g_array_set_size (batch->packets, batch->packets->len + 1);
+  wpacket = &g_array_index (batch->packets, TSDemuxWorkerPacket,
+      batch->packets->len - 1);
+  wpacket->offset = packet->offset;
+  wpacket->scram_afc_cc = packet->scram_afc_cc;
+  wpacket->payload_unit_start_indicator = packet->payload_unit_start_indicator;
+  wpacket->payload = 0;
+  wpacket->payload_size = 0;
+  wpacket->copied = FALSE;
+
+  if (packet->payload) {
+    wpacket->payload_size = packet->data_end - packet->payload;
+    if (batch->buffer && packet->payload >= packetizer->map_data
+        && packet->data_end <= packetizer->map_data + packetizer->map_size) {
+      wpacket->payload = packet->payload - packetizer->map_data;
+    } else {
+      /* Not part of the input, the packet data will be reused */
+      if (batch->copies == NULL)
+        batch->copies = g_byte_array_new ();
+      wpacket->payload = batch->copies->len;
+      wpacket->copied = TRUE;
+      g_byte_array_append (batch->copies, packet->payload,
+          wpacket->payload_size);
+    }
+  }
+
+  if (packet->payload_unit_start_indicator && packet->payload)
+    gst_ts_demux_worker_packet_set_times (demux, wpacket, packet->payload,
+        wpacket->payload_size);
+
+  return GST_FLOW_OK;
+}
+
+/* Waits until the stream workers handled all the packets given to them */
+static void
+gst_ts_demux_wait_pushed (MpegTSBase * base)
+{
+  GstTSDemux *demux = GST_TS_DEMUX_CAST (base);
+  GList *tmp;
+
+  gst_ts_demux_queue_worker_batches (demux);
+
+  for (tmp = demux->workers; tmp; tmp = tmp->next) {
+    TSDemuxWorker *worker = tmp->data;
+
+    g_mutex_lock (&worker->lock);
+    while (worker->busy || (worker->queue.length && !worker->flushing))
+      g_cond_wait (&worker->cond, &worker->lock);
+    g_mutex_unlock (&worker->lock);
+  }
+}
+
+static GstFlowReturn
+gst_ts_demux_input_done (MpegTSBase * base, GstBuffer * buffer)
+{
+  GstTSDemux *demux = GST_TS_DEMUX_CAST (base);
+  GstFlowReturn res;
+
+  if (G_LIKELY (demux->workers == NULL))
+    return GST_FLOW_OK;
+
+  /* Don't keep the last packets of this input until the next one */
+  res = gst_ts_demux_queue_worker_batches (demux);
+  if (res == GST_FLOW_OK)
+    res = g_atomic_int_get ((gint *) & demux->worker_flow);
+
+  return res;
+}
+
+/* Runs the gap check which a stream worker left to the streaming thread */
+static void
+gst_ts_demux_check_worker_gaps (GstTSDemux * demux)
+{
+  TSDemuxStream *trigger = NULL;
+  GList *tmp;
+
+  gst_ts_demux_wait_pushed ((MpegTSBase *) demux);
+  g_atomic_int_set (&demux->need_gap_check, FALSE);
+
+  for (tmp = demux->program->stream_list; tmp; tmp = tmp->next) {
+    TSDemuxStream *stream = (TSDemuxStream *) tmp->data;
+
+    if (stream->need_gap_check && trigger == NULL)
+      trigger = stream;
+    stream->need_gap_check = FALSE;
+  }
+
+  /* Another check might have happened in the meantime */
+  if (trigger && GST_CLOCK_TIME_IS_VALID (trigger->pts)
+      && trigger->pts > trigger->gap_ref_pts + 2 * GST_SECOND)
+    gst_ts_demux_sync_streams_to_stream (demux, trigger);
+}
+
+/* Whether the PES starting in @packet begins with a random access point,
+ * only looking at this first packet */
+static gboolean
+gst_ts_demux_packet_is_keyframe (MpegTSBaseStream * bstream,
+    MpegTSPacketizerPacket * packet)
+{
+  const guint8 *data = packet->payload, *end = packet->data_end;
+
+  if (packet->afc_flags & MPEGTS_AFC_RANDOM_ACCESS_FLAG)
+    return TRUE;
+
+  /* Skip the PES header */
+  if (end - data < 9 || GST_READ_UINT24_BE (data) != 0x000001)
+    return FALSE;
+  data += 9 + data[8];
+
+  for (; end - data >= 4; data++) {
+    if (GST_READ_UINT24_BE (data) != 0x000001)
+      continue;
+    data += 3;
+
+    switch (bstream->stream_type) {
+      case GST_MPEGTS_STREAM_TYPE_VIDEO_H264:{
+        guint nal_type = data[0] & 0x1f;
+
+        /* The first slice tells, parameter sets and SEI are also sent
+         * before non-IDR pictures */
+        if (nal_type == 5)
+          return TRUE;
+        if (nal_type >= 1 && nal_type <= 4)
+          return FALSE;
+        break;
+      }
+      case GST_MPEGTS_STREAM_TYPE_VIDEO_HEVC:{
+        guint nal_type = (data[0] >> 1) & 0x3f;
+
+        /* IRAP slices */
+        if (nal_type >= 16 && nal_type <= 21)
+          return TRUE;
+        if (nal_type < 16)
+          return FALSE;
+        break;
+      }
+      default:
+        /* MPEG-1/2 sequence header, anything else is a picture or GOP
+         * belonging to a sequence started earlier */
+        return data[0] == 0xb3;
+    }
+  }
+
+  return FALSE;
+}
+
+static void
+gst_ts_demux_index_packet (GstTSDemux * demux, MpegTSPacketizerPacket * packet)
+{
+  MpegTSBaseProgram *program = demux->program;
+  MpegTSBaseStream *bstream;
+
+  if (packet->pid == program->pcr_pid
+      && (packet->afc_flags & MPEGTS_AFC_PCR_FLAG))
+    mpegts_index_add_pcr (demux->index, program->pcr_pid, packet->pcr,
+        packet->offset);
+
+  if (!packet->payload_unit_start_indicator || packet->payload == NULL)
+    return;
+
+  bstream = program->streams[packet->pid];
+  if (bstream == NULL)
+    return;
+
+  switch (bstream->stream_type) {
+    case GST_MPEGTS_STREAM_TYPE_VIDEO_MPEG1:
+    case GST_MPEGTS_STREAM_TYPE_VIDEO_MPEG2:
+    case GST_MPEGTS_STREAM_TYPE_VIDEO_H264:
+    case GST_MPEGTS_STREAM_TYPE_VIDEO_HEVC:
+      if (gst_ts_demux_packet_is_keyframe (bstream, packet))
+        mpegts_index_add_keyframe (demux->index, program->pcr_pid,
+            packet->offset);
+      break;
+    default:
+      break;
+  }
+}
+
 static GstFlowReturn
 gst_ts_demux_push (MpegTSBase * base, MpegTSPacketizerPacket * packet,
     GstMpegtsSection * section)
@@ -3423,10 +4411,38 @@ gst_ts_demux_push (MpegTSBase * base, MpegTSPacketizerPacket * packet,
   GstFlowReturn res = GST_FLOW_OK;
 
   if (G_LIKELY (demux->program)) {
+    if (G_UNLIKELY (demux->index_location
+            && demux->index_state != GST_TS_DEMUX_INDEX_LOADED
+            && demux->index_state != GST_TS_DEMUX_INDEX_DISABLED)) {
+      if (demux->index_state == GST_TS_DEMUX_INDEX_UNKNOWN)
+        gst_ts_demux_index_start (demux,
+            gst_ts_demux_index_from_start (base));
+      if (demux->index_state == GST_TS_DEMUX_INDEX_RECORDING)
+        gst_ts_demux_index_packet (demux, packet);
+    }
+
     stream = (TSDemuxStream *) demux->program->streams[packet->pid];
 
     if (stream) {
-      res = gst_ts_demux_handle_packet (demux, stream, packet, section);
+      if (G_UNLIKELY (!stream->worker && demux->parallel_streams
+              && base->mode == BASE_MODE_PUSHING && stream->pad))
+        gst_ts_demux_stream_start_worker (demux, stream);
+
+      if (G_UNLIKELY (g_atomic_int_get (&demux->need_gap_check)))
+        gst_ts_demux_check_worker_gaps (demux);
+
+      if (stream->worker && !stream->pending_ts && !stream->need_newsegment) {
+        res = g_atomic_int_get ((gint *) & demux->worker_flow);
+        if (G_LIKELY (res == GST_FLOW_OK))
+          res = gst_ts_demux_worker_queue_packet (demux, stream->worker,
+              packet);
+      } else {
+        /* The initial timestamps and segment are computed over all the
+         * streams, do that with the workers idle */
+        if (G_UNLIKELY (demux->workers != NULL) && stream->pad)
+          gst_ts_demux_wait_pushed (base);
+        res = gst_ts_demux_handle_packet (demux, stream, packet, section);
+      }
     }
   }
   return res;
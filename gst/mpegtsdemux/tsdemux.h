@@ -32,6 +32,7 @@
 #include <gst/base/gstflowcombiner.h>
 #include "mpegtsbase.h"
 #include "mpegtspacketizer.h"
+#include "mpegtsindex.h"
 
 /* color specifications for JPEG 2000 stream over MPEG TS */
 typedef enum
@@ -47,6 +48,19 @@ typedef enum
 } GstMpegTsDemuxJpeg2000ColorSpec;
 
 
+/* Use of the sidecar seek index */
+typedef enum
+{
+  /* No index-location, or no data seen yet */
+  GST_TS_DEMUX_INDEX_UNKNOWN,
+  /* Seeks are answered from the loaded index */
+  GST_TS_DEMUX_INDEX_LOADED,
+  /* The index is collected, and written at EOS */
+  GST_TS_DEMUX_INDEX_RECORDING,
+  /* Playback wasn't linear, no index can be written */
+  GST_TS_DEMUX_INDEX_DISABLED
+} GstTSDemuxIndexState;
+
 G_BEGIN_DECLS
 #define GST_TYPE_TS_DEMUX \
   (gst_ts_demux_get_type())
@@ -77,6 +91,9 @@ struct _GstTSDemux
   guint program_number;
   gboolean emit_statistics;
   gint latency; /* latency in ms */
+  gboolean zero_copy_pes; /* Collect PES payload without copying it */
+  gboolean parallel_streams; /* Process each stream in its own thread */
+  gchar *index_location; /* Sidecar seek index file */
 
   /*< private >*/
   gint program_generation; /* Incremented each time we switch program 0..15 */
@@ -101,6 +118,22 @@ struct _GstTSDemux
 
   /* Used when seeking for a keyframe to go backward in the stream */
   guint64 last_seek_offset;
+
+  /* Sidecar seek index, only modified from the streaming thread or with the
+   * stream lock taken */
+  MpegTSIndex *index;
+  GstTSDemuxIndexState index_state;
+
+  /* Stream worker threads (parallel-streams), only modified from the
+   * streaming thread with the OBJECT_LOCK taken */
+  GList *workers;
+  /* Protects the output state shared by the workers: the flow combiner and
+   * the output segment position */
+  GMutex output_lock;
+  /* First error returned by a worker, until the next flush */
+  GstFlowReturn worker_flow;
+  /* Set by a worker when the streams need to be checked for gaps */
+  gint need_gap_check;
 };
 
 struct _GstTSDemuxClass
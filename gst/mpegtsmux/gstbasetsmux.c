@@ -139,11 +139,16 @@ gst_base_ts_mux_pad_flush (GstAggregatorPad * agg_pad, GstAggregator * agg)
 {
   GList *cur;
   GstBaseTsMux *mux = GST_BASE_TS_MUX (agg);
+  GstBaseTsMuxPad *ts_pad = GST_BASE_TS_MUX_PAD (agg_pad);
 
   /* Send initial segments again after a flush-stop, and also resend the
    * header sections */
   mux->first = TRUE;
 
+  /* drop the data the constant bitrate schedule still held back */
+  if (ts_pad->stream)
+    tsmux_stream_flush (ts_pad->stream);
+
   /* output PAT, SI tables */
   tsmux_resend_pat (mux->tsmux);
   tsmux_resend_si (mux->tsmux);
@@ -200,12 +205,18 @@ enum
   PROP_BITRATE,
   PROP_PCR_INTERVAL,
   PROP_SCTE_35_PID,
-  PROP_SCTE_35_NULL_INTERVAL
+  PROP_SCTE_35_NULL_INTERVAL,
+  PROP_ZERO_COPY_PES
 };
 
 #define DEFAULT_SCTE_35_PID 0
 
 #define BASETSMUX_DEFAULT_ALIGNMENT    -1
+#define BASETSMUX_DEFAULT_ZERO_COPY_PES FALSE
+
+/* Packets per slab when no alignment is configured, 7 packets fit
+ * a 1316 bytes UDP/RTP payload */
+#define BASETSMUX_DEFAULT_SLAB_PACKETS 7
 
 #define CLOCK_BASE 9LL
 #define CLOCK_FREQ (CLOCK_BASE * 10000) /* 90 kHz PTS clock */
@@ -238,8 +249,20 @@ typedef struct
 
 G_DEFINE_TYPE (GstBaseTsMux, gst_base_ts_mux, GST_TYPE_AGGREGATOR);
 
+static void gst_base_ts_mux_clear_slabs (GstBaseTsMux * mux);
+
 /* Internals */
 
+/* Packets made of several memories can't be resized in place to make room
+ * for the M2TS header, only share the payload for plain 188 bytes packets */
+static void
+gst_base_ts_mux_update_zero_copy_pes (GstBaseTsMux * mux)
+{
+  if (mux->tsmux)
+    tsmux_set_zero_copy_pes (mux->tsmux, mux->zero_copy_pes
+        && mux->packet_size == GST_BASE_TS_MUX_NORMAL_PACKET_LENGTH);
+}
+
 /* Takes over the ref on the buffer */
 static StreamData *
 stream_data_new (GstBuffer * buffer)
@@ -342,7 +365,7 @@ gst_base_ts_mux_reset (GstBaseTsMux * mux, gboolean alloc)
     gst_buffer_unref (buf);
 
   gst_event_replace (&mux->force_key_unit_event, NULL);
-  gst_buffer_replace (&mux->out_buffer, NULL);
+  gst_base_ts_mux_clear_slabs (mux);
 
   for (l = GST_ELEMENT (mux)->sinkpads; l; l = l->next) {
     gst_base_ts_mux_pad_reset (GST_BASE_TS_MUX_PAD (l->data));
@@ -352,6 +375,7 @@ gst_base_ts_mux_reset (GstBaseTsMux * mux, gboolean alloc)
     g_assert (klass->create_ts_mux);
 
     mux->tsmux = klass->create_ts_mux (mux);
+    gst_base_ts_mux_update_zero_copy_pes (mux);
 
     /* Preserve user-specified sections across resets */
     if (si_sections)
@@ -873,6 +897,222 @@ new_packet_common_init (GstBaseTsMux * mux, GstBuffer * buf, guint8 * data,
   }
 }
 
+/* A slab is a pool buffer that stays mapped while packets are written into
+ * it. Each packet memory keeps a reference on the slab, the buffer goes back
+ * to the pool when the last packet pointing into it is freed. */
+struct GstBaseTsMuxSlab
+{
+  gint refcount;
+  GstBuffer *buffer;
+  GstMapInfo map;
+  /* bytes already handed out as packets */
+  gsize offset;
+};
+
+static GstBaseTsMuxSlab *
+gst_base_ts_mux_slab_new (GstBuffer * buffer)
+{
+  GstBaseTsMuxSlab *slab = g_slice_new0 (GstBaseTsMuxSlab);
+
+  if (!gst_buffer_map (buffer, &slab->map, GST_MAP_READWRITE)) {
+    gst_buffer_unref (buffer);
+    g_slice_free (GstBaseTsMuxSlab, slab);
+    return NULL;
+  }
+
+  slab->refcount = 1;
+  slab->buffer = buffer;
+  slab->offset = 0;
+
+  return slab;
+}
+
+static GstBaseTsMuxSlab *
+gst_base_ts_mux_slab_ref (GstBaseTsMuxSlab * slab)
+{
+  g_atomic_int_inc (&slab->refcount);
+
+  return slab;
+}
+
+static void
+gst_base_ts_mux_slab_unref (GstBaseTsMuxSlab * slab)
+{
+  if (!g_atomic_int_dec_and_test (&slab->refcount))
+    return;
+
+  gst_buffer_unmap (slab->buffer, &slab->map);
+  /* returns the buffer to the pool */
+  gst_buffer_unref (slab->buffer);
+  g_slice_free (GstBaseTsMuxSlab, slab);
+}
+
+static GstMemory *
+gst_base_ts_mux_slab_wrap (GstBaseTsMuxSlab * slab, gsize offset, gsize size)
+{
+  return gst_memory_new_wrapped (0, slab->map.data + offset, size, 0, size,
+      gst_base_ts_mux_slab_ref (slab),
+      (GDestroyNotify) gst_base_ts_mux_slab_unref);
+}
+
+static gboolean
+gst_base_ts_mux_ensure_slab_pool (GstBaseTsMux * mux)
+{
+  GstStructure *config;
+  gsize slab_packets;
+
+  if (mux->alignment > 0)
+    slab_packets = mux->alignment;
+  else if (mux->alignment < 0 && mux->automatic_alignment > 0)
+    slab_packets = mux->automatic_alignment;
+  else
+    slab_packets = BASETSMUX_DEFAULT_SLAB_PACKETS;
+
+  if (mux->slab_pool && mux->slab_size == slab_packets * mux->packet_size)
+    return TRUE;
+
+  if (mux->slab) {
+    gst_base_ts_mux_slab_unref (mux->slab);
+    mux->slab = NULL;
+  }
+  if (mux->slab_pool) {
+    gst_buffer_pool_set_active (mux->slab_pool, FALSE);
+    gst_object_unref (mux->slab_pool);
+  }
+
+  mux->slab_size = slab_packets * mux->packet_size;
+  mux->slab_pool = gst_buffer_pool_new ();
+
+  config = gst_buffer_pool_get_config (mux->slab_pool);
+  gst_buffer_pool_config_set_params (config, NULL, mux->slab_size, 0, 0);
+  if (!gst_buffer_pool_set_config (mux->slab_pool, config) ||
+      !gst_buffer_pool_set_active (mux->slab_pool, TRUE)) {
+    GST_WARNING_OBJECT (mux, "failed to configure slab pool");
+    gst_object_unref (mux->slab_pool);
+    mux->slab_pool = NULL;
+    return FALSE;
+  }
+
+  GST_DEBUG_OBJECT (mux, "allocating packets in slabs of %" G_GSIZE_FORMAT
+      " packets", slab_packets);
+
+  return TRUE;
+}
+
+/* Writes the next packet into the current slab, getting a new one from the
+ * pool when it is full */
+static GstBuffer *
+gst_base_ts_mux_slab_alloc_packet (GstBaseTsMux * mux)
+{
+  GstBaseTsMuxSlab *slab;
+  GstBuffer *buf;
+
+  if (!gst_base_ts_mux_ensure_slab_pool (mux))
+    return NULL;
+
+  slab = mux->slab;
+  if (slab && slab->offset + mux->packet_size > slab->map.size) {
+    gst_base_ts_mux_slab_unref (slab);
+    slab = mux->slab = NULL;
+  }
+
+  if (!slab) {
+    if (gst_buffer_pool_acquire_buffer (mux->slab_pool, &buf,
+            NULL) != GST_FLOW_OK)
+      return NULL;
+    slab = mux->slab = gst_base_ts_mux_slab_new (buf);
+    if (!slab)
+      return NULL;
+  }
+
+  buf = gst_buffer_new ();
+  gst_buffer_append_memory (buf,
+      gst_base_ts_mux_slab_wrap (slab, slab->offset, mux->packet_size));
+  slab->offset += mux->packet_size;
+
+  return buf;
+}
+
+/* Moves the packets merged into out_buffer to the output adapter as a
+ * single buffer spanning their slab range */
+static void
+gst_base_ts_mux_flush_slab_range (GstBaseTsMux * mux)
+{
+  GstBuffer *buf;
+
+  if (!mux->out_buffer)
+    return;
+
+  if (mux->out_end - mux->out_start > gst_buffer_get_size (mux->out_buffer)) {
+    buf = gst_buffer_new ();
+    gst_buffer_copy_into (buf, mux->out_buffer, GST_BUFFER_COPY_METADATA, 0,
+        -1);
+    gst_buffer_append_memory (buf, gst_base_ts_mux_slab_wrap (mux->out_slab,
+            mux->out_start, mux->out_end - mux->out_start));
+    gst_buffer_unref (mux->out_buffer);
+  } else {
+    buf = mux->out_buffer;
+  }
+  mux->out_buffer = NULL;
+
+  gst_base_ts_mux_slab_unref (mux->out_slab);
+  mux->out_slab = NULL;
+
+  gst_adapter_push (mux->out_adapter, buf);
+}
+
+static void
+gst_base_ts_mux_clear_slabs (GstBaseTsMux * mux)
+{
+  gst_buffer_replace (&mux->out_buffer, NULL);
+  if (mux->out_slab) {
+    gst_base_ts_mux_slab_unref (mux->out_slab);
+    mux->out_slab = NULL;
+  }
+  if (mux->slab) {
+    gst_base_ts_mux_slab_unref (mux->slab);
+    mux->slab = NULL;
+  }
+}
+
+/* Adds the next @size bytes of packets sharing their payload memory to
+ * @list. They are gathered into one buffer when their memories fit in it,
+ * else kept as separate buffers since merging them would copy the payload */
+static void
+gst_base_ts_mux_take_shared_packets (GstBaseTsMux * mux, gsize size,
+    GstBufferList * list)
+{
+  GstBufferList *packets;
+  GstBuffer *buf = NULL;
+  GstClockTime pts;
+  guint i, len, n_mem = 0;
+
+  pts = gst_adapter_prev_pts (mux->out_adapter, NULL);
+  packets = gst_adapter_take_buffer_list (mux->out_adapter, size);
+  len = gst_buffer_list_length (packets);
+
+  for (i = 0; i < len; i++)
+    n_mem += gst_buffer_n_memory (gst_buffer_list_get (packets, i));
+
+  if (n_mem > gst_buffer_get_max_memory ()) {
+    GST_LOG_OBJECT (mux, "%u memories, pushing %u buffers", n_mem, len);
+    for (i = 0; i < len; i++)
+      gst_buffer_list_add (list,
+          gst_buffer_ref (gst_buffer_list_get (packets, i)));
+  } else {
+    for (i = 0; i < len; i++) {
+      GstBuffer *packet = gst_buffer_ref (gst_buffer_list_get (packets, i));
+
+      buf = buf ? gst_buffer_append (buf, packet) : packet;
+    }
+    buf = gst_buffer_make_writable (buf);
+    GST_BUFFER_PTS (buf) = pts;
+    gst_buffer_list_add (list, buf);
+  }
+
+  gst_buffer_list_unref (packets);
+}
+
 static GstFlowReturn
 gst_base_ts_mux_push_packets (GstBaseTsMux * mux, gboolean force)
 {
@@ -880,6 +1120,8 @@ gst_base_ts_mux_push_packets (GstBaseTsMux * mux, gboolean force)
   gint align = mux->alignment;
   gint av, packet_size;
 
+  gst_base_ts_mux_flush_slab_range (mux);
+
   packet_size = mux->packet_size;
 
   if (align < 0)
@@ -910,13 +1152,20 @@ gst_base_ts_mux_push_packets (GstBaseTsMux * mux, gboolean force)
     GstBuffer *buf;
     GstClockTime pts;
 
+    av -= align;
+
+    if (mux->tsmux && mux->tsmux->zero_copy_pes) {
+      gst_base_ts_mux_take_shared_packets (mux, align, buffer_list);
+      continue;
+    }
+
+    /* packets from different slabs are gathered without copying */
     pts = gst_adapter_prev_pts (mux->out_adapter, NULL);
-    buf = gst_adapter_take_buffer (mux->out_adapter, align);
+    buf = gst_adapter_take_buffer_fast (mux->out_adapter, align);
 
     GST_BUFFER_PTS (buf) = pts;
 
     gst_buffer_list_add (buffer_list, buf);
-    av -= align;
   }
 
   if (av > 0 && force) {
@@ -930,20 +1179,30 @@ gst_base_ts_mux_push_packets (GstBaseTsMux * mux, gboolean force)
     GST_LOG_OBJECT (mux, "handling %d leftover bytes", av);
 
     pts = gst_adapter_prev_pts (mux->out_adapter, NULL);
-    buf = gst_buffer_new_and_alloc (align);
 
-    GST_BUFFER_PTS (buf) = pts;
+    if (mux->tsmux && mux->tsmux->zero_copy_pes) {
+      /* Only the null packets are written, in a buffer of their own */
+      gst_base_ts_mux_take_shared_packets (mux, av, buffer_list);
+      buf = gst_buffer_new_and_alloc (align - av);
+      gst_buffer_map (buf, &map, GST_MAP_WRITE);
+      data = map.data;
+      /* Zero-copy is only done for packets without M2TS header */
+      header = 0;
+    } else {
+      buf = gst_buffer_new_and_alloc (align);
+      gst_buffer_map (buf, &map, GST_MAP_WRITE);
+      data = map.data;
 
-    gst_buffer_map (buf, &map, GST_MAP_READ);
-    data = map.data;
+      gst_adapter_copy (mux->out_adapter, data, 0, av);
+      gst_adapter_clear (mux->out_adapter);
 
-    gst_adapter_copy (mux->out_adapter, data, 0, av);
-    gst_adapter_clear (mux->out_adapter);
+      data += av;
+      header = GST_READ_UINT32_BE (data - packet_size);
+    }
 
-    data += av;
-    header = GST_READ_UINT32_BE (data - packet_size);
+    GST_BUFFER_PTS (buf) = pts;
 
-    dummy = (map.size - av) / packet_size;
+    dummy = (map.data + map.size - data) / packet_size;
     GST_LOG_OBJECT (mux, "adding %d null packets", dummy);
 
     for (; dummy > 0; dummy--) {
@@ -974,12 +1233,51 @@ gst_base_ts_mux_push_packets (GstBaseTsMux * mux, gboolean force)
   return gst_aggregator_finish_buffer_list (GST_AGGREGATOR (mux), buffer_list);
 }
 
+#define SLAB_RANGE_FLAGS (GST_BUFFER_FLAG_DELTA_UNIT | GST_BUFFER_FLAG_HEADER)
+
 static GstFlowReturn
 gst_base_ts_mux_collect_packet (GstBaseTsMux * mux, GstBuffer * buf)
 {
+  GstBaseTsMuxSlab *slab = mux->slab;
+  gboolean in_slab = FALSE;
+  gsize offset = 0, size = 0;
+  GstMapInfo map;
+
   GST_LOG_OBJECT (mux, "collecting packet size %" G_GSIZE_FORMAT,
       gst_buffer_get_size (buf));
-  gst_adapter_push (mux->out_adapter, buf);
+
+  /* Packets written back to back into the current slab are merged into one
+   * buffer, as long as their flags do not differ */
+  if (slab && gst_buffer_n_memory (buf) == 1
+      && gst_buffer_map (buf, &map, GST_MAP_READ)) {
+    if (map.data >= slab->map.data
+        && map.data + map.size <= slab->map.data + slab->offset) {
+      in_slab = TRUE;
+      offset = map.data - slab->map.data;
+      size = map.size;
+    }
+    gst_buffer_unmap (buf, &map);
+  }
+
+  if (in_slab && mux->out_buffer && mux->out_slab == slab
+      && offset == mux->out_end
+      && (GST_BUFFER_FLAGS (buf) & SLAB_RANGE_FLAGS) ==
+      (GST_BUFFER_FLAGS (mux->out_buffer) & SLAB_RANGE_FLAGS)) {
+    mux->out_end += size;
+    gst_buffer_unref (buf);
+    return GST_FLOW_OK;
+  }
+
+  gst_base_ts_mux_flush_slab_range (mux);
+
+  if (in_slab) {
+    mux->out_buffer = buf;
+    mux->out_slab = gst_base_ts_mux_slab_ref (slab);
+    mux->out_start = offset;
+    mux->out_end = offset + size;
+  } else {
+    gst_adapter_push (mux->out_adapter, buf);
+  }
 
   return GST_FLOW_OK;
 }
@@ -1042,11 +1340,15 @@ new_packet_cb (GstBuffer * buf, void *user_data, gint64 new_pcr)
 {
   GstBaseTsMux *mux = (GstBaseTsMux *) user_data;
   GstBaseTsMuxClass *klass = GST_BASE_TS_MUX_GET_CLASS (mux);
+  GstMemory *mem;
   GstMapInfo map;
 
   g_assert (klass->output_packet);
 
-  gst_buffer_map (buf, &map, GST_MAP_READWRITE);
+  /* Only the packet header is needed here, mapping the whole buffer would
+   * merge the memories of packets that share their payload */
+  mem = gst_buffer_peek_memory (buf, 0);
+  gst_memory_map (mem, &map, GST_MAP_READ);
 
   if (!GST_CLOCK_TIME_IS_VALID (GST_BUFFER_PTS (buf)))
     GST_BUFFER_PTS (buf) = mux->last_ts;
@@ -1054,7 +1356,7 @@ new_packet_cb (GstBuffer * buf, void *user_data, gint64 new_pcr)
   /* do common init (flags and streamheaders) */
   new_packet_common_init (mux, buf, map.data, map.size);
 
-  gst_buffer_unmap (buf, &map);
+  gst_memory_unmap (mem, &map);
 
   return klass->output_packet (mux, buf, new_pcr);
 }
@@ -1222,8 +1524,9 @@ gst_base_ts_mux_aggregate_buffer (GstBaseTsMux * mux,
   GST_DEBUG_OBJECT (mux, "delta: %d", delta);
 
   stream_data = stream_data_new (buf);
-  tsmux_stream_add_data (best->stream, stream_data->map_info.data,
-      stream_data->map_info.size, stream_data, pts, dts, !delta);
+  tsmux_stream_add_buffer (best->stream, stream_data->buffer,
+      stream_data->map_info.data, stream_data->map_info.size, stream_data,
+      pts, dts, !delta);
 
   /* outgoing ts follows ts of PCR program stream */
   if (prog->pcr_stream == best->stream) {
@@ -1235,22 +1538,27 @@ gst_base_ts_mux_aggregate_buffer (GstBaseTsMux * mux,
 
   mux->is_delta = delta;
   mux->is_header = header;
-  while (tsmux_stream_bytes_in_buffer (best->stream) > 0) {
-    if (!tsmux_write_stream_packet (mux->tsmux, best->stream)) {
-      /* Failed writing data for some reason. Set appropriate error */
-      GST_DEBUG_OBJECT (mux, "Failed to write data packet");
-      GST_ELEMENT_ERROR (mux, STREAM, MUX,
-          ("Failed writing output data to stream %04x", best->stream->id),
-          (NULL));
-      goto write_fail;
+  if (mux->tsmux->bitrate) {
+    /* at constant bitrate the packets of all streams are interleaved */
+    if (!tsmux_write_scheduled_packets (mux->tsmux, FALSE))
+      goto write_error;
+  } else {
+    while (tsmux_stream_bytes_in_buffer (best->stream) > 0) {
+      if (!tsmux_write_stream_packet (mux->tsmux, best->stream))
+        goto write_error;
     }
   }
   /* flush packet cache */
   return gst_base_ts_mux_push_packets (mux, FALSE);
 
   /* ERRORS */
-write_fail:
+write_error:
   {
+    /* Failed writing data for some reason. Set appropriate error */
+    GST_DEBUG_OBJECT (mux, "Failed to write data packet");
+    GST_ELEMENT_ERROR (mux, STREAM, MUX,
+        ("Failed writing output data to stream %04x", best->stream->id),
+        (NULL));
     return mux->last_flow_ret;
   }
 }
@@ -1691,6 +1999,16 @@ gst_base_ts_mux_aggregate (GstAggregator * agg, gboolean timeout)
 
   if (gst_base_ts_mux_are_all_pads_eos (mux)) {
     GstBaseTsMuxClass *klass = GST_BASE_TS_MUX_GET_CLASS (mux);
+
+    /* write the data still held back by the constant bitrate schedule */
+    if (mux->tsmux->bitrate
+        && !tsmux_write_scheduled_packets (mux->tsmux, TRUE)) {
+      GST_ELEMENT_ERROR (mux, STREAM, MUX,
+          ("Failed writing output data"), (NULL));
+      ret = GST_FLOW_ERROR;
+      goto done;
+    }
+
     /* drain some possibly cached data */
     if (klass->drain)
       klass->drain (mux);
@@ -1732,6 +2050,11 @@ gst_base_ts_mux_dispose (GObject * object)
     g_object_unref (mux->out_adapter);
     mux->out_adapter = NULL;
   }
+  if (mux->slab_pool) {
+    gst_buffer_pool_set_active (mux->slab_pool, FALSE);
+    gst_object_unref (mux->slab_pool);
+    mux->slab_pool = NULL;
+  }
   if (mux->prog_map) {
     gst_structure_free (mux->prog_map);
     mux->prog_map = NULL;
@@ -1811,6 +2134,10 @@ gst_base_ts_mux_set_property (GObject * object, guint prop_id,
     case PROP_SCTE_35_NULL_INTERVAL:
       mux->scte35_null_interval = g_value_get_uint (value);
       break;
+    case PROP_ZERO_COPY_PES:
+      mux->zero_copy_pes = g_value_get_boolean (value);
+      gst_base_ts_mux_update_zero_copy_pes (mux);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1851,6 +2178,9 @@ gst_base_ts_mux_get_property (GObject * object, guint prop_id,
     case PROP_SCTE_35_NULL_INTERVAL:
       g_value_set_uint (value, mux->scte35_null_interval);
       break;
+    case PROP_ZERO_COPY_PES:
+      g_value_set_boolean (value, mux->zero_copy_pes);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1876,7 +2206,9 @@ gst_base_ts_mux_default_allocate_packet (GstBaseTsMux * mux,
 {
   GstBuffer *buf;
 
-  buf = gst_buffer_new_and_alloc (mux->packet_size);
+  buf = gst_base_ts_mux_slab_alloc_packet (mux);
+  if (!buf)
+    buf = gst_buffer_new_and_alloc (mux->packet_size);
 
   *buffer = buf;
 }
@@ -1896,6 +2228,7 @@ void
 gst_base_ts_mux_set_packet_size (GstBaseTsMux * mux, gsize size)
 {
   mux->packet_size = size;
+  gst_base_ts_mux_update_zero_copy_pes (mux);
 }
 
 void
@@ -2000,6 +2333,14 @@ gst_base_ts_mux_class_init (GstBaseTsMuxClass * klass)
           TSMUX_DEFAULT_SCTE_35_NULL_INTERVAL,
           (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 
+  g_object_class_install_property (G_OBJECT_CLASS (klass),
+      PROP_ZERO_COPY_PES, g_param_spec_boolean ("zero-copy-pes",
+          "Zero-copy PES",
+          "Output packets referencing the input buffer memory instead of "
+          "copying the elementary stream data (only for 188 byte packets)",
+          BASETSMUX_DEFAULT_ZERO_COPY_PES,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
   gst_element_class_add_static_pad_template_with_gtype (gstelement_class,
       &gst_base_ts_mux_src_factory, GST_TYPE_AGGREGATOR_PAD);
 
@@ -2021,6 +2362,7 @@ gst_base_ts_mux_init (GstBaseTsMux * mux)
   mux->bitrate = TSMUX_DEFAULT_BITRATE;
   mux->scte35_pid = DEFAULT_SCTE_35_PID;
   mux->scte35_null_interval = TSMUX_DEFAULT_SCTE_35_NULL_INTERVAL;
+  mux->zero_copy_pes = BASETSMUX_DEFAULT_ZERO_COPY_PES;
 
   mux->packet_size = GST_BASE_TS_MUX_NORMAL_PACKET_LENGTH;
   mux->automatic_alignment = 0;
@@ -111,6 +111,7 @@ typedef struct _GstBaseTsMuxPadPrivate GstBaseTsMuxPadPrivate;
 typedef struct GstBaseTsMux GstBaseTsMux;
 typedef struct GstBaseTsMuxClass GstBaseTsMuxClass;
 typedef struct GstBaseTsPadData GstBaseTsPadData;
+typedef struct GstBaseTsMuxSlab GstBaseTsMuxSlab;
 
 typedef GstBuffer * (*GstBaseTsMuxPadPrepareFunction) (GstBuffer * buf,
     GstBaseTsMuxPad * data, GstBaseTsMux * mux);
@@ -176,6 +177,7 @@ struct GstBaseTsMux {
   guint pcr_interval;
   guint scte35_pid;
   guint scte35_null_interval;
+  gboolean zero_copy_pes;
   
   /* state */
   gboolean first;
@@ -197,6 +199,15 @@ struct GstBaseTsMux {
   /* output buffer aggregation */
   GstAdapter *out_adapter;
   GstBuffer *out_buffer;
+
+  /* packets are carved out of slabs from this pool */
+  GstBufferPool *slab_pool;
+  gsize slab_size;
+  GstBaseTsMuxSlab *slab;
+  /* slab range of the packets merged into out_buffer */
+  GstBaseTsMuxSlab *out_slab;
+  gsize out_start;
+  gsize out_end;
 };
 
 /**
@@ -208,7 +219,8 @@ struct GstBaseTsMux {
  *                 @media_type (eg. video/x-h264).
  * @allocate_packet: Optional.
  *                 Called when the underlying #TsMux object needs a packet
- *                 to write into.
+ *                 to write into. The default implementation carves packets
+ *                 out of pooled slabs of several packets.
  * @output_packet: Optional.
  *                 Called when the underlying #TsMux object has a packet
  *                 ready to output.
@@ -113,9 +113,21 @@
 static gboolean tsmux_write_pat (TsMux * mux);
 static gboolean tsmux_write_pmt (TsMux * mux, TsMuxProgram * program);
 static gboolean tsmux_write_scte_null (TsMux * mux, TsMuxProgram * program);
+/* Drop the cached packets of @section, to be called whenever the
+ * section is replaced */
+static void
+tsmux_section_invalidate (TsMuxSection * section)
+{
+  if (section->packets) {
+    g_byte_array_unref (section->packets);
+    section->packets = NULL;
+  }
+}
+
 static void
 tsmux_section_free (TsMuxSection * section)
 {
+  tsmux_section_invalidate (section);
   gst_mpegts_section_unref (section->section);
   g_slice_free (TsMuxSection, section);
 }
@@ -380,6 +392,7 @@ tsmux_free (TsMux * mux)
   g_return_if_fail (mux != NULL);
 
   /* Free PAT section */
+  tsmux_section_invalidate (&mux->pat);
   if (mux->pat.section)
     gst_mpegts_section_unref (mux->pat.section);
 
@@ -707,6 +720,8 @@ tsmux_create_stream (TsMux * mux, guint stream_type, guint16 pid,
   mux->streams = g_list_prepend (mux->streams, stream);
   mux->nb_streams++;
 
+  tsmux_stream_set_tstd (stream, mux->bitrate != 0);
+
   if (language) {
     strncpy (stream->language, language, 4);
     stream->language[3] = 0;
@@ -800,9 +815,18 @@ tsmux_packet_out (TsMux * mux, GstBuffer * buf, gint64 pcr)
     return TRUE;
   }
 
-  if (mux->bitrate)
-    GST_BUFFER_PTS (buf) =
+  /* Each packet goes out at the time of its constant-rate slot, on the
+   * timeline of the input timestamps the PCR is derived from */
+  if (mux->bitrate) {
+    GstClockTime origin = 0;
+
+    if (mux->first_pcr_ts != G_MININT64 && mux->first_pcr_ts > CLOCK_BASE)
+      origin = gst_util_uint64_scale (mux->first_pcr_ts - CLOCK_BASE,
+          GST_SECOND, TSMUX_CLOCK_FREQ);
+
+    GST_BUFFER_PTS (buf) = origin +
         gst_util_uint64_scale (mux->n_bytes * 8, GST_SECOND, mux->bitrate);
+  }
 
   mux->n_bytes += gst_buffer_get_size (buf);
 
@@ -1057,26 +1081,18 @@ tsmux_write_ts_header (TsMux * mux, guint8 * buf, TsMuxPacketInfo * pi,
   return TRUE;
 }
 
-/* The unused_arg is needed for g_hash_table_foreach() */
+/* Packetize @section into section->packets. The continuity counters are
+ * left blank, they are filled in each time the packets are written */
 static gboolean
-tsmux_section_write_packet (gpointer unused_arg,
-    TsMuxSection * section, TsMux * mux)
+tsmux_section_packetize (TsMux * mux, TsMuxSection * section)
 {
-  GstBuffer *section_buffer;
-  GstBuffer *packet_buffer = NULL;
-  GstMemory *mem;
-  guint8 *packet;
-  guint8 *data;
+  TsMuxPacketInfo *pi = &section->pi;
+  guint8 counter = mux->pid_packet_counts[pi->pid];
+  GByteArray *packets;
+  guint8 *data, *packet;
   gsize data_size = 0;
-  gsize payload_written;
-  guint len = 0, offset = 0, payload_len = 0;
-  guint extra_alloc_bytes = 0;
-
-  g_return_val_if_fail (section != NULL, FALSE);
-  g_return_val_if_fail (mux != NULL, FALSE);
-
-  /* Mark the start of new PES unit */
-  section->pi.packet_start_unit_indicator = TRUE;
+  gsize payload_written = 0;
+  guint len, offset, payload_len;
 
   data = gst_mpegts_section_packetize (section->section, &data_size);
 
@@ -1085,106 +1101,89 @@ tsmux_section_write_packet (gpointer unused_arg,
     return FALSE;
   }
 
-  /* Mark payload data size */
-  section->pi.stream_avail = data_size;
-  payload_written = 0;
-
-  /* Wrap section data in a buffer without free function.
-     The data will be freed when the GstMpegtsSection is destroyed. */
-  section_buffer = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
-      data, data_size, 0, data_size, NULL, NULL);
+  packets = g_byte_array_sized_new (TSMUX_PACKET_LENGTH *
+      ((data_size + TSMUX_PAYLOAD_LENGTH) / TSMUX_PAYLOAD_LENGTH));
 
-  TS_DEBUG ("Section buffer with size %" G_GSIZE_FORMAT " created",
-      gst_buffer_get_size (section_buffer));
+  /* Mark the start of new PES unit, with room for a pointer byte */
+  pi->packet_start_unit_indicator = TRUE;
+  pi->stream_avail = data_size + 1;
 
-  while (section->pi.stream_avail > 0) {
+  while (pi->stream_avail > 0) {
+    g_byte_array_set_size (packets, packets->len + TSMUX_PACKET_LENGTH);
+    packet = packets->data + packets->len - TSMUX_PACKET_LENGTH;
 
-    packet = g_malloc (TSMUX_PACKET_LENGTH);
-
-    if (section->pi.packet_start_unit_indicator) {
-      /* Wee need room for a pointer byte */
-      section->pi.stream_avail++;
-
-      if (!tsmux_write_ts_header (mux, packet, &section->pi, &len, &offset,
-              section->pi.stream_avail))
-        goto fail;
+    if (!tsmux_write_ts_header (mux, packet, pi, &len, &offset,
+            pi->stream_avail))
+      goto fail;
+    packet[3] &= 0xf0;
 
+    payload_len = len;
+    if (pi->packet_start_unit_indicator) {
       /* Write the pointer byte */
       packet[offset++] = 0x00;
-      payload_len = len - 1;
-
-    } else {
-      if (!tsmux_write_ts_header (mux, packet, &section->pi, &len, &offset,
-              section->pi.stream_avail))
-        goto fail;
-      payload_len = len;
+      payload_len--;
     }
 
-    /* Wrap the TS header and adaption field in a GstMemory */
-    mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
-        packet, TSMUX_PACKET_LENGTH, 0, offset, packet, g_free);
-
-    TS_DEBUG ("Creating packet buffer at offset "
-        "%" G_GSIZE_FORMAT " with length %u", payload_written, payload_len);
-
-    /* If in M2TS mode, we will need to resize to 4 bytes after the end
-       of the buffer. For performance reasons, we will now try to include
-       4 extra bytes from the source buffer, then resize down, to avoid
-       having an extra 4 byte GstMemory appended. If the source buffer
-       does not have enough data for this, a new GstMemory will be used */
-    if (gst_buffer_get_size (section_buffer) - (payload_written +
-            payload_len) >= 4) {
-      /* enough space */
-      extra_alloc_bytes = 4;
-    } else {
-      extra_alloc_bytes = 0;
-    }
-    packet_buffer = gst_buffer_copy_region (section_buffer, GST_BUFFER_COPY_ALL,
-        payload_written, payload_len + extra_alloc_bytes);
-
-    /* Prepend the header to the section data */
-    gst_buffer_prepend_memory (packet_buffer, mem);
-
-    /* add an extra 4 bytes if it could not be reserved already */
-    if (extra_alloc_bytes == 4) {
-      /* we allocated those already, resize */
-      gst_buffer_set_size (packet_buffer,
-          gst_buffer_get_size (packet_buffer) - extra_alloc_bytes);
-    } else {
-      void *ptr = g_malloc (4);
-      GstMemory *extra =
-          gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, ptr, 4, 0, 0, ptr,
-          g_free);
-      gst_buffer_append_memory (packet_buffer, extra);
-    }
-
-    TS_DEBUG ("Writing %d bytes to section. %d bytes remaining",
-        len, section->pi.stream_avail - len);
-
-    /* Push the packet without PCR */
-    if (G_UNLIKELY (!tsmux_packet_out (mux, packet_buffer, -1))) {
-      /* Buffer given away */
-      packet_buffer = NULL;
-      goto fail;
-    }
+    memcpy (packet + offset, data + payload_written, payload_len);
 
-    packet_buffer = NULL;
-    section->pi.stream_avail -= len;
+    pi->stream_avail -= len;
     payload_written += payload_len;
-    section->pi.packet_start_unit_indicator = FALSE;
+    pi->packet_start_unit_indicator = FALSE;
   }
 
-  gst_buffer_unref (section_buffer);
+  TS_DEBUG ("Section of %" G_GSIZE_FORMAT " bytes packetized into %u packets",
+      data_size, packets->len / TSMUX_PACKET_LENGTH);
+
+  /* The counters are advanced when the packets are actually written */
+  mux->pid_packet_counts[pi->pid] = counter;
+  section->packets = packets;
 
   return TRUE;
 
 fail:
-  g_free (packet);
-  if (section_buffer)
-    gst_buffer_unref (section_buffer);
+  mux->pid_packet_counts[pi->pid] = counter;
+  g_byte_array_unref (packets);
   return FALSE;
 }
 
+/* The unused_arg is needed for g_hash_table_foreach() */
+static gboolean
+tsmux_section_write_packet (gpointer unused_arg,
+    TsMuxSection * section, TsMux * mux)
+{
+  guint i;
+
+  g_return_val_if_fail (section != NULL, FALSE);
+  g_return_val_if_fail (mux != NULL, FALSE);
+
+  /* Sections are only packetized again once they changed, repeating
+   * them only takes to copy the packets and set the continuity counters */
+  if (!section->packets && !tsmux_section_packetize (mux, section))
+    return FALSE;
+
+  for (i = 0; i < section->packets->len; i += TSMUX_PACKET_LENGTH) {
+    GstBuffer *packet_buffer = NULL;
+    GstMapInfo map;
+    guint8 counter;
+
+    if (!tsmux_get_buffer (mux, &packet_buffer))
+      return FALSE;
+
+    counter = ++mux->pid_packet_counts[section->pi.pid];
+
+    gst_buffer_map (packet_buffer, &map, GST_MAP_WRITE);
+    memcpy (map.data, section->packets->data + i, TSMUX_PACKET_LENGTH);
+    map.data[3] |= counter & 0x0f;
+    gst_buffer_unmap (packet_buffer, &map);
+
+    /* Push the packet without PCR */
+    if (G_UNLIKELY (!tsmux_packet_out (mux, packet_buffer, -1)))
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
 /**
  * tsmux_send_section:
  * @mux: a #TsMux
@@ -1212,6 +1211,7 @@ tsmux_send_section (TsMux * mux, GstMpegtsSection * section)
   tsmux_section.pi.pid = section->pid;
 
   ret = tsmux_section_write_packet (NULL, &tsmux_section, mux);
+  tsmux_section_invalidate (&tsmux_section);
   gst_mpegts_section_unref (section);
 
   return ret;
@@ -1386,75 +1386,172 @@ rewrite_si (TsMux * mux, gint64 cur_ts)
   return TRUE;
 }
 
+/* Find a PCR stream, other than @skip, whose next PCR is due at @cur_pcr */
+static TsMuxStream *
+find_due_pcr_stream (TsMux * mux, TsMuxStream * skip, gint64 cur_pcr)
+{
+  GList *cur;
+
+  for (cur = mux->programs; cur; cur = cur->next) {
+    TsMuxProgram *program = (TsMuxProgram *) cur->data;
+    TsMuxStream *stream = program->pcr_stream;
+
+    if (stream == NULL || stream == skip)
+      continue;
+
+    if (stream->next_pcr == -1 || cur_pcr > stream->next_pcr)
+      return stream;
+  }
+
+  return NULL;
+}
+
+/* Fill the current constant-rate slot with an adaptation field only packet
+ * carrying the PCR of @pcr_stream, or with a null packet if @pcr_stream is
+ * NULL */
 static gboolean
-pad_stream (TsMux * mux, TsMuxStream * stream, gint64 cur_ts)
+write_filler_packet (TsMux * mux, TsMuxStream * pcr_stream, gint64 cur_pcr)
 {
-  guint64 bitrate;
   GstBuffer *buf = NULL;
   GstMapInfo map;
-  gboolean ret = TRUE;
-
-  if (!mux->bitrate)
-    goto done;
+  gint64 new_pcr = -1;
 
-  do {
-    if (GST_CLOCK_STIME_IS_VALID (cur_ts)) {
-      GstClockTimeDiff diff;
+  if (!tsmux_get_buffer (mux, &buf))
+    return FALSE;
 
-      if (!GST_CLOCK_STIME_IS_VALID (stream->first_ts))
-        stream->first_ts = cur_ts;
+  gst_buffer_map (buf, &map, GST_MAP_WRITE);
+
+  if (pcr_stream) {
+    TsMuxPacketInfo *pi = &pcr_stream->pi;
+    guint32 flags = pi->flags;
+    gboolean pusi = pi->packet_start_unit_indicator;
+    guint payload_len, payload_offs;
+
+    new_pcr = write_new_pcr (mux, pcr_stream, cur_pcr);
+    /* don't burst PCRs after a gap, resume the regular interval from here */
+    if (pcr_stream->next_pcr < cur_pcr)
+      pcr_stream->next_pcr = cur_pcr + mux->pcr_interval * 300;
+
+    pi->flags = TSMUX_PACKET_FLAG_ADAPTATION | TSMUX_PACKET_FLAG_WRITE_PCR;
+    pi->packet_start_unit_indicator = FALSE;
+    tsmux_write_ts_header (mux, map.data, pi, &payload_len, &payload_offs,
+        0);
+    pi->flags = flags;
+    pi->packet_start_unit_indicator = pusi;
+  } else {
+    tsmux_write_null_ts_header (map.data);
+    memset (map.data + TSMUX_HEADER_LENGTH, 0xff, TSMUX_PAYLOAD_LENGTH);
+  }
 
-      diff = GST_CLOCK_DIFF (stream->first_ts, cur_ts);
+  gst_buffer_unmap (buf, &map);
 
-      if (diff) {
-        bitrate =
-            gst_util_uint64_scale (mux->n_bytes * 8, TSMUX_CLOCK_FREQ, diff);
+  return tsmux_packet_out (mux, buf, new_pcr);
+}
 
-        GST_LOG ("Transport stream bitrate: %" G_GUINT64_FORMAT, bitrate);
+/**
+ * tsmux_write_scheduled_packets:
+ * @mux: a #TsMux
+ * @drain: whether all the remaining data has to be written
+ *
+ * Write the data queued in the streams of @mux at its constant bitrate.
+ * Every packet takes the next slot of the constant-rate output, so the PCR
+ * of each packet follows from its position. A slot goes to the stream with
+ * the earliest DTS among those whose next data is due, which is
+ * TSMUX_PCR_OFFSET ahead of its DTS, and whose T-STD buffer can take a
+ * packet. Slots no stream can take carry SI, the PCRs that became due or
+ * null packets.
+ *
+ * Unless @drain is set, data that is only held back by a full T-STD buffer
+ * is left queued while input that is still to come could be due at the
+ * current slot, so that other streams can take it.
+ *
+ * Returns: TRUE if the packets could be written.
+ */
+gboolean
+tsmux_write_scheduled_packets (TsMux * mux, gboolean drain)
+{
+  g_return_val_if_fail (mux != NULL, FALSE);
+  g_return_val_if_fail (mux->bitrate != 0, FALSE);
 
-        if (bitrate < mux->bitrate) {
-          gint64 new_pcr;
-          guint payload_len, payload_offs;
+  while (TRUE) {
+    TsMuxStream *best = NULL, *pcr_stream;
+    gint64 best_ts = G_MAXINT64, first_ts = G_MAXINT64, last_ts = G_MININT64;
+    gint64 cur_ts, cur_pcr;
+    gboolean pending = FALSE;
+    GList *cur;
 
-          GST_LOG ("Padding transport stream");
+    for (cur = mux->streams; cur; cur = cur->next) {
+      TsMuxStream *stream = (TsMuxStream *) cur->data;
+      gint64 ts;
 
-          if (!rewrite_si (mux, cur_ts)) {
-            ret = FALSE;
-            goto done;
-          }
+      if (tsmux_stream_bytes_in_buffer (stream) == 0)
+        continue;
 
-          if (!tsmux_get_buffer (mux, &buf)) {
-            ret = FALSE;
-            goto done;
-          }
+      pending = TRUE;
+      ts = tsmux_stream_get_next_ts (stream);
+      if (ts != G_MININT64)
+        first_ts = MIN (first_ts, ts);
+      last_ts = MAX (last_ts, tsmux_stream_get_last_ts (stream));
+    }
 
-          gst_buffer_map (buf, &map, GST_MAP_READ);
+    if (!pending)
+      return TRUE;
 
-          if ((new_pcr =
-                  write_new_pcr (mux, stream, get_current_pcr (mux,
-                          cur_ts)) != -1))
-            tsmux_write_ts_header (mux, map.data, &stream->pi, &payload_len,
-                &payload_offs, 0);
-          else
-            tsmux_write_null_ts_header (map.data);
+    cur_ts = first_ts != G_MAXINT64 ? CLOCK_BASE + first_ts : CLOCK_BASE;
+    if (!rewrite_si (mux, cur_ts))
+      return FALSE;
+    cur_pcr = get_current_pcr (mux, cur_ts);
 
-          gst_buffer_unmap (buf, &map);
+    for (cur = mux->streams; cur; cur = cur->next) {
+      TsMuxStream *stream = (TsMuxStream *) cur->data;
+      gint64 ts;
+
+      if (tsmux_stream_bytes_in_buffer (stream) == 0)
+        continue;
+
+      /* data without any timestamp goes out whenever a slot is free */
+      ts = tsmux_stream_get_next_ts (stream);
+      if (ts == G_MININT64)
+        ts = G_MAXINT64;
+      else if (cur_pcr < ts_to_pcr (CLOCK_BASE + ts))
+        continue;
+
+      tsmux_stream_tstd_update (stream, cur_pcr / 300 - CLOCK_BASE);
+      if (tsmux_stream_tstd_is_full (stream, TSMUX_PAYLOAD_LENGTH)) {
+        GST_LOG ("T-STD buffer of PID 0x%04x full (%u bytes), delaying",
+            stream->pi.pid, stream->tstd_fullness);
+        continue;
+      }
 
-          stream->pi.flags &= TSMUX_PACKET_FLAG_PES_FULL_HEADER;
+      if (best == NULL || ts < best_ts) {
+        best = stream;
+        best_ts = ts;
+      }
+    }
 
-          if (!(ret = tsmux_packet_out (mux, buf, new_pcr)))
-            goto done;
-        }
-      } else {
-        break;
+    if (best) {
+      while ((pcr_stream = find_due_pcr_stream (mux, best, cur_pcr))) {
+        if (!write_filler_packet (mux, pcr_stream, cur_pcr))
+          return FALSE;
+        cur_pcr = get_current_pcr (mux, cur_ts);
       }
-    } else {
-      break;
+
+      if (!tsmux_write_stream_packet (mux, best))
+        return FALSE;
+
+      continue;
     }
-  } while (bitrate < mux->bitrate);
 
-done:
-  return ret;
+    /* Input comes in DTS order, so the data still to come can only be due
+     * at this slot if the last queued one is */
+    if (!drain && last_ts != G_MININT64
+        && cur_pcr >= ts_to_pcr (CLOCK_BASE + last_ts))
+      return TRUE;
+
+    pcr_stream = find_due_pcr_stream (mux, NULL, cur_pcr);
+    if (!write_filler_packet (mux, pcr_stream, cur_pcr))
+      return FALSE;
+  }
 }
 
 /**
@@ -1473,26 +1570,25 @@ tsmux_write_stream_packet (TsMux * mux, TsMuxStream * stream)
   TsMuxPacketInfo *pi = &stream->pi;
   gboolean res;
   gint64 new_pcr = -1;
+  gint64 cur_ts = G_MININT64;
   GstBuffer *buf = NULL;
   GstMapInfo map;
 
   g_return_val_if_fail (mux != NULL, FALSE);
   g_return_val_if_fail (stream != NULL, FALSE);
 
-  if (tsmux_stream_is_pcr (stream)) {
-    gint64 cur_ts = CLOCK_BASE;
+  if (tsmux_stream_get_dts (stream) != G_MININT64)
+    cur_ts = CLOCK_BASE + tsmux_stream_get_dts (stream);
+  else if (tsmux_stream_get_pts (stream) != G_MININT64)
+    cur_ts = CLOCK_BASE + tsmux_stream_get_pts (stream);
 
-    if (tsmux_stream_get_dts (stream) != G_MININT64)
-      cur_ts += tsmux_stream_get_dts (stream);
-    else
-      cur_ts += tsmux_stream_get_pts (stream);
+  if (tsmux_stream_is_pcr (stream)) {
+    if (cur_ts == G_MININT64)
+      cur_ts = CLOCK_BASE;
 
     if (!rewrite_si (mux, cur_ts))
       goto fail;
 
-    if (!pad_stream (mux, stream, cur_ts))
-      goto fail;
-
     new_pcr = write_new_pcr (mux, stream, get_current_pcr (mux, cur_ts));
   }
 
@@ -1516,11 +1612,27 @@ tsmux_write_stream_packet (TsMux * mux, TsMuxStream * stream)
           pi->stream_avail))
     goto fail;
 
+  if (mux->zero_copy_pes) {
+    GstBuffer *payload = gst_buffer_new ();
+    guint header_len;
 
-  if (!tsmux_stream_get_data (stream, map.data + payload_offs, payload_len))
-    goto fail;
+    /* The packet keeps the TS header, any adaptation field stuffing and the
+     * PES header, followed by memory shared with the input buffers */
+    if (!tsmux_stream_get_data_shared (stream, map.data + payload_offs,
+            payload_len, payload, &header_len)) {
+      gst_buffer_unref (payload);
+      goto fail;
+    }
 
-  gst_buffer_unmap (buf, &map);
+    gst_buffer_unmap (buf, &map);
+    gst_buffer_resize (buf, 0, payload_offs + header_len);
+    buf = gst_buffer_append (buf, payload);
+  } else {
+    if (!tsmux_stream_get_data (stream, map.data + payload_offs, payload_len))
+      goto fail;
+
+    gst_buffer_unmap (buf, &map);
+  }
 
   GST_DEBUG ("Writing PES of size %d", (int) gst_buffer_get_size (buf));
   res = tsmux_packet_out (mux, buf, new_pcr);
@@ -1554,6 +1666,7 @@ tsmux_program_free (TsMuxProgram * program)
   g_return_if_fail (program != NULL);
 
   /* Free PMT section */
+  tsmux_section_invalidate (&program->pmt);
   if (program->pmt.section)
     gst_mpegts_section_unref (program->pmt.section);
   if (program->scte35_null_section)
@@ -1592,6 +1705,7 @@ tsmux_write_pat (TsMux * mux)
       g_ptr_array_add (pat, pat_pgm);
     }
 
+    tsmux_section_invalidate (&mux->pat);
     if (mux->pat.section)
       gst_mpegts_section_unref (mux->pat.section);
 
@@ -1696,6 +1810,7 @@ tsmux_write_pmt (TsMux * mux, TsMuxProgram * program)
     program->pmt.pi.pid = program->pmt_pid;
     program->pmt_changed = FALSE;
 
+    tsmux_section_invalidate (&program->pmt);
     if (program->pmt.section)
       gst_mpegts_section_unref (program->pmt.section);
 
@@ -1714,8 +1829,38 @@ tsmux_write_scte_null (TsMux * mux, TsMuxProgram * program)
   return tsmux_section_write_packet (NULL, program->scte35_null_section, mux);
 }
 
+/**
+ * tsmux_set_bitrate:
+ * @mux: a #TsMux
+ * @bitrate: the constant bitrate in bits per second, or 0
+ *
+ * Set the multiplex-wide constant bitrate. When non-zero, packets are
+ * scheduled into constant-rate slots, the T-STD buffers of the streams are
+ * modelled and null packets fill the slots no stream can use.
+ */
 void
 tsmux_set_bitrate (TsMux * mux, guint64 bitrate)
 {
+  GList *cur;
+
   mux->bitrate = bitrate;
+
+  for (cur = mux->streams; cur; cur = cur->next)
+    tsmux_stream_set_tstd ((TsMuxStream *) cur->data, bitrate != 0);
+}
+
+/**
+ * tsmux_set_zero_copy_pes:
+ * @mux: a #TsMux
+ * @zero_copy: whether to share PES payload memory
+ *
+ * When @zero_copy is set, stream packets are made of the memory the TS and
+ * PES headers are written to, followed by memory shared with the buffers
+ * added with tsmux_stream_add_buffer(), instead of a single memory the
+ * payload is copied into.
+ */
+void
+tsmux_set_zero_copy_pes (TsMux * mux, gboolean zero_copy)
+{
+  mux->zero_copy_pes = zero_copy;
 }
@@ -107,6 +107,10 @@ typedef TsMuxStream * (*TsMuxNewStreamFunc) (guint16 new_pid, guint stream_type,
 struct TsMuxSection {
   TsMuxPacketInfo pi;
   GstMpegtsSection *section;
+
+  /* TS packets of @section, with blank continuity counters, reused
+   * until the section changes */
+  GByteArray *packets;
 };
 
 /* Information for the streams associated with one program */
@@ -198,6 +202,9 @@ struct TsMux {
   guint64 bitrate;
   guint64 n_bytes;
 
+  /* share PES payload memory into the packets instead of copying it */
+  gboolean zero_copy_pes;
+
   /* For the per-PID continuity counter */
   guint8 pid_packet_counts[8192];
 
@@ -217,6 +224,7 @@ guint 		tsmux_get_pat_interval          (TsMux *mux);
 void 		tsmux_resend_pat                (TsMux *mux);
 guint16		tsmux_get_new_pid 		(TsMux *mux);
 void    tsmux_set_bitrate       (TsMux *mux, guint64 bitrate);
+void    tsmux_set_zero_copy_pes (TsMux *mux, gboolean zero_copy);
 
 /* pid/program management */
 TsMuxProgram *	tsmux_program_new 		(TsMux *mux, gint prog_id);
@@ -250,6 +258,7 @@ void    tsmux_set_pcr_interval (TsMux * mux, guint freq);
 
 /* writing stuff */
 gboolean 	tsmux_write_stream_packet 	(TsMux *mux, TsMuxStream *stream);
+gboolean 	tsmux_write_scheduled_packets 	(TsMux *mux, gboolean drain);
 
 G_END_DECLS
 
@@ -101,6 +101,10 @@ struct TsMuxStreamBuffer
   guint8 *data;
   guint32 size;
 
+  /* buffer @data was mapped from, if any. Its memory can be shared
+   * into output packets instead of copying @data */
+  GstBuffer *buffer;
+
   /* PTS & DTS associated with the contents of this buffer */
   gint64 pts;
   gint64 dts;
@@ -112,6 +116,22 @@ struct TsMuxStreamBuffer
   void *user_data;
 };
 
+/* An access unit occupying the T-STD buffer until its removal time */
+typedef struct
+{
+  gint64 ts;
+  guint32 bytes;
+} TsMuxStreamTSTDUnit;
+
+/* T-STD buffer sizes in bytes, ISO/IEC 13818-1 2.4.2.3 and 2.4.2.6 */
+#define TSMUX_TSTD_SIZE_MPEG1_VIDEO  40960
+#define TSMUX_TSTD_SIZE_MPEG2_VIDEO  229376
+/* CPB of an H.264 level 4 stream including the NAL overhead, used for
+ * video formats without a level dependent size */
+#define TSMUX_TSTD_SIZE_VIDEO        3750000
+#define TSMUX_TSTD_SIZE_AUDIO        3584
+#define TSMUX_TSTD_SIZE_AC3          5696
+
 /**
  * tsmux_stream_new:
  * @pid: a PID
@@ -225,7 +245,6 @@ tsmux_stream_new (guint16 pid, guint stream_type)
       break;
   }
 
-  stream->first_ts = GST_CLOCK_STIME_NONE;
 
   stream->last_pts = GST_CLOCK_STIME_NONE;
   stream->last_dts = GST_CLOCK_STIME_NONE;
@@ -264,6 +283,24 @@ tsmux_stream_get_pid (TsMuxStream * stream)
  */
 void
 tsmux_stream_free (TsMuxStream * stream)
+{
+  g_return_if_fail (stream != NULL);
+
+  tsmux_stream_flush (stream);
+  tsmux_stream_set_tstd (stream, FALSE);
+
+  g_slice_free (TsMuxStream, stream);
+}
+
+/**
+ * tsmux_stream_flush:
+ * @stream: a #TsMuxStream
+ *
+ * Drop the data queued in @stream that was not written yet. The next data
+ * added starts a new PES packet.
+ */
+void
+tsmux_stream_flush (TsMuxStream * stream)
 {
   GList *cur;
 
@@ -278,8 +315,15 @@ tsmux_stream_free (TsMuxStream * stream)
     g_slice_free (TsMuxStreamBuffer, tmbuf);
   }
   g_list_free (stream->buffers);
+  stream->buffers = NULL;
+  stream->cur_buffer = NULL;
+  stream->cur_buffer_consumed = 0;
+  stream->bytes_avail = 0;
 
-  g_slice_free (TsMuxStream, stream);
+  stream->state = TSMUX_STREAM_STATE_HEADER;
+  stream->pes_bytes_written = 0;
+
+  tsmux_stream_set_tstd (stream, stream->tstd_size != 0);
 }
 
 /**
@@ -319,6 +363,36 @@ tsmux_stream_set_get_es_descriptors_func (TsMuxStream * stream,
   stream->get_es_descrs_data = user_data;
 }
 
+/* Account @len bytes of the current buffer as delivered into the T-STD
+ * buffer. Bytes without timestamp belong to the preceding access unit */
+static void
+tsmux_stream_tstd_deliver (TsMuxStream * stream, guint len)
+{
+  TsMuxStreamBuffer *cur = stream->cur_buffer;
+  TsMuxStreamTSTDUnit *unit;
+  gint64 ts;
+
+  if (len == 0)
+    return;
+
+  ts = GST_CLOCK_STIME_IS_VALID (cur->dts) ? cur->dts : cur->pts;
+  unit = g_queue_peek_tail (&stream->tstd_units);
+
+  if (!GST_CLOCK_STIME_IS_VALID (ts)) {
+    /* nothing to attach to, the data is considered removed right away */
+    if (unit == NULL)
+      return;
+  } else if (unit == NULL || unit->ts != ts) {
+    unit = g_slice_new (TsMuxStreamTSTDUnit);
+    unit->ts = ts;
+    unit->bytes = 0;
+    g_queue_push_tail (&stream->tstd_units, unit);
+  }
+
+  unit->bytes += len;
+  stream->tstd_fullness += len;
+}
+
 /* Advance the current packet stream position by len bytes.
  * Mustn't consume more than available in the current packet */
 static void
@@ -330,6 +404,9 @@ tsmux_stream_consume (TsMuxStream * stream, guint len)
   stream->cur_buffer_consumed += len;
   stream->bytes_avail -= len;
 
+  if (stream->tstd_size != 0)
+    tsmux_stream_tstd_deliver (stream, len);
+
   if (stream->cur_buffer_consumed == 0 && stream->cur_buffer->size != 0)
     return;
 
@@ -448,8 +525,17 @@ tsmux_stream_initialize_pes_packet (TsMuxStream * stream)
     tsmux_stream_find_pts_dts_within (stream, stream->cur_pes_payload_size,
         &stream->pts, &stream->dts);
   } else {
-    /* Output a PES packet of all currently available bytes otherwise */
-    stream->cur_pes_payload_size = stream->bytes_avail;
+    /* Output a PES packet per queued buffer otherwise. This assumes that
+     * incoming data is packetised sensibly - ie, every video frame */
+    TsMuxStreamBuffer *buf = stream->buffers ?
+        (TsMuxStreamBuffer *) stream->buffers->data : NULL;
+
+    if (buf == NULL)
+      stream->cur_pes_payload_size = 0;
+    else if (buf == stream->cur_buffer)
+      stream->cur_pes_payload_size = buf->size - stream->cur_buffer_consumed;
+    else
+      stream->cur_pes_payload_size = buf->size;
     tsmux_stream_find_pts_dts_within (stream, stream->cur_pes_payload_size,
         &stream->pts, &stream->dts);
   }
@@ -487,21 +573,15 @@ tsmux_stream_initialize_pes_packet (TsMuxStream * stream)
   return TRUE;
 }
 
-/**
- * tsmux_stream_get_data:
- * @stream: a #TsMuxStream
- * @buf: a buffer to hold the result
- * @len: the length of @buf
- *
- * Copy up to @len available data in @stream into the buffer @buf.
- *
- * Returns: TRUE if @len bytes could be retrieved.
- */
-gboolean
-tsmux_stream_get_data (TsMuxStream * stream, guint8 * buf, guint len)
+/* Write the PES header if needed, then copy @len - header bytes of payload
+ * into @buf, or append them to @out as memory shared with the input
+ * buffers when @out is not NULL. @header_len is set to the number of bytes
+ * written to @buf. */
+static gboolean
+tsmux_stream_get_data_internal (TsMuxStream * stream, guint8 * buf,
+    guint len, GstBuffer * out, guint * header_len)
 {
-  g_return_val_if_fail (stream != NULL, FALSE);
-  g_return_val_if_fail (buf != NULL, FALSE);
+  *header_len = 0;
 
   if (stream->state == TSMUX_STREAM_STATE_HEADER) {
     guint8 pes_hdr_length;
@@ -518,6 +598,7 @@ tsmux_stream_get_data (TsMuxStream * stream, guint8 * buf, guint len)
 
     len -= pes_hdr_length;
     buf += pes_hdr_length;
+    *header_len = pes_hdr_length;
 
     stream->state = TSMUX_STREAM_STATE_PACKET;
   }
@@ -549,23 +630,75 @@ tsmux_stream_get_data (TsMuxStream * stream, guint8 * buf, guint len)
     /* Take as much as we can from the current buffer */
     avail = stream->cur_buffer->size - stream->cur_buffer_consumed;
     cur = stream->cur_buffer->data + stream->cur_buffer_consumed;
-    if (avail < len) {
-      memcpy (buf, cur, avail);
-      tsmux_stream_consume (stream, avail);
+    avail = MIN (avail, len);
 
+    if (out == NULL) {
+      memcpy (buf, cur, avail);
       buf += avail;
-      len -= avail;
+    } else if (stream->cur_buffer->buffer) {
+      gst_buffer_copy_into (out, stream->cur_buffer->buffer,
+          GST_BUFFER_COPY_MEMORY, stream->cur_buffer_consumed, avail);
     } else {
-      memcpy (buf, cur, len);
-      tsmux_stream_consume (stream, len);
+      guint8 *copy = g_memdup (cur, avail);
 
-      len = 0;
+      gst_buffer_append_memory (out,
+          gst_memory_new_wrapped (0, copy, avail, 0, avail, copy, g_free));
     }
+    tsmux_stream_consume (stream, avail);
+
+    len -= avail;
   }
 
   return TRUE;
 }
 
+/**
+ * tsmux_stream_get_data:
+ * @stream: a #TsMuxStream
+ * @buf: a buffer to hold the result
+ * @len: the length of @buf
+ *
+ * Copy up to @len available data in @stream into the buffer @buf.
+ *
+ * Returns: TRUE if @len bytes could be retrieved.
+ */
+gboolean
+tsmux_stream_get_data (TsMuxStream * stream, guint8 * buf, guint len)
+{
+  guint header_len;
+
+  g_return_val_if_fail (stream != NULL, FALSE);
+  g_return_val_if_fail (buf != NULL, FALSE);
+
+  return tsmux_stream_get_data_internal (stream, buf, len, NULL, &header_len);
+}
+
+/**
+ * tsmux_stream_get_data_shared:
+ * @stream: a #TsMuxStream
+ * @buf: a buffer to hold the PES header
+ * @len: the number of bytes to retrieve, including the PES header
+ * @out: a #GstBuffer to append the payload to
+ * @header_len: (out): the number of bytes written to @buf
+ *
+ * Like tsmux_stream_get_data(), but only the PES header, if any, is written
+ * into @buf. The payload is appended to @out as memory shared with the
+ * buffers that were added with tsmux_stream_add_buffer().
+ *
+ * Returns: TRUE if @len bytes could be retrieved.
+ */
+gboolean
+tsmux_stream_get_data_shared (TsMuxStream * stream, guint8 * buf, guint len,
+    GstBuffer * out, guint * header_len)
+{
+  g_return_val_if_fail (stream != NULL, FALSE);
+  g_return_val_if_fail (buf != NULL, FALSE);
+  g_return_val_if_fail (out != NULL, FALSE);
+  g_return_val_if_fail (header_len != NULL, FALSE);
+
+  return tsmux_stream_get_data_internal (stream, buf, len, out, header_len);
+}
+
 static guint8
 tsmux_stream_pes_header_length (TsMuxStream * stream)
 {
@@ -727,6 +860,30 @@ tsmux_stream_write_pes_header (TsMuxStream * stream, guint8 * data)
 void
 tsmux_stream_add_data (TsMuxStream * stream, guint8 * data, guint len,
     void *user_data, gint64 pts, gint64 dts, gboolean random_access)
+{
+  tsmux_stream_add_buffer (stream, NULL, data, len, user_data, pts, dts,
+      random_access);
+}
+
+/**
+ * tsmux_stream_add_buffer:
+ * @stream: a #TsMuxStream
+ * @buffer: (nullable): the buffer @data is mapped from
+ * @data: data to add
+ * @len: length of @data
+ * @user_data: user data to pass to release func
+ * @pts: PTS of access unit in @data
+ * @dts: DTS of access unit in @data
+ * @random_access: TRUE if random access point (keyframe)
+ *
+ * Like tsmux_stream_add_data(), but also passes the @buffer holding @data
+ * so that tsmux_stream_get_data_shared() can share its memory. @buffer must
+ * stay valid until the release function is called for @user_data.
+ */
+void
+tsmux_stream_add_buffer (TsMuxStream * stream, GstBuffer * buffer,
+    guint8 * data, guint len, void *user_data, gint64 pts, gint64 dts,
+    gboolean random_access)
 {
   TsMuxStreamBuffer *packet;
 
@@ -735,6 +892,7 @@ tsmux_stream_add_data (TsMuxStream * stream, guint8 * data, guint len,
   packet = g_slice_new (TsMuxStreamBuffer);
   packet->data = data;
   packet->size = len;
+  packet->buffer = buffer;
   packet->user_data = user_data;
   packet->random_access = random_access;
 
@@ -1125,6 +1283,164 @@ tsmux_stream_is_pcr (TsMuxStream * stream)
   return stream->pcr_ref != 0;
 }
 
+/**
+ * tsmux_stream_set_tstd:
+ * @stream: a #TsMuxStream
+ * @enable: whether to model the T-STD buffer
+ *
+ * Enable or disable tracking of the fullness of the T-STD elementary stream
+ * buffer of @stream. The buffer size depends on the stream type, streams of
+ * types without a known size are never reported full.
+ */
+void
+tsmux_stream_set_tstd (TsMuxStream * stream, gboolean enable)
+{
+  TsMuxStreamTSTDUnit *unit;
+
+  g_return_if_fail (stream != NULL);
+
+  while ((unit = g_queue_pop_head (&stream->tstd_units)))
+    g_slice_free (TsMuxStreamTSTDUnit, unit);
+  stream->tstd_fullness = 0;
+  stream->tstd_size = 0;
+
+  if (!enable)
+    return;
+
+  if (stream->is_video_stream) {
+    switch (stream->stream_type) {
+      case TSMUX_ST_VIDEO_MPEG1:
+        stream->tstd_size = TSMUX_TSTD_SIZE_MPEG1_VIDEO;
+        break;
+      case TSMUX_ST_VIDEO_MPEG2:
+        stream->tstd_size = TSMUX_TSTD_SIZE_MPEG2_VIDEO;
+        break;
+      default:
+        stream->tstd_size = TSMUX_TSTD_SIZE_VIDEO;
+        break;
+    }
+  } else if (stream->is_audio) {
+    switch (stream->stream_type) {
+      case TSMUX_ST_PS_AUDIO_AC3:
+        stream->tstd_size = TSMUX_TSTD_SIZE_AC3;
+        break;
+      case TSMUX_ST_PS_AUDIO_LPCM:
+      case TSMUX_ST_PS_AUDIO_DTS:
+        /* frames may exceed the buffer size of compressed audio */
+        break;
+      default:
+        stream->tstd_size = TSMUX_TSTD_SIZE_AUDIO;
+        break;
+    }
+  }
+}
+
+/**
+ * tsmux_stream_tstd_update:
+ * @stream: a #TsMuxStream
+ * @now: the current system time, in the MPEG clock time of the stream
+ *
+ * Remove the access units whose decoding time is not later than @now from
+ * the T-STD buffer of @stream.
+ */
+void
+tsmux_stream_tstd_update (TsMuxStream * stream, gint64 now)
+{
+  TsMuxStreamTSTDUnit *unit;
+
+  while ((unit = g_queue_peek_head (&stream->tstd_units))) {
+    if (unit->ts > now)
+      break;
+
+    g_queue_pop_head (&stream->tstd_units);
+    stream->tstd_fullness -= unit->bytes;
+    g_slice_free (TsMuxStreamTSTDUnit, unit);
+  }
+}
+
+/**
+ * tsmux_stream_tstd_is_full:
+ * @stream: a #TsMuxStream
+ * @len: number of bytes to deliver
+ *
+ * Check whether delivering up to @len more bytes of @stream now would
+ * overflow its T-STD buffer. A buffer that holds no access unit is never
+ * full, so that access units larger than the buffer still make progress.
+ *
+ * Returns: TRUE if the delivery has to wait for access units to be removed.
+ */
+gboolean
+tsmux_stream_tstd_is_full (TsMuxStream * stream, guint len)
+{
+  if (stream->tstd_size == 0 || g_queue_is_empty (&stream->tstd_units))
+    return FALSE;
+
+  len = MIN (len, stream->bytes_avail);
+
+  return stream->tstd_fullness + len > stream->tstd_size;
+}
+
+/**
+ * tsmux_stream_get_next_ts:
+ * @stream: a #TsMuxStream
+ *
+ * Return the DTS, or the PTS if it has none, of the next buffer to be
+ * written in @stream. Data without timestamp belongs to the access unit
+ * of the last buffer that had one.
+ *
+ * Returns: the timestamp of the next data in @stream, or
+ * %GST_CLOCK_STIME_NONE.
+ */
+gint64
+tsmux_stream_get_next_ts (TsMuxStream * stream)
+{
+  TsMuxStreamBuffer *buf;
+
+  g_return_val_if_fail (stream != NULL, GST_CLOCK_STIME_NONE);
+
+  if (stream->buffers) {
+    buf = (TsMuxStreamBuffer *) stream->buffers->data;
+    if (GST_CLOCK_STIME_IS_VALID (buf->dts))
+      return buf->dts;
+    if (GST_CLOCK_STIME_IS_VALID (buf->pts))
+      return buf->pts;
+  }
+
+  if (GST_CLOCK_STIME_IS_VALID (stream->last_dts))
+    return stream->last_dts;
+
+  return stream->last_pts;
+}
+
+/**
+ * tsmux_stream_get_last_ts:
+ * @stream: a #TsMuxStream
+ *
+ * Return the DTS, or the PTS if it has none, of the last buffer queued in
+ * @stream that has one.
+ *
+ * Returns: the timestamp of the last queued data in @stream, or
+ * %GST_CLOCK_STIME_NONE.
+ */
+gint64
+tsmux_stream_get_last_ts (TsMuxStream * stream)
+{
+  GList *cur;
+
+  g_return_val_if_fail (stream != NULL, GST_CLOCK_STIME_NONE);
+
+  for (cur = g_list_last (stream->buffers); cur; cur = cur->prev) {
+    TsMuxStreamBuffer *buf = cur->data;
+
+    if (GST_CLOCK_STIME_IS_VALID (buf->dts))
+      return buf->dts;
+    if (GST_CLOCK_STIME_IS_VALID (buf->pts))
+      return buf->pts;
+  }
+
+  return GST_CLOCK_STIME_NONE;
+}
+
 /**
  * tsmux_stream_get_pts:
  * @stream: a #TsMuxStream
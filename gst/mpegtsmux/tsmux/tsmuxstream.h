@@ -204,13 +204,18 @@ struct TsMuxStream {
   gint64 last_dts;
   gint64 last_pts;
 
-  gint64 first_ts;
-
   /* count of programs using this as PCR */
   gint   pcr_ref;
   /* Next time PCR should be written */
   gint64 next_pcr;
 
+  /* T-STD elementary stream buffer model used for constant bitrate
+   * scheduling: buffer size (0 if not modelled), bytes delivered into it
+   * and the access units still waiting for removal at their DTS */
+  guint32 tstd_size;
+  guint32 tstd_fullness;
+  GQueue tstd_units;
+
   /* audio parameters for stream
    * (used in stream descriptor) */
   gint audio_sampling;
@@ -241,6 +246,7 @@ struct TsMuxStream {
 /* stream management */
 TsMuxStream *	tsmux_stream_new 		(guint16 pid, guint stream_type);
 void 		tsmux_stream_free 		(TsMuxStream *stream);
+void 		tsmux_stream_flush 		(TsMuxStream *stream);
 
 guint16         tsmux_stream_get_pid            (TsMuxStream *stream);
 
@@ -256,6 +262,10 @@ void 		tsmux_stream_set_get_es_descriptors_func 	(TsMuxStream *stream,
 void 		tsmux_stream_add_data 		(TsMuxStream *stream, guint8 *data, guint len,
        						 void *user_data, gint64 pts, gint64 dts,
                                                  gboolean random_access);
+void 		tsmux_stream_add_buffer 	(TsMuxStream *stream, GstBuffer *buffer,
+						 guint8 *data, guint len,
+       						 void *user_data, gint64 pts, gint64 dts,
+                                                 gboolean random_access);
 
 void 		tsmux_stream_pcr_ref 		(TsMuxStream *stream);
 void 		tsmux_stream_pcr_unref  	(TsMuxStream *stream);
@@ -269,9 +279,17 @@ gint 		tsmux_stream_bytes_in_buffer 	(TsMuxStream *stream);
 gint 		tsmux_stream_bytes_avail 	(TsMuxStream *stream);
 gboolean 	tsmux_stream_initialize_pes_packet (TsMuxStream *stream);
 gboolean 	tsmux_stream_get_data 		(TsMuxStream *stream, guint8 *buf, guint len);
+gboolean 	tsmux_stream_get_data_shared 	(TsMuxStream *stream, guint8 *buf, guint len,
+						 GstBuffer *out, guint *header_len);
+
+void 		tsmux_stream_set_tstd 		(TsMuxStream *stream, gboolean enable);
+void 		tsmux_stream_tstd_update 	(TsMuxStream *stream, gint64 now);
+gboolean 	tsmux_stream_tstd_is_full 	(TsMuxStream *stream, guint len);
 
 gint64 	tsmux_stream_get_pts 		(TsMuxStream *stream);
 gint64 	tsmux_stream_get_dts 		(TsMuxStream *stream);
+gint64 	tsmux_stream_get_next_ts 	(TsMuxStream *stream);
+gint64 	tsmux_stream_get_last_ts 	(TsMuxStream *stream);
 
 G_END_DECLS
 
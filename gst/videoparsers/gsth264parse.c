@@ -38,12 +38,14 @@ GST_DEBUG_CATEGORY (h264_parse_debug);
 
 #define DEFAULT_CONFIG_INTERVAL      (0)
 #define DEFAULT_UPDATE_TIMECODE       FALSE
+#define DEFAULT_LIGHT_PARSING         FALSE
 
 enum
 {
   PROP_0,
   PROP_CONFIG_INTERVAL,
   PROP_UPDATE_TIMECODE,
+  PROP_LIGHT_PARSING,
 };
 
 enum
@@ -169,6 +171,25 @@ gst_h264_parse_class_init (GstH264ParseClass * klass)
           "VUI and pic_struct_present_flag of VUI must be non-zero",
           DEFAULT_CONFIG_INTERVAL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstH264Parse:light-parsing:
+   *
+   * Only parse what splitting access units and flagging key frames needs,
+   * for pipelines which only repackage the stream. Slice headers are
+   * parsed up to pic_order_cnt_lsb, an SPS identical to the last one is not
+   * parsed again, and SEI messages are only parsed in access units which
+   * carry an SPS, along with a recovery point, or if
+   * #GstH264Parse:update-timecode is set. The closed captions and picture
+   * timing of the other access units are not extracted.
+   *
+   * Since: 1.20
+   */
+  g_object_class_install_property (gobject_class, PROP_LIGHT_PARSING,
+      g_param_spec_boolean ("light-parsing", "Light parsing",
+          "Only parse the headers needed to split access units and find "
+          "key frames", DEFAULT_LIGHT_PARSING,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /* Override BaseParse vfuncs */
   parse_class->start = GST_DEBUG_FUNCPTR (gst_h264_parse_start);
   parse_class->stop = GST_DEBUG_FUNCPTR (gst_h264_parse_stop);
@@ -201,6 +222,7 @@ gst_h264_parse_init (GstH264Parse * h264parse)
   h264parse->aud_needed = TRUE;
   h264parse->aud_insert = TRUE;
   h264parse->update_timecode = FALSE;
+  h264parse->light_parsing = DEFAULT_LIGHT_PARSING;
 }
 
 static void
@@ -921,6 +943,24 @@ gst_h264_parse_process_sei (GstH264Parse * h264parse, GstH264NalUnit * nalu)
   g_array_free (messages, TRUE);
 }
 
+/* In light parsing mode, an SPS identical to the last one parsed is not
+ * parsed again, its VUI and HRD parameters are already known */
+static gboolean
+gst_h264_parse_is_last_sps (GstH264Parse * h264parse, GstH264NalUnit * nalu)
+{
+  GstH264SPS *last_sps = h264parse->nalparser->last_sps;
+  GstBuffer *stored;
+
+  if (!h264parse->light_parsing || last_sps == NULL || !last_sps->valid)
+    return FALSE;
+
+  stored = h264parse->sps_nals[last_sps->id];
+
+  return stored && gst_buffer_get_size (stored) == nalu->size
+      && gst_buffer_memcmp (stored, 0, nalu->data + nalu->offset,
+      nalu->size) == 0;
+}
+
 /* caller guarantees 2 bytes of nal payload */
 static gboolean
 gst_h264_parse_process_nal (GstH264Parse * h264parse, GstH264NalUnit * nalu)
@@ -954,6 +994,15 @@ gst_h264_parse_process_nal (GstH264Parse * h264parse, GstH264NalUnit * nalu)
     case GST_H264_NAL_SPS:
       /* reset state, everything else is obsolete */
       h264parse->state = 0;
+      if (gst_h264_parse_is_last_sps (h264parse, nalu)) {
+        /* byte identical to the stored one, the caps can't change */
+        GST_LOG_OBJECT (h264parse, "SPS unchanged, not parsing it again");
+        h264parse->have_sps_in_frame = TRUE;
+        h264parse->state |= GST_H264_PARSE_STATE_GOT_SPS;
+        h264parse->header = TRUE;
+        break;
+      }
+
       pres = gst_h264_parser_parse_sps (nalparser, nalu, &sps);
 
     process_sps:
@@ -1024,7 +1073,15 @@ gst_h264_parse_process_nal (GstH264Parse * h264parse, GstH264NalUnit * nalu)
         return FALSE;
 
       h264parse->header = TRUE;
-      gst_h264_parse_process_sei (h264parse, nalu);
+      /* In light parsing mode, only the SEI sent along with the SPS, where
+       * the HDR metadata is expected, are parsed, and the ones carrying a
+       * recovery point, which makes a key frame */
+      if (!h264parse->light_parsing || h264parse->update_timecode
+          || h264parse->have_sps_in_frame
+          || gst_video_parse_utils_sei_has_payload_type (nalu->data +
+              nalu->offset + nalu->header_bytes,
+              nalu->size - nalu->header_bytes, GST_H264_SEI_RECOVERY_POINT))
+        gst_h264_parse_process_sei (h264parse, nalu);
       /* mark SEI pos */
       if (h264parse->sei_pos == -1) {
         if (h264parse->transform)
@@ -1063,8 +1120,11 @@ gst_h264_parse_process_nal (GstH264Parse * h264parse, GstH264NalUnit * nalu)
       if (nal_type == GST_H264_NAL_SLICE_EXT && !GST_H264_IS_MVC_NALU (nalu))
         break;
 
-      pres = gst_h264_parser_parse_slice_hdr (nalparser, nalu, &slice,
-          FALSE, FALSE);
+      if (h264parse->light_parsing)
+        pres = gst_h264_parser_parse_slice_hdr_light (nalparser, nalu, &slice);
+      else
+        pres = gst_h264_parser_parse_slice_hdr (nalparser, nalu, &slice,
+            FALSE, FALSE);
       GST_DEBUG_OBJECT (h264parse,
           "parse result %d, first MB: %u, slice type: %u",
           pres, slice.first_mb_in_slice, slice.type);
@@ -3665,6 +3725,9 @@ gst_h264_parse_set_property (GObject * object, guint prop_id,
     case PROP_UPDATE_TIMECODE:
       parse->update_timecode = g_value_get_boolean (value);
       break;
+    case PROP_LIGHT_PARSING:
+      parse->light_parsing = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -3686,6 +3749,9 @@ gst_h264_parse_get_property (GObject * object, guint prop_id,
     case PROP_UPDATE_TIMECODE:
       g_value_set_boolean (value, parse->update_timecode);
       break;
+    case PROP_LIGHT_PARSING:
+      g_value_set_boolean (value, parse->light_parsing);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
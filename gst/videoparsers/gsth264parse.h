@@ -137,6 +137,7 @@ struct _GstH264Parse
   /* props */
   gint interval;
   gboolean update_timecode;
+  gboolean light_parsing;
 
   GstClockTime pending_key_unit_ts;
   GstEvent *force_key_unit_event;
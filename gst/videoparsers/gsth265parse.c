@@ -32,11 +32,13 @@ GST_DEBUG_CATEGORY (h265_parse_debug);
 #define GST_CAT_DEFAULT h265_parse_debug
 
 #define DEFAULT_CONFIG_INTERVAL      (0)
+#define DEFAULT_LIGHT_PARSING        FALSE
 
 enum
 {
   PROP_0,
-  PROP_CONFIG_INTERVAL
+  PROP_CONFIG_INTERVAL,
+  PROP_LIGHT_PARSING
 };
 
 enum
@@ -139,6 +141,25 @@ gst_h265_parse_class_init (GstH265ParseClass * klass)
           "(0 = disabled, -1 = send with every IDR frame)",
           -1, 3600, DEFAULT_CONFIG_INTERVAL,
           G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstH265Parse:light-parsing:
+   *
+   * Only parse what splitting access units and flagging key frames needs,
+   * for pipelines which only repackage the stream. Slice segment headers
+   * are parsed up to slice_pic_order_cnt_lsb, an SPS identical to the last
+   * one is not parsed again, and SEI messages are only parsed in access
+   * units which carry an SPS, along with a recovery point. The closed
+   * captions and picture timing of the other access units are not
+   * extracted.
+   *
+   * Since: 1.20
+   */
+  g_object_class_install_property (gobject_class, PROP_LIGHT_PARSING,
+      g_param_spec_boolean ("light-parsing", "Light parsing",
+          "Only parse the headers needed to split access units and find "
+          "key frames", DEFAULT_LIGHT_PARSING,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
   /* Override BaseParse vfuncs */
   parse_class->start = GST_DEBUG_FUNCPTR (gst_h265_parse_start);
   parse_class->stop = GST_DEBUG_FUNCPTR (gst_h265_parse_stop);
@@ -167,6 +188,8 @@ gst_h265_parse_init (GstH265Parse * h265parse)
   gst_base_parse_set_infer_ts (GST_BASE_PARSE (h265parse), FALSE);
   GST_PAD_SET_ACCEPT_INTERSECT (GST_BASE_PARSE_SINK_PAD (h265parse));
   GST_PAD_SET_ACCEPT_TEMPLATE (GST_BASE_PARSE_SINK_PAD (h265parse));
+
+  h265parse->light_parsing = DEFAULT_LIGHT_PARSING;
 }
 
 
@@ -705,6 +728,24 @@ gst_h265_parse_process_sei_user_data (GstH265Parse * h265parse,
 
 }
 
+/* In light parsing mode, an SPS identical to the last one parsed is not
+ * parsed again, its VUI parameters are already known */
+static gboolean
+gst_h265_parse_is_last_sps (GstH265Parse * h265parse, GstH265NalUnit * nalu)
+{
+  GstH265SPS *last_sps = h265parse->nalparser->last_sps;
+  GstBuffer *stored;
+
+  if (!h265parse->light_parsing || last_sps == NULL || !last_sps->valid)
+    return FALSE;
+
+  stored = h265parse->sps_nals[last_sps->id];
+
+  return stored && gst_buffer_get_size (stored) == nalu->size
+      && gst_buffer_memcmp (stored, 0, nalu->data + nalu->offset,
+      nalu->size) == 0;
+}
+
 /* caller guarantees 2 bytes of nal payload */
 static gboolean
 gst_h265_parse_process_nal (GstH265Parse * h265parse, GstH265NalUnit * nalu)
@@ -758,6 +799,15 @@ gst_h265_parse_process_nal (GstH265Parse * h265parse, GstH265NalUnit * nalu)
       /* reset state, everything else is obsolete */
       h265parse->state = 0;
 
+      if (gst_h265_parse_is_last_sps (h265parse, nalu)) {
+        /* byte identical to the stored one, the caps can't change */
+        GST_LOG_OBJECT (h265parse, "SPS unchanged, not parsing it again");
+        h265parse->have_sps_in_frame = TRUE;
+        h265parse->header = TRUE;
+        h265parse->state |= GST_H265_PARSE_STATE_GOT_SPS;
+        break;
+      }
+
       pres = gst_h265_parser_parse_sps (nalparser, nalu, &sps, TRUE);
 
 
@@ -836,7 +886,14 @@ gst_h265_parse_process_nal (GstH265Parse * h265parse, GstH265NalUnit * nalu)
 
       h265parse->header = TRUE;
 
-      gst_h265_parse_process_sei (h265parse, nalu);
+      /* In light parsing mode, only the SEI sent along with the SPS, where
+       * the HDR metadata is expected, are parsed, and the ones carrying a
+       * recovery point, which makes a key frame */
+      if (!h265parse->light_parsing || h265parse->have_sps_in_frame
+          || gst_video_parse_utils_sei_has_payload_type (nalu->data +
+              nalu->offset + nalu->header_bytes,
+              nalu->size - nalu->header_bytes, GST_H265_SEI_RECOVERY_POINT))
+        gst_h265_parse_process_sei (h265parse, nalu);
 
       /* mark SEI pos */
       if (nal_type == GST_H265_NAL_PREFIX_SEI && h265parse->sei_pos == -1) {
@@ -880,7 +937,10 @@ gst_h265_parse_process_nal (GstH265Parse * h265parse, GstH265NalUnit * nalu)
        * AU is complete. This is used to keep track of AU */
       h265parse->picture_start = TRUE;
 
-      pres = gst_h265_parser_parse_slice_hdr (nalparser, nalu, &slice);
+      if (h265parse->light_parsing)
+        pres = gst_h265_parser_parse_slice_hdr_light (nalparser, nalu, &slice);
+      else
+        pres = gst_h265_parser_parse_slice_hdr (nalparser, nalu, &slice);
 
       if (pres == GST_H265_PARSER_OK) {
         if (GST_H265_IS_I_SLICE (&slice))
@@ -3196,6 +3256,9 @@ gst_h265_parse_set_property (GObject * object, guint prop_id,
     case PROP_CONFIG_INTERVAL:
       parse->interval = g_value_get_int (value);
       break;
+    case PROP_LIGHT_PARSING:
+      parse->light_parsing = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -3213,6 +3276,9 @@ gst_h265_parse_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_CONFIG_INTERVAL:
       g_value_set_int (value, parse->interval);
       break;
+    case PROP_LIGHT_PARSING:
+      g_value_set_boolean (value, parse->light_parsing);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
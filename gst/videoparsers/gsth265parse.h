@@ -117,6 +117,7 @@ struct _GstH265Parse
 
   /* props */
   gint interval;
+  gboolean light_parsing;
 
   GstClockTime pending_key_unit_ts;
   GstEvent *force_key_unit_event;
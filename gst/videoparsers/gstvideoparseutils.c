@@ -432,3 +432,73 @@ gst_video_parse_utils_parse_afd (const guint8 data, GstVideoAFD * afd,
   afd->afd = (GstVideoAFDValue) afd_data;
   return TRUE;
 }
+
+/* Reads the next RBSP byte of @data, skipping emulation prevention bytes */
+static gboolean
+gst_video_parse_utils_read_rbsp_byte (const guint8 * data, gsize size,
+    gsize * pos, guint * n_zeros, guint8 * byte)
+{
+  if (*n_zeros >= 2 && *pos < size && data[*pos] == 0x03) {
+    (*pos)++;
+    *n_zeros = 0;
+  }
+
+  if (*pos >= size)
+    return FALSE;
+
+  *byte = data[(*pos)++];
+  *n_zeros = *byte == 0 ? *n_zeros + 1 : 0;
+
+  return TRUE;
+}
+
+/**
+ * gst_video_parse_utils_sei_has_payload_type:
+ * @data: the SEI RBSP, after the NAL unit header, emulation prevention bytes
+ *     included
+ * @size: size of @data
+ * @payload_type: the payloadType to look for
+ *
+ * Walks the sei_message() headers of an H.264 or H.265 SEI NAL unit,
+ * without parsing the payloads
+ *
+ * Returns: TRUE if one of the messages is of @payload_type
+ */
+gboolean
+gst_video_parse_utils_sei_has_payload_type (const guint8 * data, gsize size,
+    guint payload_type)
+{
+  gsize pos = 0;
+  guint n_zeros = 0, type, payload_size, i;
+  guint8 byte;
+
+  /* The last byte holds the rbsp_stop_one_bit */
+  while (pos + 1 < size) {
+    type = 0;
+    do {
+      if (!gst_video_parse_utils_read_rbsp_byte (data, size, &pos, &n_zeros,
+              &byte))
+        return FALSE;
+      type += byte;
+    } while (byte == 0xff);
+
+    payload_size = 0;
+    do {
+      if (!gst_video_parse_utils_read_rbsp_byte (data, size, &pos, &n_zeros,
+              &byte))
+        return FALSE;
+      payload_size += byte;
+    } while (byte == 0xff);
+
+    if (type == payload_type)
+      return TRUE;
+
+    for (i = 0; i < payload_size; i++) {
+      if (!gst_video_parse_utils_read_rbsp_byte (data, size, &pos, &n_zeros,
+              &byte))
+        return FALSE;
+    }
+  }
+
+  return FALSE;
+}
@@ -182,5 +182,8 @@ void gst_video_parse_user_data(GstElement * elt, GstVideoParseUserData * user_da
 void gst_video_push_user_data(GstElement * elt, GstVideoParseUserData * user_data,
 			 GstBuffer * buf);
 
+gboolean gst_video_parse_utils_sei_has_payload_type(const guint8 * data, gsize size,
+			 guint payload_type);
+
 G_END_DECLS
 #endif /* __VIDEO_PARSE_UTILS_H__ */
@@ -27,6 +27,7 @@
 #ifdef HAVE_CONFIG_H
 #include "config.h"
 #endif
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <gst/mpegts/mpegts.h>
@@ -122,7 +123,10 @@ typedef struct
   GstMpegtsSection *old_section;
   const GstMpegtsPMT *pmt;
   const GstMpegtsPMT *old_pmt;
+  /* in program-numbers */
   gboolean selected;
+  /* has a program pad */
+  gboolean requested;
   gboolean pmt_active;
   gboolean active;
   GstPad *ghost;
@@ -235,6 +239,13 @@ dvb_base_bin_get_program (DvbBaseBin * dvbbasebin, gint program_number)
       GINT_TO_POINTER (program_number));
 }
 
+/* Whether the PIDs of the program are in the filter */
+static gboolean
+dvb_base_bin_program_wanted (DvbBaseBinProgram * program)
+{
+  return program->selected || program->requested;
+}
+
 
 static guint dvb_base_bin_signals[LAST_SIGNAL] = { 0 };
 
@@ -521,6 +532,9 @@ dvb_base_bin_init (DvbBaseBin * dvbbasebin)
   dvbbasebin->pmtlist = NULL;
   dvbbasebin->pmtlist_changed = FALSE;
 
+  dvbbasebin->filter = NULL;
+  g_mutex_init (&dvbbasebin->program_lock);
+
   dvbbasebin->disposed = FALSE;
   dvb_base_bin_reset (dvbbasebin);
 
@@ -572,54 +586,72 @@ dvb_base_bin_finalize (GObject * object)
   g_hash_table_destroy (dvbbasebin->streams);
   g_hash_table_destroy (dvbbasebin->programs);
   g_list_free (dvbbasebin->pmtlist);
+  g_free (dvbbasebin->filter);
+  g_mutex_clear (&dvbbasebin->program_lock);
 
   if (G_OBJECT_CLASS (parent_class)->finalize)
     G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+/* Start filtering a program which wasn't wanted so far. Without a PMT PID
+ * yet, this happens once the PAT is received */
+static void
+dvb_base_bin_select_program (DvbBaseBin * dvbbasebin,
+    DvbBaseBinProgram * program)
+{
+  if (program->pmt_pid != G_MAXUINT16)
+    dvb_base_bin_activate_program (dvbbasebin, program);
+}
+
 static void
 dvb_base_bin_set_program_numbers (DvbBaseBin * dvbbasebin, const gchar * pn)
 {
   gchar **strv, **walk;
   DvbBaseBinProgram *program;
-  gboolean update_filter;
+  GHashTableIter iter;
+  GList *selected = NULL;
+
+  g_mutex_lock (&dvbbasebin->program_lock);
 
   /* Split up and update programs */
   strv = g_strsplit (pn, ":", 0);
 
-  update_filter = FALSE;
   for (walk = strv; *walk; walk++) {
-    gint program_number = strtol (*walk, NULL, 0);
+    gint program_number;
+
+    if (**walk == '\0')
+      continue;
 
+    program_number = strtol (*walk, NULL, 0);
     program = dvb_base_bin_get_program (dvbbasebin, program_number);
     if (program == NULL) {
       program = dvb_base_bin_add_program (dvbbasebin, program_number);
     }
-    if (program && !program->selected) {
+    if (!program->selected) {
       program->selected = TRUE;
-      if (program->pmt_pid != G_MAXUINT16) {
-        DvbBaseBinStream *stream;
-
-        stream = dvb_base_bin_get_stream (dvbbasebin, program->pmt_pid);
-        if (stream == NULL)
-          stream = dvb_base_bin_add_stream (dvbbasebin, program->pmt_pid);
-        dvb_base_bin_ref_stream (stream);
-        update_filter = TRUE;
-      }
+      if (!program->requested)
+        dvb_base_bin_select_program (dvbbasebin, program);
     }
+    selected = g_list_prepend (selected, program);
   }
-  if (update_filter)
-    dvb_base_bin_rebuild_filter (dvbbasebin);
 
   g_strfreev (strv);
 
-  /* FIXME : Deactivate programs no longer selected */
+  /* Deactivate programs no longer selected, unless they have a pad */
+  g_hash_table_iter_init (&iter, dvbbasebin->programs);
+  while (g_hash_table_iter_next (&iter, NULL, (gpointer *) & program)) {
+    if (program->selected && !g_list_find (selected, program)) {
+      program->selected = FALSE;
+      if (!program->requested)
+        dvb_base_bin_deactivate_program (dvbbasebin, program);
+    }
+  }
+  g_list_free (selected);
 
   g_free (dvbbasebin->program_numbers);
   dvbbasebin->program_numbers = g_strdup (pn);
 
-  if (0)
-    dvb_base_bin_deactivate_program (dvbbasebin, NULL);
+  g_mutex_unlock (&dvbbasebin->program_lock);
 }
 
 static void
@@ -736,7 +768,9 @@ dvb_base_bin_get_property (GObject * object, guint prop_id,
       g_object_get_property (G_OBJECT (dvbbasebin->dvbsrc), pspec->name, value);
       break;
     case PROP_PROGRAM_NUMBERS:
+      g_mutex_lock (&dvbbasebin->program_lock);
       g_value_set_string (value, dvbbasebin->program_numbers);
+      g_mutex_unlock (&dvbbasebin->program_lock);
       break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -748,9 +782,11 @@ dvb_base_bin_request_new_pad (GstElement * element,
     GstPadTemplate * templ, const gchar * name, const GstCaps * caps)
 {
   DvbBaseBin *dvbbasebin = GST_DVB_BASE_BIN (element);
+  DvbBaseBinProgram *program;
   GstPad *pad;
   GstPad *ghost;
   gchar *pad_name;
+  guint program_number;
 
   GST_DEBUG_OBJECT (dvbbasebin, "New pad requested %s", GST_STR_NULL (name));
 
@@ -765,6 +801,23 @@ dvb_base_bin_request_new_pad (GstElement * element,
     return NULL;
 
   pad_name = gst_pad_get_name (pad);
+
+  /* Add the program to the PID filter while it has a pad, the tuner is
+   * shared by all the programs of the transport stream */
+  if (sscanf (pad_name, "program_%u", &program_number) == 1) {
+    g_mutex_lock (&dvbbasebin->program_lock);
+    program = dvb_base_bin_get_program (dvbbasebin, program_number);
+    if (program == NULL)
+      program = dvb_base_bin_add_program (dvbbasebin, program_number);
+    if (!dvb_base_bin_program_wanted (program)) {
+      program->requested = TRUE;
+      dvb_base_bin_select_program (dvbbasebin, program);
+    } else {
+      program->requested = TRUE;
+    }
+    g_mutex_unlock (&dvbbasebin->program_lock);
+  }
+
   ghost = gst_ghost_pad_new (pad_name, pad);
   gst_object_unref (pad);
   g_free (pad_name);
@@ -776,10 +829,25 @@ dvb_base_bin_request_new_pad (GstElement * element,
 static void
 dvb_base_bin_release_pad (GstElement * element, GstPad * pad)
 {
+  DvbBaseBin *dvbbasebin;
+  DvbBaseBinProgram *program;
   GstGhostPad *ghost;
   GstPad *target;
+  guint program_number;
 
   g_return_if_fail (GST_IS_DVB_BASE_BIN (element));
+  dvbbasebin = GST_DVB_BASE_BIN (element);
+
+  if (sscanf (GST_PAD_NAME (pad), "program_%u", &program_number) == 1) {
+    g_mutex_lock (&dvbbasebin->program_lock);
+    program = dvb_base_bin_get_program (dvbbasebin, program_number);
+    if (program && program->requested) {
+      program->requested = FALSE;
+      if (!dvb_base_bin_program_wanted (program))
+        dvb_base_bin_deactivate_program (dvbbasebin, program);
+    }
+    g_mutex_unlock (&dvbbasebin->program_lock);
+  }
 
   ghost = GST_GHOST_PAD (pad);
   target = gst_ghost_pad_get_target (ghost);
@@ -889,42 +957,59 @@ dvb_base_bin_change_state (GstElement * element, GstStateChange transition)
   return ret;
 }
 
-static void
+static gboolean
 foreach_stream_build_filter (gpointer key, gpointer value, gpointer user_data)
 {
-  DvbBaseBin *dvbbasebin = GST_DVB_BASE_BIN (user_data);
+  GArray *pids = user_data;
   DvbBaseBinStream *stream = (DvbBaseBinStream *) value;
-  gchar *tmp, *pid;
 
   GST_DEBUG ("stream %d usecount %d", stream->pid, stream->usecount);
 
-  if (stream->usecount > 0) {
-    /* TODO: use g_strjoinv FTW */
-    tmp = dvbbasebin->filter;
-    pid = g_strdup_printf ("%d", stream->pid);
-    dvbbasebin->filter = g_strjoin (":", pid, dvbbasebin->filter, NULL);
+  /* Drop the streams of the programs which are gone */
+  if (stream->usecount == 0)
+    return TRUE;
 
-    g_free (pid);
-    g_free (tmp);
-  }
+  g_array_append_val (pids, stream->pid);
+  return FALSE;
+}
+
+static gint
+compare_pid (gconstpointer a, gconstpointer b)
+{
+  return *(const guint16 *) a - *(const guint16 *) b;
 }
 
 static void
 dvb_base_bin_rebuild_filter (DvbBaseBin * dvbbasebin)
 {
-  g_hash_table_foreach (dvbbasebin->streams,
-      foreach_stream_build_filter, dvbbasebin);
+  GArray *pids = g_array_new (FALSE, FALSE, sizeof (guint16));
+  GString *filter = g_string_new (NULL);
+  guint i;
+
+  g_hash_table_foreach_remove (dvbbasebin->streams,
+      foreach_stream_build_filter, pids);
+
+  /* Sorted, so that the same set of PIDs always gives the same filter */
+  g_array_sort (pids, compare_pid);
+  for (i = 0; i < pids->len; i++)
+    g_string_append_printf (filter, i ? ":%d" : "%d",
+        g_array_index (pids, guint16, i));
+  g_array_free (pids, TRUE);
+
+  /* Only touch the hardware filters when adding or removing a program
+   * changed the set of PIDs */
+  if (g_strcmp0 (filter->str, dvbbasebin->filter) == 0) {
+    g_string_free (filter, TRUE);
+    return;
+  }
 
-  if (dvbbasebin->filter == NULL)
-    /* fix dvbsrc to handle NULL filter */
-    dvbbasebin->filter = g_strdup ("");
+  g_free (dvbbasebin->filter);
+  dvbbasebin->filter = g_string_free (filter, FALSE);
 
   GST_INFO_OBJECT (dvbbasebin, "rebuilt filter %s", dvbbasebin->filter);
 
   /* FIXME: find a way to not add unwanted pids controlled by app */
   g_object_set (dvbbasebin->dvbsrc, "pids", dvbbasebin->filter, NULL);
-  g_free (dvbbasebin->filter);
-  dvbbasebin->filter = NULL;
 }
 
 static guint16
@@ -1072,20 +1157,25 @@ dvb_base_bin_deactivate_program (DvbBaseBin * dvbbasebin,
 {
   DvbBaseBinStream *stream;
 
-  stream = dvb_base_bin_get_stream (dvbbasebin, program->pmt_pid);
-  if (stream != NULL) {
-    dvb_base_bin_unref_stream (stream);
+  if (program->pmt_active) {
+    stream = dvb_base_bin_get_stream (dvbbasebin, program->pmt_pid);
+    if (stream != NULL) {
+      dvb_base_bin_unref_stream (stream);
+    }
   }
 
-  stream = dvb_base_bin_get_stream (dvbbasebin, program->pcr_pid);
-  if (stream != NULL) {
-    dvb_base_bin_unref_stream (stream);
-  }
+  if (program->active) {
+    stream = dvb_base_bin_get_stream (dvbbasebin, program->pcr_pid);
+    if (stream != NULL) {
+      dvb_base_bin_unref_stream (stream);
+    }
+    program->pcr_pid = G_MAXUINT16;
 
-  if (program->pmt) {
-    dvb_base_bin_remove_pmt_streams (dvbbasebin, program->pmt);
-    dvbbasebin->pmtlist = g_list_remove (dvbbasebin->pmtlist, program->pmt);
-    dvbbasebin->pmtlist_changed = TRUE;
+    if (program->pmt) {
+      dvb_base_bin_remove_pmt_streams (dvbbasebin, program->pmt);
+      dvbbasebin->pmtlist = g_list_remove (dvbbasebin->pmtlist, program->pmt);
+      dvbbasebin->pmtlist_changed = TRUE;
+    }
   }
 
   dvb_base_bin_rebuild_filter (dvbbasebin);
@@ -1140,6 +1230,8 @@ dvb_base_bin_pat_info_cb (DvbBaseBin * dvbbasebin, GstMpegtsSection * section)
     return;
   }
 
+  g_mutex_lock (&dvbbasebin->program_lock);
+
   for (i = 0; i < pat->len; i++) {
     GstMpegtsPatProgram *patp = g_ptr_array_index (pat, i);
 
@@ -1150,9 +1242,10 @@ dvb_base_bin_pat_info_cb (DvbBaseBin * dvbbasebin, GstMpegtsSection * section)
     old_pmt_pid = program->pmt_pid;
     program->pmt_pid = patp->network_or_program_map_PID;
 
-    if (program->selected) {
+    if (dvb_base_bin_program_wanted (program)
+        && (!program->pmt_active || old_pmt_pid != program->pmt_pid)) {
       /* PAT update */
-      if (old_pmt_pid != G_MAXUINT16) {
+      if (program->pmt_active) {
         dvb_base_bin_unref_stream (dvb_base_bin_get_stream (dvbbasebin,
                 old_pmt_pid));
       }
@@ -1162,6 +1255,7 @@ dvb_base_bin_pat_info_cb (DvbBaseBin * dvbbasebin, GstMpegtsSection * section)
         stream = dvb_base_bin_add_stream (dvbbasebin, program->pmt_pid);
 
       dvb_base_bin_ref_stream (stream);
+      program->pmt_active = TRUE;
 
       rebuild_filter = TRUE;
     }
@@ -1170,6 +1264,8 @@ dvb_base_bin_pat_info_cb (DvbBaseBin * dvbbasebin, GstMpegtsSection * section)
 
   if (rebuild_filter)
     dvb_base_bin_rebuild_filter (dvbbasebin);
+
+  g_mutex_unlock (&dvbbasebin->program_lock);
 }
 
 static void
@@ -1187,6 +1283,8 @@ dvb_base_bin_pmt_info_cb (DvbBaseBin * dvbbasebin, GstMpegtsSection * section)
 
   program_number = section->subtable_extension;
 
+  g_mutex_lock (&dvbbasebin->program_lock);
+
   program = dvb_base_bin_get_program (dvbbasebin, program_number);
   if (program == NULL) {
     GST_WARNING ("got PMT for program %d but program not in PAT",
@@ -1201,13 +1299,16 @@ dvb_base_bin_pmt_info_cb (DvbBaseBin * dvbbasebin, GstMpegtsSection * section)
 
   /* activate the program if it's selected and either it's not active or its pmt
    * changed */
-  if (program->selected && (!program->active || program->old_pmt != NULL))
+  if (dvb_base_bin_program_wanted (program)
+      && (!program->active || program->old_pmt != NULL))
     dvb_base_bin_activate_program (dvbbasebin, program);
 
   if (program->old_pmt) {
     gst_mpegts_section_unref (program->old_section);
     program->old_pmt = NULL;
   }
+
+  g_mutex_unlock (&dvbbasebin->program_lock);
 }
 
 static guint
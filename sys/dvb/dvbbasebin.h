@@ -54,7 +54,11 @@ struct _DvbBaseBin {
   gboolean trycam;
   GList *pmtlist;
   gboolean pmtlist_changed;
+  /* PID filter last set on dvbsrc */
   gchar *filter;
+  /* Protects the streams and programs, which are updated from the
+   * application (program-numbers, program pads) and from tsparse */
+  GMutex program_lock;
   GHashTable *streams;
   GHashTable *programs;
   gboolean disposed;
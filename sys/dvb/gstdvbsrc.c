@@ -198,7 +198,10 @@ enum
   ARG_DVBSRC_LNB_SLOF,
   ARG_DVBSRC_LNB_LOF1,
   ARG_DVBSRC_LNB_LOF2,
-  ARG_DVBSRC_INTERLEAVING
+  ARG_DVBSRC_INTERLEAVING,
+  ARG_DVBSRC_MAX_READ_SIZE,
+  ARG_DVBSRC_READ_LATENCY,
+  ARG_DVBSRC_MAX_PID_FILTERS
 };
 
 #define DEFAULT_ADAPTER 0
@@ -221,7 +224,13 @@ enum
 #define DEFAULT_TIMEOUT 1000000 /* 1 second */
 #define DEFAULT_TUNING_TIMEOUT 10 * GST_SECOND  /* 10 seconds */
 #define DEFAULT_DVB_BUFFER_SIZE (10*188*1024)   /* kernel default is 8192 */
-#define DEFAULT_BUFFER_SIZE 8192        /* not a property */
+#define DEFAULT_BUFFER_SIZE (44*188)    /* initial read size, not a property */
+#define DEFAULT_MAX_READ_SIZE (1024*188)
+#define DEFAULT_READ_LATENCY 20000      /* 20 ms */
+#define DEFAULT_MAX_PID_FILTERS MAX_FILTERS
+#define MIN_READ_SIZE (7*188)   /* one TS over UDP datagram */
+#define RATE_INTERVAL (250 * G_TIME_SPAN_MILLISECOND)
+#define POOL_MAX_BYTES (8 * 1024 * 1024)       /* recycled read buffers */
 #define DEFAULT_DELSYS SYS_UNDEFINED
 #define DEFAULT_PILOT PILOT_AUTO
 #define DEFAULT_ROLLOFF ROLLOFF_AUTO
@@ -969,6 +978,51 @@ gst_dvbsrc_class_init (GstDvbSrcClass * klass)
           GST_TYPE_INTERLEAVING, DEFAULT_INTERLEAVING,
           GST_PARAM_MUTABLE_PLAYING | G_PARAM_READWRITE));
 
+  /**
+   * GstDvbSrc:max-read-size:
+   *
+   * Maximum size of the outputted buffers, rounded down to a multiple of the
+   * TS packet size. Each read from the DVR device takes whatever is
+   * available up to the read size, which follows the bitrate up to this
+   * size.
+   */
+  g_object_class_install_property (gobject_class,
+      ARG_DVBSRC_MAX_READ_SIZE,
+      g_param_spec_uint ("max-read-size", "Maximum read size",
+          "Maximum number of bytes read from the DVR device per buffer",
+          188, G_MAXUINT, DEFAULT_MAX_READ_SIZE,
+          GST_PARAM_MUTABLE_READY | G_PARAM_READWRITE));
+
+  /**
+   * GstDvbSrc:read-latency:
+   *
+   * Maximum time data is held before being pushed. The size of the
+   * outputted buffers follows the measured bitrate so that they are filled
+   * in this time, which saves syscalls at high bitrates without delaying
+   * data at low ones.
+   */
+  g_object_class_install_property (gobject_class,
+      ARG_DVBSRC_READ_LATENCY,
+      g_param_spec_uint64 ("read-latency", "Read latency",
+          "Microseconds to accumulate data for before pushing a buffer",
+          0, G_MAXUINT64, DEFAULT_READ_LATENCY,
+          GST_PARAM_MUTABLE_PLAYING | G_PARAM_READWRITE));
+
+  /**
+   * GstDvbSrc:max-pid-filters:
+   *
+   * Number of PIDs the device can filter, one demux filter each. Changes
+   * of #GstDvbSrc:pids only add and remove the PIDs which differ, and
+   * capture switches to the full transport stream while more PIDs than this
+   * are requested, or when the device refuses a PID.
+   */
+  g_object_class_install_property (gobject_class,
+      ARG_DVBSRC_MAX_PID_FILTERS,
+      g_param_spec_uint ("max-pid-filters", "Maximum PID filters",
+          "Number of PIDs filtered by the device before capturing the full "
+          "MPEG-TS instead", 1, MAX_FILTERS, DEFAULT_MAX_PID_FILTERS,
+          GST_PARAM_MUTABLE_PLAYING | G_PARAM_READWRITE));
+
   /**
    * GstDvbSrc::tuning-start:
    * @gstdvbsrc: the element on which the signal is emitted
@@ -1035,6 +1089,7 @@ gst_dvbsrc_init (GstDvbSrc * object)
 {
   int i = 0;
   const gchar *adapter;
+  guint16 pid;
 
   GST_DEBUG_OBJECT (object, "Kernel DVB API version %d.%d", DVB_API_VERSION,
       DVB_API_VERSION_MINOR);
@@ -1054,9 +1109,14 @@ gst_dvbsrc_init (GstDvbSrc * object)
   }
 
   /* PID 8192 on DVB gets the whole transport stream */
-  object->pids[0] = 8192;
-  object->pids[1] = G_MAXUINT16;
+  object->pids = g_array_new (FALSE, FALSE, sizeof (guint16));
+  object->filter_pids = g_array_new (FALSE, FALSE, sizeof (guint16));
+  pid = 8192;
+  g_array_append_val (object->pids, pid);
+  object->max_pid_filters = DEFAULT_MAX_PID_FILTERS;
   object->dvb_buffer_size = DEFAULT_DVB_BUFFER_SIZE;
+  object->max_read_size = DEFAULT_MAX_READ_SIZE;
+  object->read_latency = DEFAULT_READ_LATENCY;
 
   adapter = g_getenv ("GST_DVB_ADAPTER");
   if (adapter)
@@ -1117,42 +1177,57 @@ gst_dvbsrc_init (GstDvbSrc * object)
   object->tuning_timeout = DEFAULT_TUNING_TIMEOUT;
 }
 
+static gint
+compare_pid (gconstpointer a, gconstpointer b)
+{
+  return *(const guint16 *) a - *(const guint16 *) b;
+}
+
 static void
 gst_dvbsrc_set_pids (GstDvbSrc * dvbsrc, const gchar * pid_string)
 {
-  int pid = 0;
-  int pid_count;
-  gchar **pids;
-  char **tmp;
+  GArray *pids = dvbsrc->pids;
+  guint16 pid;
+  gchar **strv, **walk;
+  guint i, j;
+
+  g_array_set_size (pids, 0);
 
   if (!strcmp (pid_string, "8192")) {
     /* get the whole TS */
-    dvbsrc->pids[0] = 8192;
-    dvbsrc->pids[1] = G_MAXUINT16;
+    pid = 8192;
+    g_array_append_val (pids, pid);
     goto done;
   }
 
   /* always add the PAT and CAT pids */
-  dvbsrc->pids[0] = 0;
-  dvbsrc->pids[1] = 1;
-  pid_count = 2;
-
-  tmp = pids = g_strsplit (pid_string, ":", MAX_FILTERS);
-
-  while (*pids != NULL && pid_count < MAX_FILTERS) {
-    pid = strtol (*pids, NULL, 0);
-    if (pid > 1 && pid <= 8192) {
-      GST_INFO_OBJECT (dvbsrc, "Parsed PID: %d", pid);
-      dvbsrc->pids[pid_count] = pid;
-      pid_count++;
+  pid = 0;
+  g_array_append_val (pids, pid);
+  pid = 1;
+  g_array_append_val (pids, pid);
+
+  strv = g_strsplit (pid_string, ":", -1);
+
+  for (walk = strv; *walk != NULL; walk++) {
+    gint parsed = strtol (*walk, NULL, 0);
+
+    if (parsed > 1 && parsed <= 8192) {
+      GST_INFO_OBJECT (dvbsrc, "Parsed PID: %d", parsed);
+      pid = parsed;
+      g_array_append_val (pids, pid);
     }
-    pids++;
   }
 
-  g_strfreev (tmp);
+  g_strfreev (strv);
 
-  if (pid_count < MAX_FILTERS)
-    dvbsrc->pids[pid_count] = G_MAXUINT16;
+  /* Sorted and without duplicates, to be compared with the filtered PIDs */
+  g_array_sort (pids, compare_pid);
+  for (i = 1, j = 1; i < pids->len; i++) {
+    if (g_array_index (pids, guint16, i) != g_array_index (pids, guint16,
+            j - 1))
+      g_array_index (pids, guint16, j++) = g_array_index (pids, guint16, i);
+  }
+  g_array_set_size (pids, j);
 
 done:
   if (GST_ELEMENT (dvbsrc)->current_state > GST_STATE_READY) {
@@ -1363,6 +1438,15 @@ gst_dvbsrc_set_property (GObject * _object, guint prop_id,
     case ARG_DVBSRC_INTERLEAVING:
       object->interleaving = g_value_get_enum (value);
       break;
+    case ARG_DVBSRC_MAX_READ_SIZE:
+      object->max_read_size = g_value_get_uint (value);
+      break;
+    case ARG_DVBSRC_READ_LATENCY:
+      object->read_latency = g_value_get_uint64 (value);
+      break;
+    case ARG_DVBSRC_MAX_PID_FILTERS:
+      object->max_pid_filters = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -1535,6 +1619,15 @@ gst_dvbsrc_get_property (GObject * _object, guint prop_id,
     case ARG_DVBSRC_INTERLEAVING:
       g_value_set_enum (value, object->interleaving);
       break;
+    case ARG_DVBSRC_MAX_READ_SIZE:
+      g_value_set_uint (value, object->max_read_size);
+      break;
+    case ARG_DVBSRC_READ_LATENCY:
+      g_value_set_uint64 (value, object->read_latency);
+      break;
+    case ARG_DVBSRC_MAX_PID_FILTERS:
+      g_value_set_uint (value, object->max_pid_filters);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -1839,6 +1932,9 @@ gst_dvbsrc_finalize (GObject * _object)
   /* freeing the mutex segfaults somehow */
   g_mutex_clear (&object->tune_mutex);
 
+  g_array_free (object->pids, TRUE);
+  g_array_free (object->filter_pids, TRUE);
+
   if (G_OBJECT_CLASS (parent_class)->finalize)
     G_OBJECT_CLASS (parent_class)->finalize (_object);
 }
@@ -1868,22 +1964,132 @@ gst_dvbsrc_plugin_init (GstPlugin * plugin)
       GST_TYPE_DVBSRC);
 }
 
+/* The read size closest below @size among MIN_READ_SIZE times a power of
+ * two, so that the pool is only replaced when the bitrate doubles or
+ * halves */
+static guint
+gst_dvbsrc_round_read_size (GstDvbSrc * object, guint64 size)
+{
+  guint max = object->max_read_size - object->max_read_size % 188;
+  guint read_size = MIN_READ_SIZE;
+
+  while (read_size * 2 <= size && read_size * 2 <= max)
+    read_size *= 2;
+
+  return MIN (read_size, max);
+}
+
+/* Replace the pool by one of buffers of the read size */
+static gboolean
+gst_dvbsrc_setup_pool (GstDvbSrc * src)
+{
+  GstBufferPool *pool, *old_pool;
+  GstStructure *config;
+  guint max_buffers = MAX (POOL_MAX_BYTES / src->read_size, 2);
+
+  pool = gst_buffer_pool_new ();
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, NULL, src->read_size, 2,
+      max_buffers);
+  if (!gst_buffer_pool_set_config (pool, config)
+      || !gst_buffer_pool_set_active (pool, TRUE)) {
+    GST_ELEMENT_ERROR (src, RESOURCE, SETTINGS, (NULL),
+        ("Could not set up a pool of %u bytes buffers", src->read_size));
+    gst_object_unref (pool);
+    return FALSE;
+  }
+
+  GST_DEBUG_OBJECT (src, "Pool of up to %u buffers of %u bytes",
+      max_buffers, src->read_size);
+
+  GST_OBJECT_LOCK (src);
+  if (src->pool_flushing)
+    gst_buffer_pool_set_flushing (pool, TRUE);
+  old_pool = src->pool;
+  src->pool = pool;
+  src->pool_size = src->read_size;
+  GST_OBJECT_UNLOCK (src);
+
+  /* Buffers still in use are freed when released */
+  if (old_pool) {
+    gst_buffer_pool_set_active (old_pool, FALSE);
+    gst_object_unref (old_pool);
+  }
+
+  return TRUE;
+}
+
+/* Size the next reads so that buffers are filled within the read latency
+ * at the measured bitrate */
+static void
+gst_dvbsrc_update_read_size (GstDvbSrc * object, gsize count, gint64 now)
+{
+  guint64 read_size;
+  gint64 elapsed;
+
+  object->rate_bytes += count;
+  elapsed = now - object->rate_start_time;
+  if (elapsed < RATE_INTERVAL)
+    return;
+
+  object->bitrate = gst_util_uint64_scale (object->rate_bytes,
+      G_TIME_SPAN_SECOND, elapsed);
+  object->rate_start_time = now;
+  object->rate_bytes = 0;
+
+  read_size = gst_dvbsrc_round_read_size (object,
+      gst_util_uint64_scale (object->bitrate, object->read_latency,
+          G_TIME_SPAN_SECOND));
+
+  if (read_size != object->read_size)
+    GST_LOG_OBJECT (object, "bitrate %" G_GUINT64_FORMAT " B/s, read size %"
+        G_GUINT64_FORMAT, object->bitrate, read_size);
+  object->read_size = read_size;
+}
+
 static GstFlowReturn
-gst_dvbsrc_read_device (GstDvbSrc * object, int size, GstBuffer ** buffer)
+gst_dvbsrc_read_device (GstDvbSrc * object, GstBuffer ** buffer)
 {
-  gint count = 0;
+  gsize count = 0;
   gint ret_val = 0;
-  GstBuffer *buf = gst_buffer_new_and_alloc (size);
-  GstClockTime timeout = object->timeout * GST_USECOND;
+  GstBuffer *buf = NULL;
+  GstClockTime timeout;
+  GstFlowReturn flow;
   GstMapInfo map;
+  gint64 deadline = -1, now;
+  GstBufferPoolAcquireParams params = { 0, };
 
-  g_return_val_if_fail (GST_IS_BUFFER (buf), GST_FLOW_ERROR);
+  if (object->fd_dvr < 0 || object->pool == NULL)
+    return GST_FLOW_ERROR;
 
-  if (object->fd_dvr < 0)
+  if (object->pool_size != object->read_size
+      && !gst_dvbsrc_setup_pool (object))
     return GST_FLOW_ERROR;
 
+  /* The DVR device can't wait for downstream to release buffers without
+   * overflowing, so allocate a new one when they are all in use */
+  params.flags = GST_BUFFER_POOL_ACQUIRE_FLAG_DONTWAIT;
+  flow = gst_buffer_pool_acquire_buffer (object->pool, &buf, &params);
+  if (G_UNLIKELY (flow == GST_FLOW_EOS)) {
+    GST_LOG_OBJECT (object, "All pooled buffers in use, allocating one");
+    buf = gst_buffer_new_and_alloc (object->read_size);
+  } else if (G_UNLIKELY (flow != GST_FLOW_OK)) {
+    return flow;
+  }
+
   gst_buffer_map (buf, &map, GST_MAP_WRITE);
-  while (count < size) {
+  /* Read what is available up to the buffer size, the read size, and keep
+   * on reading until it is full or the oldest data is read-latency old.
+   * Always return whole packets. */
+  while (count < map.size || count % 188) {
+    timeout = object->timeout * GST_USECOND;
+    if (deadline != -1 && count % 188 == 0) {
+      now = g_get_monotonic_time ();
+      if (now >= deadline)
+        break;
+      timeout = (deadline - now) * GST_USECOND;
+    }
+
     ret_val = gst_poll_wait (object->poll, timeout);
     GST_LOG_OBJECT (object, "select returned %d", ret_val);
     if (G_UNLIKELY (ret_val < 0)) {
@@ -1894,14 +2100,19 @@ gst_dvbsrc_read_device (GstDvbSrc * object, int size, GstBuffer ** buffer)
       else
         goto select_error;
     } else if (G_UNLIKELY (!ret_val)) {
+      /* Only the end of the read latency, not a stall in a packet */
+      if (deadline != -1 && count % 188 == 0)
+        continue;
       /* timeout, post element message */
       gst_element_post_message (GST_ELEMENT_CAST (object),
           gst_message_new_element (GST_OBJECT (object),
               gst_structure_new_empty ("dvb-read-failure")));
     } else {
-      int nread = read (object->fd_dvr, map.data + count, size - count);
+      gssize nread = read (object->fd_dvr, map.data + count, map.size - count);
 
       if (G_UNLIKELY (nread < 0)) {
+        if (errno == EAGAIN || errno == EINTR)
+          continue;
         GST_WARNING_OBJECT
             (object,
             "Unable to read from device: /dev/dvb/adapter%d/dvr%d (%d)",
@@ -1909,13 +2120,18 @@ gst_dvbsrc_read_device (GstDvbSrc * object, int size, GstBuffer ** buffer)
         gst_element_post_message (GST_ELEMENT_CAST (object),
             gst_message_new_element (GST_OBJECT (object),
                 gst_structure_new_empty ("dvb-read-failure")));
-      } else
+      } else {
         count = count + nread;
+        if (deadline == -1 && count > 0)
+          deadline = g_get_monotonic_time () + object->read_latency;
+      }
     }
   }
   gst_buffer_unmap (buf, &map);
   gst_buffer_resize (buf, 0, count);
 
+  gst_dvbsrc_update_read_size (object, count, g_get_monotonic_time ());
+
   *buffer = buf;
 
   return GST_FLOW_OK;
@@ -1940,7 +2156,6 @@ select_error:
 static GstFlowReturn
 gst_dvbsrc_create (GstPushSrc * element, GstBuffer ** buf)
 {
-  gint buffer_size;
   GstFlowReturn retval = GST_FLOW_ERROR;
   GstDvbSrc *object;
   fe_status_t status;
@@ -1948,8 +2163,6 @@ gst_dvbsrc_create (GstPushSrc * element, GstBuffer ** buf)
   object = GST_DVBSRC (element);
   GST_LOG ("fd_dvr: %d", object->fd_dvr);
 
-  buffer_size = DEFAULT_BUFFER_SIZE;
-
   /* device can not be tuned during read */
   g_mutex_lock (&object->tune_mutex);
 
@@ -1957,7 +2170,7 @@ gst_dvbsrc_create (GstPushSrc * element, GstBuffer ** buf)
   if (object->fd_dvr > -1) {
     /* --- Read TS from DVR device --- */
     GST_DEBUG_OBJECT (object, "Reading from DVR device");
-    retval = gst_dvbsrc_read_device (object, buffer_size, buf);
+    retval = gst_dvbsrc_read_device (object, buf);
 
     if (object->stats_interval &&
         ++object->stats_counter == object->stats_interval) {
@@ -2000,6 +2213,17 @@ gst_dvbsrc_change_state (GstElement * element, GstStateChange transition)
 }
 
 
+static gboolean
+gst_dvbsrc_start_pool (GstDvbSrc * src)
+{
+  src->read_size = gst_dvbsrc_round_read_size (src, DEFAULT_BUFFER_SIZE);
+  src->bitrate = 0;
+  src->rate_start_time = g_get_monotonic_time ();
+  src->rate_bytes = 0;
+
+  return gst_dvbsrc_setup_pool (src);
+}
+
 static gboolean
 gst_dvbsrc_start (GstBaseSrc * bsrc)
 {
@@ -2028,11 +2252,18 @@ gst_dvbsrc_start (GstBaseSrc * bsrc)
   gst_poll_add_fd (src->poll, &src->poll_fd_dvr);
   gst_poll_fd_ctl_read (src->poll, &src->poll_fd_dvr, TRUE);
 
+  if (!gst_dvbsrc_start_pool (src))
+    goto fail;
+
   return TRUE;
 
 fail:
   gst_dvbsrc_unset_pes_filters (src);
   close (src->fd_frontend);
+  if (src->poll) {
+    gst_poll_free (src->poll);
+    src->poll = NULL;
+  }
   return FALSE;
 }
 
@@ -2040,6 +2271,7 @@ static gboolean
 gst_dvbsrc_stop (GstBaseSrc * bsrc)
 {
   GstDvbSrc *src = GST_DVBSRC (bsrc);
+  GstBufferPool *pool;
 
   gst_dvbsrc_close_devices (src);
   g_list_free (src->supported_delsys);
@@ -2048,6 +2280,15 @@ gst_dvbsrc_stop (GstBaseSrc * bsrc)
     gst_poll_free (src->poll);
     src->poll = NULL;
   }
+  GST_OBJECT_LOCK (src);
+  pool = src->pool;
+  src->pool = NULL;
+  src->pool_size = 0;
+  GST_OBJECT_UNLOCK (src);
+  if (pool) {
+    gst_buffer_pool_set_active (pool, FALSE);
+    gst_object_unref (pool);
+  }
 
   return TRUE;
 }
@@ -2058,6 +2299,13 @@ gst_dvbsrc_unlock (GstBaseSrc * bsrc)
   GstDvbSrc *src = GST_DVBSRC (bsrc);
 
   gst_poll_set_flushing (src->poll, TRUE);
+
+  GST_OBJECT_LOCK (src);
+  src->pool_flushing = TRUE;
+  if (src->pool)
+    gst_buffer_pool_set_flushing (src->pool, TRUE);
+  GST_OBJECT_UNLOCK (src);
+
   return TRUE;
 }
 
@@ -2067,6 +2315,13 @@ gst_dvbsrc_unlock_stop (GstBaseSrc * bsrc)
   GstDvbSrc *src = GST_DVBSRC (bsrc);
 
   gst_poll_set_flushing (src->poll, FALSE);
+
+  GST_OBJECT_LOCK (src);
+  src->pool_flushing = FALSE;
+  if (src->pool)
+    gst_buffer_pool_set_flushing (src->pool, FALSE);
+  GST_OBJECT_UNLOCK (src);
+
   return TRUE;
 }
 
@@ -2791,54 +3046,151 @@ gst_dvbsrc_unset_pes_filters (GstDvbSrc * object)
     close (object->fd_filters[i]);
     object->fd_filters[i] = -1;
   }
+  g_array_set_size (object->filter_pids, 0);
 }
 
-static void
-gst_dvbsrc_set_pes_filters (GstDvbSrc * object)
+/* Open a new demux filter for @pid */
+static gboolean
+gst_dvbsrc_open_pes_filter (GstDvbSrc * object, int *fd, guint16 pid)
 {
-  int *fd;
-  int pid, i;
   struct dmx_pes_filter_params pes_filter;
   gint err;
   gchar *demux_dev = g_strdup_printf ("/dev/dvb/adapter%d/demux%d",
       object->adapter_number, object->frontend_number);
 
-  GST_INFO_OBJECT (object, "Setting PES filter");
+  if ((*fd = open (demux_dev, O_RDWR | O_NONBLOCK)) < 0) {
+    GST_ERROR_OBJECT (object, "Error opening demuxer: %s (%s)",
+        g_strerror (errno), demux_dev);
+    g_free (demux_dev);
+    return FALSE;
+  }
 
-  /* Set common params for all filters */
+  pes_filter.pid = pid;
   pes_filter.input = DMX_IN_FRONTEND;
   pes_filter.output = DMX_OUT_TS_TAP;
   pes_filter.pes_type = DMX_PES_OTHER;
   pes_filter.flags = DMX_IMMEDIATE_START;
 
-  for (i = 0; i < MAX_FILTERS; i++) {
-    if (object->pids[i] == G_MAXUINT16)
-      break;
+  GST_INFO_OBJECT (object, "Setting PES filter: pid = %d, type = %d",
+      pes_filter.pid, pes_filter.pes_type);
 
-    fd = &object->fd_filters[i];
-    pid = object->pids[i];
+  LOOP_WHILE_EINTR (err, ioctl (*fd, DMX_SET_PES_FILTER, &pes_filter));
+  if (err) {
+    GST_WARNING_OBJECT (object, "Error setting PES filter on %s: %s",
+        demux_dev, g_strerror (errno));
+    close (*fd);
+    *fd = -1;
+  }
 
-    if (*fd >= 0) {
-      ioctl (*fd, DMX_STOP);
-      close (*fd);
-    }
-    if ((*fd = open (demux_dev, O_RDWR | O_NONBLOCK)) < 0) {
-      GST_ERROR_OBJECT (object, "Error opening demuxer: %s (%s)",
-          g_strerror (errno), demux_dev);
+  g_free (demux_dev);
+  return *fd != -1;
+}
+
+/* DMX_ADD_PID is not used: Linux only accepts it on DMX_OUT_TSDEMUX_TAP
+ * filters, whose data is read from the demux device instead of the DVR */
+static gboolean
+gst_dvbsrc_add_pid (GstDvbSrc * object, guint16 pid)
+{
+  gint i;
+
+  for (i = 0; i < MAX_FILTERS; i++) {
+    if (object->fd_filters[i] != -1)
       continue;
+    if (!gst_dvbsrc_open_pes_filter (object, &object->fd_filters[i], pid))
+      return FALSE;
+    object->fd_filter_pids[i] = pid;
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+static void
+gst_dvbsrc_remove_pid (GstDvbSrc * object, guint16 pid)
+{
+  gint i;
+
+  for (i = 0; i < MAX_FILTERS; i++) {
+    if (object->fd_filters[i] != -1 && object->fd_filter_pids[i] == pid) {
+      ioctl (object->fd_filters[i], DMX_STOP);
+      close (object->fd_filters[i]);
+      object->fd_filters[i] = -1;
+      return;
     }
-    g_return_if_fail (*fd != -1);
+  }
+}
+
+static void
+gst_dvbsrc_set_full_ts_filter (GstDvbSrc * object)
+{
+  guint16 pid = 8192;
 
-    pes_filter.pid = pid;
+  if (object->filter_pids->len == 1
+      && g_array_index (object->filter_pids, guint16, 0) == pid)
+    return;
 
-    GST_INFO_OBJECT (object, "Setting PES filter: pid = %d, type = %d",
-        pes_filter.pid, pes_filter.pes_type);
+  GST_INFO_OBJECT (object, "Capturing the full transport stream");
 
-    LOOP_WHILE_EINTR (err, ioctl (*fd, DMX_SET_PES_FILTER, &pes_filter));
-    if (err)
-      GST_WARNING_OBJECT (object, "Error setting PES filter on %s: %s",
-          demux_dev, g_strerror (errno));
+  gst_dvbsrc_unset_pes_filters (object);
+  if (gst_dvbsrc_open_pes_filter (object, &object->fd_filters[0], pid)) {
+    object->fd_filter_pids[0] = pid;
+    g_array_append_val (object->filter_pids, pid);
   }
+}
 
-  g_free (demux_dev);
+/* Bring the demux filters to the requested PIDs, only adding and removing
+ * the PIDs which changed. Capture the full TS instead when the device
+ * can't filter that many PIDs. */
+static void
+gst_dvbsrc_set_pes_filters (GstDvbSrc * object)
+{
+  GArray *pids = object->pids, *filter_pids = object->filter_pids;
+  guint16 pid;
+  guint budget, i, j;
+
+  GST_INFO_OBJECT (object, "Setting PES filter");
+
+  budget = MIN (object->max_pid_filters, MAX_FILTERS);
+
+  if (pids->len == 0)
+    return;
+
+  /* Sorted, 8192 is the last one */
+  if (g_array_index (pids, guint16, pids->len - 1) == 8192
+      || pids->len > budget) {
+    gst_dvbsrc_set_full_ts_filter (object);
+    return;
+  }
+
+  if (filter_pids->len == 1 && g_array_index (filter_pids, guint16, 0) == 8192)
+    gst_dvbsrc_unset_pes_filters (object);
+
+  /* Removals first, to free filters for the additions */
+  for (i = 0, j = 0; i < filter_pids->len;) {
+    pid = g_array_index (filter_pids, guint16, i);
+    while (j < pids->len && g_array_index (pids, guint16, j) < pid)
+      j++;
+    if (j < pids->len && g_array_index (pids, guint16, j) == pid) {
+      i++;
+      continue;
+    }
+    gst_dvbsrc_remove_pid (object, pid);
+    g_array_remove_index (filter_pids, i);
+  }
+
+  for (i = 0, j = 0; i < pids->len; i++) {
+    pid = g_array_index (pids, guint16, i);
+    while (j < filter_pids->len
+        && g_array_index (filter_pids, guint16, j) < pid)
+      j++;
+    if (j < filter_pids->len && g_array_index (filter_pids, guint16, j) == pid)
+      continue;
+
+    if (!gst_dvbsrc_add_pid (object, pid)) {
+      GST_WARNING_OBJECT (object, "Device refused PID %d", pid);
+      gst_dvbsrc_set_full_ts_filter (object);
+      return;
+    }
+    g_array_insert_val (filter_pids, j, pid);
+  }
 }
@@ -72,11 +72,17 @@ struct _GstDvbSrc
 
   int fd_frontend;
   int fd_dvr;
+  /* Demux filters, each one carries the PID in fd_filter_pids */
   int fd_filters[MAX_FILTERS];
+  guint16 fd_filter_pids[MAX_FILTERS];
   GstPoll *poll;
   GstPollFD poll_fd_dvr;
 
-  guint16 pids[MAX_FILTERS];
+  /* Requested PIDs, sorted, 8192 for the full TS */
+  GArray *pids;
+  /* PIDs currently filtered by the demux, sorted */
+  GArray *filter_pids;
+  guint max_pid_filters;
   unsigned int freq;
   unsigned int sym_rate;
   int tone;
@@ -104,6 +110,18 @@ struct _GstDvbSrc
 
   guint dvb_buffer_size;
 
+  /* DVR reads. The pool is replaced from the streaming thread and used by
+   * unlock(), with the OBJECT_LOCK taken */
+  GstBufferPool *pool;
+  guint pool_size;
+  gboolean pool_flushing;
+  guint max_read_size;
+  guint64 read_latency;
+  guint read_size;
+  guint64 bitrate;
+  gint64 rate_start_time;
+  guint64 rate_bytes;
+
   unsigned int isdbt_layer_enabled;
   int isdbt_partial_reception;
   int isdbt_sound_broadcasting;
@@ -0,0 +1,875 @@
+/* GStreamer
+ * Copyright (C) 2020 Igalia, S.L.
+ *     Author: Víctor Jáquez <vjaquez@igalia.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "gstvabasedec.h"
+
+#include <va/va_drmcommon.h>
+
+#include "gstvaallocator.h"
+#include "gstvacaps.h"
+#include "gstvapool.h"
+#include "gstvautils.h"
+#include "gstvavideoformat.h"
+
+#define GST_CAT_DEFAULT (base->debug_category)
+
+static gboolean
+gst_va_base_dec_open (GstVideoDecoder * decoder)
+{
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+  GstVaBaseDecClass *klass = GST_VA_BASE_DEC_GET_CLASS (decoder);
+
+  if (!gst_va_ensure_element_data (decoder, klass->render_device_path,
+          &base->display))
+    return FALSE;
+
+  if (!base->decoder)
+    base->decoder = gst_va_decoder_new (base->display, klass->codec);
+
+  return (base->decoder != NULL);
+}
+
+static gboolean
+gst_va_base_dec_close (GstVideoDecoder * decoder)
+{
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+
+  gst_clear_object (&base->decoder);
+  gst_clear_object (&base->display);
+
+  return TRUE;
+}
+
+static gboolean
+gst_va_base_dec_stop (GstVideoDecoder * decoder)
+{
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+
+  if (!gst_va_decoder_close (base->decoder))
+    return FALSE;
+
+  if (base->output_state)
+    gst_video_codec_state_unref (base->output_state);
+  base->output_state = NULL;
+
+  if (base->other_pool)
+    gst_buffer_pool_set_active (base->other_pool, FALSE);
+  gst_clear_object (&base->other_pool);
+
+  return GST_VA_BASE_DEC_GET_PARENT_CLASS (decoder)->stop (decoder);
+}
+
+static gboolean
+gst_va_base_dec_src_query (GstVideoDecoder * decoder, GstQuery * query)
+{
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+  gboolean ret = FALSE;
+
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_CONTEXT:{
+      return gst_va_handle_context_query (GST_ELEMENT_CAST (base), query,
+          base->display);
+    }
+    case GST_QUERY_CAPS:{
+      GstCaps *caps = NULL, *tmp, *filter = NULL;
+
+      gst_query_parse_caps (query, &filter);
+      if (base->decoder)
+        caps = gst_va_decoder_get_srcpad_caps (base->decoder);
+      if (caps) {
+        if (filter) {
+          tmp =
+              gst_caps_intersect_full (filter, caps, GST_CAPS_INTERSECT_FIRST);
+          gst_caps_unref (caps);
+          caps = tmp;
+        }
+
+        GST_LOG_OBJECT (base, "Returning caps %" GST_PTR_FORMAT, caps);
+        gst_query_set_caps_result (query, caps);
+        gst_caps_unref (caps);
+        ret = TRUE;
+        break;
+      }
+      /* else jump to default */
+    }
+    default:
+      ret = GST_VA_BASE_DEC_GET_PARENT_CLASS (decoder)->src_query (decoder,
+          query);
+      break;
+  }
+
+  return ret;
+}
+
+static gboolean
+gst_va_base_dec_sink_query (GstVideoDecoder * decoder, GstQuery * query)
+{
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+
+  if (GST_QUERY_TYPE (query) == GST_QUERY_CONTEXT) {
+    return gst_va_handle_context_query (GST_ELEMENT_CAST (base), query,
+        base->display);
+  }
+
+  return GST_VA_BASE_DEC_GET_PARENT_CLASS (decoder)->sink_query (decoder,
+      query);
+}
+
+static GstVideoFormat
+_default_video_format_from_chroma (guint chroma_type)
+{
+  switch (chroma_type) {
+    case VA_RT_FORMAT_YUV420:
+    case VA_RT_FORMAT_YUV422:
+    case VA_RT_FORMAT_YUV444:
+      return GST_VIDEO_FORMAT_NV12;
+    case VA_RT_FORMAT_YUV420_10:
+    case VA_RT_FORMAT_YUV422_10:
+    case VA_RT_FORMAT_YUV444_10:
+      return GST_VIDEO_FORMAT_P010_10LE;
+    default:
+      return GST_VIDEO_FORMAT_UNKNOWN;
+  }
+}
+
+static void
+_get_preferred_format_and_caps_features (GstVaBaseDec * base,
+    GstVideoFormat * format, GstCapsFeatures ** capsfeatures)
+{
+  GstCaps *peer_caps, *preferred_caps = NULL;
+  GstCapsFeatures *features;
+  GstStructure *structure;
+  const GValue *v_format;
+  guint num_structures, i;
+
+  peer_caps = gst_pad_get_allowed_caps (GST_VIDEO_DECODER_SRC_PAD (base));
+  GST_DEBUG_OBJECT (base, "Allowed caps %" GST_PTR_FORMAT, peer_caps);
+
+  /* prefer memory:VASurface over other caps features */
+  num_structures = gst_caps_get_size (peer_caps);
+  for (i = 0; i < num_structures; i++) {
+    features = gst_caps_get_features (peer_caps, i);
+    structure = gst_caps_get_structure (peer_caps, i);
+
+    if (gst_caps_features_is_any (features))
+      continue;
+
+    if (gst_caps_features_contains (features, "memory:VAMemory")) {
+      preferred_caps = gst_caps_new_full (gst_structure_copy (structure), NULL);
+      gst_caps_set_features_simple (preferred_caps,
+          gst_caps_features_copy (features));
+      break;
+    }
+  }
+
+  if (!preferred_caps)
+    preferred_caps = peer_caps;
+  else
+    gst_clear_caps (&peer_caps);
+
+  if (gst_caps_is_empty (preferred_caps)
+      || gst_caps_is_any (preferred_caps)) {
+    /* if any or not linked yet then system memory and nv12 */
+    if (capsfeatures)
+      *capsfeatures = NULL;
+    if (format)
+      *format = _default_video_format_from_chroma (base->rt_format);
+    goto bail;
+  }
+
+  features = gst_caps_get_features (preferred_caps, 0);
+  if (features && capsfeatures)
+    *capsfeatures = gst_caps_features_copy (features);
+
+  if (!format)
+    goto bail;
+
+  structure = gst_caps_get_structure (preferred_caps, 0);
+  v_format = gst_structure_get_value (structure, "format");
+  if (!v_format)
+    *format = _default_video_format_from_chroma (base->rt_format);
+  else if (G_VALUE_HOLDS_STRING (v_format))
+    *format = gst_video_format_from_string (g_value_get_string (v_format));
+  else if (GST_VALUE_HOLDS_LIST (v_format)) {
+    guint num_values = gst_value_list_get_size (v_format);
+    for (i = 0; i < num_values; i++) {
+      GstVideoFormat fmt;
+      const GValue *v_fmt = gst_value_list_get_value (v_format, i);
+      if (!v_fmt)
+        continue;
+      fmt = gst_video_format_from_string (g_value_get_string (v_fmt));
+      if (gst_va_chroma_from_video_format (fmt) == base->rt_format) {
+        *format = fmt;
+        break;
+      }
+    }
+    if (i == num_values)
+      *format = _default_video_format_from_chroma (base->rt_format);
+  }
+
+bail:
+  gst_clear_caps (&preferred_caps);
+}
+
+/* The negotiate vmethod of the elements, which have to pass the input
+ * state of their codec base class */
+gboolean
+gst_va_base_dec_negotiate (GstVaBaseDec * base,
+    GstVideoCodecState * input_state)
+{
+  GstVideoDecoder *decoder = GST_VIDEO_DECODER (base);
+  GstVideoFormat format = GST_VIDEO_FORMAT_UNKNOWN;
+  GstCapsFeatures *capsfeatures = NULL;
+
+  /* Ignore downstream renegotiation request. */
+  if (!base->need_negotiation)
+    return TRUE;
+
+  base->need_negotiation = FALSE;
+
+  if (gst_va_decoder_is_open (base->decoder)
+      && !gst_va_decoder_close (base->decoder))
+    return FALSE;
+
+  if (!gst_va_decoder_open (base->decoder, base->profile, base->rt_format))
+    return FALSE;
+
+  if (!gst_va_decoder_set_format (base->decoder, base->coded_width,
+          base->coded_height, NULL))
+    return FALSE;
+
+  if (base->output_state)
+    gst_video_codec_state_unref (base->output_state);
+
+  _get_preferred_format_and_caps_features (base, &format, &capsfeatures);
+
+  base->output_state =
+      gst_video_decoder_set_output_state (decoder, format,
+      base->display_width, base->display_height, input_state);
+
+  base->output_state->caps = gst_video_info_to_caps (&base->output_state->info);
+  if (capsfeatures)
+    gst_caps_set_features_simple (base->output_state->caps, capsfeatures);
+
+  GST_INFO_OBJECT (base, "Negotiated caps %" GST_PTR_FORMAT,
+      base->output_state->caps);
+
+  return GST_VA_BASE_DEC_GET_PARENT_CLASS (base)->negotiate (decoder);
+}
+
+static gboolean
+_format_changed (GstVaBaseDec * base, VAProfile new_profile,
+    guint new_rtformat, gint new_width, gint new_height)
+{
+  VAProfile profile = VAProfileNone;
+  guint rt_format = VA_RT_FORMAT_YUV420;
+  gint width = 0, height = 0;
+
+  g_object_get (base->decoder, "va-profile", &profile, "va-rt-format",
+      &rt_format, "coded-width", &width, "coded-height", &height, NULL);
+
+  /* @TODO: Check if current buffers are large enough, and reuse
+   * them */
+  return !(profile == new_profile && rt_format == new_rtformat
+      && width == new_width && height == new_height);
+}
+
+/* Stores the format of a new sequence, and returns whether the decoder
+ * has to negotiate it */
+gboolean
+gst_va_base_dec_update_format (GstVaBaseDec * base, VAProfile profile,
+    guint rt_format, gint coded_width, gint coded_height, gint display_width,
+    gint display_height)
+{
+  if (_format_changed (base, profile, rt_format, coded_width, coded_height)) {
+    base->profile = profile;
+    base->rt_format = rt_format;
+    base->coded_width = coded_width;
+    base->coded_height = coded_height;
+
+    base->need_negotiation = TRUE;
+    GST_INFO_OBJECT (base, "Format changed to %s [%x] (%dx%d)",
+        gst_va_profile_name (profile), rt_format, base->coded_width,
+        base->coded_height);
+  }
+
+  if (base->display_width != display_width
+      || base->display_height != display_height) {
+    base->display_width = display_width;
+    base->display_height = display_height;
+
+    base->need_negotiation = TRUE;
+    GST_INFO_OBJECT (base, "Resolution changed to %dx%d",
+        base->display_width, base->display_height);
+  }
+
+  base->need_cropping = base->display_width < base->coded_width
+      || base->display_height < base->coded_height;
+
+  return base->need_negotiation;
+}
+
+void
+gst_va_base_dec_set_latency (GstVaBaseDec * base, guint min_frames,
+    guint max_frames)
+{
+  GstClockTime duration, min, max;
+  gint fps_d, fps_n;
+
+  fps_d = base->output_state->info.fps_d;
+  fps_n = base->output_state->info.fps_n;
+
+  /* if 0/1 then 25/1 */
+  if (fps_n == 0) {
+    fps_n = 25;
+    fps_d = 1;
+  }
+
+  duration = gst_util_uint64_scale_int (GST_SECOND, fps_d, fps_n);
+  min = min_frames * duration;
+  max = max_frames * duration;
+
+  GST_LOG_OBJECT (base,
+      "latency min %" G_GUINT64_FORMAT " max %" G_GUINT64_FORMAT, min, max);
+
+  gst_video_decoder_set_latency (GST_VIDEO_DECODER (base), min, max);
+}
+
+static inline gboolean
+_caps_is_dmabuf (GstVaBaseDec * base, GstCaps * caps)
+{
+  GstCapsFeatures *features;
+
+  features = gst_caps_get_features (caps, 0);
+  return gst_caps_features_contains (features, GST_CAPS_FEATURE_MEMORY_DMABUF)
+      && (gst_va_decoder_get_mem_types (base->decoder)
+      & VA_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME);
+}
+
+static inline gboolean
+_caps_is_va_memory (GstCaps * caps)
+{
+  GstCapsFeatures *features;
+
+  features = gst_caps_get_features (caps, 0);
+  return gst_caps_features_contains (features, "memory:VAMemory");
+}
+
+static inline void
+_shall_copy_frames (GstVaBaseDec * base, GstVideoInfo * info)
+{
+  GstVideoInfo ref_info;
+  guint i;
+
+  base->copy_frames = FALSE;
+
+  if (base->has_videometa)
+    return;
+
+  gst_video_info_set_format (&ref_info, GST_VIDEO_INFO_FORMAT (info),
+      base->display_width, base->display_height);
+
+  for (i = 0; i < GST_VIDEO_INFO_N_PLANES (info); i++) {
+    if (info->stride[i] != ref_info.stride[i] ||
+        info->offset[i] != ref_info.offset[i]) {
+      GST_WARNING_OBJECT (base,
+          "GstVideoMeta support required, copying frames.");
+      base->copy_frames = TRUE;
+      break;
+    }
+  }
+}
+
+static gboolean
+_try_allocator (GstVaBaseDec * base, GstAllocator * allocator, GstCaps * caps,
+    guint * size)
+{
+  GstVaAllocationParams params = {
+    .usage_hint = VA_SURFACE_ATTRIB_USAGE_HINT_DECODER,
+  };
+
+  if (!gst_video_info_from_caps (&params.info, caps))
+    return FALSE;
+  if (base->need_cropping) {
+    GST_VIDEO_INFO_WIDTH (&params.info) = base->coded_width;
+    GST_VIDEO_INFO_HEIGHT (&params.info) = base->coded_height;
+  }
+
+  if (GST_IS_VA_DMABUF_ALLOCATOR (allocator)) {
+    if (!gst_va_dmabuf_try (allocator, &params))
+      return FALSE;
+  } else if (GST_IS_VA_ALLOCATOR (allocator)) {
+    if (!gst_va_allocator_try (allocator, &params))
+      return FALSE;
+    if (!_caps_is_va_memory (caps))
+      _shall_copy_frames (base, &params.info);
+  } else {
+    return FALSE;
+  }
+
+  if (size)
+    *size = GST_VIDEO_INFO_SIZE (&params.info);
+
+  return TRUE;
+}
+
+static GstAllocator *
+_create_allocator (GstVaBaseDec * base, GstCaps * caps, guint * size)
+{
+  GstAllocator *allocator = NULL;
+  GstVaDisplay *display = NULL;
+
+  g_object_get (base->decoder, "display", &display, NULL);
+
+  if (_caps_is_dmabuf (base, caps))
+    allocator = gst_va_dmabuf_allocator_new (display);
+  else {
+    GArray *surface_formats =
+        gst_va_decoder_get_surface_formats (base->decoder);
+    allocator = gst_va_allocator_new (display, surface_formats);
+  }
+
+  gst_object_unref (display);
+
+  if (!_try_allocator (base, allocator, caps, size))
+    gst_clear_object (&allocator);
+
+  return allocator;
+}
+
+/* 1. get allocator in query
+ *    1.1 if allocator is not ours and downstream doesn't handle
+ *        videometa, keep it for other_pool
+ * 2. get pool in query
+ *    2.1 if pool is not va, keep it as other_pool if downstream
+ *        doesn't handle videometa or (it doesn't handle alignment and
+ *        the stream needs cropping)
+ *    2.2 if there's no pool in query and downstream doesn't handle
+ *        videometa, create other_pool as GstVideoPool with the non-va
+ *        from query and query's params
+ * 3. create our allocator and pool if they aren't in query
+ * 4. add or update pool and allocator in query
+ * 5. set our custom pool configuration
+ */
+static gboolean
+gst_va_base_dec_decide_allocation (GstVideoDecoder * decoder, GstQuery * query)
+{
+  GstAllocator *allocator = NULL, *other_allocator = NULL;
+  GstAllocationParams other_params, params;
+  GstBufferPool *pool = NULL;
+  GstCaps *caps = NULL;
+  GstStructure *config;
+  GstVideoInfo info;
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+  guint size, min, max;
+  gboolean update_pool = FALSE, update_allocator = FALSE, has_videoalignment;
+
+  gst_query_parse_allocation (query, &caps, NULL);
+
+  if (!(caps && gst_video_info_from_caps (&info, caps)))
+    goto wrong_caps;
+
+  base->has_videometa = gst_query_find_allocation_meta (query,
+      GST_VIDEO_META_API_TYPE, NULL);
+
+  if (gst_query_get_n_allocation_params (query) > 0) {
+    gst_query_parse_nth_allocation_param (query, 0, &allocator, &other_params);
+    if (allocator && !(GST_IS_VA_DMABUF_ALLOCATOR (allocator)
+            || GST_IS_VA_ALLOCATOR (allocator))) {
+      /* save the allocator for the other pool */
+      other_allocator = allocator;
+      allocator = NULL;
+    }
+    update_allocator = TRUE;
+  } else {
+    gst_allocation_params_init (&other_params);
+  }
+
+  gst_allocation_params_init (&params);
+
+  if (gst_query_get_n_allocation_pools (query) > 0) {
+    gst_query_parse_nth_allocation_pool (query, 0, &pool, &size, &min, &max);
+    if (pool) {
+      if (!GST_IS_VA_POOL (pool)) {
+        has_videoalignment = gst_buffer_pool_has_option (pool,
+            GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT);
+        if (!base->has_videometa || (!has_videoalignment
+                && base->need_cropping)) {
+          GST_DEBUG_OBJECT (base,
+              "keeping other pool for copy %" GST_PTR_FORMAT, pool);
+          gst_object_replace ((GstObject **) & base->other_pool,
+              (GstObject *) pool);
+          gst_object_unref (pool);      /* decrease previous increase */
+        }
+        gst_clear_object (&pool);
+      }
+    }
+
+    min = MAX (base->min_buffers, min);
+    size = MAX (size, GST_VIDEO_INFO_SIZE (&info));
+
+    update_pool = TRUE;
+  } else {
+    size = GST_VIDEO_INFO_SIZE (&info);
+
+    if (!base->has_videometa && !_caps_is_va_memory (caps)) {
+      GST_DEBUG_OBJECT (base, "making new other pool for copy");
+      base->other_pool = gst_video_buffer_pool_new ();
+      config = gst_buffer_pool_get_config (base->other_pool);
+      gst_buffer_pool_config_set_params (config, caps, size, 0, 0);
+      gst_buffer_pool_config_set_allocator (config, other_allocator,
+          &other_params);
+      if (!gst_buffer_pool_set_config (base->other_pool, config)) {
+        GST_ERROR_OBJECT (base, "couldn't configure other pool for copy");
+        gst_clear_object (&base->other_pool);
+      }
+    } else {
+      gst_clear_object (&other_allocator);
+    }
+
+    min = base->min_buffers;
+    max = 0;
+  }
+
+  if (!allocator) {
+    if (!(allocator = _create_allocator (base, caps, &size)))
+      return FALSE;
+  }
+
+  if (!pool)
+    pool = gst_va_pool_new ();
+
+  {
+    GstStructure *config = gst_buffer_pool_get_config (pool);
+
+    gst_buffer_pool_config_set_params (config, caps, size, min, max);
+    gst_buffer_pool_config_set_allocator (config, allocator, &params);
+    gst_buffer_pool_config_add_option (config,
+        GST_BUFFER_POOL_OPTION_VIDEO_META);
+
+    if (base->need_cropping) {
+      GstVideoAlignment video_align = {
+        .padding_bottom = base->coded_height - base->display_height,
+        .padding_left = base->coded_width - base->display_width,
+      };
+      gst_buffer_pool_config_add_option (config,
+          GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT);
+      gst_buffer_pool_config_set_video_alignment (config, &video_align);
+    }
+
+    gst_buffer_pool_config_set_va_allocation_params (config,
+        VA_SURFACE_ATTRIB_USAGE_HINT_DECODER);
+
+    if (!gst_buffer_pool_set_config (pool, config))
+      return FALSE;
+  }
+
+  if (update_allocator)
+    gst_query_set_nth_allocation_param (query, 0, allocator, &params);
+  else
+    gst_query_add_allocation_param (query, allocator, &params);
+
+  if (update_pool)
+    gst_query_set_nth_allocation_pool (query, 0, pool, size, min, max);
+  else
+    gst_query_add_allocation_pool (query, pool, size, min, max);
+
+  gst_object_unref (allocator);
+  gst_object_unref (pool);
+
+  return GST_VA_BASE_DEC_GET_PARENT_CLASS (decoder)->decide_allocation
+      (decoder, query);
+
+wrong_caps:
+  {
+    GST_WARNING_OBJECT (base, "No valid caps");
+    return FALSE;
+  }
+}
+
+/* Allocates the output buffer of @frame and the decode picture of its
+ * surface */
+GstVaDecodePicture *
+gst_va_base_dec_new_decode_picture (GstVaBaseDec * base,
+    GstVideoCodecFrame * frame)
+{
+  GstVaDecodePicture *pic;
+  VASurfaceID surface;
+
+  base->last_ret =
+      gst_video_decoder_allocate_output_frame (GST_VIDEO_DECODER (base),
+      frame);
+  if (base->last_ret != GST_FLOW_OK)
+    goto error;
+
+  surface = gst_va_buffer_get_surface (frame->output_buffer, NULL);
+
+  pic = gst_va_decode_picture_new (surface);
+
+  GST_LOG_OBJECT (base, "New va decode picture %p - %#x", pic, pic->surface);
+
+  return pic;
+
+error:
+  {
+    GST_WARNING_OBJECT (base,
+        "Failed to allocated output buffer, return %s",
+        gst_flow_get_name (base->last_ret));
+    return NULL;
+  }
+}
+
+static gboolean
+_copy_output_buffer (GstVaBaseDec * base, GstVideoCodecFrame * codec_frame)
+{
+  GstVideoFrame src_frame;
+  GstVideoFrame dest_frame;
+  GstVideoInfo dest_vinfo;
+  GstBuffer *buffer;
+  GstFlowReturn ret;
+
+  if (!base->other_pool)
+    return FALSE;
+
+  if (!gst_buffer_pool_set_active (base->other_pool, TRUE))
+    return FALSE;
+
+  gst_video_info_set_format (&dest_vinfo,
+      GST_VIDEO_INFO_FORMAT (&base->output_state->info), base->display_width,
+      base->display_height);
+
+  ret = gst_buffer_pool_acquire_buffer (base->other_pool, &buffer, NULL);
+  if (ret != GST_FLOW_OK)
+    goto fail;
+
+  if (!gst_video_frame_map (&src_frame, &base->output_state->info,
+          codec_frame->output_buffer, GST_MAP_READ))
+    goto fail;
+
+  if (!gst_video_frame_map (&dest_frame, &dest_vinfo, buffer, GST_MAP_WRITE)) {
+    gst_video_frame_unmap (&dest_frame);
+    goto fail;
+  }
+
+  /* gst_video_frame_copy can crop this, but does not know, so let
+   * make it think it's all right */
+  GST_VIDEO_INFO_WIDTH (&src_frame.info) = base->display_width;
+  GST_VIDEO_INFO_HEIGHT (&src_frame.info) = base->display_height;
+
+  if (!gst_video_frame_copy (&dest_frame, &src_frame)) {
+    gst_video_frame_unmap (&src_frame);
+    gst_video_frame_unmap (&dest_frame);
+    goto fail;
+  }
+
+  gst_video_frame_unmap (&src_frame);
+  gst_video_frame_unmap (&dest_frame);
+  gst_buffer_replace (&codec_frame->output_buffer, buffer);
+  gst_buffer_unref (buffer);
+
+  return TRUE;
+
+fail:
+  GST_ERROR_OBJECT (base, "Failed copy output buffer.");
+  return FALSE;
+}
+
+/* Pushes @frame once its picture is decoded, or drops it if its output
+ * buffer couldn't be allocated */
+GstFlowReturn
+gst_va_base_dec_finish_frame (GstVaBaseDec * base, GstVideoCodecFrame * frame)
+{
+  if (base->last_ret != GST_FLOW_OK) {
+    gst_video_decoder_drop_frame (GST_VIDEO_DECODER (base), frame);
+    return base->last_ret;
+  }
+
+  if (base->copy_frames)
+    _copy_output_buffer (base, frame);
+
+  GST_BUFFER_PTS (frame->output_buffer) = GST_BUFFER_PTS (frame->input_buffer);
+  GST_BUFFER_DTS (frame->output_buffer) = GST_CLOCK_TIME_NONE;
+  GST_BUFFER_DURATION (frame->output_buffer) =
+      GST_BUFFER_DURATION (frame->input_buffer);
+
+  GST_LOG_OBJECT (base, "Finish frame %" GST_TIME_FORMAT,
+      GST_TIME_ARGS (GST_BUFFER_PTS (frame->output_buffer)));
+
+  return gst_video_decoder_finish_frame (GST_VIDEO_DECODER (base), frame);
+}
+
+static void
+gst_va_base_dec_set_context (GstElement * element, GstContext * context)
+{
+  GstVaDisplay *old_display, *new_display;
+  GstVaBaseDec *base = GST_VA_BASE_DEC (element);
+  GstVaBaseDecClass *klass = GST_VA_BASE_DEC_GET_CLASS (base);
+  gboolean ret;
+
+  old_display = base->display ? gst_object_ref (base->display) : NULL;
+  ret = gst_va_handle_set_context (element, context, klass->render_device_path,
+      &base->display);
+  new_display = base->display ? gst_object_ref (base->display) : NULL;
+
+  if (!ret
+      || (old_display && new_display && old_display != new_display
+          && base->decoder)) {
+    GST_ELEMENT_WARNING (element, RESOURCE, BUSY,
+        ("Can't replace VA display while operating"), (NULL));
+  }
+
+  gst_clear_object (&old_display);
+  gst_clear_object (&new_display);
+
+  GST_ELEMENT_CLASS (klass->parent_decoder_class)->set_context (element,
+      context);
+}
+
+static void
+gst_va_base_dec_dispose (GObject * object)
+{
+  gst_va_base_dec_close (GST_VIDEO_DECODER (object));
+  G_OBJECT_CLASS (GST_VA_BASE_DEC_GET_PARENT_CLASS (object))->dispose (object);
+}
+
+void
+gst_va_base_dec_init (GstVaBaseDec * base, GstDebugCategory * cat,
+    guint min_buffers)
+{
+  base->debug_category = cat;
+  base->min_buffers = min_buffers;
+}
+
+/* Sets up the pad templates and the vmethods shared by all the decoders,
+ * and frees @cdata. The subclass sets its metadata and the vmethods of
+ * its codec base class. */
+void
+gst_va_base_dec_class_init (GstVaBaseDecClass * klass, GstVaCodecs codec,
+    struct CData *cdata, const gchar * sink_doc_caps_str,
+    const gchar * src_doc_caps_str)
+{
+  GstCaps *src_doc_caps, *sink_doc_caps;
+  GstPadTemplate *sink_pad_templ, *src_pad_templ;
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstVideoDecoderClass *decoder_class = GST_VIDEO_DECODER_CLASS (klass);
+
+  klass->parent_decoder_class = g_type_class_peek_parent (klass);
+
+  klass->codec = codec;
+  klass->render_device_path = g_strdup (cdata->render_device_path);
+
+  sink_pad_templ = gst_pad_template_new ("sink", GST_PAD_SINK, GST_PAD_ALWAYS,
+      cdata->sink_caps);
+  gst_element_class_add_pad_template (element_class, sink_pad_templ);
+  sink_doc_caps = gst_caps_from_string (sink_doc_caps_str);
+  gst_pad_template_set_documentation_caps (sink_pad_templ, sink_doc_caps);
+  gst_caps_unref (sink_doc_caps);
+
+  src_pad_templ = gst_pad_template_new ("src", GST_PAD_SRC, GST_PAD_ALWAYS,
+      cdata->src_caps);
+  gst_element_class_add_pad_template (element_class, src_pad_templ);
+  src_doc_caps = gst_caps_from_string (src_doc_caps_str);
+  gst_pad_template_set_documentation_caps (src_pad_templ, src_doc_caps);
+  gst_caps_unref (src_doc_caps);
+
+  gobject_class->dispose = gst_va_base_dec_dispose;
+
+  element_class->set_context = GST_DEBUG_FUNCPTR (gst_va_base_dec_set_context);
+
+  decoder_class->open = GST_DEBUG_FUNCPTR (gst_va_base_dec_open);
+  decoder_class->close = GST_DEBUG_FUNCPTR (gst_va_base_dec_close);
+  decoder_class->stop = GST_DEBUG_FUNCPTR (gst_va_base_dec_stop);
+  decoder_class->src_query = GST_DEBUG_FUNCPTR (gst_va_base_dec_src_query);
+  decoder_class->sink_query = GST_DEBUG_FUNCPTR (gst_va_base_dec_sink_query);
+  decoder_class->decide_allocation =
+      GST_DEBUG_FUNCPTR (gst_va_base_dec_decide_allocation);
+
+  g_free (cdata->description);
+  g_free (cdata->render_device_path);
+  gst_caps_unref (cdata->src_caps);
+  gst_caps_unref (cdata->sink_caps);
+  g_free (cdata);
+}
+
+/* Registers the decoder of @codec_name (as in its type name, such as
+ * "H264") for @device. @type_info has to be filled but for its class
+ * data. */
+gboolean
+gst_va_base_dec_register (GstPlugin * plugin, GstVaDevice * device,
+    GType parent_type, const gchar * codec_name, GTypeInfo * type_info,
+    GstCaps * sink_caps, GstCaps * src_caps, guint rank)
+{
+  struct CData *cdata;
+  gboolean ret;
+  gchar *type_name, *feature_name, *name;
+  GType type;
+
+  g_return_val_if_fail (GST_IS_PLUGIN (plugin), FALSE);
+  g_return_val_if_fail (GST_IS_VA_DEVICE (device), FALSE);
+  g_return_val_if_fail (GST_IS_CAPS (sink_caps), FALSE);
+  g_return_val_if_fail (GST_IS_CAPS (src_caps), FALSE);
+
+  cdata = g_new (struct CData, 1);
+  cdata->description = NULL;
+  cdata->render_device_path = g_strdup (device->render_device_path);
+  cdata->sink_caps = gst_caps_ref (sink_caps);
+  cdata->src_caps = gst_caps_ref (src_caps);
+
+  /* class data will be leaked if the element never gets instantiated */
+  GST_MINI_OBJECT_FLAG_SET (sink_caps, GST_MINI_OBJECT_FLAG_MAY_BE_LEAKED);
+  GST_MINI_OBJECT_FLAG_SET (src_caps, GST_MINI_OBJECT_FLAG_MAY_BE_LEAKED);
+
+  type_info->class_data = cdata;
+
+  type_name = g_strdup_printf ("GstVa%sDec", codec_name);
+  name = g_ascii_strdown (codec_name, -1);
+  feature_name = g_strdup_printf ("va%sdec", name);
+
+  /* The first decoder to be registered should use a constant name,
+   * like vah264dec, for any additional decoders, we create unique
+   * names, using inserting the render device name. */
+  if (g_type_from_name (type_name)) {
+    gchar *basename = g_path_get_basename (device->render_device_path);
+    g_free (type_name);
+    g_free (feature_name);
+    type_name = g_strdup_printf ("GstVa%s%sDec", basename, codec_name);
+    feature_name = g_strdup_printf ("va%s%sdec", basename, name);
+    cdata->description = basename;
+
+    /* lower rank for non-first device */
+    if (rank > 0)
+      rank--;
+  }
+
+  type = g_type_register_static (parent_type, type_name, type_info, 0);
+
+  ret = gst_element_register (plugin, feature_name, rank, type);
+
+  g_free (name);
+  g_free (type_name);
+  g_free (feature_name);
+
+  return ret;
+}
@@ -0,0 +1,135 @@
+/* GStreamer
+ * Copyright (C) 2020 Igalia, S.L.
+ *     Author: Víctor Jáquez <vjaquez@igalia.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#pragma once
+
+#include <gst/codecs/gsth264decoder.h>
+#include <gst/codecs/gstmpeg2decoder.h>
+
+#include "gstvadecoder.h"
+#include "gstvadevice.h"
+#include "gstvaprofile.h"
+
+G_BEGIN_DECLS
+
+#define GST_VA_BASE_DEC(obj)           ((GstVaBaseDec *) (obj))
+#define GST_VA_BASE_DEC_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), G_TYPE_FROM_INSTANCE (obj), GstVaBaseDecClass))
+#define GST_VA_BASE_DEC_CLASS(klass)   ((GstVaBaseDecClass *) (klass))
+#define GST_VA_BASE_DEC_GET_PARENT_CLASS(obj) (GST_VA_BASE_DEC_GET_CLASS (obj)->parent_decoder_class)
+
+typedef struct _GstVaBaseDec GstVaBaseDec;
+typedef struct _GstVaBaseDecClass GstVaBaseDecClass;
+
+/* Common part of the VA decoders. Each one derives from the decoder base
+ * class of its codec, which is the first member of its instance and class
+ * structures. */
+struct _GstVaBaseDec
+{
+  /* <private> */
+  union
+  {
+    GstH264Decoder h264;
+    GstMpeg2Decoder mpeg2;
+  } parent;
+
+  GstDebugCategory *debug_category;
+
+  GstVaDisplay *display;
+  GstVaDecoder *decoder;
+
+  GstBufferPool *other_pool;
+  /* max num pic references + scratch surfaces */
+  guint min_buffers;
+
+  GstFlowReturn last_ret;
+  GstVideoCodecState *output_state;
+
+  VAProfile profile;
+  gint display_width;
+  gint display_height;
+  gint coded_width;
+  gint coded_height;
+  guint rt_format;
+
+  gboolean need_negotiation;
+  gboolean need_cropping;
+  gboolean has_videometa;
+  gboolean copy_frames;
+};
+
+struct _GstVaBaseDecClass
+{
+  /* <private> */
+  union
+  {
+    GstH264DecoderClass h264;
+    GstMpeg2DecoderClass mpeg2;
+  } parent_class;
+
+  GstVaCodecs codec;
+  gchar *render_device_path;
+  /* the decoder base class of the codec, to chain up to */
+  GstVideoDecoderClass *parent_decoder_class;
+};
+
+struct CData
+{
+  gchar *render_device_path;
+  gchar *description;
+  GstCaps *sink_caps;
+  GstCaps *src_caps;
+};
+
+void                  gst_va_base_dec_init                (GstVaBaseDec * base,
+                                                           GstDebugCategory * cat,
+                                                           guint min_buffers);
+void                  gst_va_base_dec_class_init          (GstVaBaseDecClass * klass,
+                                                           GstVaCodecs codec,
+                                                           struct CData * cdata,
+                                                           const gchar * sink_doc_caps_str,
+                                                           const gchar * src_doc_caps_str);
+gboolean              gst_va_base_dec_register            (GstPlugin * plugin,
+                                                           GstVaDevice * device,
+                                                           GType parent_type,
+                                                           const gchar * codec_name,
+                                                           GTypeInfo * type_info,
+                                                           GstCaps * sink_caps,
+                                                           GstCaps * src_caps,
+                                                           guint rank);
+
+gboolean              gst_va_base_dec_negotiate           (GstVaBaseDec * base,
+                                                           GstVideoCodecState * input_state);
+gboolean              gst_va_base_dec_update_format       (GstVaBaseDec * base,
+                                                           VAProfile profile,
+                                                           guint rt_format,
+                                                           gint coded_width,
+                                                           gint coded_height,
+                                                           gint display_width,
+                                                           gint display_height);
+void                  gst_va_base_dec_set_latency         (GstVaBaseDec * base,
+                                                           guint min_frames,
+                                                           guint max_frames);
+
+GstVaDecodePicture *  gst_va_base_dec_new_decode_picture  (GstVaBaseDec * base,
+                                                           GstVideoCodecFrame * frame);
+GstFlowReturn         gst_va_base_dec_finish_frame        (GstVaBaseDec * base,
+                                                           GstVideoCodecFrame * frame);
+
+G_END_DECLS
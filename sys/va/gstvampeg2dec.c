@@ -0,0 +1,518 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "gstvampeg2dec.h"
+
+#include <string.h>
+
+#include "gstvabasedec.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_va_mpeg2dec_debug);
+#define GST_CAT_DEFAULT gst_va_mpeg2dec_debug
+
+#define GST_VA_MPEG2_DEC(obj)           ((GstVaMpeg2Dec *) obj)
+
+typedef struct _GstVaMpeg2Dec GstVaMpeg2Dec;
+typedef struct _GstVaMpeg2DecClass GstVaMpeg2DecClass;
+
+struct _GstVaMpeg2DecClass
+{
+  GstVaBaseDecClass parent_class;
+};
+
+struct _GstVaMpeg2Dec
+{
+  GstVaBaseDec parent;
+};
+
+/* *INDENT-OFF* */
+static const gchar *src_caps_str = GST_VIDEO_CAPS_MAKE_WITH_FEATURES ("memory:VAMemory",
+            "{ NV12 }") " ;" GST_VIDEO_CAPS_MAKE ("{ NV12 }");
+/* *INDENT-ON* */
+
+static const gchar *sink_caps_str = "video/mpeg, mpegversion = (int) 2";
+
+static gboolean
+gst_va_mpeg2_dec_end_picture (GstMpeg2Decoder * decoder,
+    GstMpeg2Picture * picture)
+{
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+  GstVaDecodePicture *va_pic;
+
+  GST_LOG_OBJECT (base, "end picture %p, (tsn %d)", picture, picture->tsn);
+
+  va_pic = gst_mpeg2_picture_get_user_data (picture);
+
+  return gst_va_decoder_decode (base->decoder, va_pic);
+}
+
+static GstFlowReturn
+gst_va_mpeg2_dec_output_picture (GstMpeg2Decoder * decoder,
+    GstVideoCodecFrame * frame, GstMpeg2Picture * picture)
+{
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+
+  GST_LOG_OBJECT (base,
+      "Outputting picture %p (tsn %d)", picture, picture->tsn);
+
+  gst_mpeg2_picture_unref (picture);
+
+  return gst_va_base_dec_finish_frame (base, frame);
+}
+
+static inline VASurfaceID
+_get_surface_id (GstMpeg2Picture * picture)
+{
+  GstVaDecodePicture *va_pic;
+
+  if (!picture)
+    return VA_INVALID_ID;
+
+  va_pic = gst_mpeg2_picture_get_user_data (picture);
+  if (!va_pic)
+    return VA_INVALID_ID;
+
+  return va_pic->surface;
+}
+
+static gboolean
+gst_va_mpeg2_dec_decode_slice (GstMpeg2Decoder * decoder,
+    GstMpeg2Picture * picture, GstMpeg2Slice * slice)
+{
+  GstMpegVideoSliceHdr *header = &slice->header;
+  GstMpegVideoPacket *packet = &slice->packet;
+  GstVaDecodePicture *va_pic;
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+  VASliceParameterBufferMPEG2 slice_param;
+  gboolean ret;
+
+  GST_TRACE_OBJECT (base, "-");
+
+  /* The slice data starts at the slice start code, so the macroblock data
+   * follows it and the slice header */
+  /* *INDENT-OFF* */
+  slice_param = (VASliceParameterBufferMPEG2) {
+    .slice_data_size = slice->size,
+    .slice_data_offset = 0,
+    .slice_data_flag = VA_SLICE_DATA_FLAG_ALL,
+    .macroblock_offset = header->header_size + 32,
+    .slice_horizontal_position = header->mb_column,
+    .slice_vertical_position = header->mb_row,
+    .quantiser_scale_code = header->quantiser_scale_code,
+    .intra_slice_flag = header->intra_slice,
+  };
+  /* *INDENT-ON* */
+
+  va_pic = gst_mpeg2_picture_get_user_data (picture);
+
+  ret = gst_va_decoder_add_slice_buffer (base->decoder, va_pic, &slice_param,
+      sizeof (slice_param), (guint8 *) packet->data + slice->sc_offset,
+      slice->size);
+  if (!ret) {
+    gst_va_decoder_destroy_buffers (base->decoder, va_pic);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+static gboolean
+gst_va_mpeg2_dec_start_picture (GstMpeg2Decoder * decoder,
+    GstMpeg2Picture * picture, GstMpeg2Slice * slice,
+    GstMpeg2Picture * prev_picture, GstMpeg2Picture * next_picture)
+{
+  const GstMpegVideoPictureHdr *pic_hdr = slice->pic_hdr;
+  const GstMpegVideoPictureExt *pic_ext = slice->pic_ext;
+  const GstMpegVideoQuantMatrixExt *quant_matrix = slice->quant_matrix;
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+  GstVaDecodePicture *va_pic;
+  VAIQMatrixBufferMPEG2 iq_matrix = { 0, };
+  VAPictureParameterBufferMPEG2 pic_param;
+  VASurfaceID surface;
+
+  GST_TRACE_OBJECT (base, "-");
+
+  va_pic = gst_mpeg2_picture_get_user_data (picture);
+
+  /* *INDENT-OFF* */
+  pic_param = (VAPictureParameterBufferMPEG2) {
+    .horizontal_size = base->coded_width,
+    .vertical_size = base->coded_height,
+    .forward_reference_picture = VA_INVALID_ID,
+    .backward_reference_picture = VA_INVALID_ID,
+    .picture_coding_type = pic_hdr->pic_type,
+    .f_code = (pic_ext->f_code[0][0] << 12) | (pic_ext->f_code[0][1] << 8)
+        | (pic_ext->f_code[1][0] << 4) | pic_ext->f_code[1][1],
+    .picture_coding_extension.bits = {
+      .intra_dc_precision = pic_ext->intra_dc_precision,
+      .picture_structure = pic_ext->picture_structure,
+      .top_field_first = pic_ext->top_field_first,
+      .frame_pred_frame_dct = pic_ext->frame_pred_frame_dct,
+      .concealment_motion_vectors = pic_ext->concealment_motion_vectors,
+      .q_scale_type = pic_ext->q_scale_type,
+      .intra_vlc_format = pic_ext->intra_vlc_format,
+      .alternate_scan = pic_ext->alternate_scan,
+      .repeat_first_field = pic_ext->repeat_first_field,
+      .progressive_frame = pic_ext->progressive_frame,
+      .is_first_field = picture->first_field == NULL,
+    },
+  };
+  /* *INDENT-ON* */
+
+  /* The missing reference of the leading B pictures of a closed GOP, and
+   * of a P field following an I field at the start of the stream, are never
+   * used for prediction, but the driver needs a valid surface */
+  switch (pic_hdr->pic_type) {
+    case GST_MPEG_VIDEO_PICTURE_TYPE_B:
+      surface = _get_surface_id (next_picture);
+      if (surface == VA_INVALID_ID)
+        surface = va_pic->surface;
+      pic_param.backward_reference_picture = surface;
+      /* fall-through */
+    case GST_MPEG_VIDEO_PICTURE_TYPE_P:
+      surface = _get_surface_id (prev_picture);
+      if (surface == VA_INVALID_ID)
+        surface = pic_param.backward_reference_picture;
+      if (surface == VA_INVALID_ID)
+        surface = va_pic->surface;
+      pic_param.forward_reference_picture = surface;
+      break;
+    default:
+      break;
+  }
+
+  if (!gst_va_decoder_add_param_buffer (base->decoder, va_pic,
+          VAPictureParameterBufferType, &pic_param, sizeof (pic_param)))
+    goto fail;
+
+  /* Both are in zigzag scan order */
+  iq_matrix.load_intra_quantiser_matrix =
+      quant_matrix->load_intra_quantiser_matrix;
+  memcpy (iq_matrix.intra_quantiser_matrix,
+      quant_matrix->intra_quantiser_matrix, 64);
+  iq_matrix.load_non_intra_quantiser_matrix =
+      quant_matrix->load_non_intra_quantiser_matrix;
+  memcpy (iq_matrix.non_intra_quantiser_matrix,
+      quant_matrix->non_intra_quantiser_matrix, 64);
+  iq_matrix.load_chroma_intra_quantiser_matrix =
+      quant_matrix->load_chroma_intra_quantiser_matrix;
+  memcpy (iq_matrix.chroma_intra_quantiser_matrix,
+      quant_matrix->chroma_intra_quantiser_matrix, 64);
+  iq_matrix.load_chroma_non_intra_quantiser_matrix =
+      quant_matrix->load_chroma_non_intra_quantiser_matrix;
+  memcpy (iq_matrix.chroma_non_intra_quantiser_matrix,
+      quant_matrix->chroma_non_intra_quantiser_matrix, 64);
+
+  if (!gst_va_decoder_add_param_buffer (base->decoder, va_pic,
+          VAIQMatrixBufferType, &iq_matrix, sizeof (iq_matrix)))
+    goto fail;
+
+  return TRUE;
+
+fail:
+  {
+    gst_va_decoder_destroy_buffers (base->decoder, va_pic);
+    return FALSE;
+  }
+}
+
+static gboolean
+gst_va_mpeg2_dec_new_picture (GstMpeg2Decoder * decoder,
+    GstVideoCodecFrame * frame, GstMpeg2Picture * picture)
+{
+  GstVaDecodePicture *pic;
+
+  pic = gst_va_base_dec_new_decode_picture (GST_VA_BASE_DEC (decoder), frame);
+  if (!pic)
+    return FALSE;
+
+  gst_mpeg2_picture_set_user_data (picture, pic,
+      (GDestroyNotify) gst_va_decode_picture_free);
+
+  return TRUE;
+}
+
+static gboolean
+gst_va_mpeg2_dec_new_field_picture (GstMpeg2Decoder * decoder,
+    GstMpeg2Picture * first_field, GstMpeg2Picture * second_field)
+{
+  GstVaMpeg2Dec *self = GST_VA_MPEG2_DEC (decoder);
+  GstVaDecodePicture *first_pic, *second_pic;
+
+  first_pic = gst_mpeg2_picture_get_user_data (first_field);
+  if (!first_pic)
+    return FALSE;
+
+  /* The second field is decoded into the surface of the first one */
+  second_pic = gst_va_decode_picture_new (first_pic->surface);
+  gst_mpeg2_picture_set_user_data (second_field, second_pic,
+      (GDestroyNotify) gst_va_decode_picture_free);
+
+  GST_LOG_OBJECT (self, "New va decode picture %p - %#x", second_pic,
+      second_pic->surface);
+
+  return TRUE;
+}
+
+static guint
+_get_rtformat (GstVaMpeg2Dec * self, guint8 chroma_format)
+{
+  switch (chroma_format) {
+    case 1:
+      return VA_RT_FORMAT_YUV420;
+    case 2:
+      return VA_RT_FORMAT_YUV422;
+    default:
+      GST_ERROR_OBJECT (self, "Unsupported chroma format: %d", chroma_format);
+      return 0;
+  }
+}
+
+/* *INDENT-OFF* */
+static const struct
+{
+  guint8 profile;               /* ISO/IEC 13818-2, Table 8-2 */
+  VAProfile va_profile;
+} profile_map[] = {
+  { 5 /* Simple */, VAProfileMPEG2Simple },
+  { 4 /* Main */, VAProfileMPEG2Main },
+};
+/* *INDENT-ON* */
+
+static VAProfile
+_get_profile (GstVaMpeg2Dec * self, const GstMpegVideoSequenceExt * seq_ext)
+{
+  GstVaBaseDec *base = GST_VA_BASE_DEC (self);
+  VAProfile profiles[2];
+  gint i = 0, j;
+
+  /* Without sequence extension, it is MPEG-1, a subset of main profile */
+  if (seq_ext) {
+    for (j = 0; j < G_N_ELEMENTS (profile_map); j++) {
+      if (profile_map[j].profile == seq_ext->profile) {
+        profiles[i++] = profile_map[j].va_profile;
+        break;
+      }
+    }
+  }
+
+  /* main profile decoders can decode simple profile */
+  if (!seq_ext || seq_ext->profile == 5)
+    profiles[i++] = VAProfileMPEG2Main;
+
+  for (j = 0; j < i && j < G_N_ELEMENTS (profiles); j++) {
+    if (gst_va_decoder_has_profile (base->decoder, profiles[j]))
+      return profiles[j];
+  }
+
+  GST_ERROR_OBJECT (self, "Unsupported profile: %d",
+      seq_ext ? seq_ext->profile : -1);
+
+  return VAProfileNone;
+}
+
+static void
+_set_latency (GstVaMpeg2Dec * self, const GstMpegVideoSequenceExt * seq_ext)
+{
+  guint num_reorder_frames;
+
+  /* An anchor picture is output after the B pictures following it */
+  num_reorder_frames = (seq_ext && seq_ext->low_delay) ? 0 : 1;
+
+  gst_va_base_dec_set_latency (GST_VA_BASE_DEC (self), num_reorder_frames, 2);
+}
+
+static gboolean
+gst_va_mpeg2_dec_new_sequence (GstMpeg2Decoder * decoder,
+    const GstMpegVideoSequenceHdr * seq,
+    const GstMpegVideoSequenceExt * seq_ext,
+    const GstMpegVideoSequenceDisplayExt * seq_display_ext,
+    const GstMpegVideoSequenceScalableExt * seq_scalable_ext)
+{
+  GstVaMpeg2Dec *self = GST_VA_MPEG2_DEC (decoder);
+  VAProfile profile;
+  gint width, height;
+  guint rt_format;
+
+  width = seq->width;
+  height = seq->height;
+  if (seq_ext) {
+    width = (width & 0x0fff) | ((guint32) seq_ext->horiz_size_ext << 12);
+    height = (height & 0x0fff) | ((guint32) seq_ext->vert_size_ext << 12);
+  }
+
+  profile = _get_profile (self, seq_ext);
+  if (profile == VAProfileNone)
+    return FALSE;
+
+  rt_format = _get_rtformat (self, seq_ext ? seq_ext->chroma_format : 1);
+  if (rt_format == 0)
+    return FALSE;
+
+  /* The display extension only gives the pan-scan area */
+  if (gst_va_base_dec_update_format (GST_VA_BASE_DEC (self), profile,
+          rt_format, width, height, width, height)) {
+    if (!gst_video_decoder_negotiate (GST_VIDEO_DECODER (self))) {
+      GST_ERROR_OBJECT (self, "Failed to negotiate with downstream");
+      return FALSE;
+    }
+
+    _set_latency (self, seq_ext);
+  }
+
+  return TRUE;
+}
+
+static GstCaps *
+_complete_sink_caps (GstCaps * sinkcaps)
+{
+  GstCaps *caps = gst_caps_copy (sinkcaps);
+
+  gst_caps_set_simple (caps, "systemstream", G_TYPE_BOOLEAN, FALSE, NULL);
+
+  return caps;
+}
+
+static GstCaps *
+gst_va_mpeg2_dec_sink_getcaps (GstVideoDecoder * decoder, GstCaps * filter)
+{
+  GstCaps *sinkcaps, *caps = NULL, *tmp;
+  GstVaBaseDec *base = GST_VA_BASE_DEC (decoder);
+
+  if (base->decoder)
+    caps = gst_va_decoder_get_sinkpad_caps (base->decoder);
+
+  if (caps) {
+    sinkcaps = _complete_sink_caps (caps);
+    gst_caps_unref (caps);
+    if (filter) {
+      tmp = gst_caps_intersect_full (filter, sinkcaps,
+          GST_CAPS_INTERSECT_FIRST);
+      gst_caps_unref (sinkcaps);
+      caps = tmp;
+    } else {
+      caps = sinkcaps;
+    }
+    GST_LOG_OBJECT (base, "Returning caps %" GST_PTR_FORMAT, caps);
+  } else if (!caps) {
+    caps = gst_video_decoder_proxy_getcaps (decoder, NULL, filter);
+  }
+
+  return caps;
+}
+
+static gboolean
+gst_va_mpeg2_dec_negotiate (GstVideoDecoder * decoder)
+{
+  GstMpeg2Decoder *mpeg2dec = GST_MPEG2_DECODER (decoder);
+
+  return gst_va_base_dec_negotiate (GST_VA_BASE_DEC (decoder),
+      mpeg2dec->input_state);
+}
+
+static void
+gst_va_mpeg2_dec_class_init (gpointer g_class, gpointer class_data)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (g_class);
+  GstMpeg2DecoderClass *mpeg2decoder_class = GST_MPEG2_DECODER_CLASS (g_class);
+  GstVideoDecoderClass *decoder_class = GST_VIDEO_DECODER_CLASS (g_class);
+  struct CData *cdata = class_data;
+  gchar *long_name;
+
+  if (cdata->description) {
+    long_name = g_strdup_printf ("VA-API MPEG-2 Decoder in %s",
+        cdata->description);
+  } else {
+    long_name = g_strdup ("VA-API MPEG-2 Decoder");
+  }
+
+  gst_element_class_set_metadata (element_class, long_name,
+      "Codec/Decoder/Video/Hardware",
+      "VA-API based MPEG-2 video decoder",
+      "GStreamer maintainers <gstreamer-devel@lists.freedesktop.org>");
+
+  gst_va_base_dec_class_init (GST_VA_BASE_DEC_CLASS (g_class), MPEG2, cdata,
+      sink_caps_str, src_caps_str);
+
+  decoder_class->getcaps = GST_DEBUG_FUNCPTR (gst_va_mpeg2_dec_sink_getcaps);
+  decoder_class->negotiate = GST_DEBUG_FUNCPTR (gst_va_mpeg2_dec_negotiate);
+
+  mpeg2decoder_class->new_sequence =
+      GST_DEBUG_FUNCPTR (gst_va_mpeg2_dec_new_sequence);
+  mpeg2decoder_class->decode_slice =
+      GST_DEBUG_FUNCPTR (gst_va_mpeg2_dec_decode_slice);
+
+  mpeg2decoder_class->new_picture =
+      GST_DEBUG_FUNCPTR (gst_va_mpeg2_dec_new_picture);
+  mpeg2decoder_class->new_field_picture =
+      GST_DEBUG_FUNCPTR (gst_va_mpeg2_dec_new_field_picture);
+  mpeg2decoder_class->output_picture =
+      GST_DEBUG_FUNCPTR (gst_va_mpeg2_dec_output_picture);
+  mpeg2decoder_class->start_picture =
+      GST_DEBUG_FUNCPTR (gst_va_mpeg2_dec_start_picture);
+  mpeg2decoder_class->end_picture =
+      GST_DEBUG_FUNCPTR (gst_va_mpeg2_dec_end_picture);
+
+  g_free (long_name);
+}
+
+static void
+gst_va_mpeg2_dec_init (GTypeInstance * instance, gpointer g_class)
+{
+  /* max num pic references + scratch surfaces */
+  gst_va_base_dec_init (GST_VA_BASE_DEC (instance), GST_CAT_DEFAULT, 2 + 4);
+}
+
+static gpointer
+_register_debug_category (gpointer data)
+{
+  GST_DEBUG_CATEGORY_INIT (gst_va_mpeg2dec_debug, "vampeg2dec", 0,
+      "VA mpeg2 decoder");
+
+  return NULL;
+}
+
+gboolean
+gst_va_mpeg2_dec_register (GstPlugin * plugin, GstVaDevice * device,
+    GstCaps * sink_caps, GstCaps * src_caps, guint rank)
+{
+  static GOnce debug_once = G_ONCE_INIT;
+  GTypeInfo type_info = {
+    .class_size = sizeof (GstVaMpeg2DecClass),
+    .class_init = gst_va_mpeg2_dec_class_init,
+    .instance_size = sizeof (GstVaMpeg2Dec),
+    .instance_init = gst_va_mpeg2_dec_init,
+  };
+  GstCaps *complete_caps;
+  gboolean ret;
+
+  g_return_val_if_fail (GST_IS_CAPS (sink_caps), FALSE);
+
+  g_once (&debug_once, _register_debug_category, NULL);
+
+  complete_caps = _complete_sink_caps (sink_caps);
+  ret = gst_va_base_dec_register (plugin, device, GST_TYPE_MPEG2_DECODER,
+      "Mpeg2", &type_info, complete_caps, src_caps, rank);
+  gst_caps_unref (complete_caps);
+
+  return ret;
+}
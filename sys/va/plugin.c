@@ -30,6 +30,7 @@
 #include "gstvacaps.h"
 #include "gstvadevice.h"
 #include "gstvah264dec.h"
+#include "gstvampeg2dec.h"
 #include "gstvaprofile.h"
 
 #define GST_CAT_DEFAULT gstva_debug
@@ -91,6 +92,13 @@ plugin_register_decoders (GstPlugin * plugin, GstVaDevice * device,
               device->render_device_path);
         }
         break;
+      case MPEG2:
+        if (!gst_va_mpeg2_dec_register (plugin, device, sinkcaps, srccaps,
+                GST_RANK_NONE)) {
+          GST_WARNING ("Failed to register Mpeg2 decoder: %s",
+              device->render_device_path);
+        }
+        break;
       default:
         GST_DEBUG ("No decoder implementation for %" GST_FOURCC_FORMAT,
             GST_FOURCC_ARGS (codec));
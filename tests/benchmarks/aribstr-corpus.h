@@ -0,0 +1,415 @@
+/* GStreamer
+ *
+ * aribstr-corpus.h: ARIB STD-B24 strings for the aribstr benchmark
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Event names and descriptions as found in the EIT of Japanese terrestrial
+ * and BS services, encoded the way broadcasters do: kanji in G0, hiragana
+ * in GR, katakana through LS3R, alphanumerics through LS1 and additional
+ * symbols in rows 90-94 of the Kanji set. Each entry comes with the
+ * expected UTF-8 output and, for the iconv baseline, its EUC-JISX0213
+ * equivalent. */
+
+typedef struct
+{
+  const gchar *arib;
+  guint arib_len;
+  const gchar *utf8;
+  const gchar *euc;
+} AribCorpusEntry;
+
+static const AribCorpusEntry arib_corpus[] = {
+  /* ニュース７[字] */
+  {
+      "\x1b\x7c\xcb\xe5\x21\x3c\xb9\x23\x37\x7a\x56", 11,
+      "\xe3\x83\x8b\xe3\x83\xa5\xe3\x83\xbc\xe3\x82\xb9\xef\xbc\x97\x5b\xe5"
+      "\xad\x97\x5d",
+      "\xa5\xcb\xa5\xe5\xa1\xbc\xa5\xb9\xa3\xb7\x5b\xbb\xfa\x5d"
+  },
+  /* ＮＨＫニュース　おはよう日本[字][デ] */
+  {
+      "\x23\x4e\x23\x48\x23\x4b\x1b\x7c\xcb\xe5\x21\x3c\xb9\x21\x21\x1b\x7d"
+      "\xaa\xcf\xe8\xa6\x46\x7c\x4b\x5c\x7a\x56\x7a\x58", 29,
+      "\xef\xbc\xae\xef\xbc\xa8\xef\xbc\xab\xe3\x83\x8b\xe3\x83\xa5\xe3\x83"
+      "\xbc\xe3\x82\xb9\xe3\x80\x80\xe3\x81\x8a\xe3\x81\xaf\xe3\x82\x88\xe3"
+      "\x81\x86\xe6\x97\xa5\xe6\x9c\xac\x5b\xe5\xad\x97\x5d\x5b\xe3\x83\x87"
+      "\x5d",
+      "\xa3\xce\xa3\xc8\xa3\xcb\xa5\xcb\xa5\xe5\xa1\xbc\xa5\xb9\xa1\xa1\xa4"
+      "\xaa\xa4\xcf\xa4\xe8\xa4\xa6\xc6\xfc\xcb\xdc\x5b\xbb\xfa\x5d\x5b\xa5"
+      "\xc7\x5d"
+  },
+  /* 天気予報・交通情報 */
+  {
+      "\x45\x37\x35\x24\x4d\x3d\x4a\x73\x21\x26\x38\x72\x44\x4c\x3e\x70\x4a"
+      "\x73", 18,
+      "\xe5\xa4\xa9\xe6\xb0\x97\xe4\xba\x88\xe5\xa0\xb1\xe3\x83\xbb\xe4\xba"
+      "\xa4\xe9\x80\x9a\xe6\x83\x85\xe5\xa0\xb1",
+      "\xc5\xb7\xb5\xa4\xcd\xbd\xca\xf3\xa1\xa6\xb8\xf2\xc4\xcc\xbe\xf0\xca"
+      "\xf3"
+  },
+  /* 首都圏ネットワーク[字] */
+  {
+      "\x3c\x73\x45\x54\x37\x77\x1b\x7c\xcd\xc3\xc8\xef\x21\x3c\xaf\x7a\x56", 17,
+      "\xe9\xa6\x96\xe9\x83\xbd\xe5\x9c\x8f\xe3\x83\x8d\xe3\x83\x83\xe3\x83"
+      "\x88\xe3\x83\xaf\xe3\x83\xbc\xe3\x82\xaf\x5b\xe5\xad\x97\x5d",
+      "\xbc\xf3\xc5\xd4\xb7\xf7\xa5\xcd\xa5\xc3\xa5\xc8\xa5\xef\xa1\xbc\xa5"
+      "\xaf\x5b\xbb\xfa\x5d"
+  },
+  /* 連続テレビ小説　第１２週「あたらしい朝」（６７）[字][解][デ] */
+  {
+      "\x4f\x22\x42\x33\x1b\x7c\xc6\xec\xd3\x3e\x2e\x40\x62\x21\x21\x42\x68"
+      "\x23\x31\x23\x32\x3d\x35\x21\x56\x1b\x7d\xa2\xbf\xe9\xb7\xa4\x44\x2b"
+      "\x21\x57\x21\x4a\x23\x36\x23\x37\x21\x4b\x7a\x56\x7a\x5c\x7a\x58", 50,
+      "\xe9\x80\xa3\xe7\xb6\x9a\xe3\x83\x86\xe3\x83\xac\xe3\x83\x93\xe5\xb0"
+      "\x8f\xe8\xaa\xac\xe3\x80\x80\xe7\xac\xac\xef\xbc\x91\xef\xbc\x92\xe9"
+      "\x80\xb1\xe3\x80\x8c\xe3\x81\x82\xe3\x81\x9f\xe3\x82\x89\xe3\x81\x97"
+      "\xe3\x81\x84\xe6\x9c\x9d\xe3\x80\x8d\xef\xbc\x88\xef\xbc\x96\xef\xbc"
+      "\x97\xef\xbc\x89\x5b\xe5\xad\x97\x5d\x5b\xe8\xa7\xa3\x5d\x5b\xe3\x83"
+      "\x87\x5d",
+      "\xcf\xa2\xc2\xb3\xa5\xc6\xa5\xec\xa5\xd3\xbe\xae\xc0\xe2\xa1\xa1\xc2"
+      "\xe8\xa3\xb1\xa3\xb2\xbd\xb5\xa1\xd6\xa4\xa2\xa4\xbf\xa4\xe9\xa4\xb7"
+      "\xa4\xa4\xc4\xab\xa1\xd7\xa1\xca\xa3\xb6\xa3\xb7\xa1\xcb\x5b\xbb\xfa"
+      "\x5d\x5b\xb2\xf2\x5d\x5b\xa5\xc7\x5d"
+  },
+  /* 大河ドラマ　第３８回「決戦の時」[字][再] */
+  {
+      "\x42\x67\x32\x4f\x1b\x7c\xc9\xe9\xde\x21\x21\x42\x68\x23\x33\x23\x38"
+      "\x32\x73\x21\x56\x37\x68\x40\x6f\x1b\x7d\xce\x3b\x7e\x21\x57\x7a\x56"
+      "\x7a\x6a", 36,
+      "\xe5\xa4\xa7\xe6\xb2\xb3\xe3\x83\x89\xe3\x83\xa9\xe3\x83\x9e\xe3\x80"
+      "\x80\xe7\xac\xac\xef\xbc\x93\xef\xbc\x98\xe5\x9b\x9e\xe3\x80\x8c\xe6"
+      "\xb1\xba\xe6\x88\xa6\xe3\x81\xae\xe6\x99\x82\xe3\x80\x8d\x5b\xe5\xad"
+      "\x97\x5d\x5b\xe5\x86\x8d\x5d",
+      "\xc2\xe7\xb2\xcf\xa5\xc9\xa5\xe9\xa5\xde\xa1\xa1\xc2\xe8\xa3\xb3\xa3"
+      "\xb8\xb2\xf3\xa1\xd6\xb7\xe8\xc0\xef\xa4\xce\xbb\xfe\xa1\xd7\x5b\xbb"
+      "\xfa\x5d\x5b\xba\xc6\x5d"
+  },
+  /* きょうの料理　旬の野菜でつくる秋のおかず[字] */
+  {
+      "\xad\xe7\xa6\xce\x4e\x41\x4d\x7d\x21\x21\x3d\x5c\xce\x4c\x6e\x3a\x5a"
+      "\xc7\xc4\xaf\xeb\x3d\x29\xce\xaa\xab\xba\x7a\x56", 29,
+      "\xe3\x81\x8d\xe3\x82\x87\xe3\x81\x86\xe3\x81\xae\xe6\x96\x99\xe7\x90"
+      "\x86\xe3\x80\x80\xe6\x97\xac\xe3\x81\xae\xe9\x87\x8e\xe8\x8f\x9c\xe3"
+      "\x81\xa7\xe3\x81\xa4\xe3\x81\x8f\xe3\x82\x8b\xe7\xa7\x8b\xe3\x81\xae"
+      "\xe3\x81\x8a\xe3\x81\x8b\xe3\x81\x9a\x5b\xe5\xad\x97\x5d",
+      "\xa4\xad\xa4\xe7\xa4\xa6\xa4\xce\xce\xc1\xcd\xfd\xa1\xa1\xbd\xdc\xa4"
+      "\xce\xcc\xee\xba\xda\xa4\xc7\xa4\xc4\xa4\xaf\xa4\xeb\xbd\xa9\xa4\xce"
+      "\xa4\xaa\xa4\xab\xa4\xba\x5b\xbb\xfa\x5d"
+  },
+  /* ドキュメント７２時間「深夜の食堂で」[字] */
+  {
+      "\x1b\x7c\xc9\xad\xe5\xe1\xf3\xc8\x23\x37\x23\x32\x3b\x7e\x34\x56\x21"
+      "\x56\x3f\x3c\x4c\x6b\x1b\x7d\xce\x3f\x29\x46\x32\xc7\x21\x57\x7a\x56", 34,
+      "\xe3\x83\x89\xe3\x82\xad\xe3\x83\xa5\xe3\x83\xa1\xe3\x83\xb3\xe3\x83"
+      "\x88\xef\xbc\x97\xef\xbc\x92\xe6\x99\x82\xe9\x96\x93\xe3\x80\x8c\xe6"
+      "\xb7\xb1\xe5\xa4\x9c\xe3\x81\xae\xe9\xa3\x9f\xe5\xa0\x82\xe3\x81\xa7"
+      "\xe3\x80\x8d\x5b\xe5\xad\x97\x5d",
+      "\xa5\xc9\xa5\xad\xa5\xe5\xa5\xe1\xa5\xf3\xa5\xc8\xa3\xb7\xa3\xb2\xbb"
+      "\xfe\xb4\xd6\xa1\xd6\xbf\xbc\xcc\xeb\xa4\xce\xbf\xa9\xc6\xb2\xa4\xc7"
+      "\xa1\xd7\x5b\xbb\xfa\x5d"
+  },
+  /* 映画「七人の侍」[字][解] */
+  {
+      "\x31\x47\x32\x68\x21\x56\x3c\x37\x3f\x4d\xce\x3b\x78\x21\x57\x7a\x56"
+      "\x7a\x5c", 19,
+      "\xe6\x98\xa0\xe7\x94\xbb\xe3\x80\x8c\xe4\xb8\x83\xe4\xba\xba\xe3\x81"
+      "\xae\xe4\xbe\x8d\xe3\x80\x8d\x5b\xe5\xad\x97\x5d\x5b\xe8\xa7\xa3\x5d",
+      "\xb1\xc7\xb2\xe8\xa1\xd6\xbc\xb7\xbf\xcd\xa4\xce\xbb\xf8\xa1\xd7\x5b"
+      "\xbb\xfa\x5d\x5b\xb2\xf2\x5d"
+  },
+  /* プロ野球　巨人×阪神　～東京ドームから中継～[字][デ] */
+  {
+      "\x1b\x7c\xd7\xed\x4c\x6e\x35\x65\x21\x21\x35\x70\x3f\x4d\x21\x5f\x3a"
+      "\x65\x3f\x40\x21\x21\x22\x32\x45\x6c\x35\x7e\xc9\x21\x3c\xe0\x1b\x7d"
+      "\xab\xe9\x43\x66\x37\x51\x22\x32\x7a\x56\x7a\x58", 46,
+      "\xe3\x83\x97\xe3\x83\xad\xe9\x87\x8e\xe7\x90\x83\xe3\x80\x80\xe5\xb7"
+      "\xa8\xe4\xba\xba\xc3\x97\xe9\x98\xaa\xe7\xa5\x9e\xe3\x80\x80\xef\xbd"
+      "\x9e\xe6\x9d\xb1\xe4\xba\xac\xe3\x83\x89\xe3\x83\xbc\xe3\x83\xa0\xe3"
+      "\x81\x8b\xe3\x82\x89\xe4\xb8\xad\xe7\xb6\x99\xef\xbd\x9e\x5b\xe5\xad"
+      "\x97\x5d\x5b\xe3\x83\x87\x5d",
+      "\xa5\xd7\xa5\xed\xcc\xee\xb5\xe5\xa1\xa1\xb5\xf0\xbf\xcd\xa1\xdf\xba"
+      "\xe5\xbf\xc0\xa1\xa1\xa2\xb2\xc5\xec\xb5\xfe\xa5\xc9\xa1\xbc\xa5\xe0"
+      "\xa4\xab\xa4\xe9\xc3\xe6\xb7\xd1\xa2\xb2\x5b\xbb\xfa\x5d\x5b\xa5\xc7"
+      "\x5d"
+  },
+  /* 大相撲秋場所　十日目[字] */
+  {
+      "\x42\x67\x41\x6a\x4b\x50\x3d\x29\x3e\x6c\x3d\x6a\x21\x21\x3d\x3d\x46"
+      "\x7c\x4c\x5c\x7a\x56", 22,
+      "\xe5\xa4\xa7\xe7\x9b\xb8\xe6\x92\xb2\xe7\xa7\x8b\xe5\xa0\xb4\xe6\x89"
+      "\x80\xe3\x80\x80\xe5\x8d\x81\xe6\x97\xa5\xe7\x9b\xae\x5b\xe5\xad\x97"
+      "\x5d",
+      "\xc2\xe7\xc1\xea\xcb\xd0\xbd\xa9\xbe\xec\xbd\xea\xa1\xa1\xbd\xbd\xc6"
+      "\xfc\xcc\xdc\x5b\xbb\xfa\x5d"
+  },
+  /* ＦＩＦＡワールドカップ予選　日本×オーストラリア[二][字] */
+  {
+      "\x23\x46\x23\x49\x23\x46\x23\x41\x1b\x7c\xef\x21\x3c\xeb\xc9\xab\xc3"
+      "\xd7\x4d\x3d\x41\x2a\x21\x21\x46\x7c\x4b\x5c\x21\x5f\xaa\x21\x3c\xb9"
+      "\xc8\xe9\xea\xa2\x7a\x5a\x7a\x56", 42,
+      "\xef\xbc\xa6\xef\xbc\xa9\xef\xbc\xa6\xef\xbc\xa1\xe3\x83\xaf\xe3\x83"
+      "\xbc\xe3\x83\xab\xe3\x83\x89\xe3\x82\xab\xe3\x83\x83\xe3\x83\x97\xe4"
+      "\xba\x88\xe9\x81\xb8\xe3\x80\x80\xe6\x97\xa5\xe6\x9c\xac\xc3\x97\xe3"
+      "\x82\xaa\xe3\x83\xbc\xe3\x82\xb9\xe3\x83\x88\xe3\x83\xa9\xe3\x83\xaa"
+      "\xe3\x82\xa2\x5b\xe4\xba\x8c\x5d\x5b\xe5\xad\x97\x5d",
+      "\xa3\xc6\xa3\xc9\xa3\xc6\xa3\xc1\xa5\xef\xa1\xbc\xa5\xeb\xa5\xc9\xa5"
+      "\xab\xa5\xc3\xa5\xd7\xcd\xbd\xc1\xaa\xa1\xa1\xc6\xfc\xcb\xdc\xa1\xdf"
+      "\xa5\xaa\xa1\xbc\xa5\xb9\xa5\xc8\xa5\xe9\xa5\xea\xa5\xa2\x5b\xc6\xf3"
+      "\x5d\x5b\xbb\xfa\x5d"
+  },
+  /* 名探偵コナン[字][デ] */
+  {
+      "\x4c\x3e\x43\x35\x44\x65\x1b\x7c\xb3\xca\xf3\x7a\x56\x7a\x58", 15,
+      "\xe5\x90\x8d\xe6\x8e\xa2\xe5\x81\xb5\xe3\x82\xb3\xe3\x83\x8a\xe3\x83"
+      "\xb3\x5b\xe5\xad\x97\x5d\x5b\xe3\x83\x87\x5d",
+      "\xcc\xbe\xc3\xb5\xc4\xe5\xa5\xb3\xa5\xca\xa5\xf3\x5b\xbb\xfa\x5d\x5b"
+      "\xa5\xc7\x5d"
+  },
+  /* アニメ　ドラえもん　「のび太の宇宙旅行」[字] */
+  {
+      "\x1b\x7c\xa2\xcb\xe1\x21\x21\xc9\xe9\x1b\x7d\xa8\xe2\xf3\x21\x21\x21"
+      "\x56\xce\xd3\x42\x40\xce\x31\x27\x43\x68\x4e\x39\x39\x54\x21\x57\x7a"
+      "\x56", 35,
+      "\xe3\x82\xa2\xe3\x83\x8b\xe3\x83\xa1\xe3\x80\x80\xe3\x83\x89\xe3\x83"
+      "\xa9\xe3\x81\x88\xe3\x82\x82\xe3\x82\x93\xe3\x80\x80\xe3\x80\x8c\xe3"
+      "\x81\xae\xe3\x81\xb3\xe5\xa4\xaa\xe3\x81\xae\xe5\xae\x87\xe5\xae\x99"
+      "\xe6\x97\x85\xe8\xa1\x8c\xe3\x80\x8d\x5b\xe5\xad\x97\x5d",
+      "\xa5\xa2\xa5\xcb\xa5\xe1\xa1\xa1\xa5\xc9\xa5\xe9\xa4\xa8\xa4\xe2\xa4"
+      "\xf3\xa1\xa1\xa1\xd6\xa4\xce\xa4\xd3\xc2\xc0\xa4\xce\xb1\xa7\xc3\xe8"
+      "\xce\xb9\xb9\xd4\xa1\xd7\x5b\xbb\xfa\x5d"
+  },
+  /* 英会話タイムトライアル[二] */
+  {
+      "\x31\x51\x32\x71\x4f\x43\x1b\x7c\xbf\xa4\xe0\xc8\xe9\xa4\xa2\xeb\x7a"
+      "\x5a", 18,
+      "\xe8\x8b\xb1\xe4\xbc\x9a\xe8\xa9\xb1\xe3\x82\xbf\xe3\x82\xa4\xe3\x83"
+      "\xa0\xe3\x83\x88\xe3\x83\xa9\xe3\x82\xa4\xe3\x82\xa2\xe3\x83\xab\x5b"
+      "\xe4\xba\x8c\x5d",
+      "\xb1\xd1\xb2\xf1\xcf\xc3\xa5\xbf\xa5\xa4\xa5\xe0\xa5\xc8\xa5\xe9\xa5"
+      "\xa4\xa5\xa2\xa5\xeb\x5b\xc6\xf3\x5d"
+  },
+  /* ＢＳ世界のドキュメンタリー　選「海の向こうの物語」[字][二] */
+  {
+      "\x23\x42\x23\x53\x40\x24\x33\x26\xce\x1b\x7c\xc9\xad\xe5\xe1\xf3\xbf"
+      "\xea\x21\x3c\x21\x21\x41\x2a\x21\x56\x33\x24\x1b\x7d\xce\x38\x7e\xb3"
+      "\xa6\xce\x4a\x2a\x38\x6c\x21\x57\x7a\x56\x7a\x5a", 46,
+      "\xef\xbc\xa2\xef\xbc\xb3\xe4\xb8\x96\xe7\x95\x8c\xe3\x81\xae\xe3\x83"
+      "\x89\xe3\x82\xad\xe3\x83\xa5\xe3\x83\xa1\xe3\x83\xb3\xe3\x82\xbf\xe3"
+      "\x83\xaa\xe3\x83\xbc\xe3\x80\x80\xe9\x81\xb8\xe3\x80\x8c\xe6\xb5\xb7"
+      "\xe3\x81\xae\xe5\x90\x91\xe3\x81\x93\xe3\x81\x86\xe3\x81\xae\xe7\x89"
+      "\xa9\xe8\xaa\x9e\xe3\x80\x8d\x5b\xe5\xad\x97\x5d\x5b\xe4\xba\x8c\x5d",
+      "\xa3\xc2\xa3\xd3\xc0\xa4\xb3\xa6\xa4\xce\xa5\xc9\xa5\xad\xa5\xe5\xa5"
+      "\xe1\xa5\xf3\xa5\xbf\xa5\xea\xa1\xbc\xa1\xa1\xc1\xaa\xa1\xd6\xb3\xa4"
+      "\xa4\xce\xb8\xfe\xa4\xb3\xa4\xa6\xa4\xce\xca\xaa\xb8\xec\xa1\xd7\x5b"
+      "\xbb\xfa\x5d\x5b\xc6\xf3\x5d"
+  },
+  /* クローズアップ現代＋[字] */
+  {
+      "\x1b\x7c\xaf\xed\x21\x3c\xba\xa2\xc3\xd7\x38\x3d\x42\x65\x21\x5c\x7a"
+      "\x56", 18,
+      "\xe3\x82\xaf\xe3\x83\xad\xe3\x83\xbc\xe3\x82\xba\xe3\x82\xa2\xe3\x83"
+      "\x83\xe3\x83\x97\xe7\x8f\xbe\xe4\xbb\xa3\xef\xbc\x8b\x5b\xe5\xad\x97"
+      "\x5d",
+      "\xa5\xaf\xa5\xed\xa1\xbc\xa5\xba\xa5\xa2\xa5\xc3\xa5\xd7\xb8\xbd\xc2"
+      "\xe5\xa1\xdc\x5b\xbb\xfa\x5d"
+  },
+  /* 今夜のゲストは俳優の山田太郎さん。デビュー作から最新作までの思い出を語る。 */
+  {
+      "\x3a\x23\x4c\x6b\xce\x1b\x7c\xb2\xb9\xc8\x1b\x7d\xcf\x47\x50\x4d\x25"
+      "\xce\x3b\x33\x45\x44\x42\x40\x4f\x3a\xb5\xf3\x21\x23\x1b\x7c\xc7\xd3"
+      "\xe5\x21\x3c\x3a\x6e\x1b\x7d\xab\xe9\x3a\x47\x3f\x37\x3a\x6e\xde\xc7"
+      "\xce\x3b\x57\xa4\x3d\x50\xf2\x38\x6c\xeb\x21\x23", 63,
+      "\xe4\xbb\x8a\xe5\xa4\x9c\xe3\x81\xae\xe3\x82\xb2\xe3\x82\xb9\xe3\x83"
+      "\x88\xe3\x81\xaf\xe4\xbf\xb3\xe5\x84\xaa\xe3\x81\xae\xe5\xb1\xb1\xe7"
+      "\x94\xb0\xe5\xa4\xaa\xe9\x83\x8e\xe3\x81\x95\xe3\x82\x93\xe3\x80\x82"
+      "\xe3\x83\x87\xe3\x83\x93\xe3\x83\xa5\xe3\x83\xbc\xe4\xbd\x9c\xe3\x81"
+      "\x8b\xe3\x82\x89\xe6\x9c\x80\xe6\x96\xb0\xe4\xbd\x9c\xe3\x81\xbe\xe3"
+      "\x81\xa7\xe3\x81\xae\xe6\x80\x9d\xe3\x81\x84\xe5\x87\xba\xe3\x82\x92"
+      "\xe8\xaa\x9e\xe3\x82\x8b\xe3\x80\x82",
+      "\xba\xa3\xcc\xeb\xa4\xce\xa5\xb2\xa5\xb9\xa5\xc8\xa4\xcf\xc7\xd0\xcd"
+      "\xa5\xa4\xce\xbb\xb3\xc5\xc4\xc2\xc0\xcf\xba\xa4\xb5\xa4\xf3\xa1\xa3"
+      "\xa5\xc7\xa5\xd3\xa5\xe5\xa1\xbc\xba\xee\xa4\xab\xa4\xe9\xba\xc7\xbf"
+      "\xb7\xba\xee\xa4\xde\xa4\xc7\xa4\xce\xbb\xd7\xa4\xa4\xbd\xd0\xa4\xf2"
+      "\xb8\xec\xa4\xeb\xa1\xa3"
+  },
+  /* 全国各地の天気と週間予報をお伝えします。台風１８号の最新情報も。 */
+  {
+      "\x41\x34\x39\x71\x33\x46\x43\x4f\xce\x45\x37\x35\x24\xc8\x3d\x35\x34"
+      "\x56\x4d\x3d\x4a\x73\xf2\xaa\x45\x41\xa8\xb7\xde\xb9\x21\x23\x42\x66"
+      "\x49\x77\x23\x31\x23\x38\x39\x66\xce\x3a\x47\x3f\x37\x3e\x70\x4a\x73"
+      "\xe2\x21\x23", 54,
+      "\xe5\x85\xa8\xe5\x9b\xbd\xe5\x90\x84\xe5\x9c\xb0\xe3\x81\xae\xe5\xa4"
+      "\xa9\xe6\xb0\x97\xe3\x81\xa8\xe9\x80\xb1\xe9\x96\x93\xe4\xba\x88\xe5"
+      "\xa0\xb1\xe3\x82\x92\xe3\x81\x8a\xe4\xbc\x9d\xe3\x81\x88\xe3\x81\x97"
+      "\xe3\x81\xbe\xe3\x81\x99\xe3\x80\x82\xe5\x8f\xb0\xe9\xa2\xa8\xef\xbc"
+      "\x91\xef\xbc\x98\xe5\x8f\xb7\xe3\x81\xae\xe6\x9c\x80\xe6\x96\xb0\xe6"
+      "\x83\x85\xe5\xa0\xb1\xe3\x82\x82\xe3\x80\x82",
+      "\xc1\xb4\xb9\xf1\xb3\xc6\xc3\xcf\xa4\xce\xc5\xb7\xb5\xa4\xa4\xc8\xbd"
+      "\xb5\xb4\xd6\xcd\xbd\xca\xf3\xa4\xf2\xa4\xaa\xc5\xc1\xa4\xa8\xa4\xb7"
+      "\xa4\xde\xa4\xb9\xa1\xa3\xc2\xe6\xc9\xf7\xa3\xb1\xa3\xb8\xb9\xe6\xa4"
+      "\xce\xba\xc7\xbf\xb7\xbe\xf0\xca\xf3\xa4\xe2\xa1\xa3"
+  },
+  /* 平日の朝、最新のニュースと天気、スポーツ、エンタメ情報をお届けする情報番組。 */
+  {
+      "\x4a\x3f\x46\x7c\xce\x44\x2b\x21\x22\x3a\x47\x3f\x37\xce\x1b\x7c\xcb"
+      "\xe5\x21\x3c\xb9\x1b\x7d\xc8\x45\x37\x35\x24\x21\x22\x1b\x7c\xb9\xdd"
+      "\x21\x3c\xc4\x21\x22\xa8\xf3\xbf\xe1\x3e\x70\x4a\x73\x1b\x7d\xf2\xaa"
+      "\x46\x4f\xb1\xb9\xeb\x3e\x70\x4a\x73\x48\x56\x41\x48\x21\x23", 66,
+      "\xe5\xb9\xb3\xe6\x97\xa5\xe3\x81\xae\xe6\x9c\x9d\xe3\x80\x81\xe6\x9c"
+      "\x80\xe6\x96\xb0\xe3\x81\xae\xe3\x83\x8b\xe3\x83\xa5\xe3\x83\xbc\xe3"
+      "\x82\xb9\xe3\x81\xa8\xe5\xa4\xa9\xe6\xb0\x97\xe3\x80\x81\xe3\x82\xb9"
+      "\xe3\x83\x9d\xe3\x83\xbc\xe3\x83\x84\xe3\x80\x81\xe3\x82\xa8\xe3\x83"
+      "\xb3\xe3\x82\xbf\xe3\x83\xa1\xe6\x83\x85\xe5\xa0\xb1\xe3\x82\x92\xe3"
+      "\x81\x8a\xe5\xb1\x8a\xe3\x81\x91\xe3\x81\x99\xe3\x82\x8b\xe6\x83\x85"
+      "\xe5\xa0\xb1\xe7\x95\xaa\xe7\xb5\x84\xe3\x80\x82",
+      "\xca\xbf\xc6\xfc\xa4\xce\xc4\xab\xa1\xa2\xba\xc7\xbf\xb7\xa4\xce\xa5"
+      "\xcb\xa5\xe5\xa1\xbc\xa5\xb9\xa4\xc8\xc5\xb7\xb5\xa4\xa1\xa2\xa5\xb9"
+      "\xa5\xdd\xa1\xbc\xa5\xc4\xa1\xa2\xa5\xa8\xa5\xf3\xa5\xbf\xa5\xe1\xbe"
+      "\xf0\xca\xf3\xa4\xf2\xa4\xaa\xc6\xcf\xa4\xb1\xa4\xb9\xa4\xeb\xbe\xf0"
+      "\xca\xf3\xc8\xd6\xc1\xc8\xa1\xa3"
+  },
+  /* 北海道から沖縄まで、各地の祭りを訪ねる旅。今回は青森のねぶた祭。 */
+  {
+      "\x4b\x4c\x33\x24\x46\x3b\xab\xe9\x32\x2d\x46\x6c\xde\xc7\x21\x22\x33"
+      "\x46\x43\x4f\xce\x3a\x57\xea\xf2\x4b\x2c\xcd\xeb\x4e\x39\x21\x23\x3a"
+      "\x23\x32\x73\xcf\x40\x44\x3f\x39\xce\xcd\xd6\xbf\x3a\x57\x21\x23", 50,
+      "\xe5\x8c\x97\xe6\xb5\xb7\xe9\x81\x93\xe3\x81\x8b\xe3\x82\x89\xe6\xb2"
+      "\x96\xe7\xb8\x84\xe3\x81\xbe\xe3\x81\xa7\xe3\x80\x81\xe5\x90\x84\xe5"
+      "\x9c\xb0\xe3\x81\xae\xe7\xa5\xad\xe3\x82\x8a\xe3\x82\x92\xe8\xa8\xaa"
+      "\xe3\x81\xad\xe3\x82\x8b\xe6\x97\x85\xe3\x80\x82\xe4\xbb\x8a\xe5\x9b"
+      "\x9e\xe3\x81\xaf\xe9\x9d\x92\xe6\xa3\xae\xe3\x81\xae\xe3\x81\xad\xe3"
+      "\x81\xb6\xe3\x81\x9f\xe7\xa5\xad\xe3\x80\x82",
+      "\xcb\xcc\xb3\xa4\xc6\xbb\xa4\xab\xa4\xe9\xb2\xad\xc6\xec\xa4\xde\xa4"
+      "\xc7\xa1\xa2\xb3\xc6\xc3\xcf\xa4\xce\xba\xd7\xa4\xea\xa4\xf2\xcb\xac"
+      "\xa4\xcd\xa4\xeb\xce\xb9\xa1\xa3\xba\xa3\xb2\xf3\xa4\xcf\xc0\xc4\xbf"
+      "\xb9\xa4\xce\xa4\xcd\xa4\xd6\xa4\xbf\xba\xd7\xa1\xa3"
+  },
+  /* 【出演】山田花子，鈴木一郎，佐藤次郎　【司会】田中三郎 */
+  {
+      "\x21\x5a\x3d\x50\x31\x69\x21\x5b\x3b\x33\x45\x44\x32\x56\x3b\x52\x21"
+      "\x24\x4e\x6b\x4c\x5a\x30\x6c\x4f\x3a\x21\x24\x3a\x34\x46\x23\x3c\x21"
+      "\x4f\x3a\x21\x21\x21\x5a\x3b\x4a\x32\x71\x21\x5b\x45\x44\x43\x66\x3b"
+      "\x30\x4f\x3a", 54,
+      "\xe3\x80\x90\xe5\x87\xba\xe6\xbc\x94\xe3\x80\x91\xe5\xb1\xb1\xe7\x94"
+      "\xb0\xe8\x8a\xb1\xe5\xad\x90\xef\xbc\x8c\xe9\x88\xb4\xe6\x9c\xa8\xe4"
+      "\xb8\x80\xe9\x83\x8e\xef\xbc\x8c\xe4\xbd\x90\xe8\x97\xa4\xe6\xac\xa1"
+      "\xe9\x83\x8e\xe3\x80\x80\xe3\x80\x90\xe5\x8f\xb8\xe4\xbc\x9a\xe3\x80"
+      "\x91\xe7\x94\xb0\xe4\xb8\xad\xe4\xb8\x89\xe9\x83\x8e",
+      "\xa1\xda\xbd\xd0\xb1\xe9\xa1\xdb\xbb\xb3\xc5\xc4\xb2\xd6\xbb\xd2\xa1"
+      "\xa4\xce\xeb\xcc\xda\xb0\xec\xcf\xba\xa1\xa4\xba\xb4\xc6\xa3\xbc\xa1"
+      "\xcf\xba\xa1\xa1\xa1\xda\xbb\xca\xb2\xf1\xa1\xdb\xc5\xc4\xc3\xe6\xbb"
+      "\xb0\xcf\xba"
+  },
+  /* 世界各国の料理を紹介。今回はイタリア・ナポリのピッツァ職人を訪ねる。 */
+  {
+      "\x40\x24\x33\x26\x33\x46\x39\x71\xce\x4e\x41\x4d\x7d\xf2\x3e\x52\x32"
+      "\x70\x21\x23\x3a\x23\x32\x73\xcf\x1b\x7c\xa4\xbf\xea\xa2\x21\x26\xca"
+      "\xdd\xea\x1b\x7d\xce\x1b\x7c\xd4\xc3\xc4\xa1\x3f\x26\x3f\x4d\x1b\x7d"
+      "\xf2\x4b\x2c\xcd\xeb\x21\x23", 58,
+      "\xe4\xb8\x96\xe7\x95\x8c\xe5\x90\x84\xe5\x9b\xbd\xe3\x81\xae\xe6\x96"
+      "\x99\xe7\x90\x86\xe3\x82\x92\xe7\xb4\xb9\xe4\xbb\x8b\xe3\x80\x82\xe4"
+      "\xbb\x8a\xe5\x9b\x9e\xe3\x81\xaf\xe3\x82\xa4\xe3\x82\xbf\xe3\x83\xaa"
+      "\xe3\x82\xa2\xe3\x83\xbb\xe3\x83\x8a\xe3\x83\x9d\xe3\x83\xaa\xe3\x81"
+      "\xae\xe3\x83\x94\xe3\x83\x83\xe3\x83\x84\xe3\x82\xa1\xe8\x81\xb7\xe4"
+      "\xba\xba\xe3\x82\x92\xe8\xa8\xaa\xe3\x81\xad\xe3\x82\x8b\xe3\x80\x82",
+      "\xc0\xa4\xb3\xa6\xb3\xc6\xb9\xf1\xa4\xce\xce\xc1\xcd\xfd\xa4\xf2\xbe"
+      "\xd2\xb2\xf0\xa1\xa3\xba\xa3\xb2\xf3\xa4\xcf\xa5\xa4\xa5\xbf\xa5\xea"
+      "\xa5\xa2\xa1\xa6\xa5\xca\xa5\xdd\xa5\xea\xa4\xce\xa5\xd4\xa5\xc3\xa5"
+      "\xc4\xa5\xa1\xbf\xa6\xbf\xcd\xa4\xf2\xcb\xac\xa4\xcd\xa4\xeb\xa1\xa3"
+  },
+  /* 番組内容　第５話。主人公は東京の下町で小さなパン屋を営む女性。ある日、店に一通の手紙が届く。 */
+  {
+      "\x48\x56\x41\x48\x46\x62\x4d\x46\x21\x21\x42\x68\x23\x35\x4f\x43\x21"
+      "\x23\x3c\x67\x3f\x4d\x38\x78\xcf\x45\x6c\x35\x7e\xce\x32\x3c\x44\x2e"
+      "\xc7\x3e\x2e\xb5\xca\x1b\x7c\xd1\xf3\x32\x30\x1b\x7d\xf2\x31\x44\xe0"
+      "\x3d\x77\x40\x2d\x21\x23\xa2\xeb\x46\x7c\x21\x22\x45\x39\xcb\x30\x6c"
+      "\x44\x4c\xce\x3c\x6a\x3b\x66\xac\x46\x4f\xaf\x21\x23", 81,
+      "\xe7\x95\xaa\xe7\xb5\x84\xe5\x86\x85\xe5\xae\xb9\xe3\x80\x80\xe7\xac"
+      "\xac\xef\xbc\x95\xe8\xa9\xb1\xe3\x80\x82\xe4\xb8\xbb\xe4\xba\xba\xe5"
+      "\x85\xac\xe3\x81\xaf\xe6\x9d\xb1\xe4\xba\xac\xe3\x81\xae\xe4\xb8\x8b"
+      "\xe7\x94\xba\xe3\x81\xa7\xe5\xb0\x8f\xe3\x81\x95\xe3\x81\xaa\xe3\x83"
+      "\x91\xe3\x83\xb3\xe5\xb1\x8b\xe3\x82\x92\xe5\x96\xb6\xe3\x82\x80\xe5"
+      "\xa5\xb3\xe6\x80\xa7\xe3\x80\x82\xe3\x81\x82\xe3\x82\x8b\xe6\x97\xa5"
+      "\xe3\x80\x81\xe5\xba\x97\xe3\x81\xab\xe4\xb8\x80\xe9\x80\x9a\xe3\x81"
+      "\xae\xe6\x89\x8b\xe7\xb4\x99\xe3\x81\x8c\xe5\xb1\x8a\xe3\x81\x8f\xe3"
+      "\x80\x82",
+      "\xc8\xd6\xc1\xc8\xc6\xe2\xcd\xc6\xa1\xa1\xc2\xe8\xa3\xb5\xcf\xc3\xa1"
+      "\xa3\xbc\xe7\xbf\xcd\xb8\xf8\xa4\xcf\xc5\xec\xb5\xfe\xa4\xce\xb2\xbc"
+      "\xc4\xae\xa4\xc7\xbe\xae\xa4\xb5\xa4\xca\xa5\xd1\xa5\xf3\xb2\xb0\xa4"
+      "\xf2\xb1\xc4\xa4\xe0\xbd\xf7\xc0\xad\xa1\xa3\xa4\xa2\xa4\xeb\xc6\xfc"
+      "\xa1\xa2\xc5\xb9\xa4\xcb\xb0\xec\xc4\xcc\xa4\xce\xbc\xea\xbb\xe6\xa4"
+      "\xac\xc6\xcf\xa4\xaf\xa1\xa3"
+  },
+  /* ショップチャンネル　家電特集 */
+  {
+      "\x1b\x7c\xb7\xe7\xc3\xd7\xc1\xe3\xf3\xcd\xeb\x21\x21\x32\x48\x45\x45"
+      "\x46\x43\x3d\x38", 21,
+      "\xe3\x82\xb7\xe3\x83\xa7\xe3\x83\x83\xe3\x83\x97\xe3\x83\x81\xe3\x83"
+      "\xa3\xe3\x83\xb3\xe3\x83\x8d\xe3\x83\xab\xe3\x80\x80\xe5\xae\xb6\xe9"
+      "\x9b\xbb\xe7\x89\xb9\xe9\x9b\x86",
+      "\xa5\xb7\xa5\xe7\xa5\xc3\xa5\xd7\xa5\xc1\xa5\xe3\xa5\xf3\xa5\xcd\xa5"
+      "\xeb\xa1\xa1\xb2\xc8\xc5\xc5\xc6\xc3\xbd\xb8"
+  },
+  /* ＣＮＮニュース[二] */
+  {
+      "\x23\x43\x23\x4e\x23\x4e\x1b\x7c\xcb\xe5\x21\x3c\xb9\x7a\x5a", 15,
+      "\xef\xbc\xa3\xef\xbc\xae\xef\xbc\xae\xe3\x83\x8b\xe3\x83\xa5\xe3\x83"
+      "\xbc\xe3\x82\xb9\x5b\xe4\xba\x8c\x5d",
+      "\xa3\xc3\xa3\xce\xa3\xce\xa5\xcb\xa5\xe5\xa1\xbc\xa5\xb9\x5b\xc6\xf3"
+      "\x5d"
+  },
+  /* ＪリーグＹＢＣルヴァンカップ　準決勝　第２戦[字] */
+  {
+      "\x23\x4a\x1b\x7c\xea\x21\x3c\xb0\x23\x59\x23\x42\x23\x43\xeb\xf4\xa1"
+      "\xf3\xab\xc3\xd7\x21\x21\x3d\x60\x37\x68\x3e\x21\x21\x21\x42\x68\x23"
+      "\x32\x40\x6f\x7a\x56", 39,
+      "\xef\xbc\xaa\xe3\x83\xaa\xe3\x83\xbc\xe3\x82\xb0\xef\xbc\xb9\xef\xbc"
+      "\xa2\xef\xbc\xa3\xe3\x83\xab\xe3\x83\xb4\xe3\x82\xa1\xe3\x83\xb3\xe3"
+      "\x82\xab\xe3\x83\x83\xe3\x83\x97\xe3\x80\x80\xe6\xba\x96\xe6\xb1\xba"
+      "\xe5\x8b\x9d\xe3\x80\x80\xe7\xac\xac\xef\xbc\x92\xe6\x88\xa6\x5b\xe5"
+      "\xad\x97\x5d",
+      "\xa3\xca\xa5\xea\xa1\xbc\xa5\xb0\xa3\xd9\xa3\xc2\xa3\xc3\xa5\xeb\xa5"
+      "\xf4\xa5\xa1\xa5\xf3\xa5\xab\xa5\xc3\xa5\xd7\xa1\xa1\xbd\xe0\xb7\xe8"
+      "\xbe\xa1\xa1\xa1\xc2\xe8\xa3\xb2\xc0\xef\x5b\xbb\xfa\x5d"
+  },
+  /* ｄボタンで番組に参加できます！ */
+  {
+      "\x23\x64\x1b\x7c\xdc\xbf\xf3\x1b\x7d\xc7\x48\x56\x41\x48\xcb\x3b\x32"
+      "\x32\x43\xc7\xad\xde\xb9\x21\x2a", 25,
+      "\xef\xbd\x84\xe3\x83\x9c\xe3\x82\xbf\xe3\x83\xb3\xe3\x81\xa7\xe7\x95"
+      "\xaa\xe7\xb5\x84\xe3\x81\xab\xe5\x8f\x82\xe5\x8a\xa0\xe3\x81\xa7\xe3"
+      "\x81\x8d\xe3\x81\xbe\xe3\x81\x99\xef\xbc\x81",
+      "\xa3\xe4\xa5\xdc\xa5\xbf\xa5\xf3\xa4\xc7\xc8\xd6\xc1\xc8\xa4\xcb\xbb"
+      "\xb2\xb2\xc3\xa4\xc7\xa4\xad\xa4\xde\xa4\xb9\xa1\xaa"
+  },
+  /* 放送休止 */
+  {
+      "\x4a\x7c\x41\x77\x35\x59\x3b\x5f", 8,
+      "\xe6\x94\xbe\xe9\x80\x81\xe4\xbc\x91\xe6\xad\xa2",
+      "\xca\xfc\xc1\xf7\xb5\xd9\xbb\xdf"
+  },
+  /* E-Girls LIVE 2024 in TOKYO */
+  {
+      "\x0e\x45\x2d\x47\x69\x72\x6c\x73\x20\x4c\x49\x56\x45\x20\x32\x30\x32"
+      "\x34\x20\x69\x6e\x20\x54\x4f\x4b\x59\x4f", 27,
+      "\x45\x2d\x47\x69\x72\x6c\x73\x20\x4c\x49\x56\x45\x20\x32\x30\x32\x34"
+      "\x20\x69\x6e\x20\x54\x4f\x4b\x59\x4f",
+      "\x45\x2d\x47\x69\x72\x6c\x73\x20\x4c\x49\x56\x45\x20\x32\x30\x32\x34"
+      "\x20\x69\x6e\x20\x54\x4f\x4b\x59\x4f"
+  }
+};
@@ -0,0 +1,134 @@
+/* GStreamer
+ *
+ * aribstr.c: benchmark of the ARIB STD-B24 to UTF-8 string conversion
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <gst/mpegts/mpegts.h>
+#include "gstmpegts-private.h"
+
+#include "aribstr-corpus.h"
+
+#define N_ROUNDS 2000
+
+typedef gsize (*ConvertFunc) (const AribCorpusEntry * entry);
+
+static gsize
+convert_alloc (const AribCorpusEntry * entry)
+{
+  gchar *str = aribstr_to_utf8 (entry->arib, entry->arib_len);
+  gsize len = strlen (str);
+
+  g_free (str);
+
+  return len;
+}
+
+static gsize
+convert_buf (const AribCorpusEntry * entry)
+{
+  gchar buf[ARIBSTR_UTF8_MAX_LEN (256)];
+
+  return aribstr_to_utf8_buf (entry->arib, entry->arib_len, buf, sizeof buf);
+}
+
+/* What the conversion used to cost on top of building the EUC-JP string */
+static gsize
+convert_iconv (const AribCorpusEntry * entry)
+{
+  gchar *str = g_convert_with_fallback (entry->euc, -1, "utf-8",
+      "EUC-JISX0213", "<?>", NULL, NULL, NULL);
+  gsize len = str ? strlen (str) : 0;
+
+  g_free (str);
+
+  return len;
+}
+
+static gdouble
+run (ConvertFunc convert, gsize * total)
+{
+  gint64 start, elapsed = G_MAXINT64;
+  gsize input = 0;
+  guint i, j, k;
+
+  for (i = 0; i < G_N_ELEMENTS (arib_corpus); i++)
+    input += arib_corpus[i].arib_len;
+
+  /* Keep the best of a few runs */
+  for (k = 0; k < 5; k++) {
+    start = g_get_monotonic_time ();
+    *total = 0;
+    for (j = 0; j < N_ROUNDS; j++) {
+      for (i = 0; i < G_N_ELEMENTS (arib_corpus); i++)
+        *total += convert (&arib_corpus[i]);
+    }
+    elapsed = MIN (elapsed, g_get_monotonic_time () - start);
+  }
+
+  /* Strings per second */
+  return (gdouble) N_ROUNDS * G_N_ELEMENTS (arib_corpus) * G_USEC_PER_SEC /
+      MAX (elapsed, 1);
+}
+
+int
+main (int argc, char **argv)
+{
+  gboolean ok = TRUE;
+  gdouble iconv_rate, alloc_rate, buf_rate;
+  gsize iconv_total, alloc_total, buf_total;
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (arib_corpus); i++) {
+    gchar *str = aribstr_to_utf8 (arib_corpus[i].arib,
+        arib_corpus[i].arib_len);
+
+    if (g_strcmp0 (str, arib_corpus[i].utf8) != 0) {
+      g_printerr ("Corpus entry %u converted to \"%s\" instead of \"%s\"\n",
+          i, str, arib_corpus[i].utf8);
+      ok = FALSE;
+    }
+    g_free (str);
+  }
+
+  iconv_rate = run (convert_iconv, &iconv_total);
+  alloc_rate = run (convert_alloc, &alloc_total);
+  buf_rate = run (convert_buf, &buf_total);
+
+  g_print ("%u strings, %" G_GSIZE_FORMAT " bytes of UTF-8 per round\n",
+      (guint) G_N_ELEMENTS (arib_corpus), buf_total / N_ROUNDS);
+  g_print ("%-24s %14s %8s\n", "conversion", "strings/s", "speedup");
+  g_print ("%-24s %14.0f %7.2fx\n", "iconv (EUC-JISX0213)", iconv_rate, 1.0);
+  g_print ("%-24s %14.0f %7.2fx\n", "aribstr_to_utf8", alloc_rate,
+      alloc_rate / iconv_rate);
+  g_print ("%-24s %14.0f %7.2fx\n", "aribstr_to_utf8_buf", buf_rate,
+      buf_rate / iconv_rate);
+
+  if (alloc_total != buf_total) {
+    g_printerr ("Conversions disagree (%" G_GSIZE_FORMAT "/%" G_GSIZE_FORMAT
+        " bytes)\n", alloc_total, buf_total);
+    ok = FALSE;
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,287 @@
+/* GStreamer
+ *
+ * mpegtssection.c: benchmark of the EIT section parsing
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <gst/gst.h>
+#include <gst/mpegts/mpegts.h>
+
+/* The EIT schedule of a day of ISDB-S broadcast: 24 services, 8 days of
+ * schedule each, in sections of 4 events. Each section of the schedule is
+ * repeated, as if it had been captured this many times over the day. */
+#define N_SERVICES 24
+#define N_DAYS 8
+#define EVENTS_PER_DAY 24
+#define EVENTS_PER_SECTION 4
+#define DEFAULT_REPETITIONS 20
+
+#define EIT_PID 0x12
+
+static guint32
+calc_crc32 (const guint8 * data, guint datalen)
+{
+  guint32 crc = 0xffffffff;
+  guint i, j;
+
+  for (i = 0; i < datalen; i++) {
+    crc ^= data[i] << 24;
+    for (j = 0; j < 8; j++)
+      crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04c11db7 : crc << 1;
+  }
+
+  return crc;
+}
+
+/* Kanji set characters, as found in names and descriptions */
+static void
+fill_text (guint8 * data, guint len, guint seed)
+{
+  guint i;
+
+  for (i = 0; i < len; i++)
+    data[i] = 0x30 + (seed + i * 7) % 0x20;
+}
+
+static guint8 *
+write_descriptor (guint8 * data, guint8 tag, guint len, guint seed)
+{
+  data[0] = tag;
+  data[1] = len;
+  fill_text (data + 2, len, seed);
+
+  return data + 2 + len;
+}
+
+/* Writes the descriptors ISDB broadcasters put on every event */
+static guint8 *
+write_event_descriptors (guint8 * data, guint seed)
+{
+  /* short_event: language, 32 bytes of name and 64 bytes of text */
+  data[0] = GST_MTS_DESC_DVB_SHORT_EVENT;
+  data[1] = 3 + 1 + 32 + 1 + 64;
+  memcpy (data + 2, "jpn", 3);
+  data[5] = 32;
+  fill_text (data + 6, 32, seed);
+  data[38] = 64;
+  fill_text (data + 39, 64, seed + 1);
+  data += 2 + data[1];
+
+  data = write_descriptor (data, GST_MTS_DESC_DVB_EXTENDED_EVENT, 120,
+      seed + 2);
+  data = write_descriptor (data, GST_MTS_DESC_DVB_COMPONENT, 9, seed + 3);
+  data = write_descriptor (data, GST_MTS_DESC_ISDB_AUDIO_COMPONENT, 12,
+      seed + 4);
+  data = write_descriptor (data, GST_MTS_DESC_DVB_CONTENT, 2, seed + 5);
+
+  return data;
+}
+
+static guint8 *
+make_eit_section (guint16 service_id, guint8 table_id, guint8 section_number,
+    guint8 last_section_number, guint first_event, gsize * size)
+{
+  guint8 *data = g_malloc (4096), *p, *loop;
+  guint i, section_length;
+
+  data[0] = table_id;
+  GST_WRITE_UINT16_BE (data + 3, service_id);
+  data[5] = 0xc1;
+  data[6] = section_number;
+  data[7] = last_section_number;
+  GST_WRITE_UINT16_BE (data + 8, 0x0004);       /* transport_stream_id */
+  GST_WRITE_UINT16_BE (data + 10, 0x0004);      /* original_network_id */
+  data[12] = last_section_number;
+  data[13] = table_id;
+
+  p = data + 14;
+  for (i = 0; i < EVENTS_PER_SECTION; i++) {
+    guint event = first_event + i;
+
+    GST_WRITE_UINT16_BE (p, event);
+    /* MJD and BCD start time, one hour long */
+    GST_WRITE_UINT16_BE (p + 2, 0xe4d4 + event / EVENTS_PER_DAY);
+    p[4] = ((event % 24) / 10) << 4 | (event % 24) % 10;
+    p[5] = 0x00;
+    p[6] = 0x00;
+    p[7] = 0x01;
+    p[8] = 0x00;
+    p[9] = 0x00;
+    loop = write_event_descriptors (p + 12, service_id * 1000 + event);
+    GST_WRITE_UINT16_BE (p + 10, 0x8000 | (loop - (p + 12)));
+    p = loop;
+  }
+
+  section_length = p + 4 - (data + 3);
+  GST_WRITE_UINT16_BE (data + 1, 0xf000 | section_length);
+  GST_WRITE_UINT32_BE (p, calc_crc32 (data, p - data));
+
+  *size = p + 4 - data;
+
+  return data;
+}
+
+typedef struct
+{
+  guint8 *data;
+  gsize size;
+} Section;
+
+static GPtrArray *
+make_schedule (void)
+{
+  GPtrArray *sections = g_ptr_array_new ();
+  guint service, day, i;
+  guint sections_per_day = EVENTS_PER_DAY / EVENTS_PER_SECTION;
+
+  for (service = 0; service < N_SERVICES; service++) {
+    for (day = 0; day < N_DAYS; day++) {
+      for (i = 0; i < sections_per_day; i++) {
+        Section *s = g_new (Section, 1);
+
+        /* One table id per 4 days */
+        s->data = make_eit_section (0x0100 + service, 0x50 + day / 4,
+            (day % 4) * sections_per_day + i, 4 * sections_per_day - 1,
+            day * EVENTS_PER_DAY + i * EVENTS_PER_SECTION, &s->size);
+        g_ptr_array_add (sections, s);
+      }
+    }
+  }
+
+  return sections;
+}
+
+/* Parses @s and returns a checksum of what was looked at */
+static guint64
+parse_section (const Section * s, gboolean arena, gboolean short_events)
+{
+  GstMpegtsSection *section;
+  const GstMpegtsEIT *eit;
+  guint64 sum = 0;
+  guint i, j;
+
+  section = gst_mpegts_section_new (EIT_PID, g_memdup (s->data, s->size),
+      s->size);
+  if (arena)
+    gst_mpegts_section_set_arena_parsing (section, TRUE);
+
+  eit = gst_mpegts_section_get_eit (section);
+  g_assert (eit != NULL);
+
+  for (i = 0; i < eit->events->len; i++) {
+    GstMpegtsEITEvent *event = g_ptr_array_index (eit->events, i);
+
+    sum += event->event_id;
+    for (j = 0; j < event->descriptors->len; j++) {
+      GstMpegtsDescriptor *desc = g_ptr_array_index (event->descriptors, j);
+
+      sum += desc->tag + desc->length;
+      if (short_events && desc->tag == GST_MTS_DESC_DVB_SHORT_EVENT) {
+        gchar *lang, *name, *text;
+
+        if (gst_mpegts_descriptor_parse_dvb_short_event (desc, &lang, &name,
+                &text)) {
+          sum += strlen (name) + strlen (text);
+          g_free (lang);
+          g_free (name);
+          g_free (text);
+        }
+      }
+    }
+  }
+
+  gst_mpegts_section_unref (section);
+
+  return sum;
+}
+
+static gdouble
+run (GPtrArray * sections, guint repetitions, gboolean arena,
+    gboolean short_events, guint64 * checksum)
+{
+  gint64 start, elapsed = G_MAXINT64;
+  guint i, j, k;
+
+  /* Keep the best of a few runs */
+  for (k = 0; k < 3; k++) {
+    start = g_get_monotonic_time ();
+    *checksum = 0;
+    for (j = 0; j < repetitions; j++) {
+      for (i = 0; i < sections->len; i++)
+        *checksum += parse_section (g_ptr_array_index (sections, i), arena,
+            short_events);
+    }
+    elapsed = MIN (elapsed, g_get_monotonic_time () - start);
+  }
+
+  /* Sections per second */
+  return (gdouble) repetitions * sections->len * G_USEC_PER_SEC /
+      MAX (elapsed, 1);
+}
+
+int
+main (int argc, char **argv)
+{
+  GPtrArray *sections;
+  guint repetitions = DEFAULT_REPETITIONS;
+  gboolean ok = TRUE;
+  guint i;
+
+  gst_init (&argc, &argv);
+  gst_mpegts_initialize ();
+
+  if (argc > 1)
+    repetitions = MAX (atoi (argv[1]), 1);
+
+  sections = make_schedule ();
+  g_print ("%u EIT sections, parsed %u times\n", sections->len, repetitions);
+  g_print ("%-20s %14s %14s %8s\n", "workload", "eager sect/s",
+      "arena sect/s", "speedup");
+
+  for (i = 0; i < 2; i++) {
+    guint64 eager_sum, arena_sum;
+    gdouble eager, arena;
+
+    eager = run (sections, repetitions, FALSE, i, &eager_sum);
+    arena = run (sections, repetitions, TRUE, i, &arena_sum);
+
+    g_print ("%-20s %14.0f %14.0f %7.2fx\n",
+        i ? "short events" : "descriptor walk", eager, arena, arena / eager);
+
+    if (eager_sum != arena_sum) {
+      g_printerr ("Parsing modes disagree\n");
+      ok = FALSE;
+    }
+  }
+
+  for (i = 0; i < sections->len; i++) {
+    Section *s = g_ptr_array_index (sections, i);
+
+    g_free (s->data);
+    g_free (s);
+  }
+  g_ptr_array_free (sections, TRUE);
+
+  return ok ? 0 : 1;
+}
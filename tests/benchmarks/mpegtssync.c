@@ -0,0 +1,183 @@
+/* GStreamer
+ *
+ * mpegtssync.c: benchmark of the MPEG-TS sync byte scanner
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <glib.h>
+
+#include "mpegtssync.h"
+
+#define CAPTURE_SIZE (32 * 1024 * 1024)
+#define MAX_PACKET_SIZE 208
+
+typedef gsize (*ScanFunc) (const guint8 * data, gsize start, gsize end,
+    const guint * packet_sizes, guint n_packet_sizes, guint n_syncs,
+    guint * packet_size);
+
+static const guint packet_sizes[] = { 188, 192, 204, 208 };
+
+/* Fills @data with runs of valid packets separated by bursts of garbage,
+ * @corruption being the ratio of garbage bytes. Garbage is a mix of random
+ * bytes and of truncated packets, so that it contains sync bytes too */
+static void
+generate_capture (GRand * rand, guint8 * data, gsize size, guint packet_size,
+    gdouble corruption)
+{
+  gsize offset = 0;
+
+  while (offset < size) {
+    gsize len;
+
+    if (g_rand_double (rand) < corruption) {
+      len = g_rand_int_range (rand, 1, 16 * packet_size);
+      len = MIN (len, size - offset);
+      while (len--) {
+        if (g_rand_int_range (rand, 0, 64) == 0)
+          data[offset++] = 0x47;
+        else
+          data[offset++] = g_rand_int_range (rand, 0, 256);
+      }
+    } else {
+      guint n = g_rand_int_range (rand, 1, 8);
+
+      while (n-- && offset + packet_size <= size) {
+        guint i;
+
+        data[offset] = 0x47;
+        for (i = 1; i < packet_size; i++)
+          data[offset + i] = g_rand_int_range (rand, 0, 256);
+        offset += packet_size;
+      }
+      if (offset + packet_size > size) {
+        memset (data + offset, 0, size - offset);
+        offset = size;
+      }
+    }
+  }
+}
+
+/* Walks the capture like the packetizer does: look for sync, then skip the
+ * valid packets and look for sync again. Returns the number of resyncs */
+static guint
+walk_capture (ScanFunc scan, const guint8 * data, gsize size,
+    guint packet_size, gboolean discover, guint64 * checksum)
+{
+  gsize offset = 0, end;
+  guint n_resyncs = 0;
+
+  if (discover)
+    end = size - 3 * MAX_PACKET_SIZE;
+  else
+    end = size - 2 * packet_size;
+
+  while (offset < end) {
+    guint found_size = packet_size;
+
+    if (discover)
+      offset = scan (data, offset, end, packet_sizes,
+          G_N_ELEMENTS (packet_sizes), 4, &found_size);
+    else
+      offset = scan (data, offset, end, &packet_size, 1, 3, NULL);
+
+    if (offset >= end)
+      break;
+
+    n_resyncs++;
+    *checksum = *checksum * 31 + offset * found_size;
+
+    while (offset < end && data[offset] == 0x47)
+      offset += found_size;
+  }
+
+  return n_resyncs;
+}
+
+static gdouble
+run (ScanFunc scan, const guint8 * data, gsize size,
+    guint packet_size, gboolean discover, guint * n_resyncs,
+    guint64 * checksum)
+{
+  gint64 start, elapsed = G_MAXINT64;
+  guint i;
+
+  /* Keep the best of a few runs */
+  for (i = 0; i < 5; i++) {
+    start = g_get_monotonic_time ();
+    *checksum = 0;
+    *n_resyncs = walk_capture (scan, data, size, packet_size, discover,
+        checksum);
+    elapsed = MIN (elapsed, g_get_monotonic_time () - start);
+  }
+
+  return (gdouble) size / MAX (elapsed, 1);
+}
+
+int
+main (int argc, char **argv)
+{
+  static const gdouble corruptions[] = { 0.01, 0.1, 0.5, 0.9 };
+  GRand *rand;
+  guint8 *data;
+  guint i, j, k;
+  gboolean ok = TRUE;
+
+  rand = g_rand_new_with_seed (0x47);
+  data = g_malloc (CAPTURE_SIZE);
+
+  g_print ("SIMD implementation: %s\n", mpegts_sync_get_implementation ());
+  g_print ("%-6s %-10s %-9s %8s %12s %12s %8s\n", "size", "corruption",
+      "mode", "resyncs", "scalar MB/s", "simd MB/s", "speedup");
+
+  for (i = 0; i < G_N_ELEMENTS (packet_sizes); i++) {
+    for (j = 0; j < G_N_ELEMENTS (corruptions); j++) {
+      generate_capture (rand, data, CAPTURE_SIZE, packet_sizes[i],
+          corruptions[j]);
+
+      for (k = 0; k < 2; k++) {
+        guint64 scalar_sum, simd_sum;
+        guint scalar_resyncs, simd_resyncs;
+        gdouble scalar, simd;
+
+        scalar = run (mpegts_sync_scan_scalar, data, CAPTURE_SIZE,
+            packet_sizes[i], k, &scalar_resyncs, &scalar_sum);
+        simd = run (mpegts_sync_scan, data, CAPTURE_SIZE,
+            packet_sizes[i], k, &simd_resyncs, &simd_sum);
+
+        g_print ("%-6u %-10.2f %-9s %8u %12.1f %12.1f %7.2fx\n",
+            packet_sizes[i], corruptions[j], k ? "discover" : "sync",
+            simd_resyncs, scalar, simd, simd / scalar);
+
+        if (scalar_resyncs != simd_resyncs || scalar_sum != simd_sum) {
+          g_printerr ("Scanners disagree (%u/%u resyncs)\n", scalar_resyncs,
+              simd_resyncs);
+          ok = FALSE;
+        }
+      }
+    }
+  }
+
+  g_free (data);
+  g_rand_free (rand);
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,257 @@
+/* GStreamer
+ *
+ * nalscan.c: benchmark of the H.264/H.265 start code scanner
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/gst.h>
+#include <gst/codecparsers/nalutils.h>
+
+/* 10 seconds of a 50 Mbit/s broadcast stream */
+#define BITRATE 50000000
+#define DURATION 10
+#define FRAMERATE 25
+
+typedef gint (*ScanFunc) (const guint8 * data, guint size,
+    GArray * epb_positions);
+
+typedef struct
+{
+  const gchar *name;
+  guint slices_per_frame;
+  guint8 aud[6];
+  guint aud_size;
+  guint8 slice_header[2];
+} StreamProfile;
+
+static const StreamProfile profiles[] = {
+  /* 1080i H.264, AUD then a few slices per field */
+  {"h264", 8, {0x09, 0xf0}, 2, {0x01, 0x9a}},
+  /* 2160p HEVC, AUD then one slice per CTU row */
+  {"h265", 34, {0x46, 0x01, 0x50}, 3, {0x02, 0x01}},
+};
+
+/* Appends @size escaped bytes of coded slice data. Arithmetic coded data is
+ * close to random, with a few more zero bytes */
+static void
+append_payload (GRand * rand, GByteArray * out, guint size)
+{
+  guint zeros = 0;
+
+  while (size--) {
+    guint8 byte;
+
+    if (g_rand_int_range (rand, 0, 32) == 0)
+      byte = 0;
+    else
+      byte = g_rand_int_range (rand, 0, 256);
+
+    if (zeros >= 2 && byte <= 3) {
+      guint8 epb = 0x03;
+
+      g_byte_array_append (out, &epb, 1);
+      zeros = 0;
+    }
+    g_byte_array_append (out, &byte, 1);
+    zeros = byte ? 0 : zeros + 1;
+  }
+}
+
+static void
+append_nal (GRand * rand, GByteArray * out, const guint8 * header,
+    guint header_size, guint payload_size)
+{
+  static const guint8 start_code[] = { 0x00, 0x00, 0x00, 0x01 };
+
+  g_byte_array_append (out, start_code, sizeof start_code);
+  g_byte_array_append (out, header, header_size);
+  append_payload (rand, out, payload_size);
+}
+
+static GByteArray *
+generate_stream (GRand * rand, const StreamProfile * profile)
+{
+  GByteArray *out = g_byte_array_new ();
+  guint frame_size = BITRATE / 8 / FRAMERATE;
+  guint i, j;
+
+  for (i = 0; i < DURATION * FRAMERATE; i++) {
+    append_nal (rand, out, profile->aud, profile->aud_size, 0);
+    for (j = 0; j < profile->slices_per_frame; j++)
+      append_nal (rand, out, profile->slice_header, 2,
+          frame_size / profile->slices_per_frame);
+  }
+
+  return out;
+}
+
+/* The implementation scan_for_start_codes() had before vectorization */
+static gint
+scan_byte_reader (const guint8 * data, guint size, GArray * epb_positions)
+{
+  GstByteReader br;
+
+  gst_byte_reader_init (&br, data, size);
+
+  return gst_byte_reader_masked_scan_uint32 (&br, 0xffffff00, 0x00000100,
+      0, size);
+}
+
+/* Splits the stream like gst_h264_parser_identify_nalu() does. Returns the
+ * number of NAL units */
+static guint
+walk_stream (ScanFunc scan, const guint8 * data, guint size,
+    GArray * epb_positions, guint64 * checksum)
+{
+  guint offset = 0, n_nals = 0;
+  gint off;
+
+  while ((off = scan (data + offset, size - offset, NULL)) >= 0) {
+    offset += off + 3;
+    n_nals++;
+
+    if (epb_positions)
+      g_array_set_size (epb_positions, 0);
+    off = scan (data + offset, size - offset, epb_positions);
+    if (off < 0)
+      break;
+
+    *checksum = *checksum * 31 + offset + off;
+    if (epb_positions)
+      *checksum += epb_positions->len;
+  }
+
+  return n_nals;
+}
+
+static gdouble
+run (ScanFunc scan, const guint8 * data, guint size, GArray * epb_positions,
+    guint * n_nals, guint64 * checksum)
+{
+  gint64 start, elapsed = G_MAXINT64;
+  guint i;
+
+  /* Keep the best of a few runs */
+  for (i = 0; i < 5; i++) {
+    start = g_get_monotonic_time ();
+    *checksum = 0;
+    *n_nals = walk_stream (scan, data, size, epb_positions, checksum);
+    elapsed = MIN (elapsed, g_get_monotonic_time () - start);
+  }
+
+  return (gdouble) size / MAX (elapsed, 1);
+}
+
+static gboolean
+bench_stream (const gchar * name, const guint8 * data, guint size)
+{
+  GArray *scalar_epb, *simd_epb;
+  guint64 ref_sum, scalar_sum, simd_sum, scalar_epb_sum, simd_epb_sum;
+  guint ref_nals, scalar_nals, simd_nals, n;
+  gdouble ref, scalar, simd, scalar_with_epb, simd_with_epb;
+  gboolean ok;
+
+  scalar_epb = g_array_new (FALSE, FALSE, sizeof (guint));
+  simd_epb = g_array_new (FALSE, FALSE, sizeof (guint));
+
+  ref = run (scan_byte_reader, data, size, NULL, &ref_nals, &ref_sum);
+  scalar = run (scan_for_start_codes_scalar, data, size, NULL, &scalar_nals,
+      &scalar_sum);
+  simd = run (scan_for_start_codes_with_epb, data, size, NULL, &simd_nals,
+      &simd_sum);
+  scalar_with_epb = run (scan_for_start_codes_scalar, data, size, scalar_epb,
+      &n, &scalar_epb_sum);
+  simd_with_epb = run (scan_for_start_codes_with_epb, data, size, simd_epb,
+      &n, &simd_epb_sum);
+
+  g_print ("%-24s %8u %10.1f %10.1f %10.1f %7.2fx %10.1f %10.1f\n", name,
+      simd_nals, ref, scalar, simd, simd / ref, scalar_with_epb,
+      simd_with_epb);
+
+  ok = ref_nals == scalar_nals && ref_nals == simd_nals
+      && ref_sum == scalar_sum && ref_sum == simd_sum
+      && scalar_epb_sum == simd_epb_sum;
+  if (!ok)
+    g_printerr ("Scanners disagree on %s\n", name);
+
+  g_array_free (scalar_epb, TRUE);
+  g_array_free (simd_epb, TRUE);
+
+  return ok;
+}
+
+/* Arguments are optional Annex B H.264 or H.265 elementary streams, such as
+ * the video of broadcast captures, to measure in addition to the generated
+ * ones */
+int
+main (int argc, char **argv)
+{
+  GRand *rand;
+  gboolean ok = TRUE;
+  gint i;
+
+  gst_init (&argc, &argv);
+
+  rand = g_rand_new_with_seed (0x000001);
+
+  g_print ("SIMD implementation: %s\n",
+      scan_for_start_codes_get_implementation ());
+  g_print ("%-24s %8s %10s %10s %10s %8s %10s %10s\n", "stream", "NALs",
+      "reader", "scalar", "simd", "speedup", "scalar+epb", "simd+epb");
+  g_print ("%-24s %8s %10s %10s %10s %8s %10s %10s\n", "", "", "MB/s",
+      "MB/s", "MB/s", "", "MB/s", "MB/s");
+
+  for (i = 0; i < G_N_ELEMENTS (profiles); i++) {
+    GByteArray *stream = generate_stream (rand, &profiles[i]);
+    gchar *name = g_strdup_printf ("%s %u Mbit/s", profiles[i].name,
+        BITRATE / 1000000);
+
+    ok &= bench_stream (name, stream->data, stream->len);
+
+    g_free (name);
+    g_byte_array_unref (stream);
+  }
+
+  for (i = 1; i < argc; i++) {
+    GMappedFile *file;
+    GError *err = NULL;
+    gchar *name;
+
+    file = g_mapped_file_new (argv[i], FALSE, &err);
+    if (file == NULL) {
+      g_printerr ("Can't open %s: %s\n", argv[i], err->message);
+      g_error_free (err);
+      ok = FALSE;
+      continue;
+    }
+
+    name = g_path_get_basename (argv[i]);
+    ok &= bench_stream (name,
+        (const guint8 *) g_mapped_file_get_contents (file),
+        g_mapped_file_get_length (file));
+    g_free (name);
+    g_mapped_file_unref (file);
+  }
+
+  g_rand_free (rand);
+
+  return ok ? 0 : 1;
+}
@@ -841,6 +841,22 @@ static guint8 h264_idr_slice_2[] = {
   0xd7, 0x5d, 0x75, 0xd7, 0x5e
 };
 
+/* P slices skipping all the macroblocks, frame_num 1 and 2 */
+static guint8 h264_p_slice_1[] = {
+  0x00, 0x00, 0x00, 0x01, 0x41, 0x9a, 0x00, 0x04,
+  0x00, 0x08, 0x50, 0x10, 0x60
+};
+
+static guint8 h264_p_slice_2[] = {
+  0x00, 0x00, 0x00, 0x01, 0x41, 0x9a, 0x00, 0x08,
+  0x00, 0x10, 0x50, 0x10, 0x60
+};
+
+/* Recovery point SEI, recovery_frame_cnt 0 */
+static guint8 h264_sei_recovery_point[] = {
+  0x00, 0x00, 0x00, 0x01, 0x06, 0x06, 0x01, 0xc4, 0x80
+};
+
 static inline GstBuffer *
 wrap_buffer (const guint8 * buf, gsize size, GstClockTime pts,
     GstBufferFlags flags)
@@ -1187,6 +1203,83 @@ GST_START_TEST (test_parse_skip_to_4bytes_sc)
 
 GST_END_TEST;
 
+/* Returns the buffers output for an IDR frame followed by P frames, the
+ * second of which has a recovery point SEI */
+static GList *
+parse_frames (gboolean light_parsing)
+{
+  GstHarness *h = gst_harness_new ("h264parse");
+  GList *buffers = NULL;
+  GstBuffer *buf;
+
+  g_object_set (h->element, "light-parsing", light_parsing, NULL);
+  gst_harness_set_caps_str (h,
+      "video/x-h264,stream-format=byte-stream,alignment=au,parsed=false,framerate=30/1",
+      "video/x-h264,stream-format=byte-stream,alignment=au,parsed=true");
+
+  buf = composite_buffer (0, 0, 4,
+      h264_slicing_sps, sizeof (h264_slicing_sps),
+      h264_slicing_pps, sizeof (h264_slicing_pps),
+      h264_idr_slice_1, sizeof (h264_idr_slice_1),
+      h264_idr_slice_2, sizeof (h264_idr_slice_2));
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+
+  buf = wrap_buffer (h264_p_slice_1, sizeof (h264_p_slice_1), 100, 0);
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+
+  buf = composite_buffer (200, 0, 2,
+      h264_sei_recovery_point, sizeof (h264_sei_recovery_point),
+      h264_p_slice_2, sizeof (h264_p_slice_2));
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+
+  buf = wrap_buffer (h264_p_slice_1, sizeof (h264_p_slice_1), 300, 0);
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+
+  while ((buf = gst_harness_try_pull (h)))
+    buffers = g_list_append (buffers, buf);
+
+  gst_harness_teardown (h);
+
+  return buffers;
+}
+
+GST_START_TEST (test_parse_light_parsing)
+{
+  const gboolean delta_units[] = { FALSE, TRUE, FALSE, TRUE };
+  GList *full, *light, *l, *m;
+  GstMapInfo map;
+  guint i = 0;
+
+  full = parse_frames (FALSE);
+  light = parse_frames (TRUE);
+
+  fail_unless_equals_int (g_list_length (full), G_N_ELEMENTS (delta_units));
+  fail_unless_equals_int (g_list_length (light), G_N_ELEMENTS (delta_units));
+
+  /* The output is the same, key frames included */
+  for (l = full, m = light; l; l = l->next, m = m->next, i++) {
+    GstBuffer *full_buf = l->data, *light_buf = m->data;
+
+    gst_buffer_map (full_buf, &map, GST_MAP_READ);
+    gst_check_buffer_data (light_buf, map.data, map.size);
+    gst_buffer_unmap (full_buf, &map);
+
+    fail_unless_equals_clocktime (GST_BUFFER_PTS (light_buf),
+        GST_BUFFER_PTS (full_buf));
+    fail_unless_equals_int (GST_BUFFER_FLAGS (light_buf),
+        GST_BUFFER_FLAGS (full_buf));
+    fail_unless_equals_int (GST_BUFFER_FLAG_IS_SET (full_buf,
+            GST_BUFFER_FLAG_DELTA_UNIT), delta_units[i]);
+  }
+
+  g_list_free_full (full, (GDestroyNotify) gst_buffer_unref);
+  g_list_free_full (light, (GDestroyNotify) gst_buffer_unref);
+}
+
+GST_END_TEST;
+
 
 /*
  * TODO:
@@ -1299,6 +1392,7 @@ main (int argc, char **argv)
     tcase_add_test (tc_chain, test_parse_sei_closedcaptions);
     tcase_add_test (tc_chain, test_parse_compatible_caps);
     tcase_add_test (tc_chain, test_parse_skip_to_4bytes_sc);
+    tcase_add_test (tc_chain, test_parse_light_parsing);
     nf += gst_check_run_suite (s, "h264parse", __FILE__);
   }
 
@@ -144,6 +144,22 @@ static const guint8 h265_128x128_slice_idr_n_lp[] = {
   0xef, 0x4f, 0xe1, 0xa3, 0xd4, 0x00, 0x02, 0xc2
 };
 
+/* TRAIL_R P slices predicted from the previous picture, POC 1 and 2 */
+static const guint8 h265_128x128_slice_trail_r_1[] = {
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xd0, 0x09,
+  0x70, 0xcf, 0xa5, 0x5a
+};
+
+static const guint8 h265_128x128_slice_trail_r_2[] = {
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xd0, 0x11,
+  0x70, 0xcf, 0xa5, 0x5a
+};
+
+/* Recovery point SEI, recovery_poc_cnt 0 */
+static const guint8 h265_sei_recovery_point[] = {
+  0x00, 0x00, 0x00, 0x01, 0x4e, 0x01, 0x06, 0x01, 0xd0, 0x80
+};
+
 /* multi-sliced data, generated on zynqultrascaleplus with:
  * gst-launch-1.0 videotestsrc num-buffers=1 pattern=green \
  *    ! video/x-raw,width=128,height=128 \
@@ -1051,6 +1067,83 @@ GST_START_TEST (test_drain)
 
 GST_END_TEST;
 
+/* Returns the buffers output for an IDR frame followed by P frames, the
+ * second of which has a recovery point SEI */
+static GList *
+parse_frames (gboolean light_parsing)
+{
+  GstHarness *h = gst_harness_new ("h265parse");
+  GList *buffers = NULL;
+  GstBuffer *buf;
+
+  g_object_set (h->element, "light-parsing", light_parsing, NULL);
+  bytestream_set_caps (h, "au", "au");
+
+  buf = composite_buffer (0, 0, 4,
+      h265_128x128_vps, sizeof (h265_128x128_vps),
+      h265_128x128_sps, sizeof (h265_128x128_sps),
+      h265_128x128_pps, sizeof (h265_128x128_pps),
+      h265_128x128_slice_idr_n_lp, sizeof (h265_128x128_slice_idr_n_lp));
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+
+  buf = wrap_buffer (h265_128x128_slice_trail_r_1,
+      sizeof (h265_128x128_slice_trail_r_1), 100, 0);
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+
+  buf = composite_buffer (200, 0, 2,
+      h265_sei_recovery_point, sizeof (h265_sei_recovery_point),
+      h265_128x128_slice_trail_r_2, sizeof (h265_128x128_slice_trail_r_2));
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+
+  buf = wrap_buffer (h265_128x128_slice_trail_r_1,
+      sizeof (h265_128x128_slice_trail_r_1), 300, 0);
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+
+  while ((buf = gst_harness_try_pull (h)))
+    buffers = g_list_append (buffers, buf);
+
+  gst_harness_teardown (h);
+
+  return buffers;
+}
+
+GST_START_TEST (test_light_parsing)
+{
+  const gboolean delta_units[] = { FALSE, TRUE, FALSE, TRUE };
+  GList *full, *light, *l, *m;
+  GstMapInfo map;
+  guint i = 0;
+
+  full = parse_frames (FALSE);
+  light = parse_frames (TRUE);
+
+  fail_unless_equals_int (g_list_length (full), G_N_ELEMENTS (delta_units));
+  fail_unless_equals_int (g_list_length (light), G_N_ELEMENTS (delta_units));
+
+  /* The output is the same, key frames included */
+  for (l = full, m = light; l; l = l->next, m = m->next, i++) {
+    GstBuffer *full_buf = l->data, *light_buf = m->data;
+
+    gst_buffer_map (full_buf, &map, GST_MAP_READ);
+    gst_check_buffer_data (light_buf, map.data, map.size);
+    gst_buffer_unmap (full_buf, &map);
+
+    fail_unless_equals_clocktime (GST_BUFFER_PTS (light_buf),
+        GST_BUFFER_PTS (full_buf));
+    fail_unless_equals_int (GST_BUFFER_FLAGS (light_buf),
+        GST_BUFFER_FLAGS (full_buf));
+    fail_unless_equals_int (GST_BUFFER_FLAG_IS_SET (full_buf,
+            GST_BUFFER_FLAG_DELTA_UNIT), delta_units[i]);
+  }
+
+  g_list_free_full (full, (GDestroyNotify) gst_buffer_unref);
+  g_list_free_full (light, (GDestroyNotify) gst_buffer_unref);
+}
+
+GST_END_TEST;
+
 
 static Suite *
 h265parse_harnessed_suite (void)
@@ -1086,6 +1179,7 @@ h265parse_harnessed_suite (void)
   tcase_add_test (tc_chain, test_parse_sc_with_half_header);
 
   tcase_add_test (tc_chain, test_drain);
+  tcase_add_test (tc_chain, test_light_parsing);
 
   return s;
 }
@@ -18,9 +18,13 @@
  * Boston, MA 02110-1301, USA.
  */
 
+#include <string.h>
+
+#include <glib/gstdio.h>
 #include <gst/gst.h>
 #include <gst/check/gstcheck.h>
 #include <gst/check/gstharness.h>
+#include <gst/mpegts/mpegts.h>
 
 #define PACKETSIZE 188
 
@@ -284,6 +288,115 @@ GST_START_TEST (test_tsparse_align_split)
 
 GST_END_TEST;
 
+static GstPadProbeReturn
+count_buffer_lists (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  GstBufferList *list = GST_PAD_PROBE_INFO_BUFFER_LIST (info);
+  guint *n_lists = user_data;
+
+  fail_unless_equals_int (gst_buffer_list_length (list), aac_ts_packets);
+  *n_lists += 1;
+
+  return GST_PAD_PROBE_OK;
+}
+
+GST_START_TEST (test_tsparse_align_buffer_list)
+{
+  GstHarness *h = gst_harness_new ("tsparse");
+  GstBuffer *buf;
+  guint n_lists = 0;
+  gsize i;
+
+  gst_harness_set (h, "tsparse", "alignment", aac_ts_packets,
+      "buffer-list", TRUE, NULL);
+  gst_pad_add_probe (h->sinkpad, GST_PAD_PROBE_TYPE_BUFFER_LIST,
+      count_buffer_lists, &n_lists, NULL);
+
+  gst_harness_set_src_caps_str (h, "video/mpegts,systemstream=true");
+  gst_harness_set_sink_caps_str (h,
+      "video/mpegts,systemstream=true,packetsize=" G_STRINGIFY (PACKETSIZE));
+
+  buf =
+      gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY, (guint8 *) aac_ts,
+      sizeof aac_ts, 0, sizeof aac_ts, NULL, NULL);
+  for (i = 0; i < sizeof aac_ts; i += PACKETSIZE) {
+    fail_unless (gst_harness_push (h, gst_buffer_copy_region (buf,
+                GST_BUFFER_COPY_MEMORY, i, PACKETSIZE)) == GST_FLOW_OK);
+  }
+  gst_buffer_unref (buf);
+
+  gst_harness_push_event (h, gst_event_new_eos ());
+  fail_unless_equals_int (n_lists, 1);
+  fail_unless (gst_harness_buffers_in_queue (h) == aac_ts_packets,
+      "Expected %u buffers, got %u", aac_ts_packets,
+      gst_harness_buffers_in_queue (h));
+
+  for (i = 0; i < sizeof aac_ts; i += PACKETSIZE) {
+    buf = gst_harness_pull (h);
+    gst_check_buffer_data (buf, aac_ts + i, PACKETSIZE);
+    gst_buffer_unref (buf);
+  }
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+static GstBuffer *
+make_timed_buffer (const guint8 * data, gsize size, GstClockTime pts)
+{
+  GstBuffer *buf = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+      (guint8 *) data, size, 0, size, NULL, NULL);
+
+  GST_BUFFER_PTS (buf) = pts;
+
+  return buf;
+}
+
+GST_START_TEST (test_tsparse_batch_latency)
+{
+  GstHarness *h = gst_harness_new ("tsparse");
+  GstHarness *h_prog = gst_harness_new_with_element (h->element, NULL,
+      "program_1");
+  GstBuffer *buf;
+
+  gst_harness_set (h, "tsparse", "alignment", 100, "batch-latency", 10000,
+      NULL);
+  gst_harness_set_src_caps_str (h,
+      "video/mpegts,systemstream=true,packetsize=" G_STRINGIFY (PACKETSIZE));
+
+  /* PAT, PMT and a first audio packet of program 1, then padding packets
+   * which only go to the src pad */
+  fail_unless_equals_int (gst_harness_push (h, make_timed_buffer (aac_ts,
+              3 * PACKETSIZE, 0)), GST_FLOW_OK);
+  fail_unless_equals_int (gst_harness_push (h, make_timed_buffer (padding_ts,
+              PACKETSIZE, 5 * GST_MSECOND)), GST_FLOW_OK);
+  fail_unless_equals_int (gst_harness_buffers_in_queue (h), 0);
+  fail_unless_equals_int (gst_harness_buffers_in_queue (h_prog), 0);
+
+  /* Once the latency is reached, both pads are pushed, including the
+   * program one which got no packet from this input */
+  fail_unless_equals_int (gst_harness_push (h, make_timed_buffer (padding_ts,
+              PACKETSIZE, 20 * GST_MSECOND)), GST_FLOW_OK);
+  fail_unless_equals_int (gst_harness_buffers_in_queue (h), 1);
+  fail_unless_equals_int (gst_harness_buffers_in_queue (h_prog), 1);
+
+  buf = gst_harness_pull (h);
+  fail_unless_equals_int (gst_buffer_get_size (buf), 5 * PACKETSIZE);
+  gst_buffer_unref (buf);
+
+  buf = gst_harness_pull (h_prog);
+  fail_unless_equals_int (gst_buffer_get_size (buf), 3 * PACKETSIZE);
+  fail_unless_equals_int (gst_buffer_memcmp (buf, 2 * PACKETSIZE,
+          aac_ts + 2 * PACKETSIZE, PACKETSIZE), 0);
+  gst_buffer_unref (buf);
+
+  gst_harness_teardown (h_prog);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_tsparse_padding)
 {
   GstHarness *h = gst_harness_new ("tsparse");
@@ -335,6 +448,625 @@ GST_START_TEST (test_tsparse_padding)
 
 GST_END_TEST;
 
+/* Builds a TS packet carrying an EIT schedule section of service 1, with
+ * one event starting at each of the given hours */
+static GstBuffer *
+make_eit_schedule_packet (guint8 version, guint8 cc, const guint16 * event_ids,
+    const guint8 * hours, guint n_events)
+{
+  guint8 *data = g_malloc (PACKETSIZE), *section, *event;
+  guint section_length = 11 + 12 * n_events + 4;
+  guint i;
+
+  memset (data, 0xff, PACKETSIZE);
+  data[0] = 0x47;
+  data[1] = 0x40;
+  data[2] = 0x12;
+  data[3] = 0x10 | cc;
+  data[4] = 0x00;
+
+  section = data + 5;
+  section[0] = GST_MTS_TABLE_ID_EVENT_INFORMATION_ACTUAL_TS_SCHEDULE_1;
+  GST_WRITE_UINT16_BE (section + 1, 0xf000 | section_length);
+  GST_WRITE_UINT16_BE (section + 3, 0x0001);
+  section[5] = 0xc1 | (version << 1);
+  section[6] = 0x00;
+  section[7] = 0x00;
+  GST_WRITE_UINT16_BE (section + 8, 0x0001);
+  GST_WRITE_UINT16_BE (section + 10, 0x0001);
+  section[12] = 0x00;
+  section[13] = section[0];
+
+  for (i = 0; i < n_events; i++) {
+    event = section + 14 + 12 * i;
+    GST_WRITE_UINT16_BE (event, event_ids[i]);
+    /* MJD, then BCD start time and duration (1 hour) */
+    GST_WRITE_UINT16_BE (event + 2, 0xe4d4);
+    event[4] = (hours[i] / 10) << 4 | (hours[i] % 10);
+    event[5] = 0x00;
+    event[6] = 0x00;
+    event[7] = 0x01;
+    event[8] = 0x00;
+    event[9] = 0x00;
+    /* running, no descriptors */
+    GST_WRITE_UINT16_BE (event + 10, 0x8000);
+  }
+
+  GST_WRITE_UINT32_BE (section + 3 + section_length - 4,
+      _calc_crc32 (section, 3 + section_length - 4));
+
+  return gst_buffer_new_wrapped (data, PACKETSIZE);
+}
+
+static GstStructure *
+pop_eit_update (GstBus * bus)
+{
+  GstMessage *msg;
+  GstStructure *s = NULL;
+
+  while (s == NULL
+      && (msg = gst_bus_pop_filtered (bus, GST_MESSAGE_ELEMENT)) != NULL) {
+    if (gst_message_has_name (msg, "mpegts-eit-update"))
+      s = gst_structure_copy (gst_message_get_structure (msg));
+    gst_message_unref (msg);
+  }
+
+  return s;
+}
+
+static guint
+get_event_id (const GValue * events, guint i)
+{
+  GstMpegtsEITEvent *event =
+      g_value_get_boxed (gst_value_array_get_value (events, i));
+
+  return event->event_id;
+}
+
+GST_START_TEST (test_tsparse_eit_cache)
+{
+  GstHarness *h = gst_harness_new ("tsparse");
+  GstBus *bus = gst_bus_new ();
+  GstBuffer *buf;
+  GstStructure *s;
+  const GValue *events, *removed;
+  static const guint16 ids_v0[] = { 1, 2 }, ids_v1[] = { 2, 3 };
+  static const guint8 hours_v0[] = { 10, 11 }, hours_v1[] = { 12, 13 };
+
+  gst_element_set_bus (h->element, bus);
+  g_object_set (h->element, "cache-eit", TRUE, NULL);
+  gst_harness_set_src_caps_str (h,
+      "video/mpegts,systemstream=true,packetsize=" G_STRINGIFY (PACKETSIZE));
+
+  /* A section, its repetition and a new version */
+  buf = make_eit_schedule_packet (0, 0, ids_v0, hours_v0, 2);
+  buf = gst_buffer_append (buf,
+      make_eit_schedule_packet (0, 1, ids_v0, hours_v0, 2));
+  buf = gst_buffer_append (buf,
+      make_eit_schedule_packet (1, 2, ids_v1, hours_v1, 2));
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+
+  /* Both events are new */
+  s = pop_eit_update (bus);
+  fail_unless (s != NULL);
+  fail_unless (gst_structure_has_field (s, "service-id"));
+  events = gst_structure_get_value (s, "events");
+  removed = gst_structure_get_value (s, "removed");
+  fail_unless_equals_int (gst_value_array_get_size (events), 2);
+  fail_unless_equals_int (gst_value_array_get_size (removed), 0);
+  gst_structure_free (s);
+
+  /* The repetition was ignored. With the new version, event 1 was removed,
+   * event 2 moved and event 3 added */
+  s = pop_eit_update (bus);
+  fail_unless (s != NULL);
+  events = gst_structure_get_value (s, "events");
+  removed = gst_structure_get_value (s, "removed");
+  fail_unless_equals_int (gst_value_array_get_size (events), 2);
+  fail_unless_equals_int (get_event_id (events, 0), 2);
+  fail_unless_equals_int (get_event_id (events, 1), 3);
+  fail_unless_equals_int (gst_value_array_get_size (removed), 1);
+  fail_unless_equals_int (g_value_get_uint (gst_value_array_get_value (removed,
+              0)), 1);
+  gst_structure_free (s);
+
+  fail_unless (pop_eit_update (bus) == NULL);
+
+  /* Full schedule, sorted by start time */
+  g_signal_emit_by_name (h->element, "get-eit-schedule", 1, &s);
+  fail_unless (s != NULL);
+  events = gst_structure_get_value (s, "events");
+  fail_unless_equals_int (gst_value_array_get_size (events), 2);
+  fail_unless_equals_int (get_event_id (events, 0), 2);
+  fail_unless_equals_int (get_event_id (events, 1), 3);
+  gst_structure_free (s);
+
+  g_signal_emit_by_name (h->element, "get-eit-schedule", 2, &s);
+  fail_unless (s == NULL);
+
+  gst_element_set_bus (h->element, NULL);
+  gst_object_unref (bus);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_tsparse_eit_cache_program_pad)
+{
+  GstHarness *h = gst_harness_new ("tsparse");
+  GstHarness *h_prog = gst_harness_new_with_element (h->element, NULL,
+      "program_1");
+  GstBus *bus = gst_bus_new ();
+  GstBuffer *buf, *eit;
+  GstStructure *s;
+  GstMapInfo map;
+  static const guint16 ids_v0[] = { 1, 2 }, ids_v1[] = { 2, 3 };
+  static const guint8 hours_v0[] = { 10, 11 }, hours_v1[] = { 12, 13 };
+
+  gst_element_set_bus (h->element, bus);
+  g_object_set (h->element, "cache-eit", TRUE, NULL);
+  gst_harness_set_src_caps_str (h,
+      "video/mpegts,systemstream=true,packetsize=" G_STRINGIFY (PACKETSIZE));
+
+  /* PAT and PMT of program 1, then EIT schedule sections: once cached, the
+   * sections must still be forwarded to the program pad */
+  buf = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+      (guint8 *) aac_ts, 2 * PACKETSIZE, 0, 2 * PACKETSIZE, NULL, NULL);
+  eit = make_eit_schedule_packet (0, 0, ids_v0, hours_v0, 2);
+  eit = gst_buffer_append (eit,
+      make_eit_schedule_packet (1, 1, ids_v1, hours_v1, 2));
+  buf = gst_buffer_append (buf, gst_buffer_ref (eit));
+
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+  gst_harness_push_event (h, gst_event_new_eos ());
+
+  /* PAT, PMT and both EIT sections */
+  buf = gst_harness_take_all_data_as_buffer (h_prog);
+  fail_unless_equals_int (gst_buffer_get_size (buf), 4 * PACKETSIZE);
+  gst_buffer_map (eit, &map, GST_MAP_READ);
+  fail_unless_equals_int (gst_buffer_memcmp (buf, 2 * PACKETSIZE, map.data,
+          map.size), 0);
+  gst_buffer_unmap (eit, &map);
+  gst_buffer_unref (eit);
+  gst_buffer_unref (buf);
+
+  /* Both sections were cached */
+  s = pop_eit_update (bus);
+  fail_unless (s != NULL);
+  gst_structure_free (s);
+  s = pop_eit_update (bus);
+  fail_unless (s != NULL);
+  gst_structure_free (s);
+
+  gst_element_set_bus (h->element, NULL);
+  gst_object_unref (bus);
+  gst_harness_teardown (h_prog);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+/* Parses the section starting in @packet */
+static GstMpegtsSection *
+parse_packet_section (const guint8 * packet)
+{
+  const guint8 *data = packet + 4;
+  gsize len;
+
+  fail_unless (packet[1] & 0x40);
+  if (packet[3] & 0x20)
+    data += 1 + data[0];
+  data += 1 + data[0];
+  len = 3 + (GST_READ_UINT16_BE (data + 1) & 0x0fff);
+  fail_unless (data + len <= packet + PACKETSIZE);
+
+  return gst_mpegts_section_new (GST_READ_UINT16_BE (packet + 1) & 0x1fff,
+      g_memdup (data, len), len);
+}
+
+static GstBuffer *
+push_and_pull_remuxed (GstHarness * h)
+{
+  GstBuffer *buf;
+
+  gst_harness_set_src_caps_str (h, "video/mpegts,systemstream=true");
+
+  buf =
+      gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY, (guint8 *) aac_ts,
+      sizeof aac_ts, 0, sizeof aac_ts, NULL, NULL);
+  buf = gst_harness_push_and_pull (h, buf);
+  fail_unless (buf != NULL);
+  fail_unless_equals_int (gst_buffer_get_size (buf), sizeof aac_ts);
+
+  return buf;
+}
+
+GST_START_TEST (test_tsremux_pid_map)
+{
+  GstHarness *h = gst_harness_new ("tsremux");
+  GstMpegtsSection *section;
+  GstMpegtsPatProgram *program;
+  GstMpegtsPMTStream *stream;
+  const GstMpegtsPMT *pmt;
+  GPtrArray *programs;
+  GstBuffer *buf;
+  GstMapInfo map;
+  guint i;
+
+  g_object_set (h->element, "pid-map", "0x20=0x30,0x41=0x100", NULL);
+  buf = push_and_pull_remuxed (h);
+  gst_buffer_map (buf, &map, GST_MAP_READ);
+
+  /* The PAT points to the moved PMT */
+  section = parse_packet_section (map.data);
+  fail_unless_equals_int (section->pid, 0);
+  programs = gst_mpegts_section_get_pat (section);
+  fail_unless (programs != NULL);
+  fail_unless_equals_int (programs->len, 1);
+  program = g_ptr_array_index (programs, 0);
+  fail_unless_equals_int (program->program_number, 1);
+  fail_unless_equals_int (program->network_or_program_map_PID, 0x30);
+  g_ptr_array_unref (programs);
+  gst_mpegts_section_unref (section);
+
+  /* The PMT describes the moved stream and keeps its descriptors */
+  section = parse_packet_section (map.data + PACKETSIZE);
+  fail_unless_equals_int (section->pid, 0x30);
+  pmt = gst_mpegts_section_get_pmt (section);
+  fail_unless (pmt != NULL);
+  fail_unless_equals_int (pmt->program_number, 1);
+  fail_unless_equals_int (pmt->pcr_pid, 0x100);
+  fail_unless_equals_int (pmt->streams->len, 1);
+  stream = g_ptr_array_index (pmt->streams, 0);
+  fail_unless_equals_int (stream->stream_type, 0x0f);
+  fail_unless_equals_int (stream->pid, 0x100);
+  fail_unless_equals_int (stream->descriptors->len, 1);
+  gst_mpegts_section_unref (section);
+
+  /* Elementary stream packets only differ by their PID */
+  for (i = 2; i < sizeof aac_ts / PACKETSIZE; i++) {
+    const guint8 *in = aac_ts + i * PACKETSIZE;
+    const guint8 *out = map.data + i * PACKETSIZE;
+
+    fail_unless_equals_int (GST_READ_UINT16_BE (out + 1) & 0x1fff, 0x100);
+    fail_unless_equals_int (out[1] & 0xe0, in[1] & 0xe0);
+    fail_unless (memcmp (out + 3, in + 3, PACKETSIZE - 3) == 0);
+  }
+
+  gst_buffer_unmap (buf, &map);
+  gst_buffer_unref (buf);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_tsremux_keep_timing)
+{
+  GstHarness *h = gst_harness_new ("tsremux");
+  GstMpegtsSection *section;
+  GPtrArray *programs;
+  GstBuffer *buf;
+  GstMapInfo map;
+  guint i;
+
+  /* Program 2 doesn't exist, all but the PAT become null packets */
+  g_object_set (h->element, "programs", "2", "keep-timing", TRUE, NULL);
+  buf = push_and_pull_remuxed (h);
+  gst_buffer_map (buf, &map, GST_MAP_READ);
+
+  section = parse_packet_section (map.data);
+  programs = gst_mpegts_section_get_pat (section);
+  fail_unless (programs != NULL);
+  fail_unless_equals_int (programs->len, 0);
+  g_ptr_array_unref (programs);
+  gst_mpegts_section_unref (section);
+
+  for (i = 1; i < sizeof aac_ts / PACKETSIZE; i++)
+    fail_unless_equals_int (GST_READ_UINT16_BE (map.data + i * PACKETSIZE +
+            1) & 0x1fff, 0x1fff);
+
+  gst_buffer_unmap (buf, &map);
+  gst_buffer_unref (buf);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+/* Writes the header of a long section of @table_id whose data, CRC
+ * excluded, is @section_size bytes long */
+static void
+write_section_header (guint8 * section, guint8 table_id, guint16 extension,
+    guint8 version, guint section_size)
+{
+  section[0] = table_id;
+  GST_WRITE_UINT16_BE (section + 1, 0xb000 | (section_size + 4 - 3));
+  GST_WRITE_UINT16_BE (section + 3, extension);
+  section[5] = 0xc1 | (version << 1);
+  section[6] = section[7] = 0x00;
+}
+
+/* Appends the TS packets carrying the section of @section_size bytes (CRC
+ * excluded) at @section, which must have room for the CRC. @cc is the
+ * continuity counter of @pid */
+static void
+append_section_packets (GByteArray * ts, guint16 pid, guint8 * cc,
+    guint8 * section, guint section_size)
+{
+  guint offset = 0, size = section_size + 4;
+
+  GST_WRITE_UINT32_BE (section + section_size,
+      _calc_crc32 (section, section_size));
+
+  while (offset < size) {
+    guint8 packet[PACKETSIZE], *p = packet + 4;
+    guint avail = PACKETSIZE - 4, len;
+
+    memset (packet, 0xff, PACKETSIZE);
+    packet[0] = 0x47;
+    GST_WRITE_UINT16_BE (packet + 1, (offset == 0 ? 0x4000 : 0) | pid);
+    packet[3] = 0x10 | *cc;
+    *cc = (*cc + 1) & 0xf;
+    if (offset == 0) {
+      /* pointer_field */
+      *p++ = 0x00;
+      avail--;
+    }
+
+    len = MIN (avail, size - offset);
+    memcpy (p, section + offset, len);
+    offset += len;
+    g_byte_array_append (ts, packet, PACKETSIZE);
+  }
+}
+
+/* Appends an adaptation field only packet carrying @pcr */
+static void
+append_pcr_packet (GByteArray * ts, guint16 pid, guint64 pcr)
+{
+  guint8 packet[PACKETSIZE];
+  guint64 pcr_base = pcr / 300;
+
+  memset (packet, 0xff, PACKETSIZE);
+  packet[0] = 0x47;
+  GST_WRITE_UINT16_BE (packet + 1, pid);
+  packet[3] = 0x20;
+  packet[4] = PACKETSIZE - 5;
+  packet[5] = 0x10;
+  GST_WRITE_UINT32_BE (packet + 6, pcr_base >> 1);
+  packet[10] = ((pcr_base & 1) << 7) | 0x7e | ((pcr % 300) >> 8);
+  packet[11] = (pcr % 300) & 0xff;
+  g_byte_array_append (ts, packet, PACKETSIZE);
+}
+
+static guint64
+read_pcr (const guint8 * packet)
+{
+  guint64 pcr_base = (guint64) GST_READ_UINT32_BE (packet + 6) << 1 |
+      packet[10] >> 7;
+
+  return pcr_base * 300 + ((packet[10] & 1) << 8 | packet[11]);
+}
+
+/* Appends a payload only packet */
+static void
+append_data_packet (GByteArray * ts, guint16 pid)
+{
+  guint8 packet[PACKETSIZE];
+
+  memset (packet, 0xaa, PACKETSIZE);
+  packet[0] = 0x47;
+  GST_WRITE_UINT16_BE (packet + 1, pid);
+  packet[3] = 0x10;
+  g_byte_array_append (ts, packet, PACKETSIZE);
+}
+
+static guint16
+read_pid (const guint8 * packet)
+{
+  return GST_READ_UINT16_BE (packet + 1) & 0x1fff;
+}
+
+static GstBuffer *
+push_and_pull_remuxed_ts (GstHarness * h, GByteArray * ts)
+{
+  GstBuffer *buf;
+  guint size = ts->len;
+
+  gst_harness_set_src_caps_str (h, "video/mpegts,systemstream=true");
+
+  buf = gst_buffer_new_wrapped (g_byte_array_free (ts, FALSE), size);
+  buf = gst_harness_push_and_pull (h, buf);
+  fail_unless (buf != NULL);
+
+  return buf;
+}
+
+/* Checks the CA_PID of the CA descriptor @desc */
+static void
+check_ca_pid (GstMpegtsDescriptor * desc, guint16 expected)
+{
+  guint16 ca_system_id, ca_pid;
+
+  fail_unless (gst_mpegts_descriptor_parse_ca (desc, &ca_system_id, &ca_pid,
+          NULL, NULL));
+  fail_unless_equals_int (ca_system_id, 0x0100);
+  fail_unless_equals_int (ca_pid, expected);
+}
+
+GST_START_TEST (test_tsremux_ca)
+{
+  GstHarness *h = gst_harness_new ("tsremux");
+  GByteArray *ts = g_byte_array_new ();
+  GstMpegtsSection *section;
+  GstMpegtsPatProgram *program;
+  const GstMpegtsPMT *pmt;
+  GPtrArray *programs, *descriptors;
+  guint8 data[64], cc[3] = { 0, };
+  GstBuffer *buf;
+  GstMapInfo map;
+
+  /* PAT: NIT on PID 0x10, program 1 on PID 0x20 */
+  write_section_header (data, 0x00, 0x0001, 0, 16);
+  GST_WRITE_UINT16_BE (data + 8, 0x0000);
+  GST_WRITE_UINT16_BE (data + 10, 0xe010);
+  GST_WRITE_UINT16_BE (data + 12, 0x0001);
+  GST_WRITE_UINT16_BE (data + 14, 0xe020);
+  append_section_packets (ts, 0x0000, &cc[0], data, 16);
+
+  /* CAT: EMM stream on PID 0x50 */
+  write_section_header (data, 0x01, 0xffff, 0, 14);
+  data[8] = GST_MTS_DESC_CA;
+  data[9] = 4;
+  GST_WRITE_UINT16_BE (data + 10, 0x0100);
+  GST_WRITE_UINT16_BE (data + 12, 0xe050);
+  append_section_packets (ts, 0x0001, &cc[1], data, 14);
+
+  /* PMT: ECM stream on PID 0x51, MPEG-2 video on PID 0x41 */
+  write_section_header (data, 0x02, 0x0001, 0, 23);
+  GST_WRITE_UINT16_BE (data + 8, 0xe041);
+  GST_WRITE_UINT16_BE (data + 10, 0xf006);
+  data[12] = GST_MTS_DESC_CA;
+  data[13] = 4;
+  GST_WRITE_UINT16_BE (data + 14, 0x0100);
+  GST_WRITE_UINT16_BE (data + 16, 0xe051);
+  data[18] = 0x02;
+  GST_WRITE_UINT16_BE (data + 19, 0xe041);
+  GST_WRITE_UINT16_BE (data + 21, 0xf000);
+  append_section_packets (ts, 0x0020, &cc[2], data, 23);
+
+  append_data_packet (ts, 0x50);
+  append_data_packet (ts, 0x51);
+  append_data_packet (ts, 0x10);
+  append_data_packet (ts, 0x41);
+
+  /* 0x41 can't be moved onto the PID the EMMs were moved to */
+  g_object_set (h->element, "pid-map", "0x50=0x60,0x51=0x61,0x41=0x60",
+      NULL);
+  buf = push_and_pull_remuxed_ts (h, ts);
+  fail_unless_equals_int (gst_buffer_get_size (buf), 7 * PACKETSIZE);
+  gst_buffer_map (buf, &map, GST_MAP_READ);
+
+  /* The PAT still points to the NIT */
+  section = parse_packet_section (map.data);
+  programs = gst_mpegts_section_get_pat (section);
+  fail_unless (programs != NULL);
+  fail_unless_equals_int (programs->len, 2);
+  program = g_ptr_array_index (programs, 0);
+  fail_unless_equals_int (program->program_number, 0);
+  fail_unless_equals_int (program->network_or_program_map_PID, 0x10);
+  g_ptr_array_unref (programs);
+  gst_mpegts_section_unref (section);
+
+  /* The CA descriptors point to the moved EMM and ECM streams */
+  section = parse_packet_section (map.data + PACKETSIZE);
+  fail_unless_equals_int (section->pid, 0x0001);
+  descriptors = gst_mpegts_section_get_cat (section);
+  fail_unless (descriptors != NULL);
+  fail_unless_equals_int (descriptors->len, 1);
+  check_ca_pid (g_ptr_array_index (descriptors, 0), 0x60);
+  g_ptr_array_unref (descriptors);
+  gst_mpegts_section_unref (section);
+
+  section = parse_packet_section (map.data + 2 * PACKETSIZE);
+  pmt = gst_mpegts_section_get_pmt (section);
+  fail_unless (pmt != NULL);
+  fail_unless_equals_int (pmt->descriptors->len, 1);
+  check_ca_pid (g_ptr_array_index (pmt->descriptors, 0), 0x61);
+  fail_unless_equals_int (pmt->pcr_pid, 0x41);
+  gst_mpegts_section_unref (section);
+
+  fail_unless_equals_int (read_pid (map.data + 3 * PACKETSIZE), 0x60);
+  fail_unless_equals_int (read_pid (map.data + 4 * PACKETSIZE), 0x61);
+  fail_unless_equals_int (read_pid (map.data + 5 * PACKETSIZE), 0x10);
+  fail_unless_equals_int (read_pid (map.data + 6 * PACKETSIZE), 0x41);
+
+  gst_buffer_unmap (buf, &map);
+  gst_buffer_unref (buf);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+/* Writes a PMT of program 1 with MPEG-2 video on PID 0x41 and a program
+ * descriptor of @desc_size bytes */
+static guint
+write_pmt (guint8 * data, guint8 version, guint desc_size)
+{
+  guint size = 12 + 2 + desc_size + 5;
+
+  write_section_header (data, 0x02, 0x0001, version, size);
+  GST_WRITE_UINT16_BE (data + 8, 0xe041);
+  GST_WRITE_UINT16_BE (data + 10, 0xf000 | (2 + desc_size));
+  data[12] = 0x80;
+  data[13] = desc_size;
+  memset (data + 14, 0x55, desc_size);
+  data[14 + desc_size] = 0x02;
+  GST_WRITE_UINT16_BE (data + 15 + desc_size, 0xe041);
+  GST_WRITE_UINT16_BE (data + 17 + desc_size, 0xf000);
+
+  return size;
+}
+
+#define RESTAMP_PCR (G_GUINT64_CONSTANT (1000000) * 300)
+#define RESTAMP_PCR_STEP (G_GUINT64_CONSTANT (3000) * 300)
+
+GST_START_TEST (test_tsremux_restamp_pcr)
+{
+  GstHarness *h = gst_harness_new ("tsremux");
+  GByteArray *ts = g_byte_array_new ();
+  guint8 data[256], cc[2] = { 0, };
+  GstBuffer *buf;
+  GstMapInfo map;
+  guint size;
+
+  write_section_header (data, 0x00, 0x0001, 0, 12);
+  GST_WRITE_UINT16_BE (data + 8, 0x0001);
+  GST_WRITE_UINT16_BE (data + 10, 0xe020);
+  append_section_packets (ts, 0x0000, &cc[0], data, 12);
+
+  size = write_pmt (data, 0, 1);
+  append_section_packets (ts, 0x0020, &cc[1], data, size);
+
+  /* One PCR step per packet */
+  append_pcr_packet (ts, 0x41, RESTAMP_PCR);
+  append_pcr_packet (ts, 0x41, RESTAMP_PCR + RESTAMP_PCR_STEP);
+
+  /* A new PMT version spanning two packets: the previous version is
+   * repeated where it starts and the new one is written once complete, the
+   * following packets are delayed by one packet */
+  size = write_pmt (data, 1, 200);
+  append_section_packets (ts, 0x0020, &cc[1], data, size);
+  fail_unless_equals_int (ts->len, 6 * PACKETSIZE);
+
+  append_pcr_packet (ts, 0x41, RESTAMP_PCR + 4 * RESTAMP_PCR_STEP);
+
+  g_object_set (h->element, "keep-timing", TRUE, NULL);
+  buf = push_and_pull_remuxed_ts (h, ts);
+  fail_unless_equals_int (gst_buffer_get_size (buf), 8 * PACKETSIZE);
+  gst_buffer_map (buf, &map, GST_MAP_READ);
+
+  /* The PCRs that didn't move are untouched */
+  fail_unless_equals_uint64 (read_pcr (map.data + 2 * PACKETSIZE),
+      RESTAMP_PCR);
+  fail_unless_equals_uint64 (read_pcr (map.data + 3 * PACKETSIZE),
+      RESTAMP_PCR + RESTAMP_PCR_STEP);
+
+  fail_unless_equals_int (read_pid (map.data + 4 * PACKETSIZE), 0x20);
+  fail_unless_equals_int (read_pid (map.data + 5 * PACKETSIZE), 0x20);
+  fail_unless_equals_int (read_pid (map.data + 6 * PACKETSIZE), 0x20);
+
+  /* The moved one is corrected by the rate measured before */
+  fail_unless_equals_int (read_pid (map.data + 7 * PACKETSIZE), 0x41);
+  fail_unless_equals_uint64 (read_pcr (map.data + 7 * PACKETSIZE),
+      RESTAMP_PCR + 5 * RESTAMP_PCR_STEP);
+
+  gst_buffer_unmap (buf, &map);
+  gst_buffer_unref (buf);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
 static void
 tsdemux_simple_pad_added (GstElement * tsdemux, GstPad * pad, GstHarness * h)
 {
@@ -342,13 +1074,21 @@ tsdemux_simple_pad_added (GstElement * tsdemux, GstPad * pad, GstHarness * h)
   gst_harness_add_element_src_pad (h, pad);
 }
 
-GST_START_TEST (test_tsdemux_simple)
+/* Also collects the PTS of the output buffers in @pts, if not %NULL */
+static void
+run_tsdemux_simple (gboolean zero_copy_pes, gboolean parallel_streams,
+    gsize garbage_size, GArray * pts)
 {
   GstHarness *h = gst_harness_new_with_padnames ("tsdemux", "sink", NULL);
-  GstBuffer *buf;
+  GstBuffer *buf, *outbuf = NULL;
+  guint8 *garbage;
+  gsize i;
   GstCaps *caps;
   GstSegment segment;
 
+  g_object_set (h->element, "zero-copy-pes", zero_copy_pes,
+      "parallel-streams", parallel_streams, NULL);
+
   caps = gst_caps_from_string ("video/mpegts,systemstream=true");
   gst_harness_push_event (h, gst_event_new_caps (caps));
   gst_caps_unref (caps);
@@ -365,18 +1105,715 @@ GST_START_TEST (test_tsdemux_simple)
   buf =
       gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY, (guint8 *) aac_ts,
       sizeof aac_ts, 0, sizeof aac_ts, NULL, NULL);
+
+  /* Corrupted data (with a few sync bytes) before the first packet */
+  if (garbage_size) {
+    garbage = g_malloc (garbage_size);
+    for (i = 0; i < garbage_size; i++)
+      garbage[i] = (i % 100) ? (i & 0x3f) : 0x47;
+    buf = gst_buffer_append (gst_buffer_new_wrapped (garbage, garbage_size),
+        buf);
+  }
+
   fail_unless (gst_harness_push (h, buf) == GST_FLOW_OK);
   gst_harness_push_event (h, gst_event_new_eos ());
 
-  buf = gst_harness_take_all_data_as_buffer (h);
-  gst_check_buffer_data (buf, aac_data, sizeof aac_data);
+  while ((buf = gst_harness_try_pull (h))) {
+    if (pts)
+      g_array_append_val (pts, GST_BUFFER_PTS (buf));
+    outbuf = outbuf ? gst_buffer_append (outbuf, buf) : buf;
+  }
+  fail_unless (outbuf != NULL);
+  gst_check_buffer_data (outbuf, aac_data, sizeof aac_data);
+  gst_buffer_unref (outbuf);
+
+  gst_harness_teardown (h);
+}
+
+GST_START_TEST (test_tsdemux_simple)
+{
+  run_tsdemux_simple (FALSE, FALSE, 0, NULL);
+}
+
+GST_END_TEST;
+
+/* Writes a TS packet carrying the section of @section_size bytes
+ * (CRC excluded) at @section */
+static void
+write_section_packet (guint8 * packet, guint16 pid, guint8 * section,
+    guint section_size)
+{
+  GST_WRITE_UINT32_BE (section + section_size,
+      _calc_crc32 (section, section_size));
+
+  memset (packet, 0xff, PACKETSIZE);
+  packet[0] = 0x47;
+  GST_WRITE_UINT16_BE (packet + 1, 0x4000 | pid);
+  packet[3] = 0x10;
+  packet[4] = 0x00;
+  memcpy (packet + 5, section, section_size + 4);
+}
+
+/* Writes the PAT and PMT packets of a program made of a video stream of
+ * @stream_type on PID 0x41, also carrying the PCR */
+static void
+write_video_program (guint8 * data, guint8 stream_type)
+{
+  guint8 section[32];
+
+  /* PAT: program 1 on PID 0x20 */
+  section[0] = 0x00;
+  GST_WRITE_UINT16_BE (section + 1, 0xb000 | 13);
+  GST_WRITE_UINT16_BE (section + 3, 0x0001);
+  section[5] = 0xc1;
+  section[6] = section[7] = 0x00;
+  GST_WRITE_UINT16_BE (section + 8, 0x0001);
+  GST_WRITE_UINT16_BE (section + 10, 0xe020);
+  write_section_packet (data, 0x0000, section, 12);
+
+  /* PMT */
+  section[0] = 0x02;
+  GST_WRITE_UINT16_BE (section + 1, 0xb000 | 18);
+  GST_WRITE_UINT16_BE (section + 3, 0x0001);
+  section[5] = 0xc1;
+  section[6] = section[7] = 0x00;
+  GST_WRITE_UINT16_BE (section + 8, 0xe041);
+  GST_WRITE_UINT16_BE (section + 10, 0xf000);
+  section[12] = stream_type;
+  GST_WRITE_UINT16_BE (section + 13, 0xe041);
+  GST_WRITE_UINT16_BE (section + 15, 0xf000);
+  write_section_packet (data + PACKETSIZE, 0x0020, section, 17);
+}
+
+/* Builds a TS with a program made of an MPEG-2 video stream on PID 0x41,
+ * carrying a single PES of @n_packets packets. The payload is returned in
+ * @payload */
+static GstBuffer *
+make_video_ts (guint n_packets, GByteArray * payload)
+{
+  guint8 *data = g_malloc ((2 + n_packets) * PACKETSIZE), *packet;
+  guint i, j, offset;
+
+  write_video_program (data, 0x02);
+
+  for (i = 0; i < n_packets; i++) {
+    packet = data + (2 + i) * PACKETSIZE;
+    packet[0] = 0x47;
+    GST_WRITE_UINT16_BE (packet + 1, (i == 0 ? 0x4000 : 0x0000) | 0x41);
+    packet[3] = 0x10 | (i & 0xf);
+    offset = 4;
+
+    if (i == 0) {
+      static const guint8 pcr_af[] = {
+        0x07, 0x10, 0x09, 0xa7, 0xd6, 0x87, 0x7e, 0x00
+      };
+      /* Unbounded video PES with a PTS */
+      static const guint8 pes_header[] = {
+        0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x81, 0x80, 0x05, 0x21,
+        0x4d, 0x3f, 0xb2, 0x01
+      };
+
+      packet[3] |= 0x20;
+      memcpy (packet + offset, pcr_af, sizeof pcr_af);
+      offset += sizeof pcr_af;
+      memcpy (packet + offset, pes_header, sizeof pes_header);
+      offset += sizeof pes_header;
+    }
+
+    for (j = offset; j < PACKETSIZE; j++)
+      packet[j] = (i + j) & 0xff;
+    g_byte_array_append (payload, packet + offset, PACKETSIZE - offset);
+  }
+
+  return gst_buffer_new_wrapped (data, (2 + n_packets) * PACKETSIZE);
+}
+
+static void
+tsdemux_video_pad_added (GstElement * tsdemux, GstPad * pad, GstHarness * h)
+{
+  fail_unless (g_strcmp0 (GST_PAD_NAME (pad), "video_0_0041") == 0);
+  gst_harness_add_element_src_pad (h, pad);
+}
+
+GST_START_TEST (test_tsdemux_zero_copy_pes)
+{
+  GstHarness *h;
+  GByteArray *payload;
+  GstBuffer *in, *buf, *out;
+  GstMemory *mem;
+  GstCaps *caps;
+  GstSegment segment;
+  guint i, n_memory = 0, n_buffers = 0;
+
+  run_tsdemux_simple (TRUE, FALSE, 0, NULL);
+
+  /* A PES spread over more TS packets than a buffer can hold memories */
+  h = gst_harness_new_with_padnames ("tsdemux", "sink", NULL);
+  g_object_set (h->element, "zero-copy-pes", TRUE, NULL);
+
+  caps = gst_caps_from_string ("video/mpegts,systemstream=true");
+  gst_harness_push_event (h, gst_event_new_caps (caps));
+  gst_caps_unref (caps);
+
+  gst_segment_init (&segment, GST_FORMAT_BYTES);
+  gst_harness_push_event (h, gst_event_new_segment (&segment));
+
+  g_signal_connect (h->element, "pad-added",
+      G_CALLBACK (tsdemux_video_pad_added), h);
+
+  payload = g_byte_array_new ();
+  in = make_video_ts (3 * gst_buffer_get_max_memory (), payload);
+
+  fail_unless_equals_int (gst_harness_push (h, gst_buffer_ref (in)),
+      GST_FLOW_OK);
+  gst_harness_push_event (h, gst_event_new_eos ());
+
+  out = gst_buffer_new ();
+  while ((buf = gst_harness_try_pull (h))) {
+    /* Only the first buffer is timestamped */
+    fail_unless_equals_int (GST_BUFFER_PTS_IS_VALID (buf), n_buffers == 0);
+
+    /* Every memory is a slice of the input memory, not a copy */
+    fail_unless (gst_buffer_n_memory (buf) <= gst_buffer_get_max_memory ());
+    for (i = 0; i < gst_buffer_n_memory (buf); i++) {
+      mem = gst_buffer_peek_memory (buf, i);
+      fail_unless (mem->parent == gst_buffer_peek_memory (in, 0));
+      n_memory++;
+    }
+    out = gst_buffer_append (out, buf);
+    n_buffers++;
+  }
+
+  /* One memory per TS packet */
+  fail_unless_equals_int (n_buffers, 3);
+  fail_unless_equals_int (n_memory, 3 * gst_buffer_get_max_memory ());
+  gst_check_buffer_data (out, payload->data, payload->len);
+
+  gst_buffer_unref (out);
+  gst_buffer_unref (in);
+  g_byte_array_unref (payload);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_tsdemux_resync)
+{
+  run_tsdemux_simple (FALSE, FALSE, 333, NULL);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_tsdemux_parallel_streams)
+{
+  GArray *pts = g_array_new (FALSE, FALSE, sizeof (GstClockTime));
+  GArray *parallel_pts = g_array_new (FALSE, FALSE, sizeof (GstClockTime));
+  guint i;
+
+  run_tsdemux_simple (FALSE, FALSE, 0, pts);
+  run_tsdemux_simple (FALSE, TRUE, 0, parallel_pts);
+  run_tsdemux_simple (TRUE, TRUE, 0, NULL);
+
+  /* The stream workers get the same timestamps */
+  fail_unless_equals_int (parallel_pts->len, pts->len);
+  for (i = 0; i < pts->len; i++)
+    fail_unless_equals_uint64 (g_array_index (parallel_pts, GstClockTime, i),
+        g_array_index (pts, GstClockTime, i));
+
+  g_array_free (pts, TRUE);
+  g_array_free (parallel_pts, TRUE);
+}
+
+GST_END_TEST;
+
+#define H264_FRAME_DURATION (40 * GST_MSECOND)
+#define H264_GOP 25
+
+/* Builds a TS with a program made of an H.264 stream on PID 0x41, with
+ * @n_frames frames of one packet each, every H264_FRAME_DURATION. Every
+ * H264_GOP frames there is an IDR picture, the other pictures are preceded
+ * by an SPS too */
+static GstBuffer *
+make_h264_ts (guint n_frames)
+{
+  static const guint8 idr[] = {
+    0x00, 0x00, 0x00, 0x01, 0x65, 0x88, 0x84, 0x00
+  };
+  static const guint8 sps_non_idr[] = {
+    0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0xc0, 0x1e,
+    0x00, 0x00, 0x00, 0x01, 0x41, 0x9a, 0x02, 0x00
+  };
+  guint8 *data = g_malloc ((2 + n_frames) * PACKETSIZE), *packet;
+  guint64 pts, pcr;
+  guint i, offset;
+
+  write_video_program (data, 0x1b);
+
+  for (i = 0; i < n_frames; i++) {
+    packet = data + (2 + i) * PACKETSIZE;
+    memset (packet, 0xaa, PACKETSIZE);
+    packet[0] = 0x47;
+    GST_WRITE_UINT16_BE (packet + 1, 0x4000 | 0x41);
+    packet[3] = 0x30 | (i & 0xf);
+
+    /* PCR, 50ms before the PTS */
+    pts = 90000 + gst_util_uint64_scale (i * H264_FRAME_DURATION, 90000,
+        GST_SECOND);
+    pcr = pts - 4500;
+    packet[4] = 7;
+    packet[5] = 0x10;
+    GST_WRITE_UINT32_BE (packet + 6, pcr >> 1);
+    packet[10] = ((pcr & 1) << 7) | 0x7e;
+    packet[11] = 0x00;
+    offset = 12;
+
+    /* Unbounded video PES with a PTS */
+    GST_WRITE_UINT32_BE (packet + offset, 0x000001e0);
+    GST_WRITE_UINT16_BE (packet + offset + 4, 0);
+    packet[offset + 6] = 0x80;
+    packet[offset + 7] = 0x80;
+    packet[offset + 8] = 5;
+    packet[offset + 9] = 0x21 | ((pts >> 29) & 0x0e);
+    GST_WRITE_UINT16_BE (packet + offset + 10, ((pts >> 14) & 0xfffe) | 1);
+    GST_WRITE_UINT16_BE (packet + offset + 12, ((pts << 1) & 0xfffe) | 1);
+    offset += 14;
+
+    if (i % H264_GOP == 0)
+      memcpy (packet + offset, idr, sizeof idr);
+    else
+      memcpy (packet + offset, sps_non_idr, sizeof sps_non_idr);
+  }
+
+  return gst_buffer_new_wrapped (data, (2 + n_frames) * PACKETSIZE);
+}
+
+static gchar *
+make_temp_location (void)
+{
+  gchar *location;
+  gint fd;
+
+  fd = g_file_open_tmp ("mpegtsdemux-XXXXXX", &location, NULL);
+  fail_unless (fd >= 0);
+  g_close (fd, NULL);
+
+  return location;
+}
+
+#define INDEX_HEADER_SIZE 24
+#define INDEX_ENTRY_SIZE 24
+
+/* Returns the offsets of the keyframe entries of the index at @location */
+static GArray *
+read_index_keyframes (const gchar * location)
+{
+  GArray *offsets = g_array_new (FALSE, FALSE, sizeof (guint64));
+  const guint8 *entry;
+  gchar *contents;
+  gsize size;
+  guint64 offset;
+  guint i, n_entries;
+
+  fail_unless (g_file_get_contents (location, &contents, &size, NULL));
+  fail_unless (size >= INDEX_HEADER_SIZE);
+  fail_unless (memcmp (contents, "TSIX", 4) == 0);
+  n_entries = GST_READ_UINT32_LE (contents + 8);
+  fail_unless_equals_int (size,
+      INDEX_HEADER_SIZE + n_entries * INDEX_ENTRY_SIZE);
+
+  for (i = 0; i < n_entries; i++) {
+    entry = (const guint8 *) contents + INDEX_HEADER_SIZE +
+        i * INDEX_ENTRY_SIZE;
+    fail_unless_equals_int (GST_READ_UINT16_LE (entry + 16), 0x41);
+    if (GST_READ_UINT16_LE (entry + 18) == 1) {
+      offset = GST_READ_UINT64_LE (entry + 8);
+      g_array_append_val (offsets, offset);
+    }
+  }
+  g_free (contents);
+
+  return offsets;
+}
+
+/* Writes an index with a single keyframe entry, at 0 and @offset */
+static void
+write_index (const gchar * location, guint64 offset)
+{
+  guint8 data[INDEX_HEADER_SIZE + INDEX_ENTRY_SIZE] = { 0, };
+  guint8 *entry = data + INDEX_HEADER_SIZE;
+
+  memcpy (data, "TSIX", 4);
+  GST_WRITE_UINT32_LE (data + 4, 1);
+  GST_WRITE_UINT32_LE (data + 8, 1);
+  GST_WRITE_UINT64_LE (entry + 8, offset);
+  GST_WRITE_UINT16_LE (entry + 16, 0x41);
+  GST_WRITE_UINT16_LE (entry + 18, 1);
+
+  fail_unless (g_file_set_contents (location, (const gchar *) data,
+          sizeof data, NULL));
+}
+
+GST_START_TEST (test_tsdemux_index_push)
+{
+  GstHarness *h = gst_harness_new_with_padnames ("tsdemux", "sink", NULL);
+  gchar *location = make_temp_location ();
+  GstBuffer *buf;
+  GArray *keyframes;
+  GstCaps *caps;
+  GstSegment segment;
+  guint i;
+
+  /* Only an existing file is loaded, there is none yet */
+  g_unlink (location);
+  g_object_set (h->element, "index-location", location, NULL);
+
+  caps = gst_caps_from_string ("video/mpegts,systemstream=true");
+  gst_harness_push_event (h, gst_event_new_caps (caps));
+  gst_caps_unref (caps);
+
+  gst_segment_init (&segment, GST_FORMAT_BYTES);
+  gst_harness_push_event (h, gst_event_new_segment (&segment));
+
+  g_signal_connect (h->element, "pad-added",
+      G_CALLBACK (tsdemux_video_pad_added), h);
+
+  fail_unless_equals_int (gst_harness_push (h, make_h264_ts (3 * H264_GOP)),
+      GST_FLOW_OK);
+  gst_harness_push_event (h, gst_event_new_eos ());
+
+  while ((buf = gst_harness_try_pull (h)))
+    gst_buffer_unref (buf);
+
+  /* Only the IDR pictures are keyframes, not the SPS of the others */
+  keyframes = read_index_keyframes (location);
+  fail_unless_equals_int (keyframes->len, 3);
+  for (i = 0; i < keyframes->len; i++)
+    fail_unless_equals_uint64 (g_array_index (keyframes, guint64, i),
+        (2 + i * H264_GOP) * PACKETSIZE);
+  g_array_free (keyframes, TRUE);
+
+  gst_harness_teardown (h);
+  g_unlink (location);
+  g_free (location);
+}
+
+GST_END_TEST;
+
+static GstPadProbeReturn
+first_pts_probe (GstPad * pad, GstPadProbeInfo * info,
+    GstClockTime * first_pts)
+{
+  if (GST_PAD_PROBE_INFO_TYPE (info) & GST_PAD_PROBE_TYPE_BUFFER) {
+    if (!GST_CLOCK_TIME_IS_VALID (*first_pts))
+      *first_pts = GST_BUFFER_PTS (GST_PAD_PROBE_INFO_BUFFER (info));
+  } else if (GST_EVENT_TYPE (GST_PAD_PROBE_INFO_EVENT (info)) ==
+      GST_EVENT_FLUSH_STOP) {
+    *first_pts = GST_CLOCK_TIME_NONE;
+  }
+
+  return GST_PAD_PROBE_OK;
+}
+
+GST_START_TEST (test_tsdemux_index_seek)
+{
+  gchar *location = make_temp_location ();
+  gchar *index_location = make_temp_location ();
+  GstClockTime first_pts = GST_CLOCK_TIME_NONE, start_pts;
+  GstElement *pipeline, *sink;
+  GstBuffer *buf;
+  GstMapInfo map;
+  GstPad *pad;
+  gchar *desc;
+
+  buf = make_h264_ts (4 * H264_GOP);
+  gst_buffer_map (buf, &map, GST_MAP_READ);
+  fail_unless (g_file_set_contents (location, (const gchar *) map.data,
+          map.size, NULL));
+  gst_buffer_unmap (buf, &map);
+  gst_buffer_unref (buf);
+
+  /* The index points to the last IDR picture, which the stream would not
+   * be bisected to for the seek below */
+  write_index (index_location, (2 + 3 * H264_GOP) * PACKETSIZE);
+
+  desc = g_strdup_printf ("filesrc location=%s ! tsdemux name=demux "
+      "index-location=%s demux. ! fakesink name=sink sync=false", location,
+      index_location);
+  pipeline = gst_parse_launch (desc, NULL);
+  fail_unless (pipeline != NULL);
+  g_free (desc);
+
+  sink = gst_bin_get_by_name (GST_BIN (pipeline), "sink");
+  pad = gst_element_get_static_pad (sink, "sink");
+  gst_pad_add_probe (pad,
+      GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_FLUSH,
+      (GstPadProbeCallback) first_pts_probe, &first_pts, NULL);
+  gst_object_unref (pad);
+  gst_object_unref (sink);
+
+  fail_unless_equals_int (gst_element_set_state (pipeline, GST_STATE_PAUSED),
+      GST_STATE_CHANGE_ASYNC);
+  fail_unless_equals_int (gst_element_get_state (pipeline, NULL, NULL,
+          GST_CLOCK_TIME_NONE), GST_STATE_CHANGE_SUCCESS);
+  fail_unless (GST_CLOCK_TIME_IS_VALID (first_pts));
+  start_pts = first_pts;
+
+  fail_unless (gst_element_seek_simple (pipeline, GST_FORMAT_TIME,
+          GST_SEEK_FLAG_FLUSH, 3 * GST_SECOND));
+  fail_unless_equals_int (gst_element_get_state (pipeline, NULL, NULL,
+          GST_CLOCK_TIME_NONE), GST_STATE_CHANGE_SUCCESS);
+
+  /* The output restarts at the picture found in the index */
+  fail_unless_equals_uint64 (first_pts,
+      start_pts + 3 * H264_GOP * H264_FRAME_DURATION);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (pipeline);
+  g_unlink (index_location);
+  g_free (index_location);
+  g_unlink (location);
+  g_free (location);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_tsvalidator_cc_errors)
+{
+  GstHarness *h = gst_harness_new ("tsvalidator");
+  GstStructure *stats;
+  GstBuffer *buf;
+  guint8 *data;
+  guint errors;
+
+  /* Skip a continuity counter value on the audio PID */
+  data = g_memdup (aac_ts, sizeof aac_ts);
+  data[4 * PACKETSIZE + 3] = (data[4 * PACKETSIZE + 3] & 0xf0) | 0x04;
+
+  gst_harness_set_src_caps_str (h, "video/mpegts,systemstream=true");
+  buf = gst_harness_push_and_pull (h,
+      gst_buffer_new_wrapped (data, sizeof aac_ts));
+  fail_unless (buf != NULL);
+  fail_unless_equals_int (gst_buffer_get_size (buf), sizeof aac_ts);
   gst_buffer_unref (buf);
 
+  g_object_get (h->element, "stats", &stats, NULL);
+  fail_unless (gst_structure_get_uint (stats, "cc-errors", &errors));
+  fail_unless_equals_int (errors, 1);
+  fail_unless (gst_structure_get_uint (stats, "sync-byte-errors", &errors));
+  fail_unless_equals_int (errors, 0);
+  gst_structure_free (stats);
+
   gst_harness_teardown (h);
 }
 
 GST_END_TEST;
 
+GST_START_TEST (test_tsvalidator_forward)
+{
+  GstHarness *h = gst_harness_new ("tsvalidator");
+  GstBuffer *in[2], *buf;
+  GstStructure *s;
+  GstCaps *caps;
+  guint8 *data;
+  gsize size;
+  gint packetsize;
+  guint i, n_packets = sizeof aac_ts / PACKETSIZE;
+
+  /* 192 bytes packets, after a few bytes to skip */
+  size = 5 + n_packets * 192;
+  data = g_malloc0 (size);
+  for (i = 0; i < n_packets; i++)
+    memcpy (data + 5 + i * 192 + 4, aac_ts + i * PACKETSIZE, PACKETSIZE);
+
+  in[0] = gst_buffer_new_wrapped (data, size);
+  in[1] = gst_buffer_copy_region (in[0], GST_BUFFER_COPY_ALL, 5, size - 5);
+
+  gst_harness_set_src_caps_str (h, "video/mpegts,systemstream=true");
+  for (i = 0; i < 2; i++) {
+    fail_unless_equals_int (gst_harness_push (h, gst_buffer_ref (in[i])),
+        GST_FLOW_OK);
+
+    /* The input is forwarded as is, without a copy */
+    buf = gst_harness_pull (h);
+    fail_unless (buf == in[i]);
+    gst_buffer_unref (buf);
+    gst_buffer_unref (in[i]);
+  }
+
+  caps = gst_pad_get_current_caps (h->sinkpad);
+  s = gst_caps_get_structure (caps, 0);
+  fail_unless (gst_structure_get_int (s, "packetsize", &packetsize));
+  fail_unless_equals_int (packetsize, 192);
+  gst_caps_unref (caps);
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+#define VALIDATOR_PCR_PID 0x41
+
+/* Builds a TS of the program of write_video_program() at a rate of one
+ * packet per millisecond, for @duration milliseconds. Intervals are in
+ * milliseconds: the PAT and the PMT are repeated every @psi_interval, the
+ * PCR every @pcr_interval and a PES starts every @pts_interval. Every
+ * other PCR is @pcr_jitter 27 MHz ticks late */
+static GstBuffer *
+make_validator_ts (guint duration, guint psi_interval, guint pcr_interval,
+    guint pts_interval, guint pcr_jitter)
+{
+  guint8 *data = g_malloc (duration * PACKETSIZE), *packet;
+  guint8 program[2 * PACKETSIZE];
+  guint8 pat_cc = 0, pmt_cc = 0, video_cc = 0;
+  guint64 pcr, pts;
+  guint ms, n_pcr = 0, offset;
+
+  write_video_program (program, 0x02);
+
+  for (ms = 0; ms < duration; ms++) {
+    packet = data + ms * PACKETSIZE;
+
+    if (ms % psi_interval == 0) {
+      memcpy (packet, program, PACKETSIZE);
+      packet[3] = 0x10 | (pat_cc++ & 0xf);
+      continue;
+    }
+    if (ms % psi_interval == 1) {
+      memcpy (packet, program + PACKETSIZE, PACKETSIZE);
+      packet[3] = 0x10 | (pmt_cc++ & 0xf);
+      continue;
+    }
+
+    memset (packet, 0xff, PACKETSIZE);
+    packet[0] = 0x47;
+    GST_WRITE_UINT16_BE (packet + 1, VALIDATOR_PCR_PID);
+    packet[3] = 0x10 | (video_cc++ & 0xf);
+    offset = 4;
+
+    if ((ms - 2) % pcr_interval == 0) {
+      pcr = (1000 + ms) * G_GUINT64_CONSTANT (27000);
+      if (n_pcr++ % 2)
+        pcr += pcr_jitter;
+
+      packet[3] |= 0x20;
+      packet[4] = 7;
+      packet[5] = 0x10;
+      GST_WRITE_UINT32_BE (packet + 6, (pcr / 300) >> 1);
+      packet[10] = (((pcr / 300) & 1) << 7) | 0x7e | ((pcr % 300) >> 8);
+      packet[11] = (pcr % 300) & 0xff;
+      offset = 12;
+    }
+
+    if ((ms - 2) % pts_interval == 0) {
+      pts = (1000 + ms) * 90;
+
+      /* Unbounded video PES with a PTS */
+      packet[1] |= 0x40;
+      GST_WRITE_UINT32_BE (packet + offset, 0x000001e0);
+      GST_WRITE_UINT16_BE (packet + offset + 4, 0);
+      packet[offset + 6] = 0x80;
+      packet[offset + 7] = 0x80;
+      packet[offset + 8] = 5;
+      packet[offset + 9] = 0x21 | ((pts >> 29) & 0x0e);
+      GST_WRITE_UINT16_BE (packet + offset + 10, ((pts >> 14) & 0xfffe) | 1);
+      GST_WRITE_UINT16_BE (packet + offset + 12, ((pts << 1) & 0xfffe) | 1);
+    }
+  }
+
+  return gst_buffer_new_wrapped (data, duration * PACKETSIZE);
+}
+
+static GstStructure *
+run_tsvalidator (GstBuffer * in)
+{
+  GstHarness *h = gst_harness_new ("tsvalidator");
+  GstStructure *stats;
+
+  g_object_set (h->element, "stats-interval", 0, NULL);
+  gst_harness_set_src_caps_str (h, "video/mpegts,systemstream=true");
+  fail_unless_equals_int (gst_harness_push (h, in), GST_FLOW_OK);
+
+  g_object_get (h->element, "stats", &stats, NULL);
+  gst_harness_teardown (h);
+
+  return stats;
+}
+
+static void
+check_stat (const GstStructure * stats, const gchar * name, guint expected)
+{
+  guint value;
+
+  fail_unless (gst_structure_get_uint (stats, name, &value), "no %s", name);
+  fail_unless (value == expected, "%u %s, expected %u", value, name,
+      expected);
+}
+
+GST_START_TEST (test_tsvalidator_no_errors)
+{
+  GstStructure *stats;
+  guint64 bitrate;
+
+  stats = run_tsvalidator (make_validator_ts (3000, 100, 20, 100, 0));
+
+  check_stat (stats, "cc-errors", 0);
+  check_stat (stats, "pat-errors", 0);
+  check_stat (stats, "pmt-errors", 0);
+  check_stat (stats, "pcr-repetition-errors", 0);
+  check_stat (stats, "pcr-discontinuity-errors", 0);
+  check_stat (stats, "pcr-accuracy-errors", 0);
+  check_stat (stats, "pts-errors", 0);
+
+  /* 188 bytes per millisecond */
+  fail_unless (gst_structure_get_uint64 (stats, "bitrate", &bitrate));
+  fail_unless (bitrate >= 1503999 && bitrate <= 1504001);
+
+  gst_structure_free (stats);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_tsvalidator_repetition_errors)
+{
+  GstStructure *stats;
+
+  /* The first intervals can only be measured once the transport rate is
+   * known, after the second PCR, at 52 ms: the sections at 600 ms and the
+   * PES at 802 ms aren't late */
+  stats = run_tsvalidator (make_validator_ts (3000, 600, 50, 800, 0));
+
+  check_stat (stats, "cc-errors", 0);
+  check_stat (stats, "pat-errors", 3);
+  check_stat (stats, "pmt-errors", 3);
+  /* PCRs at 2, 52, ... 2952 ms */
+  check_stat (stats, "pcr-repetition-errors", 59);
+  check_stat (stats, "pcr-discontinuity-errors", 0);
+  check_stat (stats, "pcr-accuracy-errors", 0);
+  check_stat (stats, "pts-errors", 2);
+
+  gst_structure_free (stats);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_tsvalidator_pcr_accuracy_errors)
+{
+  GstStructure *stats;
+
+  /* Every other PCR is 100 ticks (3.7 us) late. The rate is first known
+   * after the second PCR, every PCR after it is inaccurate */
+  stats = run_tsvalidator (make_validator_ts (3000, 100, 20, 100, 100));
+
+  /* PCRs at 2, 22, ... 2982 ms */
+  check_stat (stats, "pcr-accuracy-errors", 148);
+  check_stat (stats, "pcr-repetition-errors", 0);
+  check_stat (stats, "pcr-discontinuity-errors", 0);
+
+  gst_structure_free (stats);
+}
+
+GST_END_TEST;
+
 static Suite *
 mpegtsdemux_suite (void)
 {
@@ -389,11 +1826,35 @@ mpegtsdemux_suite (void)
   tcase_skip_broken_test (tc, test_tsparse_align_auto);
   tcase_add_test (tc, test_tsparse_align_fuse);
   tcase_add_test (tc, test_tsparse_align_split);
+  tcase_add_test (tc, test_tsparse_align_buffer_list);
+  tcase_add_test (tc, test_tsparse_batch_latency);
   tcase_add_test (tc, test_tsparse_padding);
+  tcase_add_test (tc, test_tsparse_eit_cache);
+  tcase_add_test (tc, test_tsparse_eit_cache_program_pad);
+
+  tc = tcase_create ("tsremux");
+  suite_add_tcase (s, tc);
+  tcase_add_test (tc, test_tsremux_pid_map);
+  tcase_add_test (tc, test_tsremux_keep_timing);
+  tcase_add_test (tc, test_tsremux_ca);
+  tcase_add_test (tc, test_tsremux_restamp_pcr);
+
+  tc = tcase_create ("tsvalidator");
+  suite_add_tcase (s, tc);
+  tcase_add_test (tc, test_tsvalidator_cc_errors);
+  tcase_add_test (tc, test_tsvalidator_forward);
+  tcase_add_test (tc, test_tsvalidator_no_errors);
+  tcase_add_test (tc, test_tsvalidator_repetition_errors);
+  tcase_add_test (tc, test_tsvalidator_pcr_accuracy_errors);
 
   tc = tcase_create ("tsdemux");
   suite_add_tcase (s, tc);
   tcase_add_test (tc, test_tsdemux_simple);
+  tcase_add_test (tc, test_tsdemux_zero_copy_pes);
+  tcase_add_test (tc, test_tsdemux_resync);
+  tcase_add_test (tc, test_tsdemux_parallel_streams);
+  tcase_add_test (tc, test_tsdemux_index_push);
+  tcase_add_test (tc, test_tsdemux_index_seek);
 
   return s;
 }
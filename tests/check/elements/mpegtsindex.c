@@ -0,0 +1,179 @@
+/* GStreamer
+ *
+ * unit test for the MPEG-TS sidecar seek index
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <glib/gstdio.h>
+
+#include <gst/check/gstcheck.h>
+
+#include "../../../gst/mpegtsdemux/mpegtsindex.h"
+
+#define PCR_PID 0x100
+#define PCR_MSECOND G_GUINT64_CONSTANT (27000)
+#define PCR_MAX (G_GUINT64_CONSTANT (0x200000000) * 300)
+
+static gchar *
+make_index_location (void)
+{
+  gchar *location;
+  gint fd;
+
+  fd = g_file_open_tmp ("mpegtsindex-XXXXXX", &location, NULL);
+  fail_unless (fd >= 0);
+  g_close (fd, NULL);
+
+  return location;
+}
+
+/* Writes @index and loads it back */
+static void
+save_and_load (MpegTSIndex * index, const gchar * location)
+{
+  fail_unless (mpegts_index_save (index, location, 0));
+  fail_unless (mpegts_index_load (index, location, 0));
+  fail_unless (mpegts_index_is_loaded (index));
+}
+
+static void
+check_lookup (MpegTSIndex * index, MpegTSIndexEntryType type,
+    GstClockTime ts, guint64 expected_offset, GstClockTime expected_ts)
+{
+  guint64 offset;
+  GstClockTime entry_ts;
+
+  fail_unless (mpegts_index_lookup (index, PCR_PID, type, ts, &offset,
+          &entry_ts));
+  fail_unless_equals_uint64 (offset, expected_offset);
+  fail_unless_equals_uint64 (entry_ts, expected_ts);
+}
+
+GST_START_TEST (test_index_lookup)
+{
+  MpegTSIndex *index = mpegts_index_new ();
+  gchar *location = make_index_location ();
+  guint64 offset;
+  guint i;
+
+  /* 3s of PCRs every 100ms, and a keyframe every second */
+  for (i = 0; i < 30; i++) {
+    mpegts_index_add_pcr (index, PCR_PID, i * 100 * PCR_MSECOND, i * 1000);
+    if (i % 10 == 0)
+      mpegts_index_add_keyframe (index, PCR_PID, i * 1000 + 188);
+  }
+  fail_unless (mpegts_index_save (index, location, 30000));
+
+  /* Only used for the stream it was made for */
+  fail_if (mpegts_index_load (index, location, 40000));
+  fail_unless (mpegts_index_load (index, location, 30000));
+
+  check_lookup (index, MPEGTS_INDEX_ENTRY_KEYFRAME, 1550 * GST_MSECOND,
+      10188, GST_SECOND);
+  check_lookup (index, MPEGTS_INDEX_ENTRY_KEYFRAME, 2 * GST_SECOND,
+      20188, 2 * GST_SECOND);
+  check_lookup (index, MPEGTS_INDEX_ENTRY_PCR, 1550 * GST_MSECOND,
+      15000, 1500 * GST_MSECOND);
+  check_lookup (index, MPEGTS_INDEX_ENTRY_PCR, 10 * GST_SECOND,
+      25000, 2500 * GST_MSECOND);
+
+  /* Nothing for another PID */
+  fail_if (mpegts_index_lookup (index, PCR_PID + 1,
+          MPEGTS_INDEX_ENTRY_PCR, GST_SECOND, &offset, NULL));
+
+  mpegts_index_free (index);
+  g_unlink (location);
+  g_free (location);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_index_pcr_gap)
+{
+  MpegTSIndex *index = mpegts_index_new ();
+  gchar *location = make_index_location ();
+  guint i;
+
+  for (i = 0; i < 10; i++)
+    mpegts_index_add_pcr (index, PCR_PID, i * 100 * PCR_MSECOND, i * 1000);
+
+  /* A 9.1s gap is part of the time line, as for the packetizer */
+  for (i = 0; i < 10; i++)
+    mpegts_index_add_pcr (index, PCR_PID, (10000 + i * 100) * PCR_MSECOND,
+        10000 + i * 1000);
+
+  /* A reset, 15000 bytes after the start of the group of PCRs before it,
+   * whose bitrate is 10000 bytes/s: 1.5s later, plus 100ms */
+  mpegts_index_add_pcr (index, PCR_PID, 42 * PCR_MSECOND, 25000);
+
+  save_and_load (index, location);
+
+  check_lookup (index, MPEGTS_INDEX_ENTRY_PCR, 10 * GST_SECOND,
+      10000, 10 * GST_SECOND);
+  check_lookup (index, MPEGTS_INDEX_ENTRY_PCR, 10600 * GST_MSECOND,
+      15000, 10500 * GST_MSECOND);
+  check_lookup (index, MPEGTS_INDEX_ENTRY_PCR, 20 * GST_SECOND,
+      25000, 11600 * GST_MSECOND);
+
+  mpegts_index_free (index);
+  g_unlink (location);
+  g_free (location);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_index_pcr_wraparound)
+{
+  MpegTSIndex *index = mpegts_index_new ();
+  gchar *location = make_index_location ();
+  guint i;
+
+  for (i = 0; i < 8; i++)
+    mpegts_index_add_pcr (index, PCR_PID,
+        (PCR_MAX - 300 * PCR_MSECOND + i * 100 * PCR_MSECOND) % PCR_MAX,
+        i * 1000);
+  mpegts_index_add_keyframe (index, PCR_PID, 7188);
+
+  save_and_load (index, location);
+
+  check_lookup (index, MPEGTS_INDEX_ENTRY_PCR, 600 * GST_MSECOND,
+      5000, 500 * GST_MSECOND);
+  check_lookup (index, MPEGTS_INDEX_ENTRY_KEYFRAME, GST_SECOND,
+      7188, 700 * GST_MSECOND);
+
+  mpegts_index_free (index);
+  g_unlink (location);
+  g_free (location);
+}
+
+GST_END_TEST;
+
+static Suite *
+mpegtsindex_suite (void)
+{
+  Suite *s = suite_create ("mpegtsindex");
+  TCase *tc_chain = tcase_create ("general");
+
+  suite_add_tcase (s, tc_chain);
+  tcase_add_test (tc_chain, test_index_lookup);
+  tcase_add_test (tc_chain, test_index_pcr_gap);
+  tcase_add_test (tc_chain, test_index_pcr_wraparound);
+
+  return s;
+}
+
+GST_CHECK_MAIN (mpegtsindex);
@@ -19,6 +19,7 @@
  */
 
 #include <gst/check/gstcheck.h>
+#include <gst/check/gstharness.h>
 #include <string.h>
 #include <gst/video/video.h>
 
@@ -540,11 +541,20 @@ test_align_check_output (GList * bufs)
   GST_LOG ("%u buffers", g_list_length (bufs));
   while (bufs != NULL) {
     GstBuffer *buf = bufs->data;
-    gsize size;
+    GstMapInfo map;
+    gsize size, i;
 
     size = gst_buffer_get_size (buf);
-    GST_LOG ("buffer, size = %5u", (guint) size);
+    GST_LOG ("buffer, size = %5u, %u memories", (guint) size,
+        gst_buffer_n_memory (buf));
     fail_unless_equals_int (size, 7 * 188);
+
+    /* packets gathered from several slabs must stay in order */
+    fail_unless (gst_buffer_map (buf, &map, GST_MAP_READ));
+    for (i = 0; i < map.size; i += 188)
+      fail_unless_equals_int (map.data[i], 0x47);
+    gst_buffer_unmap (buf, &map);
+
     bufs = bufs->next;
   }
 }
@@ -557,6 +567,354 @@ GST_START_TEST (test_align)
 
 GST_END_TEST;
 
+#define ZERO_COPY_N_BUFFERS 10
+#define ZERO_COPY_BUFFER_SIZE 4096
+
+/* Returns the size of the memories of @buf shared with @input_mems */
+static gsize
+get_shared_size (GstBuffer * buf, GstMemory ** input_mems)
+{
+  gsize shared = 0;
+  guint i, j;
+
+  for (i = 0; i < gst_buffer_n_memory (buf); i++) {
+    GstMemory *mem = gst_buffer_peek_memory (buf, i);
+
+    for (j = 0; j < ZERO_COPY_N_BUFFERS; j++) {
+      if (mem->parent == input_mems[j])
+        shared += gst_memory_get_sizes (mem, NULL, NULL);
+    }
+  }
+
+  return shared;
+}
+
+static void
+run_zero_copy_pes (gint alignment)
+{
+  GstHarness *h = gst_harness_new_with_padnames ("mpegtsmux", "sink_%d",
+      "src");
+  GstMemory *input_mems[ZERO_COPY_N_BUFFERS];
+  GstBuffer *buf;
+  GstEvent *event;
+  gsize shared = 0;
+  gboolean eos = FALSE;
+  guint i;
+
+  gst_harness_set (h, "mpegtsmux", "zero-copy-pes", TRUE, "alignment",
+      alignment, NULL);
+  gst_harness_set_src_caps_str (h, VIDEO_CAPS_STRING);
+
+  for (i = 0; i < ZERO_COPY_N_BUFFERS; i++) {
+    buf = gst_buffer_new_and_alloc (ZERO_COPY_BUFFER_SIZE);
+    GST_BUFFER_PTS (buf) = i * 40 * GST_MSECOND;
+    if (i % KEYFRAME_DISTANCE != 0)
+      GST_BUFFER_FLAG_SET (buf, GST_BUFFER_FLAG_DELTA_UNIT);
+    input_mems[i] = gst_buffer_peek_memory (buf, 0);
+    fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+  }
+  gst_harness_push_event (h, gst_event_new_eos ());
+
+  while (!eos && (event = gst_harness_pull_event (h))) {
+    eos = GST_EVENT_TYPE (event) == GST_EVENT_EOS;
+    gst_event_unref (event);
+  }
+  fail_unless (eos);
+
+  /* All the elementary stream data must be in memories shared with the
+   * input buffers, none of it was copied or merged */
+  while ((buf = gst_harness_try_pull (h))) {
+    fail_unless_equals_int (gst_buffer_get_size (buf) % 188, 0);
+    shared += get_shared_size (buf, input_mems);
+    gst_buffer_unref (buf);
+  }
+  fail_unless_equals_int (shared, ZERO_COPY_N_BUFFERS * ZERO_COPY_BUFFER_SIZE);
+
+  gst_harness_teardown (h);
+}
+
+GST_START_TEST (test_zero_copy_pes)
+{
+  run_zero_copy_pes (0);
+  /* Aligned buffers of 7 packets hold their memories */
+  run_zero_copy_pes (7);
+  /* but not 32, those are pushed as separate buffers */
+  run_zero_copy_pes (32);
+}
+
+GST_END_TEST;
+
+/* Repeated PAT and PMT packets must be identical apart from their
+ * continuity counters, which keep incrementing */
+static void
+test_psi_repeat_check_output (GList * bufs)
+{
+  guint8 first[0x40][188];
+  guint n_seen[0x40] = { 0, };
+  guint8 counter[0x40];
+
+  for (; bufs; bufs = bufs->next) {
+    GstBuffer *buf = bufs->data;
+    GstMapInfo map;
+    gsize pos;
+
+    fail_unless (gst_buffer_map (buf, &map, GST_MAP_READ));
+
+    for (pos = 0; pos + 188 <= map.size; pos += 188) {
+      const guint8 *data = map.data + pos;
+      guint pid = GST_READ_UINT16_BE (data + 1) & 0x1fff;
+
+      /* PAT and the PMT PID range */
+      if (pid != 0 && (pid < 0x20 || pid >= 0x40))
+        continue;
+
+      if (n_seen[pid] == 0) {
+        memcpy (first[pid], data, 188);
+      } else {
+        fail_unless_equals_int (data[3] & 0x0f, (counter[pid] + 1) & 0x0f);
+        fail_unless (memcmp (data, first[pid], 3) == 0);
+        fail_unless_equals_int (data[3] & 0xf0, first[pid][3] & 0xf0);
+        fail_unless (memcmp (data + 4, first[pid] + 4, 184) == 0);
+      }
+      counter[pid] = data[3] & 0x0f;
+      n_seen[pid]++;
+    }
+
+    gst_buffer_unmap (buf, &map);
+  }
+
+  /* 2 seconds of data with the default 100 ms interval */
+  fail_unless (n_seen[0] > 10);
+}
+
+GST_START_TEST (test_psi_repeat)
+{
+  check_tsmux_pad (&video_src_template, VIDEO_CAPS_STRING, 0xE0, 0x1b,
+      "sink_%d", test_psi_repeat_check_output, 50, 1024, 0);
+}
+
+GST_END_TEST;
+
+#define CBR_BITRATE 2000000
+/* T-STD buffer of H.264 video without level dependent size */
+#define CBR_TSTD_SIZE 3750000
+/* T-STD buffer of MPEG audio */
+#define CBR_AUDIO_TSTD_SIZE 3584
+
+typedef struct
+{
+  guint64 dts;                  /* removal time, 27 MHz */
+  guint64 last_arrival;         /* arrival of the last byte, 27 MHz */
+  guint bytes;
+} CbrAccessUnit;
+
+static guint64
+cbr_read_ts (const guint8 * data)
+{
+  return ((guint64) (data[0] & 0x0e) << 29) | (data[1] << 22) |
+      ((data[2] & 0xfe) << 14) | (data[3] << 7) | (data[4] >> 1);
+}
+
+/* Checks the output against a constant rate T-STD: the PCR of every packet
+ * must match its byte position, the buffer timestamps must advance at the
+ * constant rate, and the elementary stream buffer of @tstd_size bytes must
+ * neither overflow nor underflow. Returns the highest buffer fullness */
+static guint64
+cbr_check_output (GList * bufs, guint64 tstd_size)
+{
+  GArray *aus = g_array_new (FALSE, FALSE, sizeof (CbrAccessUnit));
+  GstClockTime first_pts = GST_CLOCK_TIME_NONE;
+  guint64 offset = 0, pcr_offset = 0, first_pcr = 0, last_pcr = 0;
+  guint64 fullness = 0, max_fullness = 0, arrival;
+  gboolean have_pcr = FALSE;
+  gint el_pid = -1;
+  guint n_pcr = 0, i, removed = 0;
+
+  for (; bufs; bufs = bufs->next) {
+    GstBuffer *buf = bufs->data;
+    GstMapInfo map;
+    gsize pos;
+
+    /* buffers go out at the time of their first byte */
+    if (first_pts == GST_CLOCK_TIME_NONE)
+      first_pts = GST_BUFFER_PTS (buf);
+    fail_unless_equals_uint64 (GST_BUFFER_PTS (buf), first_pts +
+        gst_util_uint64_scale (offset * 8, GST_SECOND, CBR_BITRATE));
+
+    fail_unless (gst_buffer_map (buf, &map, GST_MAP_READ));
+    fail_unless_equals_int (map.size % 188, 0);
+
+    for (pos = 0; pos < map.size; pos += 188, offset += 188) {
+      const guint8 *data = map.data + pos;
+      guint pid = GST_READ_UINT16_BE (data + 1) & 0x1fff;
+      gboolean pusi = (data[1] & 0x40) != 0;
+      CbrAccessUnit *last;
+      guint hdr = 4;
+
+      fail_unless_equals_int (data[0], 0x47);
+
+      if ((data[3] & 0x20) && data[4] > 0) {
+        hdr += 1 + data[4];
+
+        if (data[5] & 0x10) {
+          guint64 pcr;
+
+          pcr = ((guint64) GST_READ_UINT32_BE (data + 6) << 1 |
+              data[10] >> 7) * 300 + ((data[10] & 1) << 8 | data[11]);
+
+          if (!have_pcr) {
+            first_pcr = pcr;
+            pcr_offset = offset;
+            have_pcr = TRUE;
+          } else {
+            guint64 expected = first_pcr +
+                gst_util_uint64_scale (offset - pcr_offset, 8 * 27000000,
+                CBR_BITRATE);
+
+            /* +-500 ns PCR accuracy, ISO/IEC 13818-1 2.7.2 */
+            fail_unless (pcr + 14 >= expected && pcr <= expected + 14,
+                "PCR %" G_GUINT64_FORMAT " expected %" G_GUINT64_FORMAT,
+                pcr, expected);
+            /* PCRs at most 100 ms apart */
+            fail_unless (pcr - last_pcr <= 2700000);
+          }
+          last_pcr = pcr;
+          n_pcr++;
+        }
+      } else if (data[3] & 0x20) {
+        hdr += 1;
+      }
+
+      /* the elementary stream is carrying the PCR */
+      if (pid == 0x1fff || !have_pcr || !(data[3] & 0x10))
+        continue;
+      if (el_pid == -1 && pusi && GST_READ_UINT24_BE (data + hdr) == 0x1)
+        el_pid = pid;
+      if ((gint) pid != el_pid)
+        continue;
+
+      arrival = first_pcr + gst_util_uint64_scale (offset - pcr_offset,
+          8 * 27000000, CBR_BITRATE);
+
+      /* remove the access units decoded by now */
+      for (; removed < aus->len; removed++) {
+        CbrAccessUnit *au = &g_array_index (aus, CbrAccessUnit, removed);
+
+        if (au->dts > arrival)
+          break;
+        fullness -= au->bytes;
+      }
+
+      if (pusi) {
+        CbrAccessUnit au = { 0, };
+        const guint8 *pes = data + hdr;
+
+        au.dts = cbr_read_ts (pes + 9) * 300;
+        if ((pes[7] & 0xc0) == 0xc0)
+          au.dts = cbr_read_ts (pes + 14) * 300;
+        g_array_append_val (aus, au);
+
+        hdr += 9 + pes[8];
+      }
+
+      fail_unless (aus->len > removed);
+      last = &g_array_index (aus, CbrAccessUnit, aus->len - 1);
+      last->bytes += 188 - hdr;
+      last->last_arrival = arrival;
+      fullness += 188 - hdr;
+      fail_unless (fullness <= tstd_size);
+      max_fullness = MAX (max_fullness, fullness);
+    }
+
+    gst_buffer_unmap (buf, &map);
+  }
+
+  fail_unless (n_pcr > 1);
+  fail_unless (aus->len > 0);
+
+  /* every access unit was completely delivered by its decoding time */
+  for (i = 0; i < aus->len; i++) {
+    CbrAccessUnit *au = &g_array_index (aus, CbrAccessUnit, i);
+
+    fail_unless (au->last_arrival <= au->dts,
+        "access unit %u late by %" G_GUINT64_FORMAT " ticks", i,
+        au->last_arrival - au->dts);
+  }
+
+  g_array_unref (aus);
+
+  return max_fullness;
+}
+
+static void
+test_cbr_check_output (GList * bufs)
+{
+  cbr_check_output (bufs, CBR_TSTD_SIZE);
+}
+
+GST_START_TEST (test_cbr_tstd)
+{
+  GstElement *mux;
+  gchar *padname;
+
+  mux = setup_tsmux (&video_src_template, "sink_%d", &padname);
+  g_object_set (mux, "bitrate", (guint64) CBR_BITRATE, NULL);
+
+  fail_unless (gst_element_set_state (mux,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  check_tsmux_pad_given_muxer (mux, VIDEO_CAPS_STRING, 0xE0, 0x1b,
+      test_cbr_check_output, 50, 4096);
+
+  cleanup_tsmux (mux, padname);
+  g_free (padname);
+}
+
+GST_END_TEST;
+
+/* 1.2 Mbit/s of audio frames, which may be sent 125 ms ahead of their
+ * decoding time but of which only two fit in the T-STD buffer, so the
+ * following ones are held back until the buffer drains */
+GST_START_TEST (test_cbr_tstd_full)
+{
+  GstHarness *h = gst_harness_new_with_padnames ("mpegtsmux", "sink_%d",
+      "src");
+  GList *bufs = NULL;
+  GstBuffer *buf;
+  GstEvent *event;
+  gboolean eos = FALSE;
+  guint i;
+
+  gst_harness_set (h, "mpegtsmux", "bitrate", (guint64) CBR_BITRATE, NULL);
+  gst_harness_set_src_caps_str (h, AUDIO_CAPS_STRING);
+
+  for (i = 0; i < 100; i++) {
+    buf = gst_buffer_new_and_alloc (1500);
+    GST_BUFFER_PTS (buf) = i * 10 * GST_MSECOND;
+    fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+  }
+  gst_harness_push_event (h, gst_event_new_eos ());
+
+  while (!eos && (event = gst_harness_pull_event (h))) {
+    eos = GST_EVENT_TYPE (event) == GST_EVENT_EOS;
+    gst_event_unref (event);
+  }
+  fail_unless (eos);
+
+  while ((buf = gst_harness_try_pull (h)))
+    bufs = g_list_append (bufs, buf);
+
+  /* the buffer filled up to less than a packet from its size */
+  fail_unless (cbr_check_output (bufs, CBR_AUDIO_TSTD_SIZE) + 184 >
+      CBR_AUDIO_TSTD_SIZE);
+
+  g_list_free_full (bufs, (GDestroyNotify) gst_buffer_unref);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
 static void
 test_keyframe_propagation_check_output (GList * bufs)
 {
@@ -599,6 +957,10 @@ mpegtsmux_suite (void)
   tcase_add_test (tc_chain, test_multiple_state_change);
   tcase_add_test (tc_chain, test_align);
   tcase_add_test (tc_chain, test_keyframe_flag_propagation);
+  tcase_add_test (tc_chain, test_zero_copy_pes);
+  tcase_add_test (tc_chain, test_cbr_tstd);
+  tcase_add_test (tc_chain, test_cbr_tstd_full);
+  tcase_add_test (tc_chain, test_psi_repeat);
   tcase_add_test (tc_chain, test_reappearing_pad_while_playing);
   tcase_add_test (tc_chain, test_reappearing_pad_while_stopped);
   tcase_add_test (tc_chain, test_unused_pad);
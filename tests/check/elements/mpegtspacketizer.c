@@ -0,0 +1,215 @@
+/* GStreamer
+ *
+ * unit test for the MPEG-TS packetizer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <string.h>
+
+#include <gst/check/gstcheck.h>
+
+#include "../../../gst/mpegtsdemux/mpegtspacketizer.h"
+
+#define N_PACKETS 10
+
+/* Builds @n_packets TS packets of @packet_size bytes, the PID of each of
+ * them being 0x100 + its index */
+static GstBuffer *
+make_packets (guint packet_size, guint n_packets)
+{
+  guint8 *data = g_malloc0 (packet_size * n_packets), *packet;
+  guint sync_offset = packet_size == MPEGTS_M2TS_PACKETSIZE ? 4 : 0;
+  GstBuffer *buf;
+  guint i;
+
+  for (i = 0; i < n_packets; i++) {
+    packet = data + i * packet_size + sync_offset;
+    packet[0] = 0x47;
+    GST_WRITE_UINT16_BE (packet + 1, 0x100 + i);
+    packet[3] = 0x10;
+  }
+
+  buf = gst_buffer_new_wrapped (data, packet_size * n_packets);
+  GST_BUFFER_OFFSET (buf) = 0;
+
+  return buf;
+}
+
+static MpegTSPacketizer2 *
+setup_packetizer (guint packet_size, guint n_packets)
+{
+  MpegTSPacketizer2 *packetizer = mpegts_packetizer_new ();
+
+  mpegts_packetizer_push (packetizer, make_packets (packet_size, n_packets));
+
+  return packetizer;
+}
+
+static void
+check_packets (MpegTSPacketizerPacket * packets, guint n, guint first,
+    guint packet_size)
+{
+  guint i;
+
+  for (i = 0; i < n; i++) {
+    fail_unless_equals_int (packets[i].pid, 0x100 + first + i);
+    fail_unless_equals_uint64 (packets[i].offset, (first + i) * packet_size);
+    fail_unless_equals_int (packets[i].data_end - packets[i].data_start, 188);
+  }
+}
+
+static void
+run_next_packets (guint packet_size)
+{
+  MpegTSPacketizer2 *packetizer = setup_packetizer (packet_size, N_PACKETS);
+  MpegTSPacketizerPacket packets[4];
+  guint n, first = 0;
+
+  while ((n = mpegts_packetizer_next_packets (packetizer, packets,
+              G_N_ELEMENTS (packets)))) {
+    fail_unless_equals_int (n, MIN (4, N_PACKETS - first));
+    check_packets (packets, n, first, packet_size);
+    mpegts_packetizer_clear_packets (packetizer, &packets[n - 1]);
+    first += n;
+  }
+
+  fail_unless_equals_int (first, N_PACKETS);
+  fail_unless_equals_uint64 (packetizer->offset, N_PACKETS * packet_size);
+
+  g_object_unref (packetizer);
+}
+
+GST_START_TEST (test_next_packets)
+{
+  run_next_packets (MPEGTS_NORMAL_PACKETSIZE);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_next_packets_m2ts)
+{
+  run_next_packets (MPEGTS_M2TS_PACKETSIZE);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_clear_packets_partial)
+{
+  MpegTSPacketizer2 *packetizer =
+      setup_packetizer (MPEGTS_NORMAL_PACKETSIZE, N_PACKETS);
+  MpegTSPacketizerPacket packets[4];
+  guint n;
+
+  n = mpegts_packetizer_next_packets (packetizer, packets, 4);
+  fail_unless_equals_int (n, 4);
+
+  /* Only the first two were handled, the others are parsed again */
+  mpegts_packetizer_clear_packets (packetizer, &packets[1]);
+  n = mpegts_packetizer_next_packets (packetizer, packets, 4);
+  fail_unless_equals_int (n, 4);
+  check_packets (packets, n, 2, MPEGTS_NORMAL_PACKETSIZE);
+
+  g_object_unref (packetizer);
+}
+
+GST_END_TEST;
+
+static void
+run_clear_redirected_packets (guint packet_size)
+{
+  MpegTSPacketizer2 *packetizer = setup_packetizer (packet_size, N_PACKETS);
+  MpegTSPacketizerPacket packets[4], *last;
+  static guint8 copy[MPEGTS_MAX_PACKETSIZE];
+  guint n;
+
+  n = mpegts_packetizer_next_packets (packetizer, packets, 4);
+  fail_unless_equals_int (n, 4);
+
+  /* Point the last packet to a copy of its data, as is done when
+   * descrambling it */
+  last = &packets[n - 1];
+  memcpy (copy, last->data_start, last->data_end - last->data_start);
+  last->payload = copy + (last->payload - last->data_start);
+  last->data = copy + (last->data - last->data_start);
+  last->data_end = copy + (last->data_end - last->data_start);
+  last->data_start = copy;
+
+  mpegts_packetizer_clear_packets (packetizer, last);
+  fail_unless_equals_uint64 (packetizer->offset, 4 * packet_size);
+
+  n = mpegts_packetizer_next_packets (packetizer, packets, 4);
+  fail_unless_equals_int (n, 4);
+  check_packets (packets, n, 4, packet_size);
+
+  g_object_unref (packetizer);
+}
+
+GST_START_TEST (test_clear_redirected_packets)
+{
+  run_clear_redirected_packets (MPEGTS_NORMAL_PACKETSIZE);
+  run_clear_redirected_packets (MPEGTS_M2TS_PACKETSIZE);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_next_packets_skip_bad)
+{
+  MpegTSPacketizer2 *packetizer = mpegts_packetizer_new ();
+  MpegTSPacketizerPacket packets[N_PACKETS];
+  GstBuffer *buf = make_packets (MPEGTS_NORMAL_PACKETSIZE, N_PACKETS);
+  GstMapInfo map;
+  guint n;
+
+  /* Transport error indicator on the 6th packet */
+  gst_buffer_map (buf, &map, GST_MAP_WRITE);
+  map.data[5 * MPEGTS_NORMAL_PACKETSIZE + 1] |= 0x80;
+  gst_buffer_unmap (buf, &map);
+  mpegts_packetizer_push (packetizer, buf);
+
+  n = mpegts_packetizer_next_packets (packetizer, packets, N_PACKETS);
+  fail_unless_equals_int (n, N_PACKETS - 1);
+  check_packets (packets, 5, 0, MPEGTS_NORMAL_PACKETSIZE);
+  check_packets (packets + 5, 4, 6, MPEGTS_NORMAL_PACKETSIZE);
+
+  mpegts_packetizer_clear_packets (packetizer, &packets[n - 1]);
+  fail_unless_equals_uint64 (packetizer->offset,
+      N_PACKETS * MPEGTS_NORMAL_PACKETSIZE);
+  fail_unless_equals_int (mpegts_packetizer_next_packets (packetizer, packets,
+          N_PACKETS), 0);
+
+  g_object_unref (packetizer);
+}
+
+GST_END_TEST;
+
+static Suite *
+mpegtspacketizer_suite (void)
+{
+  Suite *s = suite_create ("mpegtspacketizer");
+  TCase *tc_chain = tcase_create ("general");
+
+  suite_add_tcase (s, tc_chain);
+  tcase_add_test (tc_chain, test_next_packets);
+  tcase_add_test (tc_chain, test_next_packets_m2ts);
+  tcase_add_test (tc_chain, test_clear_packets_partial);
+  tcase_add_test (tc_chain, test_clear_redirected_packets);
+  tcase_add_test (tc_chain, test_next_packets_skip_bad);
+
+  return s;
+}
+
+GST_CHECK_MAIN (mpegtspacketizer);
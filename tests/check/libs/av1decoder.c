@@ -0,0 +1,423 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <gst/check/gstcheck.h>
+#include <gst/codecs/gstav1decoder.h>
+
+/* aom testdata av1-1-b8-01-size-16x16: temporal delimiter, sequence header
+ * and a key frame refreshing all slots */
+static const guint8 key_frame_tu[] = {
+  0x12, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xfb, 0xff, 0xf3,
+  0x00, 0x80, 0x32, 0xa6, 0x01, 0x10, 0x00, 0x87, 0x80, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x9e, 0x86, 0x5b, 0xb2, 0x22, 0xb5, 0x58, 0x4d,
+  0x68, 0xe6, 0x37, 0x54, 0x42, 0x7b, 0x84, 0xce, 0xdf, 0x9f, 0xec, 0xab,
+  0x07, 0x4d, 0xf6, 0xe1, 0x5e, 0x9e, 0x27, 0xbf, 0x93, 0x2f, 0x47, 0x0d,
+  0x7b, 0x7c, 0x45, 0x8d, 0xcf, 0x26, 0xf7, 0x6c, 0x06, 0xd7, 0x8c, 0x2e,
+  0xf5, 0x2c, 0xb0, 0x8a, 0x31, 0xac, 0x69, 0xf5, 0xcd, 0xd8, 0x71, 0x5d,
+  0xaf, 0xf8, 0x96, 0x43, 0x8c, 0x9c, 0x23, 0x6f, 0xab, 0xd0, 0x35, 0x43,
+  0xdf, 0x81, 0x12, 0xe3, 0x7d, 0xec, 0x22, 0xb0, 0x30, 0x54, 0x32, 0x9f,
+  0x90, 0xc0, 0x5d, 0x64, 0x9b, 0x0f, 0x75, 0x31, 0x84, 0x3a, 0x57, 0xd7,
+  0x5f, 0x03, 0x6e, 0x7f, 0x43, 0x17, 0x6d, 0x08, 0xc3, 0x81, 0x8a, 0xae,
+  0x73, 0x1c, 0xa8, 0xa7, 0xe4, 0x9c, 0xa9, 0x5b, 0x3f, 0xd1, 0xeb, 0x75,
+  0x3a, 0x7f, 0x22, 0x77, 0x38, 0x64, 0x1c, 0x77, 0xdb, 0xcd, 0xef, 0xb7,
+  0x08, 0x45, 0x8e, 0x7f, 0xea, 0xa3, 0xd0, 0x81, 0xc9, 0xc1, 0xbc, 0x93,
+  0x9b, 0x41, 0xb1, 0xa1, 0x42, 0x17, 0x98, 0x3f, 0x1e, 0x95, 0xdf, 0x68,
+  0x7c, 0xb7, 0x98
+};
+
+/* Followed by an inter frame of order hint 1, refreshing slots 2 and 3 */
+static const guint8 inter_frame_tu[] = {
+  0x12, 0x00, 0x32, 0x4b, 0x30, 0x03, 0xc3, 0x00, 0xa7, 0x2e, 0x46, 0x8a,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x50, 0xc0, 0x20, 0x00, 0xf0, 0xb1, 0x2f,
+  0x43, 0xf3, 0xbb, 0xe6, 0x5c, 0xbe, 0xe6, 0x53, 0xbc, 0xaa, 0x61, 0x7c,
+  0x7e, 0x0a, 0x04, 0x1b, 0xa2, 0x87, 0x81, 0xe8, 0xa6, 0x85, 0xfe, 0xc2,
+  0x71, 0xb9, 0xf8, 0xc0, 0x78, 0x9f, 0x52, 0x4f, 0xa7, 0x8f, 0x55, 0x96,
+  0x79, 0x90, 0xaa, 0x2b, 0x6d, 0x0a, 0xa7, 0x05, 0x2a, 0xf8, 0xfc, 0xc9,
+  0x7d, 0x9d, 0x4a, 0x61, 0x16, 0xb1, 0x65
+};
+
+/* Temporal delimiter and a frame header showing the frame of slot 2 */
+static const guint8 show_slot_2_tu[] = {
+  0x12, 0x00, 0x1a, 0x01, 0xa8
+};
+
+/* Temporal delimiter and a frame header showing the key frame of slot 0 */
+static const guint8 show_slot_0_tu[] = {
+  0x12, 0x00, 0x1a, 0x01, 0x88
+};
+
+/* Temporal delimiter, reduced still picture sequence header of 128x64 and
+ * a frame of two tile columns with 2 bytes tile sizes, of 3 and 4 bytes */
+static const guint8 two_tiles_tu[] = {
+  0x12, 0x00, 0x0a, 0x06, 0x18, 0x19, 0x7f, 0xfe, 0x00, 0x04, 0x32, 0x0f,
+  0x19, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x11, 0x22, 0x33, 0x44,
+  0x55, 0x66, 0x77
+};
+
+/* A software decoder which only records what the base class asks */
+#define GST_TYPE_AV1_MOCK_DECODER (gst_av1_mock_decoder_get_type ())
+G_DECLARE_FINAL_TYPE (GstAV1MockDecoder, gst_av1_mock_decoder,
+    GST, AV1_MOCK_DECODER, GstAV1Decoder);
+
+struct _GstAV1MockDecoder
+{
+  GstAV1Decoder parent;
+
+  guint n_sequences;
+  guint n_tile_groups;
+  guint n_show_existing;
+  /* size of the decoded tiles */
+  GArray *tile_sizes;
+  /* order hint of the output pictures */
+  GArray *output;
+  /* order hint of the pictures in the slots when the last picture was
+   * started, or -1 */
+  gint ref_order_hint[GST_AV1_NUM_REF_FRAMES];
+};
+
+G_DEFINE_TYPE (GstAV1MockDecoder, gst_av1_mock_decoder, GST_TYPE_AV1_DECODER);
+
+static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("video/x-av1"));
+
+static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC, GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("I420")));
+
+static gboolean
+gst_av1_mock_decoder_new_sequence (GstAV1Decoder * decoder,
+    const GstAV1SequenceHeaderOBU * seq_hdr)
+{
+  GstAV1MockDecoder *self = GST_AV1_MOCK_DECODER (decoder);
+  GstVideoCodecState *state;
+
+  self->n_sequences++;
+
+  state = gst_video_decoder_set_output_state (GST_VIDEO_DECODER (decoder),
+      GST_VIDEO_FORMAT_I420, seq_hdr->max_frame_width_minus_1 + 1,
+      seq_hdr->max_frame_height_minus_1 + 1, decoder->input_state);
+  gst_video_codec_state_unref (state);
+
+  return gst_video_decoder_negotiate (GST_VIDEO_DECODER (decoder));
+}
+
+static gboolean
+gst_av1_mock_decoder_start_picture (GstAV1Decoder * decoder,
+    GstAV1Picture * picture, GstAV1Dpb * dpb)
+{
+  GstAV1MockDecoder *self = GST_AV1_MOCK_DECODER (decoder);
+  gint i;
+
+  fail_if (picture->frame_hdr.show_existing_frame);
+
+  for (i = 0; i < GST_AV1_NUM_REF_FRAMES; i++) {
+    GstAV1Picture *ref = dpb->pic_list[i];
+
+    self->ref_order_hint[i] = ref ? ref->frame_hdr.order_hint : -1;
+  }
+
+  return TRUE;
+}
+
+static gboolean
+gst_av1_mock_decoder_decode_tile (GstAV1Decoder * decoder,
+    GstAV1Picture * picture, GstAV1Tile * tile)
+{
+  GstAV1MockDecoder *self = GST_AV1_MOCK_DECODER (decoder);
+  GstAV1TileGroupOBU *tile_group = &tile->tile_group;
+  guint tile_size_bytes = picture->frame_hdr.tile_info.tile_size_bytes;
+  gint i;
+
+  self->n_tile_groups++;
+
+  fail_unless_equals_int (tile->obu.obu_type, GST_AV1_OBU_FRAME);
+  fail_unless_equals_int (tile_group->tg_start, 0);
+  fail_unless_equals_int (tile_group->tg_end, tile_group->num_tiles - 1);
+
+  for (i = tile_group->tg_start; i <= tile_group->tg_end; i++) {
+    guint32 tile_end = tile_group->entry[i].tile_offset +
+        tile_group->entry[i].tile_size;
+
+    fail_unless (tile_group->entry[i].tile_offset > 0);
+    g_array_append_val (self->tile_sizes, tile_group->entry[i].tile_size);
+
+    /* The size of the next tile is before it, the last tile ends with the
+     * OBU */
+    if (i < tile_group->tg_end)
+      fail_unless_equals_int (tile_group->entry[i + 1].tile_offset,
+          tile_end + tile_size_bytes);
+    else
+      fail_unless_equals_int (tile_end, tile->obu.obu_size);
+  }
+
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_av1_mock_decoder_output_picture (GstAV1Decoder * decoder,
+    GstVideoCodecFrame * frame, GstAV1Picture * picture)
+{
+  GstAV1MockDecoder *self = GST_AV1_MOCK_DECODER (decoder);
+  GstVideoDecoder *vdec = GST_VIDEO_DECODER (decoder);
+  gint order_hint = picture->frame_hdr.order_hint;
+  GstFlowReturn ret;
+
+  fail_unless (picture->frame_hdr.show_frame);
+  fail_unless_equals_int (picture->system_frame_number,
+      frame->system_frame_number);
+
+  if (picture->frame_hdr.show_existing_frame)
+    self->n_show_existing++;
+
+  g_array_append_val (self->output, order_hint);
+  gst_av1_picture_unref (picture);
+
+  ret = gst_video_decoder_allocate_output_frame (vdec, frame);
+  if (ret != GST_FLOW_OK) {
+    gst_video_decoder_drop_frame (vdec, frame);
+    return ret;
+  }
+
+  return gst_video_decoder_finish_frame (vdec, frame);
+}
+
+static void
+gst_av1_mock_decoder_finalize (GObject * object)
+{
+  GstAV1MockDecoder *self = GST_AV1_MOCK_DECODER (object);
+
+  g_array_unref (self->output);
+  g_array_unref (self->tile_sizes);
+
+  G_OBJECT_CLASS (gst_av1_mock_decoder_parent_class)->finalize (object);
+}
+
+static void
+gst_av1_mock_decoder_class_init (GstAV1MockDecoderClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstAV1DecoderClass *av1decoder_class = GST_AV1_DECODER_CLASS (klass);
+
+  gobject_class->finalize = gst_av1_mock_decoder_finalize;
+
+  gst_element_class_add_static_pad_template (element_class, &sink_template);
+  gst_element_class_add_static_pad_template (element_class, &src_template);
+  gst_element_class_set_static_metadata (element_class,
+      "AV1 mock decoder", "Codec/Decoder/Video",
+      "Records the calls of the AV1 decoder base class", "GStreamer");
+
+  av1decoder_class->new_sequence = gst_av1_mock_decoder_new_sequence;
+  av1decoder_class->start_picture = gst_av1_mock_decoder_start_picture;
+  av1decoder_class->decode_tile = gst_av1_mock_decoder_decode_tile;
+  av1decoder_class->output_picture = gst_av1_mock_decoder_output_picture;
+}
+
+static void
+gst_av1_mock_decoder_init (GstAV1MockDecoder * self)
+{
+  self->output = g_array_new (FALSE, FALSE, sizeof (gint));
+  self->tile_sizes = g_array_new (FALSE, FALSE, sizeof (guint32));
+}
+
+static GstHarness *
+create_harness (GstAV1MockDecoder ** decoder)
+{
+  GstHarness *h;
+
+  *decoder = g_object_new (GST_TYPE_AV1_MOCK_DECODER, NULL);
+  h = gst_harness_new_with_element (GST_ELEMENT (*decoder), "sink", "src");
+  gst_harness_set_src_caps_str (h, "video/x-av1, "
+      "stream-format = (string) obu-stream, alignment = (string) tu");
+
+  return h;
+}
+
+static void
+push_tu (GstHarness * h, const guint8 * data, gsize size, guint index)
+{
+  GstBuffer *buf;
+
+  buf = gst_buffer_new_allocate (NULL, size, NULL);
+  gst_buffer_fill (buf, 0, data, size);
+  GST_BUFFER_PTS (buf) = index * 40 * GST_MSECOND;
+  GST_BUFFER_DURATION (buf) = 40 * GST_MSECOND;
+
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+}
+
+#define PUSH_TU(h,tu,index) push_tu (h, tu, sizeof (tu), index)
+
+static void
+check_output (GstHarness * h, GstAV1MockDecoder * decoder,
+    const gint * expected, guint n_expected)
+{
+  guint i;
+
+  fail_unless_equals_int (decoder->output->len, n_expected);
+  fail_unless_equals_int (gst_harness_buffers_in_queue (h), n_expected);
+
+  for (i = 0; i < n_expected; i++) {
+    GstBuffer *buf = gst_harness_pull (h);
+
+    fail_unless_equals_int (g_array_index (decoder->output, gint, i),
+        expected[i]);
+    gst_buffer_unref (buf);
+  }
+}
+
+static void
+check_ref_order_hints (GstAV1MockDecoder * decoder, const gint * expected)
+{
+  gint i;
+
+  for (i = 0; i < GST_AV1_NUM_REF_FRAMES; i++)
+    fail_unless_equals_int (decoder->ref_order_hint[i], expected[i]);
+}
+
+GST_START_TEST (test_av1_decoder_decode)
+{
+  static const gint key_refs[] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  static const gint expected[] = { 0, 1 };
+  GstAV1MockDecoder *decoder;
+  GstHarness *h = create_harness (&decoder);
+
+  PUSH_TU (h, key_frame_tu, 0);
+  PUSH_TU (h, inter_frame_tu, 1);
+
+  /* The key frame refreshed all slots */
+  check_ref_order_hints (decoder, key_refs);
+
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+
+  fail_unless_equals_int (decoder->n_sequences, 1);
+  fail_unless_equals_int (decoder->n_tile_groups, 2);
+  check_output (h, decoder, expected, G_N_ELEMENTS (expected));
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_av1_decoder_show_existing_frame)
+{
+  static const gint key_refs[] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  static const gint expected[] = { 0, 1, 1, 0, 1 };
+  GstAV1MockDecoder *decoder;
+  GstHarness *h = create_harness (&decoder);
+
+  PUSH_TU (h, key_frame_tu, 0);
+  PUSH_TU (h, inter_frame_tu, 1);
+
+  /* The inter frame, in slots 2 and 3 */
+  PUSH_TU (h, show_slot_2_tu, 2);
+  fail_unless_equals_int (decoder->n_show_existing, 1);
+
+  /* Showing the key frame refreshes all slots with it again */
+  PUSH_TU (h, show_slot_0_tu, 3);
+  fail_unless_equals_int (decoder->n_show_existing, 2);
+
+  PUSH_TU (h, inter_frame_tu, 4);
+  check_ref_order_hints (decoder, key_refs);
+
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+
+  /* Shown frames are not decoded again */
+  fail_unless_equals_int (decoder->n_tile_groups, 3);
+  check_output (h, decoder, expected, G_N_ELEMENTS (expected));
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_av1_decoder_wait_keyframe)
+{
+  static const gint expected[] = { 0, 1, 0 };
+  GstAV1MockDecoder *decoder;
+  GstHarness *h = create_harness (&decoder);
+  GstSegment segment;
+
+  /* Before the sequence header */
+  PUSH_TU (h, inter_frame_tu, 0);
+
+  PUSH_TU (h, key_frame_tu, 1);
+  PUSH_TU (h, inter_frame_tu, 2);
+
+  fail_unless (gst_harness_push_event (h, gst_event_new_flush_start ()));
+  fail_unless (gst_harness_push_event (h, gst_event_new_flush_stop (TRUE)));
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  fail_unless (gst_harness_push_event (h, gst_event_new_segment (&segment)));
+
+  /* The slots are empty after the flush */
+  PUSH_TU (h, inter_frame_tu, 3);
+  PUSH_TU (h, show_slot_2_tu, 4);
+
+  PUSH_TU (h, key_frame_tu, 5);
+
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+
+  fail_unless_equals_int (decoder->n_sequences, 1);
+  fail_unless_equals_int (decoder->n_tile_groups, 3);
+  fail_unless_equals_int (decoder->n_show_existing, 0);
+  check_output (h, decoder, expected, G_N_ELEMENTS (expected));
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_av1_decoder_multiple_tiles)
+{
+  static const gint expected[] = { 0 };
+  GstAV1MockDecoder *decoder;
+  GstHarness *h = create_harness (&decoder);
+
+  PUSH_TU (h, two_tiles_tu, 0);
+
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+
+  /* Both tiles are in the tile group of the frame */
+  fail_unless_equals_int (decoder->n_tile_groups, 1);
+  fail_unless_equals_int (decoder->tile_sizes->len, 2);
+  fail_unless_equals_int (g_array_index (decoder->tile_sizes, guint32, 0), 3);
+  fail_unless_equals_int (g_array_index (decoder->tile_sizes, guint32, 1), 4);
+  check_output (h, decoder, expected, G_N_ELEMENTS (expected));
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+static Suite *
+av1decoder_suite (void)
+{
+  Suite *s = suite_create ("av1decoder");
+  TCase *tc_chain = tcase_create ("general");
+
+  suite_add_tcase (s, tc_chain);
+  tcase_add_test (tc_chain, test_av1_decoder_decode);
+  tcase_add_test (tc_chain, test_av1_decoder_show_existing_frame);
+  tcase_add_test (tc_chain, test_av1_decoder_wait_keyframe);
+  tcase_add_test (tc_chain, test_av1_decoder_multiple_tiles);
+
+  return s;
+}
+
+GST_CHECK_MAIN (av1decoder);
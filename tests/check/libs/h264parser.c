@@ -229,6 +229,119 @@ GST_START_TEST (test_h264_parse_slice_5bytes)
 
 GST_END_TEST;
 
+/* SPS, PPS and the first IDR slice of a 128x128 picture made of 2 slices */
+static const guint8 h264_128x128_sps[] = {
+  0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0xc0, 0x0b,
+  0x8c, 0x8d, 0x41, 0x02, 0x24, 0x03, 0xc2, 0x21,
+  0x1a, 0x80
+};
+
+static const guint8 h264_128x128_pps[] = {
+  0x00, 0x00, 0x00, 0x01, 0x68, 0xce, 0x3c, 0x80
+};
+
+static const guint8 h264_128x128_idr_slice[] = {
+  0x00, 0x00, 0x00, 0x01, 0x65, 0xb8, 0x00, 0x04,
+  0x00, 0x00, 0x11, 0xff, 0xff, 0xf8, 0x22, 0x8a,
+  0x1f, 0x1c, 0x00, 0x04, 0x0a, 0x63, 0x80, 0x00,
+  0x81, 0xec, 0x9a, 0x93, 0x93, 0x93, 0x93, 0x93,
+  0x93, 0xad, 0x57, 0x5d, 0x75, 0xd7, 0x5d, 0x75,
+  0xd7, 0x5d, 0x75, 0xd7, 0x5d, 0x75, 0xd7, 0x5d,
+  0x75, 0xd7, 0x5d, 0x78
+};
+
+/* P slice skipping all the macroblocks, frame_num 1, POC 2 */
+static const guint8 h264_128x128_p_slice[] = {
+  0x00, 0x00, 0x00, 0x01, 0x41, 0x9a, 0x00, 0x04,
+  0x00, 0x08, 0x50, 0x10, 0x60
+};
+
+static void
+check_slice_hdr_light (GstH264NalParser * parser, const guint8 * data,
+    gsize size)
+{
+  GstH264ParserResult res;
+  GstH264NalUnit nalu;
+  GstH264SliceHdr slice, light;
+
+  res = gst_h264_parser_identify_nalu_unchecked (parser, data, 0, size, &nalu);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+
+  res = gst_h264_parser_parse_slice_hdr (parser, &nalu, &slice, FALSE, FALSE);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+  res = gst_h264_parser_parse_slice_hdr_light (parser, &nalu, &light);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+
+  /* Everything parsed in light mode matches the full parsing */
+  assert_equals_int (light.first_mb_in_slice, slice.first_mb_in_slice);
+  assert_equals_int (light.type, slice.type);
+  fail_unless (light.pps == slice.pps);
+  assert_equals_int (light.frame_num, slice.frame_num);
+  assert_equals_int (light.field_pic_flag, slice.field_pic_flag);
+  assert_equals_int (light.bottom_field_flag, slice.bottom_field_flag);
+  assert_equals_int (light.max_pic_num, slice.max_pic_num);
+  assert_equals_int (light.idr_pic_id, slice.idr_pic_id);
+  assert_equals_int (light.pic_order_cnt_lsb, slice.pic_order_cnt_lsb);
+}
+
+GST_START_TEST (test_h264_parse_slice_hdr_light)
+{
+  GstH264ParserResult res;
+  GstH264NalUnit nalu;
+  GstH264NalParser *parser = gst_h264_nal_parser_new ();
+  GstH264SliceHdr slice;
+
+  res = gst_h264_parser_identify_nalu_unchecked (parser, h264_128x128_sps, 0,
+      sizeof (h264_128x128_sps), &nalu);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+  res = gst_h264_parser_parse_nal (parser, &nalu);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+
+  res = gst_h264_parser_identify_nalu_unchecked (parser, h264_128x128_pps, 0,
+      sizeof (h264_128x128_pps), &nalu);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+  res = gst_h264_parser_parse_nal (parser, &nalu);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+
+  check_slice_hdr_light (parser, h264_128x128_idr_slice,
+      sizeof (h264_128x128_idr_slice));
+  check_slice_hdr_light (parser, h264_128x128_p_slice,
+      sizeof (h264_128x128_p_slice));
+
+  res = gst_h264_parser_identify_nalu_unchecked (parser, h264_128x128_p_slice,
+      0, sizeof (h264_128x128_p_slice), &nalu);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+  res = gst_h264_parser_parse_slice_hdr_light (parser, &nalu, &slice);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+  fail_unless (GST_H264_IS_P_SLICE (&slice));
+  assert_equals_int (slice.frame_num, 1);
+  assert_equals_int (slice.pic_order_cnt_lsb, 2);
+
+  /* Only the start of the header is needed, up to the POC */
+  res = gst_h264_parser_identify_nalu_unchecked (parser, h264_128x128_p_slice,
+      0, 10, &nalu);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+  res = gst_h264_parser_parse_slice_hdr (parser, &nalu, &slice, FALSE, FALSE);
+  assert_equals_int (res, GST_H264_PARSER_ERROR);
+  res = gst_h264_parser_parse_slice_hdr_light (parser, &nalu, &slice);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+  assert_equals_int (slice.frame_num, 1);
+  assert_equals_int (slice.pic_order_cnt_lsb, 2);
+
+  /* Without the PPS */
+  gst_h264_nal_parser_free (parser);
+  parser = gst_h264_nal_parser_new ();
+  res = gst_h264_parser_identify_nalu_unchecked (parser, h264_128x128_p_slice,
+      0, sizeof (h264_128x128_p_slice), &nalu);
+  assert_equals_int (res, GST_H264_PARSER_OK);
+  res = gst_h264_parser_parse_slice_hdr_light (parser, &nalu, &slice);
+  assert_equals_int (res, GST_H264_PARSER_BROKEN_LINK);
+
+  gst_h264_nal_parser_free (parser);
+}
+
+GST_END_TEST;
+
 static guint8 nalu_sps_with_vui[] = {
   0x00, 0x00, 0x00, 0x01, 0x67, 0x64, 0x00, 0x28,
   0xac, 0xd9, 0x40, 0x78, 0x04, 0x4f, 0xde, 0x03,
@@ -666,6 +779,7 @@ h264parser_suite (void)
   tcase_add_test (tc_chain, test_h264_parse_slice_dpa);
   tcase_add_test (tc_chain, test_h264_parse_slice_eoseq_slice);
   tcase_add_test (tc_chain, test_h264_parse_slice_5bytes);
+  tcase_add_test (tc_chain, test_h264_parse_slice_hdr_light);
   tcase_add_test (tc_chain, test_h264_parse_invalid_sei);
   tcase_add_test (tc_chain, test_h264_create_sei);
 
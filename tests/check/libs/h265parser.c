@@ -138,6 +138,43 @@ static guint8 h265_sei_cll[] = {
   0x00, 0x00, 0x00, 0x01, 0x4e, 0x01, 0x90, 0x04, 0x03, 0xe8, 0x01, 0x90, 0x80
 };
 
+/* VPS, SPS, PPS and IDR slice of a 128x128 picture */
+static const guint8 h265_128x128_vps[] = {
+  0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01,
+  0xff, 0xff, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00,
+  0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x3f, 0x95, 0x98, 0x09
+};
+
+static const guint8 h265_128x128_sps[] = {
+  0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x01,
+  0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x03, 0x00, 0x3f, 0xa0, 0x10,
+  0x20, 0x20, 0x59, 0x65, 0x66, 0x92, 0x4c, 0xaf,
+  0xff, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x03, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x1e,
+  0x08
+};
+
+static const guint8 h265_128x128_pps[] = {
+  0x00, 0x00, 0x00, 0x01, 0x44, 0x01, 0xc1, 0x72,
+  0xb4, 0x22, 0x40
+};
+
+static const guint8 h265_128x128_slice_idr_n_lp[] = {
+  0x00, 0x00, 0x00, 0x01, 0x28, 0x01, 0xaf, 0x0e,
+  0xe0, 0x34, 0x82, 0x15, 0x84, 0xf4, 0x70, 0x4f,
+  0xff, 0xed, 0x41, 0x3f, 0xff, 0xe4, 0xcd, 0xc4,
+  0x7c, 0x03, 0x0c, 0xc2, 0xbb, 0xb0, 0x74, 0xe5,
+  0xef, 0x4f, 0xe1, 0xa3, 0xd4, 0x00, 0x02, 0xc2
+};
+
+/* TRAIL_R P slice predicted from the previous picture, POC 1 */
+static const guint8 h265_128x128_slice_trail_r[] = {
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xd0, 0x09,
+  0x70, 0xcf, 0xa5, 0x5a
+};
+
 GST_START_TEST (test_h265_parse_slice_eos_slice_eob)
 {
   GstH265ParserResult res;
@@ -1090,6 +1127,103 @@ GST_START_TEST (test_h265_create_sei)
 
 GST_END_TEST;
 
+static void
+check_slice_hdr_light (GstH265Parser * parser, const guint8 * data,
+    gsize size)
+{
+  GstH265ParserResult res;
+  GstH265NalUnit nalu;
+  GstH265SliceHdr slice, light;
+
+  res = gst_h265_parser_identify_nalu_unchecked (parser, data, 0, size, &nalu);
+  assert_equals_int (res, GST_H265_PARSER_OK);
+
+  res = gst_h265_parser_parse_slice_hdr (parser, &nalu, &slice);
+  assert_equals_int (res, GST_H265_PARSER_OK);
+  res = gst_h265_parser_parse_slice_hdr_light (parser, &nalu, &light);
+  assert_equals_int (res, GST_H265_PARSER_OK);
+
+  /* Everything parsed in light mode matches the full parsing */
+  assert_equals_int (light.first_slice_segment_in_pic_flag,
+      slice.first_slice_segment_in_pic_flag);
+  assert_equals_int (light.no_output_of_prior_pics_flag,
+      slice.no_output_of_prior_pics_flag);
+  fail_unless (light.pps == slice.pps);
+  assert_equals_int (light.dependent_slice_segment_flag,
+      slice.dependent_slice_segment_flag);
+  assert_equals_int (light.segment_address, slice.segment_address);
+  assert_equals_int (light.type, slice.type);
+  assert_equals_int (light.pic_output_flag, slice.pic_output_flag);
+  assert_equals_int (light.colour_plane_id, slice.colour_plane_id);
+  assert_equals_int (light.pic_order_cnt_lsb, slice.pic_order_cnt_lsb);
+
+  gst_h265_slice_hdr_free (&slice);
+}
+
+GST_START_TEST (test_h265_parse_slice_hdr_light)
+{
+  GstH265ParserResult res;
+  GstH265NalUnit nalu;
+  GstH265Parser *parser = gst_h265_parser_new ();
+  GstH265SliceHdr slice;
+  const guint8 *headers[] = {
+    h265_128x128_vps, h265_128x128_sps, h265_128x128_pps
+  };
+  const gsize header_sizes[] = {
+    sizeof (h265_128x128_vps), sizeof (h265_128x128_sps),
+    sizeof (h265_128x128_pps)
+  };
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (headers); i++) {
+    res = gst_h265_parser_identify_nalu_unchecked (parser, headers[i], 0,
+        header_sizes[i], &nalu);
+    assert_equals_int (res, GST_H265_PARSER_OK);
+    res = gst_h265_parser_parse_nal (parser, &nalu);
+    assert_equals_int (res, GST_H265_PARSER_OK);
+  }
+
+  check_slice_hdr_light (parser, h265_128x128_slice_idr_n_lp,
+      sizeof (h265_128x128_slice_idr_n_lp));
+  check_slice_hdr_light (parser, h265_128x128_slice_trail_r,
+      sizeof (h265_128x128_slice_trail_r));
+
+  res = gst_h265_parser_identify_nalu_unchecked (parser,
+      h265_128x128_slice_trail_r, 0, sizeof (h265_128x128_slice_trail_r),
+      &nalu);
+  assert_equals_int (res, GST_H265_PARSER_OK);
+  res = gst_h265_parser_parse_slice_hdr_light (parser, &nalu, &slice);
+  assert_equals_int (res, GST_H265_PARSER_OK);
+  fail_unless (GST_H265_IS_P_SLICE (&slice));
+  assert_equals_int (slice.pic_order_cnt_lsb, 1);
+
+  /* Only the start of the header is needed, up to the POC */
+  res = gst_h265_parser_identify_nalu_unchecked (parser,
+      h265_128x128_slice_trail_r, 0, 8, &nalu);
+  assert_equals_int (res, GST_H265_PARSER_OK);
+  res = gst_h265_parser_parse_slice_hdr (parser, &nalu, &slice);
+  assert_equals_int (res, GST_H265_PARSER_ERROR);
+  gst_h265_slice_hdr_free (&slice);
+  res = gst_h265_parser_parse_slice_hdr_light (parser, &nalu, &slice);
+  assert_equals_int (res, GST_H265_PARSER_OK);
+  fail_unless (GST_H265_IS_P_SLICE (&slice));
+  assert_equals_int (slice.pic_order_cnt_lsb, 1);
+
+  /* Without the PPS */
+  gst_h265_parser_free (parser);
+  parser = gst_h265_parser_new ();
+  res = gst_h265_parser_identify_nalu_unchecked (parser,
+      h265_128x128_slice_trail_r, 0, sizeof (h265_128x128_slice_trail_r),
+      &nalu);
+  assert_equals_int (res, GST_H265_PARSER_OK);
+  res = gst_h265_parser_parse_slice_hdr_light (parser, &nalu, &slice);
+  assert_equals_int (res, GST_H265_PARSER_BROKEN_LINK);
+
+  gst_h265_parser_free (parser);
+}
+
+GST_END_TEST;
+
 static Suite *
 h265parser_suite (void)
 {
@@ -1101,6 +1235,7 @@ h265parser_suite (void)
   tcase_add_test (tc_chain, test_h265_parse_slice_eos_slice_eob);
   tcase_add_test (tc_chain, test_h265_parse_pic_timing);
   tcase_add_test (tc_chain, test_h265_parse_slice_6bytes);
+  tcase_add_test (tc_chain, test_h265_parse_slice_hdr_light);
   tcase_add_test (tc_chain, test_h265_base_profiles);
   tcase_add_test (tc_chain, test_h265_base_profiles_compat);
   tcase_add_test (tc_chain, test_h265_format_range_profiles_exact_match);
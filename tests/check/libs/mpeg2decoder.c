@@ -0,0 +1,483 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <gst/check/gstcheck.h>
+#include <gst/base/gstbitwriter.h>
+#include <gst/codecs/gstmpeg2decoder.h>
+
+#define WIDTH 64
+#define HEIGHT 32
+
+/* A software decoder which only records what the base class asks */
+#define GST_TYPE_MPEG2_MOCK_DECODER (gst_mpeg2_mock_decoder_get_type ())
+G_DECLARE_FINAL_TYPE (GstMpeg2MockDecoder, gst_mpeg2_mock_decoder,
+    GST, MPEG2_MOCK_DECODER, GstMpeg2Decoder);
+
+struct _GstMpeg2MockDecoder
+{
+  GstMpeg2Decoder parent;
+
+  guint n_sequences;
+  guint n_field_pictures;
+  /* tsn of the output pictures */
+  GArray *output;
+  /* tsn of the forward reference of each second field, or -1 */
+  GArray *second_field_prev;
+};
+
+G_DEFINE_TYPE (GstMpeg2MockDecoder, gst_mpeg2_mock_decoder,
+    GST_TYPE_MPEG2_DECODER);
+
+static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("video/mpeg, mpegversion = (int) 2, "
+        "systemstream = (boolean) false"));
+
+static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC, GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("I420")));
+
+static gboolean
+gst_mpeg2_mock_decoder_new_sequence (GstMpeg2Decoder * decoder,
+    const GstMpegVideoSequenceHdr * seq,
+    const GstMpegVideoSequenceExt * seq_ext,
+    const GstMpegVideoSequenceDisplayExt * seq_display_ext,
+    const GstMpegVideoSequenceScalableExt * seq_scalable_ext)
+{
+  GstMpeg2MockDecoder *self = GST_MPEG2_MOCK_DECODER (decoder);
+  GstVideoCodecState *state;
+
+  self->n_sequences++;
+
+  state = gst_video_decoder_set_output_state (GST_VIDEO_DECODER (decoder),
+      GST_VIDEO_FORMAT_I420, seq->width, seq->height, decoder->input_state);
+  gst_video_codec_state_unref (state);
+
+  return gst_video_decoder_negotiate (GST_VIDEO_DECODER (decoder));
+}
+
+static gboolean
+gst_mpeg2_mock_decoder_new_field_picture (GstMpeg2Decoder * decoder,
+    GstMpeg2Picture * first_field, GstMpeg2Picture * second_field)
+{
+  GstMpeg2MockDecoder *self = GST_MPEG2_MOCK_DECODER (decoder);
+
+  fail_unless (second_field->first_field == first_field);
+  fail_unless (first_field->structure != second_field->structure);
+
+  self->n_field_pictures++;
+
+  return TRUE;
+}
+
+static gboolean
+gst_mpeg2_mock_decoder_start_picture (GstMpeg2Decoder * decoder,
+    GstMpeg2Picture * picture, GstMpeg2Slice * slice,
+    GstMpeg2Picture * prev_picture, GstMpeg2Picture * next_picture)
+{
+  GstMpeg2MockDecoder *self = GST_MPEG2_MOCK_DECODER (decoder);
+
+  switch (picture->type) {
+    case GST_MPEG_VIDEO_PICTURE_TYPE_I:
+      fail_unless (next_picture == NULL);
+      break;
+    case GST_MPEG_VIDEO_PICTURE_TYPE_P:
+      fail_unless (next_picture == NULL);
+      break;
+    case GST_MPEG_VIDEO_PICTURE_TYPE_B:
+      fail_unless (next_picture != NULL);
+      break;
+    default:
+      fail ("Unexpected picture type %d", picture->type);
+      break;
+  }
+
+  if (picture->first_field) {
+    gint prev = prev_picture ? prev_picture->tsn : -1;
+
+    g_array_append_val (self->second_field_prev, prev);
+  }
+
+  fail_unless_equals_int (slice->pic_hdr->tsn, picture->tsn);
+
+  return TRUE;
+}
+
+static gboolean
+gst_mpeg2_mock_decoder_decode_slice (GstMpeg2Decoder * decoder,
+    GstMpeg2Picture * picture, GstMpeg2Slice * slice)
+{
+  /* The slice starts at its start code */
+  fail_unless_equals_int (slice->packet.data[slice->sc_offset + 2], 0x01);
+  fail_unless_equals_int (slice->header.mb_column, 0);
+
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_mpeg2_mock_decoder_output_picture (GstMpeg2Decoder * decoder,
+    GstVideoCodecFrame * frame, GstMpeg2Picture * picture)
+{
+  GstMpeg2MockDecoder *self = GST_MPEG2_MOCK_DECODER (decoder);
+  GstVideoDecoder *vdec = GST_VIDEO_DECODER (decoder);
+  gint tsn = picture->tsn;
+  GstFlowReturn ret;
+
+  g_array_append_val (self->output, tsn);
+  gst_mpeg2_picture_unref (picture);
+
+  ret = gst_video_decoder_allocate_output_frame (vdec, frame);
+  if (ret != GST_FLOW_OK) {
+    gst_video_decoder_drop_frame (vdec, frame);
+    return ret;
+  }
+
+  return gst_video_decoder_finish_frame (vdec, frame);
+}
+
+static void
+gst_mpeg2_mock_decoder_finalize (GObject * object)
+{
+  GstMpeg2MockDecoder *self = GST_MPEG2_MOCK_DECODER (object);
+
+  g_array_unref (self->output);
+  g_array_unref (self->second_field_prev);
+
+  G_OBJECT_CLASS (gst_mpeg2_mock_decoder_parent_class)->finalize (object);
+}
+
+static void
+gst_mpeg2_mock_decoder_class_init (GstMpeg2MockDecoderClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstMpeg2DecoderClass *mpeg2decoder_class = GST_MPEG2_DECODER_CLASS (klass);
+
+  gobject_class->finalize = gst_mpeg2_mock_decoder_finalize;
+
+  gst_element_class_add_static_pad_template (element_class, &sink_template);
+  gst_element_class_add_static_pad_template (element_class, &src_template);
+  gst_element_class_set_static_metadata (element_class,
+      "MPEG-2 mock decoder", "Codec/Decoder/Video",
+      "Records the calls of the MPEG-2 decoder base class", "GStreamer");
+
+  mpeg2decoder_class->new_sequence = gst_mpeg2_mock_decoder_new_sequence;
+  mpeg2decoder_class->new_field_picture =
+      gst_mpeg2_mock_decoder_new_field_picture;
+  mpeg2decoder_class->start_picture = gst_mpeg2_mock_decoder_start_picture;
+  mpeg2decoder_class->decode_slice = gst_mpeg2_mock_decoder_decode_slice;
+  mpeg2decoder_class->output_picture = gst_mpeg2_mock_decoder_output_picture;
+}
+
+static void
+gst_mpeg2_mock_decoder_init (GstMpeg2MockDecoder * self)
+{
+  self->output = g_array_new (FALSE, FALSE, sizeof (gint));
+  self->second_field_prev = g_array_new (FALSE, FALSE, sizeof (gint));
+}
+
+/* Bitstream writers, with the values the tests don't care about fixed */
+
+static void
+put_start_code (GstBitWriter * bw, guint8 code)
+{
+  gst_bit_writer_align_bytes (bw, 0);
+  gst_bit_writer_put_bits_uint32 (bw, 0x000001, 24);
+  gst_bit_writer_put_bits_uint8 (bw, code, 8);
+}
+
+static void
+put_sequence (GstBitWriter * bw, gboolean progressive, gboolean closed_gop)
+{
+  put_start_code (bw, GST_MPEG_VIDEO_PACKET_SEQUENCE);
+  gst_bit_writer_put_bits_uint16 (bw, WIDTH, 12);
+  gst_bit_writer_put_bits_uint16 (bw, HEIGHT, 12);
+  gst_bit_writer_put_bits_uint8 (bw, 1, 4);     /* aspect_ratio_information */
+  gst_bit_writer_put_bits_uint8 (bw, 3, 4);     /* frame_rate_code, 25 */
+  gst_bit_writer_put_bits_uint32 (bw, 0x3ffff, 18);     /* bit_rate_value */
+  gst_bit_writer_put_bits_uint8 (bw, 1, 1);     /* marker_bit */
+  gst_bit_writer_put_bits_uint16 (bw, 112, 10); /* vbv_buffer_size_value */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* constrained_parameters */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* load_intra_quantiser */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* load_non_intra_quantiser */
+
+  put_start_code (bw, GST_MPEG_VIDEO_PACKET_EXTENSION);
+  gst_bit_writer_put_bits_uint8 (bw, GST_MPEG_VIDEO_PACKET_EXT_SEQUENCE, 4);
+  gst_bit_writer_put_bits_uint8 (bw, 0x48, 8);  /* main profile @ main level */
+  gst_bit_writer_put_bits_uint8 (bw, progressive, 1);
+  gst_bit_writer_put_bits_uint8 (bw, 1, 2);     /* chroma_format, 4:2:0 */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 2);     /* horizontal_size_extension */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 2);     /* vertical_size_extension */
+  gst_bit_writer_put_bits_uint16 (bw, 0, 12);   /* bit_rate_extension */
+  gst_bit_writer_put_bits_uint8 (bw, 1, 1);     /* marker_bit */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 8);     /* vbv_buffer_size_extension */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* low_delay */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 2);     /* frame_rate_extension_n */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 5);     /* frame_rate_extension_d */
+
+  put_start_code (bw, GST_MPEG_VIDEO_PACKET_GOP);
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* drop_frame_flag */
+  gst_bit_writer_put_bits_uint8 (bw, 1, 5);     /* hours */
+  gst_bit_writer_put_bits_uint8 (bw, 1, 6);     /* minutes */
+  gst_bit_writer_put_bits_uint8 (bw, 1, 1);     /* marker_bit */
+  gst_bit_writer_put_bits_uint8 (bw, 1, 6);     /* seconds */
+  gst_bit_writer_put_bits_uint8 (bw, 1, 6);     /* pictures */
+  gst_bit_writer_put_bits_uint8 (bw, closed_gop, 1);
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* broken_link */
+}
+
+static void
+put_picture (GstBitWriter * bw, GstMpegVideoPictureType type, guint16 tsn,
+    GstMpegVideoPictureStructure structure)
+{
+  guint8 f_code[2] = { 0xf, 0xf };
+  guint i;
+
+  put_start_code (bw, GST_MPEG_VIDEO_PACKET_PICTURE);
+  gst_bit_writer_put_bits_uint16 (bw, tsn, 10);
+  gst_bit_writer_put_bits_uint8 (bw, type, 3);
+  gst_bit_writer_put_bits_uint16 (bw, 0xffff, 16);      /* vbv_delay */
+  if (type == GST_MPEG_VIDEO_PICTURE_TYPE_P
+      || type == GST_MPEG_VIDEO_PICTURE_TYPE_B) {
+    gst_bit_writer_put_bits_uint8 (bw, 0, 1);   /* full_pel_forward_vector */
+    gst_bit_writer_put_bits_uint8 (bw, 7, 3);   /* forward_f_code */
+    f_code[0] = 1;
+  }
+  if (type == GST_MPEG_VIDEO_PICTURE_TYPE_B) {
+    gst_bit_writer_put_bits_uint8 (bw, 0, 1);   /* full_pel_backward_vector */
+    gst_bit_writer_put_bits_uint8 (bw, 7, 3);   /* backward_f_code */
+    f_code[1] = 1;
+  }
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* extra_bit_picture */
+
+  put_start_code (bw, GST_MPEG_VIDEO_PACKET_EXTENSION);
+  gst_bit_writer_put_bits_uint8 (bw, GST_MPEG_VIDEO_PACKET_EXT_PICTURE, 4);
+  for (i = 0; i < 4; i++)
+    gst_bit_writer_put_bits_uint8 (bw, f_code[i / 2], 4);
+  gst_bit_writer_put_bits_uint8 (bw, 0, 2);     /* intra_dc_precision */
+  gst_bit_writer_put_bits_uint8 (bw, structure, 2);
+  gst_bit_writer_put_bits_uint8 (bw, 1, 1);     /* top_field_first */
+  gst_bit_writer_put_bits_uint8 (bw,
+      structure == GST_MPEG_VIDEO_PICTURE_STRUCTURE_FRAME, 1);
+  gst_bit_writer_put_bits_uint8 (bw, 0, 4);     /* concealment_motion_vectors,
+                                                 * q_scale_type,
+                                                 * intra_vlc_format,
+                                                 * alternate_scan */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* repeat_first_field */
+  gst_bit_writer_put_bits_uint8 (bw, 1, 1);     /* chroma_420_type */
+  gst_bit_writer_put_bits_uint8 (bw,
+      structure == GST_MPEG_VIDEO_PICTURE_STRUCTURE_FRAME, 1);
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* composite_display_flag */
+
+  /* A slice of the first macroblock row, its data is never decoded */
+  put_start_code (bw, 0x01);
+  gst_bit_writer_put_bits_uint8 (bw, 8, 5);     /* quantiser_scale_code */
+  gst_bit_writer_put_bits_uint8 (bw, 0, 1);     /* extra_bit_slice */
+  gst_bit_writer_put_bits_uint8 (bw, 1, 1);     /* macroblock_address_inc */
+  gst_bit_writer_put_bits_uint16 (bw, 0x1ff, 9);
+}
+
+static GstBuffer *
+finish_buffer (GstBitWriter * bw, guint display_index)
+{
+  GstBuffer *buf;
+
+  gst_bit_writer_align_bytes (bw, 0);
+  buf = gst_bit_writer_reset_and_get_buffer (bw);
+  GST_BUFFER_PTS (buf) = display_index * 40 * GST_MSECOND;
+  GST_BUFFER_DURATION (buf) = 40 * GST_MSECOND;
+
+  return buf;
+}
+
+static GstHarness *
+create_harness (GstMpeg2MockDecoder ** decoder)
+{
+  GstHarness *h;
+
+  *decoder = g_object_new (GST_TYPE_MPEG2_MOCK_DECODER, NULL);
+  h = gst_harness_new_with_element (GST_ELEMENT (*decoder), "sink", "src");
+  gst_harness_set_src_caps_str (h, "video/mpeg, mpegversion = (int) 2, "
+      "systemstream = (boolean) false");
+
+  return h;
+}
+
+static void
+check_output (GstHarness * h, GstMpeg2MockDecoder * decoder,
+    const gint * expected, guint n_expected)
+{
+  GstClockTime last_pts = GST_CLOCK_TIME_NONE;
+  guint i;
+
+  fail_unless_equals_int (decoder->output->len, n_expected);
+  fail_unless_equals_int (gst_harness_buffers_in_queue (h), n_expected);
+
+  for (i = 0; i < n_expected; i++) {
+    GstBuffer *buf = gst_harness_pull (h);
+
+    fail_unless_equals_int (g_array_index (decoder->output, gint, i),
+        expected[i]);
+
+    /* Displayed in presentation order */
+    if (GST_CLOCK_TIME_IS_VALID (last_pts))
+      fail_unless (GST_BUFFER_PTS (buf) > last_pts);
+    last_pts = GST_BUFFER_PTS (buf);
+
+    gst_buffer_unref (buf);
+  }
+}
+
+typedef struct
+{
+  GstMpegVideoPictureType type;
+  guint16 tsn;
+} PictureDesc;
+
+#define I GST_MPEG_VIDEO_PICTURE_TYPE_I
+#define P GST_MPEG_VIDEO_PICTURE_TYPE_P
+#define B GST_MPEG_VIDEO_PICTURE_TYPE_B
+
+static void
+push_frames (GstHarness * h, const PictureDesc * pictures, guint n_pictures,
+    gboolean closed_gop)
+{
+  GstBitWriter bw;
+  guint i;
+
+  gst_bit_writer_init (&bw);
+
+  for (i = 0; i < n_pictures; i++) {
+    if (pictures[i].type == I)
+      put_sequence (&bw, TRUE, closed_gop);
+    put_picture (&bw, pictures[i].type, pictures[i].tsn,
+        GST_MPEG_VIDEO_PICTURE_STRUCTURE_FRAME);
+    fail_unless_equals_int (gst_harness_push (h,
+            finish_buffer (&bw, pictures[i].tsn)), GST_FLOW_OK);
+  }
+}
+
+GST_START_TEST (test_mpeg2_decoder_reorder)
+{
+  static const PictureDesc pictures[] = {
+    {I, 0}, {P, 3}, {B, 1}, {B, 2}, {P, 6}, {B, 4}, {B, 5},
+  };
+  static const gint expected[] = { 0, 1, 2, 3, 4, 5, 6 };
+  GstMpeg2MockDecoder *decoder;
+  GstHarness *h = create_harness (&decoder);
+
+  push_frames (h, pictures, G_N_ELEMENTS (pictures), TRUE);
+
+  /* The last anchor picture is output when the stream ends */
+  fail_unless_equals_int (decoder->output->len, 6);
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+
+  fail_unless_equals_int (decoder->n_sequences, 1);
+  check_output (h, decoder, expected, G_N_ELEMENTS (expected));
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_mpeg2_decoder_open_gop)
+{
+  /* Starts on a P picture, then the leading B pictures of the open GOP
+   * miss their forward reference */
+  static const PictureDesc pictures[] = {
+    {P, 9}, {I, 2}, {B, 0}, {B, 1}, {P, 5}, {B, 3}, {B, 4},
+  };
+  static const gint expected[] = { 2, 3, 4, 5 };
+  GstMpeg2MockDecoder *decoder;
+  GstHarness *h = create_harness (&decoder);
+
+  push_frames (h, pictures, G_N_ELEMENTS (pictures), FALSE);
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+
+  check_output (h, decoder, expected, G_N_ELEMENTS (expected));
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_mpeg2_decoder_field_pictures)
+{
+  static const gint expected[] = { 0, 1, 3 };
+  GstMpeg2MockDecoder *decoder;
+  GstHarness *h = create_harness (&decoder);
+  GstBitWriter bw;
+
+  gst_bit_writer_init (&bw);
+
+  /* I/P field pair in one buffer */
+  put_sequence (&bw, FALSE, TRUE);
+  put_picture (&bw, I, 0, GST_MPEG_VIDEO_PICTURE_STRUCTURE_TOP_FIELD);
+  put_picture (&bw, P, 0, GST_MPEG_VIDEO_PICTURE_STRUCTURE_BOTTOM_FIELD);
+  fail_unless_equals_int (gst_harness_push (h, finish_buffer (&bw, 0)),
+      GST_FLOW_OK);
+
+  /* P field pair with one field per buffer */
+  put_picture (&bw, P, 3, GST_MPEG_VIDEO_PICTURE_STRUCTURE_TOP_FIELD);
+  fail_unless_equals_int (gst_harness_push (h, finish_buffer (&bw, 3)),
+      GST_FLOW_OK);
+  put_picture (&bw, P, 3, GST_MPEG_VIDEO_PICTURE_STRUCTURE_BOTTOM_FIELD);
+  fail_unless_equals_int (gst_harness_push (h, finish_buffer (&bw, 3)),
+      GST_FLOW_OK);
+
+  put_picture (&bw, B, 1, GST_MPEG_VIDEO_PICTURE_STRUCTURE_TOP_FIELD);
+  put_picture (&bw, B, 1, GST_MPEG_VIDEO_PICTURE_STRUCTURE_BOTTOM_FIELD);
+  fail_unless_equals_int (gst_harness_push (h, finish_buffer (&bw, 1)),
+      GST_FLOW_OK);
+
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+
+  fail_unless_equals_int (decoder->n_field_pictures, 3);
+
+  /* The second fields are predicted from the frames before theirs */
+  fail_unless_equals_int (decoder->second_field_prev->len, 3);
+  fail_unless_equals_int (g_array_index (decoder->second_field_prev, gint,
+          0), -1);
+  fail_unless_equals_int (g_array_index (decoder->second_field_prev, gint,
+          1), 0);
+  fail_unless_equals_int (g_array_index (decoder->second_field_prev, gint,
+          2), 0);
+
+  /* One picture per frame */
+  check_output (h, decoder, expected, G_N_ELEMENTS (expected));
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+static Suite *
+mpeg2decoder_suite (void)
+{
+  Suite *s = suite_create ("mpeg2decoder");
+  TCase *tc_chain = tcase_create ("general");
+
+  suite_add_tcase (s, tc_chain);
+  tcase_add_test (tc_chain, test_mpeg2_decoder_reorder);
+  tcase_add_test (tc_chain, test_mpeg2_decoder_open_gop);
+  tcase_add_test (tc_chain, test_mpeg2_decoder_field_pictures);
+
+  return s;
+}
+
+GST_CHECK_MAIN (mpeg2decoder);
@@ -667,6 +667,171 @@ GST_START_TEST (test_mpegts_dvb_descriptors)
 
 GST_END_TEST;
 
+GST_START_TEST (test_mpegts_arena_parsing)
+{
+  GstMpegtsSection *section, *eager_section;
+  const GstMpegtsSDT *sdt, *eager_sdt;
+  GstMpegtsSDT *sdt_copy;
+  GstMpegtsSDTService *service, *eager_service, *copy;
+  GstMpegtsDescriptor *desc, *eager_desc;
+  GstMpegtsDVBServiceType service_type;
+  gchar *name, *provider;
+  guint i, j;
+
+  section = gst_mpegts_section_new (0x11, g_memdup (sdt_data_check,
+          sizeof (sdt_data_check)), sizeof (sdt_data_check));
+  eager_section = gst_mpegts_section_new (0x11, g_memdup (sdt_data_check,
+          sizeof (sdt_data_check)), sizeof (sdt_data_check));
+  gst_mpegts_section_set_arena_parsing (section, TRUE);
+
+  sdt = gst_mpegts_section_get_sdt (section);
+  eager_sdt = gst_mpegts_section_get_sdt (eager_section);
+  fail_if (sdt == NULL);
+  fail_if (eager_sdt == NULL);
+
+  /* Same services and descriptors as with the eager parsing */
+  fail_unless_equals_int (sdt->services->len, eager_sdt->services->len);
+  for (i = 0; i < sdt->services->len; i++) {
+    service = g_ptr_array_index (sdt->services, i);
+    eager_service = g_ptr_array_index (eager_sdt->services, i);
+
+    fail_unless_equals_int (service->service_id, eager_service->service_id);
+    fail_unless_equals_int (service->running_status,
+        eager_service->running_status);
+    fail_unless_equals_int (service->free_CA_mode,
+        eager_service->free_CA_mode);
+    fail_unless_equals_int (service->descriptors->len,
+        eager_service->descriptors->len);
+    for (j = 0; j < service->descriptors->len; j++) {
+      desc = g_ptr_array_index (service->descriptors, j);
+      eager_desc = g_ptr_array_index (eager_service->descriptors, j);
+
+      fail_unless_equals_int (desc->tag, eager_desc->tag);
+      fail_unless_equals_int (desc->length, eager_desc->length);
+      fail_unless (memcmp (desc->data, eager_desc->data,
+              desc->length + 2) == 0);
+    }
+  }
+
+  /* The descriptors point to the section data */
+  service = g_ptr_array_index (sdt->services, 0);
+  desc = g_ptr_array_index (service->descriptors, 0);
+  fail_unless (desc->data >= section->data &&
+      desc->data < section->data + section->section_length);
+  fail_unless (gst_mpegts_descriptor_parse_dvb_service (desc, &service_type,
+          &name, &provider));
+  fail_unless (service_type == GST_DVB_SERVICE_DIGITAL_TELEVISION);
+  g_free (name);
+  g_free (provider);
+
+  /* Copies of the table and of an entry, with their descriptors, outlive
+   * the section */
+  copy = g_boxed_copy (GST_TYPE_MPEGTS_SDT_SERVICE, service);
+  sdt_copy = g_boxed_copy (GST_TYPE_MPEGTS_SDT, sdt);
+  gst_mpegts_section_unref (section);
+  eager_service = g_ptr_array_index (eager_sdt->services, 0);
+  eager_desc = g_ptr_array_index (eager_service->descriptors, 0);
+  fail_unless_equals_int (copy->service_id, eager_service->service_id);
+  desc = g_ptr_array_index (copy->descriptors, 0);
+  fail_unless (memcmp (desc->data, eager_desc->data, desc->length + 2) == 0);
+  g_boxed_free (GST_TYPE_MPEGTS_SDT_SERVICE, copy);
+
+  fail_unless_equals_int (sdt_copy->services->len, eager_sdt->services->len);
+  service = g_ptr_array_index (sdt_copy->services, 0);
+  fail_unless_equals_int (service->service_id, eager_service->service_id);
+  desc = g_ptr_array_index (service->descriptors, 0);
+  fail_unless (memcmp (desc->data, eager_desc->data, desc->length + 2) == 0);
+  g_boxed_free (GST_TYPE_MPEGTS_SDT, sdt_copy);
+
+  gst_mpegts_section_unref (eager_section);
+}
+
+GST_END_TEST;
+
+static const struct
+{
+  const gchar *arib;
+  const gchar *utf8;
+} arib_strings[] = {
+  /* Katakana in GR (LS3R), full-width digit and additional symbol in the
+   * Kanji set */
+  {"\x1b\x7c\xcb\xe5\x21\x3c\xb9\x23\x37\x7a\x56",
+      "\xe3\x83\x8b\xe3\x83\xa5\xe3\x83\xbc\xe3\x82\xb9\xef\xbc\x97[\xe5"
+      "\xad\x97]"},
+  /* Alphanumerics (LS1), then hiragana in GR */
+  {"\x0e\x4e\x48\x4b\x20\xa4\xa2", "NHK \xe3\x81\x84\xe3\x81\x82"},
+  /* JIS X 0201 katakana designated to G2 */
+  {"\x1b\x2a\x49\xb1", "\xef\xbd\xb1"},
+  /* Character with a combining mark */
+  {"\x24\x77", "\xe3\x81\x8b\xe3\x82\x9a"},
+  /* Additional symbols designated to G3 and single shifted */
+  {"\x1b\x24\x2b\x3b\x1d\x7a\x56\xa4\xa2",
+      "[\xe5\xad\x97]\xe3\x81\x84\xe3\x81\x82"},
+};
+
+GST_START_TEST (test_mpegts_arib_strings)
+{
+  GstMpegtsDescriptor *desc;
+  gchar *string;
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (arib_strings); i++) {
+    desc = gst_mpegts_descriptor_from_custom (0x40,
+        (const guint8 *) arib_strings[i].arib, strlen (arib_strings[i].arib));
+    fail_unless (gst_mpegts_descriptor_parse_dvb_network_name (desc,
+            &string));
+    fail_unless_equals_string (string, arib_strings[i].utf8);
+    g_free (string);
+    gst_mpegts_descriptor_free (desc);
+  }
+}
+
+GST_END_TEST;
+
+static guint32
+calc_crc32_bytewise (const guint8 * data, guint datalen)
+{
+  guint32 crc = 0xffffffff;
+  guint i, j;
+
+  for (i = 0; i < datalen; i++) {
+    crc ^= data[i] << 24;
+    for (j = 0; j < 8; j++)
+      crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04c11db7 : crc << 1;
+  }
+
+  return crc;
+}
+
+GST_START_TEST (test_mpegts_crc32)
+{
+  guint8 data[4096 + 8];
+  guint i, len;
+
+  /* CRC-32/MPEG-2 check value */
+  fail_unless_equals_int (_calc_crc32 ((const guint8 *) "123456789", 9),
+      0x0376e6e7);
+
+  /* Sections with their CRC appended give a 0 remainder */
+  fail_unless_equals_int (_calc_crc32 (pat_data_check,
+          sizeof (pat_data_check)), 0);
+  fail_unless_equals_int (_calc_crc32 (nit_data_check,
+          sizeof (nit_data_check)), 0);
+  fail_unless_equals_int (_calc_crc32 (sdt_data_check,
+          sizeof (sdt_data_check)), 0);
+
+  /* All lengths and alignments */
+  for (i = 0; i < sizeof (data); i++)
+    data[i] = i * 7 + (i >> 8);
+  for (len = 0; len <= 4096; len += (len < 64) ? 1 : 61) {
+    for (i = 0; i < 8; i++)
+      fail_unless_equals_int (_calc_crc32 (data + i, len),
+          calc_crc32_bytewise (data + i, len));
+  }
+}
+
+GST_END_TEST;
+
 static Suite *
 mpegts_suite (void)
 {
@@ -685,6 +850,9 @@ mpegts_suite (void)
   tcase_add_test (tc_chain, test_mpegts_atsc_stt);
   tcase_add_test (tc_chain, test_mpegts_descriptors);
   tcase_add_test (tc_chain, test_mpegts_dvb_descriptors);
+  tcase_add_test (tc_chain, test_mpegts_arena_parsing);
+  tcase_add_test (tc_chain, test_mpegts_arib_strings);
+  tcase_add_test (tc_chain, test_mpegts_crc32);
 
   return s;
 }
@@ -102,6 +102,285 @@ GST_START_TEST (test_nal_writer_emulation_preventation)
 
 GST_END_TEST;
 
+GST_START_TEST (test_scan_for_start_codes)
+{
+  /* Start code at 40, after blocks with zeros and emulation prevention
+   * bytes on both sides of the block boundaries */
+  guint8 data[64] = { 0, };
+  static const guint expected_epb[] = { 2, 15, 18, 33 };
+  GArray *epb = g_array_new (FALSE, FALSE, sizeof (guint));
+  GRand *rand = g_rand_new_with_seed (1);
+  guint i, j;
+
+  data[2] = 0x03;
+  data[3] = 0x01;
+  memset (data + 4, 0xff, 9);
+  data[15] = 0x03;
+  data[18] = 0x03;
+  memset (data + 19, 0xff, 12);
+  data[33] = 0x03;
+  memset (data + 34, 0xff, 6);
+  data[42] = 0x01;
+  data[43] = 0x65;
+
+  assert_equals_int (scan_for_start_codes (data, sizeof data), 40);
+  assert_equals_int (scan_for_start_codes_with_epb (data, sizeof data, epb),
+      40);
+  assert_equals_int (epb->len, G_N_ELEMENTS (expected_epb));
+  for (i = 0; i < epb->len; i++)
+    assert_equals_int (g_array_index (epb, guint, i), expected_epb[i]);
+
+  /* The start code must be followed by a byte */
+  assert_equals_int (scan_for_start_codes (data + 40, 3), -1);
+  assert_equals_int (scan_for_start_codes (data + 40, 4), 0);
+
+  /* Vectorized and scalar scanners agree on random data rich in zeros */
+  for (i = 0; i < 10000; i++) {
+    GArray *ref_epb = g_array_new (FALSE, FALSE, sizeof (guint));
+    guint size = g_rand_int_range (rand, 0, sizeof data);
+
+    for (j = 0; j < size; j++) {
+      switch (g_rand_int_range (rand, 0, 6)) {
+        case 0:
+          data[j] = 0x01;
+          break;
+        case 1:
+          data[j] = 0x03;
+          break;
+        case 2:
+          data[j] = g_rand_int_range (rand, 0, 256);
+          break;
+        default:
+          data[j] = 0x00;
+          break;
+      }
+    }
+
+    g_array_set_size (epb, 0);
+    assert_equals_int (scan_for_start_codes_with_epb (data, size, epb),
+        scan_for_start_codes_scalar (data, size, ref_epb));
+    assert_equals_int (epb->len, ref_epb->len);
+    fail_unless (memcmp (epb->data, ref_epb->data,
+            epb->len * sizeof (guint)) == 0);
+    g_array_free (ref_epb, TRUE);
+  }
+
+  g_array_free (epb, TRUE);
+  g_rand_free (rand);
+}
+
+GST_END_TEST;
+
+/* Byte by byte reader, which NalReader must match exactly */
+typedef struct
+{
+  const guint8 *data;
+  guint size;
+  guint n_epb;
+  guint byte;
+  guint bits_in_cache;
+  guint8 first_byte;
+  guint32 epb_cache;
+  guint64 cache;
+} RefReader;
+
+static void
+ref_reader_init (RefReader * rr, const guint8 * data, guint size)
+{
+  memset (rr, 0, sizeof (RefReader));
+  rr->data = data;
+  rr->size = size;
+  rr->first_byte = 0xff;
+  rr->epb_cache = 0xff;
+  rr->cache = 0xff;
+}
+
+static gboolean
+ref_reader_read (RefReader * rr, guint nbits)
+{
+  if (rr->byte * 8 + (nbits - rr->bits_in_cache) > rr->size * 8)
+    return FALSE;
+
+  while (rr->bits_in_cache < nbits) {
+    guint8 byte;
+
+  next_byte:
+    if (rr->byte >= rr->size)
+      return FALSE;
+
+    byte = rr->data[rr->byte++];
+    rr->epb_cache = (rr->epb_cache << 8) | byte;
+    if ((rr->epb_cache & 0xffffff) == 0x3) {
+      rr->n_epb++;
+      goto next_byte;
+    }
+    rr->cache = (rr->cache << 8) | rr->first_byte;
+    rr->first_byte = byte;
+    rr->bits_in_cache += 8;
+  }
+
+  return TRUE;
+}
+
+static gboolean
+ref_reader_get_bits (RefReader * rr, guint32 * val, guint nbits)
+{
+  guint shift;
+
+  if (!ref_reader_read (rr, nbits))
+    return FALSE;
+
+  shift = rr->bits_in_cache - nbits;
+  *val = rr->first_byte >> shift;
+  *val |= rr->cache << (8 - shift);
+  if (nbits < 32)
+    *val &= ((guint32) 1 << nbits) - 1;
+  rr->bits_in_cache = shift;
+
+  return TRUE;
+}
+
+static gboolean
+ref_reader_skip (RefReader * rr, guint nbits)
+{
+  if (!ref_reader_read (rr, nbits))
+    return FALSE;
+  rr->bits_in_cache -= nbits;
+
+  return TRUE;
+}
+
+static gboolean
+ref_reader_get_ue (RefReader * rr, guint32 * val)
+{
+  guint32 bit, value;
+  guint i = 0;
+
+  if (!ref_reader_get_bits (rr, &bit, 1))
+    return FALSE;
+  while (bit == 0) {
+    i++;
+    if (!ref_reader_get_bits (rr, &bit, 1))
+      return FALSE;
+  }
+  if (i > 31 || !ref_reader_get_bits (rr, &value, i))
+    return FALSE;
+  *val = ((guint32) 1 << i) - 1 + value;
+
+  return TRUE;
+}
+
+static guint
+ref_reader_get_pos (const RefReader * rr)
+{
+  return rr->byte * 8 - rr->bits_in_cache;
+}
+
+GST_START_TEST (test_nal_reader_fuzz)
+{
+  GRand *rand = g_rand_new_with_seed (0x000003);
+  guint8 data[96];
+  guint i, j;
+
+  for (i = 0; i < 100000; i++) {
+    guint size = g_rand_int_range (rand, 0, sizeof data);
+    gint zeros = g_rand_int_range (rand, 2, 6);
+    NalReader nr;
+    RefReader rr;
+
+    /* Rich in start code and emulation prevention patterns */
+    for (j = 0; j < size; j++) {
+      gint r = g_rand_int_range (rand, 0, 10);
+
+      if (r < zeros)
+        data[j] = 0x00;
+      else if (r == 6)
+        data[j] = 0x03;
+      else if (r == 7)
+        data[j] = 0x01;
+      else
+        data[j] = g_rand_int_range (rand, 0, 256);
+    }
+
+    nal_reader_init (&nr, data, size);
+    ref_reader_init (&rr, data, size);
+
+    for (j = 0; j < 32; j++) {
+      guint32 val = 0, ref_val = 0;
+      guint nbits = 0;
+      gboolean ret, ref_ret;
+
+      switch (g_rand_int_range (rand, 0, 7)) {
+        case 0:{
+          guint8 v8 = 0;
+
+          nbits = g_rand_int_range (rand, 0, 9);
+          ret = nal_reader_get_bits_uint8 (&nr, &v8, nbits);
+          val = v8;
+          ref_ret = ref_reader_get_bits (&rr, &ref_val, nbits);
+          break;
+        }
+        case 1:{
+          guint16 v16 = 0;
+
+          nbits = g_rand_int_range (rand, 0, 17);
+          ret = nal_reader_get_bits_uint16 (&nr, &v16, nbits);
+          val = v16;
+          ref_ret = ref_reader_get_bits (&rr, &ref_val, nbits);
+          break;
+        }
+        case 2:
+          nbits = g_rand_int_range (rand, 0, 33);
+          ret = nal_reader_get_bits_uint32 (&nr, &val, nbits);
+          ref_ret = ref_reader_get_bits (&rr, &ref_val, nbits);
+          break;
+        case 3:
+          ret = nal_reader_get_ue (&nr, &val);
+          ref_ret = ref_reader_get_ue (&rr, &ref_val);
+          break;
+        case 4:{
+          guint8 v8 = 0;
+          RefReader tmp = rr;
+
+          nbits = g_rand_int_range (rand, 0, 9);
+          ret = nal_reader_peek_bits_uint8 (&nr, &v8, nbits);
+          val = v8;
+          ref_ret = ref_reader_get_bits (&tmp, &ref_val, nbits);
+          break;
+        }
+        case 5:
+          nbits = g_rand_int_range (rand, 0, 33);
+          ret = nal_reader_skip (&nr, nbits);
+          ref_ret = ref_reader_skip (&rr, nbits);
+          break;
+        default:
+          /* Skipped 32 bits at a time by both */
+          nbits = g_rand_int_range (rand, 0, 32);
+          ret = nal_reader_skip_long (&nr, nbits);
+          ref_ret = ref_reader_skip (&rr, nbits);
+          break;
+      }
+
+      assert_equals_int (ret, ref_ret);
+      /* The readers don't stop at the same place on errors */
+      if (!ret)
+        break;
+
+      assert_equals_uint64 (val, ref_val);
+      assert_equals_int (nal_reader_get_pos (&nr), ref_reader_get_pos (&rr));
+      assert_equals_int (nal_reader_get_remaining (&nr),
+          rr.size * 8 - ref_reader_get_pos (&rr));
+      assert_equals_int (nal_reader_get_epb_count (&nr), rr.n_epb);
+      assert_equals_int (nal_reader_is_byte_aligned (&nr),
+          rr.bits_in_cache == 0);
+    }
+  }
+
+  g_rand_free (rand);
+}
+
+GST_END_TEST;
+
 static Suite *
 nalutils_suite (void)
 {
@@ -112,6 +391,8 @@ nalutils_suite (void)
   suite_add_tcase (s, tc_chain);
   tcase_add_test (tc_chain, test_nal_writer_init);
   tcase_add_test (tc_chain, test_nal_writer_emulation_preventation);
+  tcase_add_test (tc_chain, test_scan_for_start_codes);
+  tcase_add_test (tc_chain, test_nal_reader_fuzz);
 
   return s;
 }